@@ -43,8 +43,8 @@ cmdLine = params.ghprbCommentBody
 pullId = params.ghprbPullId
 
 cgroupV1Specs = ["linux_x86"]
-cgroupV2Specs = ["linux_x86-64", "linux_ppc-64_le_gcc"]
-dockerSpecs = ["linux_x86", "linux_x86-64", "linux_riscv64_cross"]
+cgroupV2Specs = ["linux_x86-64", "linux_x86-64_futex", "linux_ppc-64_le_gcc"]
+dockerSpecs = ["linux_x86", "linux_x86-64", "linux_x86-64_futex", "linux_riscv64_cross"]
 
 nodeLabels = []
 runInDocker = false
@@ -248,6 +248,27 @@ SPECS = [
         'testArgs' : '',
         'junitPublish' : true
     ],
+    'linux_x86-64_futex' : [
+        'alias': 'xlinuxfutex',
+        'label' : 'compile:xlinux',
+        'reference' : defaultReference,
+        'environment' : [
+            'PATH+CCACHE=/usr/lib/ccache/',
+            'GTEST_COLOR=0'
+        ],
+        'ccache' : true,
+        'buildSystem' : 'cmake',
+        'builds' : [
+            [
+                'buildDir' : cmakeBuildDir,
+                'configureArgs' : '-Wdev -C../cmake/caches/Travis.cmake -DOMR_THR_SPIN_WAKE_CONTROL=OFF -DOMR_THR_FUTEX_MONITORS=ON',
+                'compile' : defaultCompile
+            ]
+        ],
+        'test' : true,
+        'testArgs' : '',
+        'junitPublish' : true
+    ],
     'osx_x86-64' : [
         'alias': 'osx',
         'label' : 'compile:xosx',
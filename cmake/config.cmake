@@ -201,6 +201,13 @@ if(OMR_THR_YIELD_ALG)
 endif()
 # TODO set to disabled. Stuff fails to compile when its on
 set(OMR_THR_MCS_LOCKS OFF CACHE BOOL "Enable the usage of the MCS lock in the OMR thread monitor.")
+set(OMR_THR_FUTEX_MONITORS OFF CACHE BOOL "Block on futexes instead of OS mutexes in three-tier monitors (Linux only).")
+if(OMR_THR_FUTEX_MONITORS)
+	omr_assert(FATAL_ERROR
+		TEST OMR_OS_LINUX AND OMR_THR_THREE_TIER_LOCKING AND NOT OMR_THR_MCS_LOCKS AND NOT OMR_THR_SPIN_WAKE_CONTROL
+		MESSAGE "OMR_THR_FUTEX_MONITORS requires Linux and OMR_THR_THREE_TIER_LOCKING, and cannot be combined with OMR_THR_MCS_LOCKS or OMR_THR_SPIN_WAKE_CONTROL"
+	)
+endif()
 
 #TODO this should maybe be a OMRTHREAD_LIB string variable?
 set(OMRTHREAD_WIN32_DEFAULT OFF)
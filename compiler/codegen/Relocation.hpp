@@ -85,6 +85,9 @@ class Relocation
 
    virtual bool isExternalRelocation() { return false; }
 
+   /** true for relocations that store the absolute address of a label in the code */
+   virtual bool isLabelAbsoluteRelocation() { return false; }
+
    TR::RelocationDebugInfo* getDebugInfo();
 
    void setDebugInfo(TR::RelocationDebugInfo* info);
@@ -256,6 +259,7 @@ class LabelAbsoluteRelocation : public TR::LabelRelocation
    LabelAbsoluteRelocation() : TR::LabelRelocation() {}
    LabelAbsoluteRelocation(uint8_t *p, TR::LabelSymbol *l)
       : TR::LabelRelocation(p, l) {}
+   virtual bool isLabelAbsoluteRelocation() { return true; }
    virtual void apply(TR::CodeGenerator *cg);
    };
 
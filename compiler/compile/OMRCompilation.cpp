@@ -270,6 +270,9 @@ OMR::Compilation::Compilation(
    _currentBlock(NULL),
    _verboseOptTransformationCount(0),
    _relocatableMethodCodeStart(NULL),
+   _reusedMethodBody(NULL),
+   _codeGeneratedHook(NULL),
+   _codeGeneratedHookData(NULL),
    _compThreadID(id),
    _failCHtableCommitFlag(false),
    _phaseTimer("Compilation", self()->allocator("phaseTimer"), self()->getOption(TR_Timing)),
@@ -1017,7 +1020,7 @@ int32_t OMR::Compilation::compile()
    LexicalTimer t("compile", self()->signature(), self()->phaseTimer());
    TR::LexicalMemProfiler mp("compile", self()->signature(), self()->phaseMemProfiler());
 
-   if (_ilGenSuccess)
+   if (_ilGenSuccess && _reusedMethodBody == NULL)
       {
       _methodSymbol->detectInternalCycles();
 
@@ -1116,6 +1119,9 @@ int32_t OMR::Compilation::compile()
            codegenTime.stopTiming(self());
         }
 
+      if (_codeGeneratedHook)
+         _codeGeneratedHook(self(), _codeGeneratedHookData);
+
       if (_recompilationInfo)
          _recompilationInfo->endOfCompilation();
 
@@ -446,6 +446,17 @@ public:
    TR_IlGenerator *getCurrentIlGenerator() { return _ilGenerator; }
    void setCurrentIlGenerator(TR_IlGenerator * il) { _ilGenerator = il; }
 
+   // An IL generator that finds the method already compiled from the same IL sets the
+   // entry point of that code as the reused method body. The method is then neither
+   // optimized nor compiled, and the compilation returns the reused body.
+   uint8_t *getReusedMethodBody() { return _reusedMethodBody; }
+   void setReusedMethodBody(uint8_t *startPC) { _reusedMethodBody = startPC; }
+
+   // Called once the code for the method has been generated and relocated, while the
+   // code generator still describes it
+   typedef void (*CodeGeneratedHook)(TR::Compilation *comp, void *data);
+   void setCodeGeneratedHook(CodeGeneratedHook hook, void *data) { _codeGeneratedHook = hook; _codeGeneratedHookData = data; }
+
    TR::Optimizer *getOptimizer() { return _optimizer; }
    void setOptimizer(TR::Optimizer * o) { _optimizer = o; }
 
@@ -1329,6 +1340,9 @@ protected:
 
 private:
    void *                            _relocatableMethodCodeStart;
+   uint8_t *                         _reusedMethodBody;
+   CodeGeneratedHook                 _codeGeneratedHook;
+   void *                            _codeGeneratedHookData;
    const int32_t                     _compThreadID; // The ID of the supporting compilation thread; 0 for compilation an application thread
    volatile bool                     _failCHtableCommitFlag;
 
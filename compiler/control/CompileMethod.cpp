@@ -61,33 +61,29 @@
 #include "runtime/CodeCacheManager.hpp"
 #include "control/CompilationController.hpp"
 
-static void
-writePerfToolEntry(void *start, uint32_t size, const char *name)
+static FILE *
+openPerfFile()
    {
-   // race condition
-   static bool firstAttempt = true;
-   static FILE *perfFile = 0;
-
-   if (firstAttempt)
-      {
-      firstAttempt = false;
 #if defined(OMR_OS_WINDOWS)
-      int jvmPid = _getpid();
+   int jvmPid = _getpid();
 #else
-      pid_t jvmPid = getpid();
+   pid_t jvmPid = getpid();
 #endif
-      static const int maxPerfFilenameSize = 15 + sizeof(jvmPid)* 3; // "/tmp/perf-%ld.map"
-      char perfFilename[maxPerfFilenameSize] = { 0 };
+   static const int maxPerfFilenameSize = 15 + sizeof(jvmPid)* 3; // "/tmp/perf-%ld.map"
+   char perfFilename[maxPerfFilenameSize] = { 0 };
+
+   bool truncated = TR::snprintfTrunc(perfFilename, maxPerfFilenameSize, "/tmp/perf-%" OMR_PRId64 ".map", static_cast<int64_t>(jvmPid));
+   if (truncated)
+      return NULL;
+   return fopen(perfFilename, "a");
+   }
+
+static void
+writePerfToolEntry(void *start, uint32_t size, const char *name)
+   {
+   // opened once even when several threads compile; NULL if it couldn't be opened
+   static FILE *perfFile = openPerfFile();
 
-      bool truncated = TR::snprintfTrunc(perfFilename, maxPerfFilenameSize, "/tmp/perf-%" OMR_PRId64 ".map", static_cast<int64_t>(jvmPid));
-      if (!truncated)
-         {
-         perfFile = fopen(perfFilename, "a");
-         }
-      if (!perfFile) // couldn't open the file
-         {
-         }
-      }
    if (perfFile)
       {
       // perf does not want 0x leading the hex start address and length of the compiled code region
@@ -270,7 +266,8 @@ compileMethodFromDetails(
       OMR_VMThread *omrVMThread,
       TR::IlGeneratorMethodDetails & details,
       TR_Hotness hotness,
-      int32_t &rc)
+      int32_t &rc,
+      int32_t compThreadID)
    {
    uint64_t translationStartTime = TR::Compiler->vm.getUSecClock();
    TR::FrontEnd *fe = TR::FrontEnd::instance();
@@ -320,7 +317,8 @@ compileMethodFromDetails(
          &compilee,
          0,
          plan,
-         false);
+         false,
+         compThreadID);
 
    // FIXME: once we can do recompilation , we need to pass in the old start PC  -----------------------^
 
@@ -328,7 +326,7 @@ compileMethodFromDetails(
    // FIXME: perhaps use stack memory instead
 
    TR_ASSERT(TR::comp() == NULL, "there seems to be a current TLS TR::Compilation object %p for this thread. At this point there should be no current TR::Compilation object", TR::comp());
-   TR::Compilation compiler(0, omrVMThread, fe, &compilee, request, options, dispatchRegion, &trMemory, plan);
+   TR::Compilation compiler(compThreadID, omrVMThread, fe, &compilee, request, options, dispatchRegion, &trMemory, plan);
    TR_ASSERT(TR::comp() == &compiler, "the TLS TR::Compilation object %p for this thread does not match the one %p just created.", TR::comp(), &compiler);
 
    try
@@ -371,18 +369,28 @@ compileMethodFromDetails(
          // not ready yet...
          //OMR::MethodMetaDataPOD *metaData = fe->createMethodMetaData(&compiler);
 
-         startPC = (uint8_t*)compiler.getMethodSymbol()->getMethodAddress();
+         bool reused = compiler.getReusedMethodBody() != NULL;
+         if (reused)
+            startPC = compiler.getReusedMethodBody();
+         else
+            startPC = (uint8_t*)compiler.getMethodSymbol()->getMethodAddress();
          uint64_t translationTime = TR::Compiler->vm.getUSecClock() - translationStartTime;
 
          if (TR::Options::isAnyVerboseOptionSet(TR_VerboseCompileEnd, TR_VerbosePerformance))
             {
             const char *signature = compilee.signature(&trMemory);
             TR_VerboseLog::CriticalSection vlogLock;
-            TR_VerboseLog::write(TR_Vlog_COMP, "(%s) %s @ " POINTER_PRINTF_FORMAT "-" POINTER_PRINTF_FORMAT,
-                                           compiler.getHotnessName(compiler.getMethodHotness()),
-                                           signature,
-                                           startPC,
-                                           compiler.cg()->getCodeEnd());
+            if (reused)
+               TR_VerboseLog::write(TR_Vlog_COMP, "(%s) %s @ " POINTER_PRINTF_FORMAT " reused",
+                                              compiler.getHotnessName(compiler.getMethodHotness()),
+                                              signature,
+                                              startPC);
+            else
+               TR_VerboseLog::write(TR_Vlog_COMP, "(%s) %s @ " POINTER_PRINTF_FORMAT "-" POINTER_PRINTF_FORMAT,
+                                              compiler.getHotnessName(compiler.getMethodHotness()),
+                                              signature,
+                                              startPC,
+                                              compiler.cg()->getCodeEnd());
 
             if (TR::Options::getVerboseOption(TR_VerbosePerformance))
                {
@@ -397,14 +405,17 @@ compileMethodFromDetails(
             trfflush(jitConfig->options.vLogFile);
             }
 
-         if (
+         // a reused body was not generated by this compilation, so there is no code to describe
+         if (!reused && (
                compiler.getOption(TR_PerfTool)
             || compiler.getOption(TR_EmitExecutableELFFile)
             || compiler.getOption(TR_EmitRelocatableELFFile)
-            )
+            ))
             {
             TR::CodeCacheManager &codeCacheManager(fe->codeCacheManager());
             TR::CodeGenerator &codeGenerator(*compiler.cg());
+            // keep a method's symbol and its relocations together when several threads compile
+            TR::CodeCacheManager::CacheListCriticalSection registerSymbols(&codeCacheManager);
             codeCacheManager.registerCompiledMethod(compiler.externalName(), startPC, codeGenerator.getCodeLength());
             if (compiler.getOption(TR_EmitRelocatableELFFile))
                {
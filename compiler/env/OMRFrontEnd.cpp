@@ -33,6 +33,8 @@
 #include "env/VerboseLog.hpp"
 #include "env/jittypes.h"
 #include "infra/Assert.hpp"
+#include "infra/Monitor.hpp"
+#include "infra/ThreadLocal.hpp"
 #include "runtime/CodeCacheManager.hpp"
 
 #if defined(OMR_OS_WINDOWS)
@@ -44,13 +46,20 @@
 
 TR::FrontEnd *OMR::FrontEnd::_instance = NULL;
 
+// TR_VerboseLog::CriticalSections nest (when printing a SimpleRegex, for instance) but the
+// vlog monitor does not, so only the outermost acquire on each thread enters it
+static TR_TLS_DEFINE(void *, vlogLockDepth);
+
 OMR::FrontEnd::FrontEnd() :
    ::TR_FrontEnd(),
       _config(),
       _codeCacheManager(TR::Compiler->rawAllocator),
-      _persistentMemory(jitConfig(), TR::Compiler->persistentAllocator())
+      _persistentMemory(jitConfig(), TR::Compiler->persistentAllocator()),
+      _vlogMonitor(TR::Monitor::create("JIT-VerboseLogMonitor")),
+      _logMonitor(TR::Monitor::create("JIT-LogMonitor"))
    {
    TR_ASSERT_FATAL(!_instance, "FrontEnd must be initialized only once");
+   TR_TLS_ALLOC(vlogLockDepth);
    _instance = static_cast<TR::FrontEnd *>(this);
    ::trPersistentMemory = &_persistentMemory;
    }
@@ -75,6 +84,18 @@ OMR::FrontEnd::reserveTrampolineIfNecessary(TR::Compilation *comp, TR::SymbolRef
    return;
    }
 
+void
+OMR::FrontEnd::acquireLogMonitor()
+   {
+   _logMonitor->enter();
+   }
+
+void
+OMR::FrontEnd::releaseLogMonitor()
+   {
+   _logMonitor->exit();
+   }
+
 TR_ResolvedMethod *
 OMR::FrontEnd::createResolvedMethod(
       TR_Memory *trMemory,
@@ -146,12 +167,18 @@ extern "C" {
 
 void TR_VerboseLog::vlogAcquire()
    {
-   //NOT IMPLEMENTED for now
+   uintptr_t depth = reinterpret_cast<uintptr_t>(TR_TLS_GET(vlogLockDepth, void *));
+   if (0 == depth)
+      TR::FrontEnd::instance()->vlogMonitor()->enter();
+   TR_TLS_SET(vlogLockDepth, reinterpret_cast<void *>(depth + 1));
    }
 
 void TR_VerboseLog::vlogRelease()
    {
-   //NOT IMPLEMENTED for now
+   uintptr_t depth = reinterpret_cast<uintptr_t>(TR_TLS_GET(vlogLockDepth, void *)) - 1;
+   TR_TLS_SET(vlogLockDepth, reinterpret_cast<void *>(depth));
+   if (0 == depth)
+      TR::FrontEnd::instance()->vlogMonitor()->exit();
    }
 
 void TR_VerboseLog::vwrite(const char *format, va_list args)
@@ -41,6 +41,7 @@ namespace OMR { typedef OMR::FrontEnd FrontEndConnector; }
 #include "runtime/CodeCacheManager.hpp"
 
 namespace TR { class FrontEnd; }
+namespace TR { class Monitor; }
 class TR_ResolvedMethod;
 
 namespace OMR
@@ -77,6 +78,11 @@ public:
    TR_ResolvedMethod *createResolvedMethod(TR_Memory *trMemory, TR_OpaqueMethodBlock *aMethod,
                                            TR_ResolvedMethod *owningMethod, TR_OpaqueClassBlock *classForNewInstance);
 
+   virtual void acquireLogMonitor();
+   virtual void releaseLogMonitor();
+
+   TR::Monitor *vlogMonitor() { return _vlogMonitor; }
+
 private:
 
    TR::JitConfig _config;
@@ -85,6 +91,9 @@ private:
    // this is deprecated in favour of TR::Allocator
    TR_PersistentMemory _persistentMemory; // global memory
 
+   TR::Monitor *_vlogMonitor; // serializes verbose log output when several threads compile
+   TR::Monitor *_logMonitor;  // guards the log files opened for each compilation thread
+
    static TR::FrontEnd *_instance;
 };
 
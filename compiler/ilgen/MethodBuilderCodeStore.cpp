@@ -0,0 +1,210 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <string.h>
+#include "compile/Compilation.hpp"
+#include "compile/ResolvedMethod.hpp"
+#include "compile/SymbolReferenceTable.hpp"
+#include "il/Block.hpp"
+#include "il/MethodSymbol.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/ParameterSymbol.hpp"
+#include "il/ResolvedMethodSymbol.hpp"
+#include "il/StaticSymbol.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "ilgen/MethodBuilderCodeStore.hpp"
+#include "infra/List.hpp"
+
+// 64 bit FNV-1a
+static uint64_t
+fnvHash(const uint8_t *data, size_t size)
+   {
+   uint64_t hash = 0xcbf29ce484222325ULL;
+   for (size_t i = 0; i < size; i++)
+      {
+      hash ^= data[i];
+      hash *= 0x100000001b3ULL;
+      }
+   return hash;
+   }
+
+// 64 bit MurmurHash2, so that the two halves of the hash are independent of each other
+static uint64_t
+murmurHash(const uint8_t *data, size_t size)
+   {
+   const uint64_t m = 0xc6a4a7935bd1e995ULL;
+   const int r = 47;
+   uint64_t hash = 0x9747b28cULL ^ (size * m);
+
+   const uint8_t *end = data + (size & ~(size_t)7);
+   for (; data != end; data += 8)
+      {
+      uint64_t k;
+      memcpy(&k, data, sizeof(k));
+      k *= m;
+      k ^= k >> r;
+      k *= m;
+      hash ^= k;
+      hash *= m;
+      }
+
+   size_t remaining = size & 7;
+   if (remaining != 0)
+      {
+      for (size_t i = remaining; i > 0; i--)
+         hash ^= (uint64_t)data[i - 1] << (8 * (i - 1));
+      hash *= m;
+      }
+
+   hash ^= hash >> r;
+   hash *= m;
+   hash ^= hash >> r;
+   return hash;
+   }
+
+OMR::MethodBuilderIL::MethodBuilderIL(TR::Compilation *comp)
+   : _bytes(ByteAllocator(comp->trMemory()->heapMemoryRegion())),
+     _numSymRefs(comp->getSymRefTab()->getNumSymRefs())
+   {
+   TR::ResolvedMethodSymbol *methodSymbol = comp->getMethodSymbol();
+
+   add(comp->getMethodHotness());
+   add(methodSymbol->getResolvedMethod()->returnType());
+   add(methodSymbol->getParameterList().getSize());
+   ListIterator<TR::ParameterSymbol> parms(&methodSymbol->getParameterList());
+   for (TR::ParameterSymbol *parm = parms.getFirst(); parm != NULL; parm = parms.getNext())
+      add(parm->getDataType());
+
+   NodeIndexMap nodeIndices(std::less<TR::Node *>(), comp->trMemory()->heapMemoryRegion());
+   for (TR::TreeTop *tt = comp->getStartTree(); tt != NULL; tt = tt->getNextTreeTop())
+      describeNode(tt->getNode(), nodeIndices);
+
+   _hash[0] = fnvHash(getBytes(), getSize());
+   _hash[1] = murmurHash(getBytes(), getSize());
+   }
+
+bool
+OMR::MethodBuilderIL::equals(const uint8_t *bytes, size_t size) const
+   {
+   return size == getSize() && memcmp(bytes, getBytes(), size) == 0;
+   }
+
+// Unsigned LEB128, so that the small numbers that make up most of the IL take a byte each
+void
+OMR::MethodBuilderIL::add(uint64_t value)
+   {
+   while (value >= 0x80)
+      {
+      _bytes.push_back((uint8_t)(value | 0x80));
+      value >>= 7;
+      }
+   _bytes.push_back((uint8_t)value);
+   }
+
+void
+OMR::MethodBuilderIL::describeNode(TR::Node *node, NodeIndexMap &nodeIndices)
+   {
+   NodeIndexMap::iterator seen = nodeIndices.find(node);
+   if (seen != nodeIndices.end())
+      {
+      // 0 is not an opcode + 1, so it marks a reference to a commoned node
+      add(0);
+      add(seen->second);
+      return;
+      }
+   uint32_t index = (uint32_t)nodeIndices.size();
+   nodeIndices.insert(std::make_pair(node, index));
+
+   add(node->getOpCodeValue() + 1);
+   add(node->getDataType());
+   add(node->getNumChildren());
+   add(node->getFlags().getValue());
+
+   if (node->getOpCode().isLoadConst())
+      {
+      switch (node->getDataType())
+         {
+         case TR::Float:
+            add(node->getFloatBits());
+            break;
+         case TR::Double:
+            add(node->getDoubleBits());
+            break;
+         case TR::Address:
+            add(node->getAddress());
+            break;
+         default:
+            if (node->getDataType().isIntegral())
+               add(node->get64bitIntegralValueAsUnsigned());
+            break;
+         }
+      }
+
+   if (node->getOpCodeValue() == TR::Case)
+      addSigned(node->getCaseConstant());
+
+   if (node->getOpCode().hasSymbolReference())
+      describeSymbolReference(node->getSymbolReference());
+
+   if (node->getOpCode().isBranch())
+      add(node->getBranchDestination()->getNode()->getBlock()->getNumber());
+
+   if (node->getOpCodeValue() == TR::BBStart || node->getOpCodeValue() == TR::BBEnd)
+      {
+      TR::Block *block = node->getBlock();
+      add(block->getNumber());
+      addSigned(block->getFrequency());
+      add(block->isCold());
+      }
+
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      describeNode(node->getChild(i), nodeIndices);
+   }
+
+void
+OMR::MethodBuilderIL::describeSymbolReference(TR::SymbolReference *symRef)
+   {
+   TR::Symbol *symbol = symRef->getSymbol();
+
+   add(symRef->getReferenceNumber());
+   addSigned(symRef->getOffset());
+   add(symRef->isUnresolved());
+   add(symbol->getFlags());
+   add(symbol->getFlags2());
+   add(symbol->getDataType());
+   add(symbol->getSize());
+
+   if (symbol->isStatic())
+      {
+      add((uintptr_t)symbol->getStaticSymbol()->getStaticAddress());
+      }
+   else if (symbol->isMethod())
+      {
+      TR::MethodSymbol *methodSymbol = symbol->castToMethodSymbol();
+      add((uintptr_t)methodSymbol->getMethodAddress());
+      add(methodSymbol->getMethodKind());
+      }
+   }
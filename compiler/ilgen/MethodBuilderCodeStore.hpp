@@ -0,0 +1,118 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef OMR_METHODBUILDERCODESTORE_INCL
+#define OMR_METHODBUILDERCODESTORE_INCL
+
+#include <stddef.h>
+#include <stdint.h>
+#include <map>
+#include <vector>
+#include "env/TRMemory.hpp"
+
+namespace TR { class Compilation; }
+namespace TR { class Node; }
+namespace TR { class SymbolReference; }
+
+namespace OMR
+{
+
+/**
+ * @brief The IL generated for a MethodBuilder in a canonical form, and a 128 bit hash of it
+ *
+ * The canonical form describes the trees in the order of the method's tree tops. Commoned
+ * nodes are described once and then referred to by the order in which they were first
+ * seen, blocks by their numbers, and symbols by what they refer to: locals and fields by
+ * their symbol reference numbers, which are the same each time a MethodBuilder generates
+ * the same IL, and statics and called functions by their addresses. Compilations of the
+ * same canonical IL at the same hotness with the same options generate equivalent code.
+ *
+ * Addresses that appear in the IL are part of the form, so IL that refers to statics,
+ * functions or address constants only matches IL that refers to the same addresses.
+ */
+class MethodBuilderIL
+   {
+   public:
+
+   /**
+    * @brief Describe the IL of the method being compiled by comp
+    */
+   MethodBuilderIL(TR::Compilation *comp);
+
+   const uint8_t *getBytes() const        { return &_bytes[0]; }
+   size_t getSize() const                 { return _bytes.size(); }
+   const uint64_t *getHash() const        { return _hash; }
+
+   /**
+    * @brief The number of symbol references when the IL was described. Symbol references
+    * numbered from this one on were created by the optimizer or the code generator.
+    */
+   int32_t getNumSymRefs() const          { return _numSymRefs; }
+
+   bool equals(const uint8_t *bytes, size_t size) const;
+
+   private:
+
+   typedef TR::typed_allocator<uint8_t, TR::Region &> ByteAllocator;
+   typedef TR::typed_allocator<std::pair<TR::Node * const, uint32_t>, TR::Region &> NodeIndexAllocator;
+   typedef std::map<TR::Node *, uint32_t, std::less<TR::Node *>, NodeIndexAllocator> NodeIndexMap;
+
+   void describeNode(TR::Node *node, NodeIndexMap &nodeIndices);
+   void describeSymbolReference(TR::SymbolReference *symRef);
+   void add(uint64_t value);
+   void addSigned(int64_t value) { add(((uint64_t)value << 1) ^ (uint64_t)(value >> 63)); }
+
+   std::vector<uint8_t, ByteAllocator> _bytes;
+   uint64_t _hash[2];
+   int32_t _numSymRefs;
+   };
+
+/**
+ * @brief Code compiled for MethodBuilders, looked up by the canonical form of their IL
+ *
+ * A MethodBuilder that has a code store looks up the IL it generated before the IL is
+ * optimized. If the store has code for the same IL, the compilation returns that code
+ * instead of compiling the method; otherwise the store is given the code once it has been
+ * generated. Stores may be called by several compilation threads at once.
+ */
+class MethodBuilderCodeStore
+   {
+   public:
+
+   /**
+    * @brief Look for code compiled from the same IL
+    * @param comp The compilation, which has generated its IL but not yet optimized it
+    * @param il The canonical form of the IL
+    * @return the entry point of the code, or NULL if the store has none
+    */
+   virtual void *lookup(TR::Compilation *comp, const MethodBuilderIL &il) = 0;
+
+   /**
+    * @brief Called once the code for il has been generated, while the code generator of
+    * comp still describes it
+    */
+   virtual void store(TR::Compilation *comp, const MethodBuilderIL &il) = 0;
+   };
+
+} // namespace OMR
+
+#endif // !defined(OMR_METHODBUILDERCODESTORE_INCL)
@@ -19,11 +19,14 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
  *******************************************************************************/
 
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 
 #include <stdint.h>
+#include <string.h>
 #include "compile/Method.hpp"
+#include "env/CompilerEnv.hpp"
 #include "env/FrontEnd.hpp"
 #include "env/Region.hpp"
 #include "env/SystemSegmentProvider.hpp"
@@ -49,6 +52,7 @@
 #include "ilgen/IlInjector.hpp"
 #include "ilgen/IlBuilder.hpp"
 #include "ilgen/MethodBuilder.hpp"
+#include "ilgen/MethodBuilderCodeStore.hpp"
 #include "ilgen/BytecodeBuilder.hpp"
 #include "ilgen/TypeDictionary.hpp"
 #include "ilgen/VirtualMachineState.hpp"
@@ -122,7 +126,9 @@ OMR::MethodBuilder::MethodBuilder(TR::TypeDictionary *types, TR::VirtualMachineS
    _inlineSiteIndex(-1),
    _nextInlineSiteIndex(0),
    _returnBuilder(NULL),
-   _returnSymbolName(NULL)
+   _returnSymbolName(NULL),
+   _profile(NULL),
+   _collectProfile(false)
    {
    _definingLine[0] = '\0';
    }
@@ -155,7 +161,9 @@ OMR::MethodBuilder::MethodBuilder(TR::MethodBuilder *callerMB, TR::VirtualMachin
    _inlineSiteIndex(callerMB->getNextInlineSiteIndex()),
    _nextInlineSiteIndex(0),
    _returnBuilder(NULL),
-   _returnSymbolName(NULL)
+   _returnSymbolName(NULL),
+   _profile(NULL),
+   _collectProfile(false)
    {
    _definingLine[0] = '\0';
    initialize(callerMB->_details, callerMB->_methodSymbol, callerMB->_fe, callerMB->_symRefTab);
@@ -717,13 +725,19 @@ OMR::MethodBuilder::GetNextBytecodeFromWorklist()
    }
 
 int32_t
-OMR::MethodBuilder::Compile(void **entry)
+OMR::MethodBuilder::Compile(void **entry, int32_t compThreadID)
    {
    TR::ResolvedMethod resolvedMethod(static_cast<TR::MethodBuilder *>(this));
    TR::IlGeneratorMethodDetails details(&resolvedMethod);
 
+   // a profiling compile is a cheap one, and the compile that uses its profile
+   // is an expensive one
+   TR_Hotness hotness = warm;
+   if (_profile != NULL)
+      hotness = _collectProfile ? cold : hot;
+
    int32_t rc=0;
-   *entry = (void *) compileMethodFromDetails(NULL, details, warm, rc);
+   *entry = (void *) compileMethodFromDetails(NULL, details, hotness, rc, compThreadID);
 
    // let TypeDictionary know to clear out sym refs used in this compilation so
    // no dangling pointers
@@ -735,9 +749,212 @@ OMR::MethodBuilder::Compile(void **entry)
    _symbols.clear();
    _connectedTrees = false;
 
+   // so that the MethodBuilder can be compiled again (to recompile it at a higher
+   // optimization level, for example): block counts and worklists were built for
+   // the IL of this compilation, and the lists were allocated in its memory
+   _count = -1;
+   _blocks = NULL;
+   _blocksAllocatedUpFront = false;
+   _countBlocksWorklist = NULL;
+   _connectTreesWorklist = NULL;
+   _allBytecodeBuilders = NULL;
+   _bytecodeWorklist = NULL;
+   _bytecodeHasBeenInWorklist = NULL;
+   _profile = NULL;
+   _collectProfile = false;
+
+   return rc;
+   }
+
+bool
+OMR::MethodBuilder::injectIL()
+   {
+   bool rc = TR::IlBuilder::injectIL();
+   if (!rc)
+      return rc;
+
+   if (_profile != NULL)
+      {
+      if (_collectProfile)
+         instrumentForProfile();
+      else
+         applyProfile();
+
+      if (TraceEnabled)
+         comp()->dumpMethodTrees(_collectProfile ? "after inserting profiling code" : "after applying profile");
+      }
+
+   // profiling code counts into this MethodBuilder's own profile, so it is never reused
+   if (_codeStore != NULL && !_collectProfile)
+      lookupCompiledCode();
+
    return rc;
    }
 
+// Reuses the code in the code store for the IL just generated if there is any, otherwise
+// arranges for the store to be given the code once it has been generated
+void
+OMR::MethodBuilder::lookupCompiledCode()
+   {
+   OMR::MethodBuilderIL *il = new (comp()->trMemory()->heapMemoryRegion()) OMR::MethodBuilderIL(comp());
+   TraceIL("MethodBuilder[ %p ] IL hash %016llx%016llx (%llu bytes)\n", this,
+           (unsigned long long)il->getHash()[0], (unsigned long long)il->getHash()[1], (unsigned long long)il->getSize());
+
+   void *entry = _codeStore->lookup(comp(), *il);
+   if (entry != NULL)
+      {
+      TraceIL("MethodBuilder[ %p ] reusing code at %p\n", this, entry);
+      comp()->setReusedMethodBody(static_cast<uint8_t *>(entry));
+      }
+   else
+      {
+      comp()->setCodeGeneratedHook(codeGenerated, il);
+      }
+   }
+
+void
+OMR::MethodBuilder::codeGenerated(TR::Compilation *comp, void *il)
+   {
+   _codeStore->store(comp, *static_cast<OMR::MethodBuilderIL *>(il));
+   }
+
+// Counts every block of the IL generated for this MethodBuilder into the profile,
+// and calls the profile's threshold helper when the method has been invoked, or
+// its loops have iterated, often enough to be worth recompiling. Blocks are
+// numbered the same way each time the same MethodBuilder generates its IL, which
+// is how the recompilation finds the count of each of its blocks.
+void
+OMR::MethodBuilder::instrumentForProfile()
+   {
+   TR_ASSERT_FATAL(_profile->_blockCounts == NULL, "MethodBuilder %s profile has already been collected", _methodName);
+
+   TR::CFG *cfg = this->cfg();
+   int32_t numBlocks = cfg->getNextNodeNumber();
+   _profile->_blockCounts = (int64_t *) TR::Compiler->rawAllocator.allocate(numBlocks * sizeof(int64_t));
+   memset(_profile->_blockCounts, 0, numBlocks * sizeof(int64_t));
+   _profile->_numBlocks = numBlocks;
+
+   TR::Block *entryBlock = _methodSymbol->getFirstTreeTop()->getNode()->getBlock();
+
+   // a branch to a block that is not after it in the trees closes a loop, so every
+   // iteration of a loop passes through the target of at least one such branch
+   int32_t *position = (int32_t *) comp()->trMemory()->allocateHeapMemory(numBlocks * sizeof(int32_t));
+   int32_t numRealBlocks = 0;
+   for (TR::Block *block = entryBlock; block; block = block->getNextBlock())
+      position[block->getNumber()] = numRealBlocks++;
+
+   TR::Block **blocks = (TR::Block **) comp()->trMemory()->allocateHeapMemory(numRealBlocks * sizeof(TR::Block *));
+   TR_BitVector *loopHeaders = new (comp()->trHeapMemory()) TR_BitVector(numBlocks, comp()->trMemory());
+   for (TR::Block *block = entryBlock; block; block = block->getNextBlock())
+      {
+      blocks[position[block->getNumber()]] = block;
+      for (auto e = block->getSuccessors().begin(); e != block->getSuccessors().end(); ++e)
+         {
+         TR::Block *target = (*e)->getTo()->asBlock();
+         if (target->getEntry() != NULL && position[target->getNumber()] <= position[block->getNumber()])
+            loopHeaders->set(target->getNumber());
+         }
+      }
+
+   TR::IlType **helperParmTypes = (TR::IlType **) comp()->trMemory()->allocateHeapMemory(sizeof(TR::IlType *));
+   helperParmTypes[0] = Address;
+   TR::ResolvedMethod *helper = new (comp()->trMemory()->heapMemoryRegion()) TR::ResolvedMethod((char *)"", (char *)"", (char *)"profileThresholdReached",
+                                                                                                1, helperParmTypes, NoType, _profile->_thresholdHelper, 0);
+   TR::SymbolReference *helperSymRef = symRefTab()->findOrCreateStaticMethodSymbol(JITTED_METHOD_INDEX, -1, helper);
+   helperSymRef->getSymbol()->getMethodSymbol()->setLinkage(TR_System);
+
+   for (int32_t b = 0; b < numRealBlocks; b++)
+      {
+      TR::Block *block = blocks[b];
+      TR::SymbolReference *countSymRef = symRefTab()->createKnownStaticDataSymbolRef(_profile->_blockCounts + block->getNumber(), TR::Int64);
+      TR::Node *increment = TR::Node::create(TR::ladd, 2, TR::Node::createLoad(countSymRef), TR::Node::lconst(1));
+      TR::TreeTop *cursor = block->prepend(TR::TreeTop::create(comp(), TR::Node::createStore(countSymRef, increment)));
+
+      // a loop header counts loop iterations rather than invocations, even if it is the entry block
+      if (loopHeaders->get(block->getNumber()))
+         insertThresholdCheck(block, cursor, &_profile->_backEdgesLeft, helperSymRef);
+      else if (block == entryBlock)
+         insertThresholdCheck(block, cursor, &_profile->_invocationsLeft, helperSymRef);
+      }
+   }
+
+// Inserts, after cursor in block:
+//    counter = counter - 1
+//    if (counter <= 0) call the threshold helper (in a cold block)
+void
+OMR::MethodBuilder::insertThresholdCheck(TR::Block *block, TR::TreeTop *cursor, int32_t *counter, TR::SymbolReference *helperSymRef)
+   {
+   TR::SymbolReference *counterSymRef = symRefTab()->createKnownStaticDataSymbolRef(counter, TR::Int32);
+   TR::Node *decrement = TR::Node::create(TR::isub, 2, TR::Node::createLoad(counterSymRef), TR::Node::iconst(1));
+   cursor = cursor->insertAfter(TR::TreeTop::create(comp(), TR::Node::createStore(counterSymRef, decrement)));
+
+   // the block is split at this placeholder, which is removed by the split
+   TR::TreeTop *splitTree = cursor->insertAfter(TR::TreeTop::create(comp(), TR::Node::create(TR::treetop, 1, TR::Node::iconst(0))));
+
+   TR::Node *compare = TR::Node::createif(TR::ificmple, TR::Node::createLoad(counterSymRef), TR::Node::iconst(0));
+   TR::Node *call = TR::Node::createWithSymRef(TR::call, 1, 1, TR::Node::aconst((uintptr_t)_profile->_thresholdHelperArg), helperSymRef);
+   block->createConditionalBlocksBeforeTree(splitTree,
+                                            TR::TreeTop::create(comp(), compare),
+                                            TR::TreeTop::create(comp(), TR::Node::create(TR::treetop, 1, call)),
+                                            NULL,
+                                            cfg());
+   }
+
+// Sets the block and edge frequencies from the profile, so that the optimizer uses
+// them instead of estimating frequencies from the structure of the method. Blocks
+// the profile never saw executed are marked cold.
+void
+OMR::MethodBuilder::applyProfile()
+   {
+   TR::CFG *cfg = this->cfg();
+   int64_t *counts = _profile->_blockCounts;
+   int32_t numBlocks = _profile->_numBlocks;
+   if (counts == NULL || numBlocks != cfg->getNextNodeNumber())
+      {
+      TraceIL("[ %p ] profile of %d blocks does not match the %d blocks generated, not using it\n", this, numBlocks, cfg->getNextNodeNumber());
+      return;
+      }
+
+   TR::Block *entryBlock = _methodSymbol->getFirstTreeTop()->getNode()->getBlock();
+   int64_t maxCount = 0;
+   for (TR::Block *block = entryBlock; block; block = block->getNextBlock())
+      maxCount = std::max(maxCount, counts[block->getNumber()]);
+   if (maxCount == 0)
+      return;
+
+   // executed blocks are kept above the cold block range however rarely they ran
+   const int32_t minHotFrequency = MAX_COLD_BLOCK_COUNT + 1;
+   for (TR::Block *block = entryBlock; block; block = block->getNextBlock())
+      {
+      int64_t count = counts[block->getNumber()];
+      if (count == 0)
+         {
+         block->setFrequency(UNKNOWN_COLD_BLOCK_COUNT);
+         block->setIsCold();
+         }
+      else
+         {
+         block->setFrequency(minHotFrequency + (int32_t)((double)count * (MAX_BLOCK_COUNT - minHotFrequency) / maxCount));
+         }
+      }
+
+   for (TR::Block *block = entryBlock; block; block = block->getNextBlock())
+      {
+      for (auto e = block->getSuccessors().begin(); e != block->getSuccessors().end(); ++e)
+         {
+         TR::CFGNode *target = (*e)->getTo();
+         if (target->asBlock()->getEntry() != NULL)
+            (*e)->setFrequency(std::min(block->getFrequency(), target->getFrequency()));
+         else
+            (*e)->setFrequency(block->getFrequency());
+         }
+      }
+
+   cfg->setMaxFrequency(MAX_BLOCK_COUNT);
+   cfg->setMaxEdgeFrequency(MAX_BLOCK_COUNT);
+   TraceIL("[ %p ] applied profile of %d blocks, highest count %lld\n", this, numBlocks, (long long)maxCount);
+   }
+
 void *
 OMR::MethodBuilder::client()
    {
@@ -748,3 +965,4 @@ OMR::MethodBuilder::client()
 
 ClientAllocator OMR::MethodBuilder::_clientAllocator = NULL;
 ClientAllocator OMR::MethodBuilder::_getImpl = NULL;
+OMR::MethodBuilderCodeStore *OMR::MethodBuilder::_codeStore = NULL;
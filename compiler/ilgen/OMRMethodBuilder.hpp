@@ -49,6 +49,23 @@ typedef bool (*RequestFunctionCallback)(void *client, const char *name);
 namespace OMR
 {
 
+class MethodBuilderCodeStore;
+
+/**
+ * @brief Counters collected by a MethodBuilder compiled to profile itself, and used to
+ *        recompile it. The counters are updated by every thread running the profiling
+ *        code without synchronization, so they are approximate.
+ */
+struct MethodBuilderProfile
+   {
+   int64_t *_blockCounts;         ///< execution count of each block, indexed by block number; allocated with TR::Compiler->rawAllocator by the profiling compile
+   int32_t  _numBlocks;           ///< number of entries in _blockCounts, 0 until the profiling compile has run
+   int32_t  _invocationsLeft;     ///< decremented each time the method is entered
+   int32_t  _backEdgesLeft;       ///< decremented each time a loop header is entered
+   void    *_thresholdHelper;     ///< void (*)(void *arg), called when either counter is no longer positive
+   void    *_thresholdHelperArg;
+   };
+
 class MethodBuilder : public TR::IlBuilder
    {
    public:
@@ -59,6 +76,7 @@ class MethodBuilder : public TR::IlBuilder
    virtual ~MethodBuilder();
 
    virtual void setupForBuildIL();
+   virtual bool injectIL();
 
    /**
     * @brief returns the next index to be used for new values
@@ -144,7 +162,27 @@ class MethodBuilder : public TR::IlBuilder
                        int32_t          numParms,
                        TR::IlType     ** parmTypes);
 
-   int32_t Compile(void **entry);
+   /**
+    * @brief compile this MethodBuilder
+    * @param entry set to the entry point of the compiled code
+    * @param compThreadID the ID of the compilation thread compiling it, 0 for an application thread
+    * @return the compilation return code
+    */
+   int32_t Compile(void **entry, int32_t compThreadID = 0);
+
+   /**
+    * @brief Profile the next compilation of this MethodBuilder, or use a profile in it
+    * @param profile the profile, which must stay allocated as long as code compiled to collect it can run
+    * @param collect if true, the next compilation is a cold one that counts block executions,
+    *        invocations and loop iterations into profile; otherwise it is a hot one that uses
+    *        the block frequencies in profile
+    * The profile only applies to the next call to Compile.
+    */
+   void setProfile(MethodBuilderProfile *profile, bool collect)
+      {
+      _profile = profile;
+      _collectProfile = collect;
+      }
 
    /**
     * @brief will be called if a Call is issued to a function that has not yet been defined, provides a
@@ -284,11 +322,28 @@ class MethodBuilder : public TR::IlBuilder
       _getImpl = getter;
       }
 
+   /**
+    * @brief Set the store that MethodBuilders look up the IL they generate in before it is
+    *        compiled, and that is given the code compiled for IL it does not have
+    *
+    * @param store the code store, or NULL to compile every MethodBuilder
+    */
+   static void setCodeStore(MethodBuilderCodeStore *store)
+      {
+      _codeStore = store;
+      }
+
    protected:
    virtual uint32_t countBlocks();
    virtual bool connectTrees();
    TR_Memory *trMemory() { return memoryManager._trMemory; }
 
+   void instrumentForProfile();
+   void applyProfile();
+   void insertThresholdCheck(TR::Block *block, TR::TreeTop *cursor, int32_t *counter, TR::SymbolReference *helperSymRef);
+   void lookupCompiledCode();
+   static void codeGenerated(TR::Compilation *comp, void *il);
+
    /*
     * @brief adjusts a local variable name so that it will be unique to the current inlined site to prevent inlining-induced name aliasing
     * @param name the original local variable name
@@ -388,9 +443,13 @@ class MethodBuilder : public TR::IlBuilder
    TR::IlBuilder             * _returnBuilder;
    const char                * _returnSymbolName;
 
+   MethodBuilderProfile      * _profile;
+   bool                        _collectProfile;
+
 private:
    static ClientAllocator      _clientAllocator;
    static ImplGetter _getImpl;
+   static MethodBuilderCodeStore *_codeStore;
    };
 
 } // namespace OMR
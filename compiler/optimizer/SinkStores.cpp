@@ -299,6 +299,7 @@ TR_SinkStores::TR_SinkStores(TR::OptimizationManager *manager)
    _sinkThruException = false;
    _firstSinkOptTransformationIndex = -1;
    _lastSinkOptTransformationIndex = -1;
+   _underCommonedNode = false;
 
    static const char *sinkAllStoresEnv = feGetEnv("TR_SinkAllStores");
    static const char *printSinkStoreStatsEnv = feGetEnv("TR_PrintSinkStoreStats");
@@ -1759,12 +1760,11 @@ bool TR_SinkStores::treeIsSinkableStore(TR::Node *node, bool sinkIndirectLoads,
       }
 
    int32_t numChildren = node->getNumChildren();
-   static bool underCommonedNode;
 
    /* initialization upon first entry */
    if (depth == 0)
       {
-      underCommonedNode = false;
+      _underCommonedNode = false;
       }
 
    if (numChildren == 0)
@@ -1862,7 +1862,7 @@ bool TR_SinkStores::treeIsSinkableStore(TR::Node *node, bool sinkIndirectLoads,
 
    if (!comp()->cg()->getSupportsJavaFloatSemantics() &&
        node->getOpCode().isFloatingPoint() &&
-       (underCommonedNode || node->getReferenceCount() > 1))
+       (_underCommonedNode || node->getReferenceCount() > 1))
       {
       if (trace())
          traceMsg(comp(), "         fp store failure\n");
@@ -1872,7 +1872,7 @@ bool TR_SinkStores::treeIsSinkableStore(TR::Node *node, bool sinkIndirectLoads,
    if (numChildren == 0 &&
        node->getOpCode().isLoadVarDirect() &&
        node->getSymbolReference()->getSymbol()->isStatic() &&
-       (underCommonedNode || node->getReferenceCount() > 1))
+       (_underCommonedNode || node->getReferenceCount() > 1))
        {
        if (trace())
          traceMsg(comp(), "         commoned static load store failure: %p\n", node);
@@ -1880,9 +1880,9 @@ bool TR_SinkStores::treeIsSinkableStore(TR::Node *node, bool sinkIndirectLoads,
        }
 
    int32_t currentDepth = ++depth;
-   bool    previouslyCommoned = underCommonedNode;
+   bool    previouslyCommoned = _underCommonedNode;
    if (node->getReferenceCount() > 1)
-      underCommonedNode = true;
+      _underCommonedNode = true;
    for (int32_t c=0;c < numChildren;c++)
       {
       int32_t childDepth = currentDepth;
@@ -1892,7 +1892,7 @@ bool TR_SinkStores::treeIsSinkableStore(TR::Node *node, bool sinkIndirectLoads,
       if (childDepth > depth)
          depth = childDepth;
       }
-   underCommonedNode = previouslyCommoned;
+   _underCommonedNode = previouslyCommoned;
    return true;
    }
 
@@ -333,6 +333,8 @@ class TR_SinkStores : public TR::Optimization
    int32_t                         _firstSinkOptTransformationIndex;
    int32_t                         _lastSinkOptTransformationIndex;
 
+   bool                            _underCommonedNode;    // treeIsSinkableStore is walking below a commoned node
+
    enum
       {
       UsesDataFlowAnalysis                     = 0x0001,
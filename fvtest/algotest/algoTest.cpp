@@ -23,6 +23,7 @@
 #include "algorithm_test_internal.h"
 #include "omrTest.h"
 #include "testEnvironment.hpp"
+#include "hashtable_api.h"
 #include "pool_api.h"
 
 extern PortEnvironment *omrTestEnv;
@@ -119,6 +120,8 @@ static const PoolInputData poolParams[] = {
 	{"POOL_ALWAYS_KEEP_SORTED flag",						32,		10,		sizeof(uintptr_t),		0,		POOL_ALWAYS_KEEP_SORTED},
 	{"POOL_ROUND_TO_PAGE_SIZE flag",						32,		10,		sizeof(uintptr_t),		0,		POOL_ROUND_TO_PAGE_SIZE},
 	{"POOL_NEVER_FREE_PUDDLES flag",						32,		10,		sizeof(uintptr_t),		0,		POOL_NEVER_FREE_PUDDLES},
+	{"POOL_USES_MAGAZINES flag",							32,		10,		sizeof(uintptr_t),		0,		POOL_USES_MAGAZINES},
+	{"POOL_USES_MAGAZINES flag - with holes",				8,		100,	sizeof(uintptr_t),		0,		POOL_USES_MAGAZINES},
 };
 
 static const uintptr_t data1[] = {1, 2, 3, 4, 5, 6, 7, 17, 18, 19, 20, 21, 22, 23, 24, 25};
@@ -169,6 +172,16 @@ TEST_P(AVLTest, test)
 
 INSTANTIATE_TEST_CASE_P(OmrAlgoTest, AVLTest, ::testing::ValuesIn(avlParams));
 
+TEST(OmrAlgoTest, BTreeRandomUpdates)
+{
+	ASSERT_EQ(0, verifyBTree(omrTestEnv->getPortLibrary(), 2000, 20000));
+}
+
+TEST(OmrAlgoTest, BTreeBulkLoad)
+{
+	ASSERT_EQ(0, verifyBTreeBulkLoad(omrTestEnv->getPortLibrary(), 5000));
+}
+
 class PoolTest: public ::testing::TestWithParam<PoolInputData>
 {
 };
@@ -187,6 +200,11 @@ TEST(OmrAlgoTest, PoolTestPuddleSharing)
 	ASSERT_EQ(0, testPoolPuddleListSharing(omrTestEnv->getPortLibrary()));
 }
 
+TEST(OmrAlgoTest, PoolTestMagazines)
+{
+	ASSERT_EQ(0, testPoolMagazines(omrTestEnv->getPortLibrary()));
+}
+
 TEST(OmrAlgoTest, hookabletest)
 {
 	uintptr_t passCount = 0;
@@ -254,6 +272,74 @@ INSTANTIATE_TEST_CASE_P(OmrAlgoTest, CollisionResilientHashtableTest,
 	)
 );
 
+class OpenAddressingHashtableTest: public ::testing::TestWithParam<HashtableInputData>
+{
+};
+
+TEST_P(OpenAddressingHashtableTest, Force)
+{
+	HashtableInputData params = GetParam();
+	params.forceCollisions = TRUE;
+	params.collisionResistant = FALSE;
+	params.openAddressing = TRUE;
+
+	ASSERT_EQ(0, buildAndVerifyHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
+}
+
+TEST_P(OpenAddressingHashtableTest, NoForce)
+{
+	HashtableInputData params = GetParam();
+	params.forceCollisions = FALSE;
+	params.collisionResistant = FALSE;
+	params.openAddressing = TRUE;
+
+	ASSERT_EQ(0, buildAndVerifyHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
+}
+
+INSTANTIATE_TEST_CASE_P(OmrAlgoTest, OpenAddressingHashtableTest, ::testing::ValuesIn(hastableParams));
+
+TEST(OmrAlgoTest, OpenAddressingHashtableLargeEntries)
+{
+	ASSERT_EQ(0, verifyOpenAddressingHashtable(omrTestEnv->getPortLibrary(), 20000));
+}
+
+TEST(OmrAlgoTest, OpenAddressingHashtableDoNotGrow)
+{
+	ASSERT_EQ(0, verifyOpenAddressingFixedCapacity(omrTestEnv->getPortLibrary(), J9HASH_TABLE_DO_NOT_GROW));
+}
+
+TEST(OmrAlgoTest, OpenAddressingHashtableDoNotRehash)
+{
+	ASSERT_EQ(0, verifyOpenAddressingFixedCapacity(omrTestEnv->getPortLibrary(), J9HASH_TABLE_DO_NOT_REHASH));
+}
+
+class ConcurrentHashtableTest: public ::testing::TestWithParam<HashtableInputData>
+{
+};
+
+TEST_P(ConcurrentHashtableTest, Force)
+{
+	HashtableInputData params = GetParam();
+	params.forceCollisions = TRUE;
+
+	ASSERT_EQ(0, buildAndVerifyConcurrentHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
+}
+
+TEST_P(ConcurrentHashtableTest, NoForce)
+{
+	HashtableInputData params = GetParam();
+	params.forceCollisions = FALSE;
+
+	ASSERT_EQ(0, buildAndVerifyConcurrentHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
+}
+
+INSTANTIATE_TEST_CASE_P(OmrAlgoTest, ConcurrentHashtableTest, ::testing::ValuesIn(hastableParams));
+
+TEST(OmrAlgoTest, ConcurrentHashtableGrowth)
+{
+	ASSERT_EQ(0, verifyConcurrentHashtableGrowth(omrTestEnv->getPortLibrary(), 10000));
+}
+
 static void
 showResult(OMRPortLibrary *portlib, uintptr_t passCount, uintptr_t failCount, int32_t numSuitesNotRun)
 {
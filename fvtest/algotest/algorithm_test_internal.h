@@ -50,6 +50,7 @@ typedef struct HashtableInputData {
 	uint32_t listToTreeThreshold;
 	BOOLEAN forceCollisions;
 	BOOLEAN collisionResistant;
+	BOOLEAN openAddressing;
 } HashtableInputData;
 
 /* ---------------- avltest.c ---------------- */
@@ -63,6 +64,27 @@ typedef struct HashtableInputData {
 int32_t
 buildAndVerifyAVLTree(OMRPortLibrary *portLib, const char *success, const char *testData);
 
+/* ---------------- btreetest.c ---------------- */
+
+/**
+* @brief Apply operationCount random inserts and deletes of rangeCount address ranges to a J9BTree, checking its queries against a reference.
+* @param *portLib
+* @param rangeCount
+* @param operationCount
+* @return int32_t
+*/
+int32_t
+verifyBTree(OMRPortLibrary *portLib, uintptr_t rangeCount, uintptr_t operationCount);
+
+/**
+* @brief Bulk load rangeCount address ranges into a J9BTree, then update it.
+* @param *portLib
+* @param rangeCount
+* @return int32_t
+*/
+int32_t
+verifyBTreeBulkLoad(OMRPortLibrary *portLib, uintptr_t rangeCount);
+
 /* ---------------- pooltest.c ---------------- */
 
 /**
@@ -82,6 +104,14 @@ createAndVerifyPool(OMRPortLibrary *portLib, PoolInputData *input);
 int32_t
 testPoolPuddleListSharing(OMRPortLibrary *portLib);
 
+/**
+* @brief
+* @param *portLib
+* @return int32_t
+*/
+int32_t
+testPoolMagazines(OMRPortLibrary *portLib);
+
 /* ---------------- hooktest.c ---------------- */
 
 /**
@@ -110,6 +140,40 @@ verifyHashtable(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCo
 int32_t
 buildAndVerifyHashtable(OMRPortLibrary *portLib, HashtableInputData *inputData);
 
+/**
+* @brief Exercise an open-addressing hash table with entries too large to be stored inline,
+* including growth, removal during iteration, hashTableForEachDo and hashTableRehash.
+* @param *portLib
+* @param entryCount
+* @return int32_t
+*/
+int32_t
+verifyOpenAddressingHashtable(OMRPortLibrary *portLib, uintptr_t entryCount);
+
+/**
+* @brief Fill an open-addressing hash table while growth is disabled by fixedCapacityFlag, which must
+* be J9HASH_TABLE_DO_NOT_GROW or J9HASH_TABLE_DO_NOT_REHASH, and check that adds fail once it is full
+* and succeed again when the flag is cleared. A chained table with the same flag is checked to fail
+* only with J9HASH_TABLE_DO_NOT_GROW.
+* @param *portLib
+* @param fixedCapacityFlag
+* @return int32_t
+*/
+int32_t
+verifyOpenAddressingFixedCapacity(OMRPortLibrary *portLib, uint32_t fixedCapacityFlag);
+
+int32_t
+buildAndVerifyConcurrentHashtable(OMRPortLibrary *portLib, HashtableInputData *inputData);
+
+/**
+* @brief Add entryCount entries to a concurrent hash table so that it grows, then remove half while iterating.
+* @param *portLib
+* @param entryCount
+* @return int32_t
+*/
+int32_t
+verifyConcurrentHashtableGrowth(OMRPortLibrary *portLib, uintptr_t entryCount);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,302 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include "algorithm_test_internal.h"
+#include "avl_api.h"
+#include "omrport.h"
+
+/*
+ * Testing the following functions of J9BTree against a reference array, with elements that
+ * cover address ranges:
+ * 		btree_insert()
+ * 		btree_delete()
+ * 		btree_bulk_load()
+ * 		btree_search()
+ * 		btree_floor()
+ * 		btree_ceiling()
+ * 		btree_start_do()
+ * 		btree_next_do()
+ * 		btree_reclaim()
+ */
+
+#define RANGE_STRIDE 16
+#define RANGE_LENGTH 8
+
+typedef struct TestRange {
+	uintptr_t start;
+	uintptr_t end;
+} TestRange;
+
+static uintptr_t
+rangeKey(J9BTree *tree, void *element)
+{
+	return ((TestRange *)element)->start;
+}
+
+static intptr_t
+rangeComparator(J9BTree *tree, uintptr_t searchValue, void *element)
+{
+	TestRange *range = (TestRange *)element;
+
+	if (searchValue < range->start) {
+		return -1;
+	}
+	return (searchValue < range->end) ? 0 : 1;
+}
+
+static uintptr_t
+nextRandom(uintptr_t *random)
+{
+	*random = (*random * 1103515245) + 12345;
+	return *random >> 8;
+}
+
+/**
+ * Check every query against the reference, which holds the ranges present in the tree, indexed by start / RANGE_STRIDE.
+ */
+static int32_t
+verifyAgainstReference(J9BTree *tree, TestRange **reference, uintptr_t rangeCount)
+{
+	J9BTreeWalkState walkState;
+	TestRange *floor = NULL;
+	TestRange *next = NULL;
+	uintptr_t present = 0;
+	uintptr_t i = 0;
+
+	/* floor and search, walking up */
+	for (i = 0; i < rangeCount; i++) {
+		uintptr_t base = i * RANGE_STRIDE;
+
+		if (NULL != reference[i]) {
+			floor = reference[i];
+			present += 1;
+		}
+		if ((floor != btree_floor(tree, base)) || (floor != btree_floor(tree, base + RANGE_LENGTH))) {
+			return -1;
+		}
+		if ((reference[i] != btree_search(tree, base + RANGE_LENGTH - 1)) || (NULL != btree_search(tree, base + RANGE_LENGTH))) {
+			return -2;
+		}
+	}
+	if (present != btree_get_count(tree)) {
+		return -3;
+	}
+
+	/* ceiling, walking down */
+	next = NULL;
+	for (i = rangeCount; i > 0; i--) {
+		uintptr_t base = (i - 1) * RANGE_STRIDE;
+
+		if (next != btree_ceiling(tree, base + 1)) {
+			return -4;
+		}
+		if (NULL != reference[i - 1]) {
+			next = reference[i - 1];
+		}
+		if (next != btree_ceiling(tree, base)) {
+			return -5;
+		}
+	}
+
+	/* walks from every start */
+	for (i = 0; i < rangeCount; i += 7) {
+		uintptr_t expected = i;
+
+		next = (TestRange *)btree_start_do(tree, i * RANGE_STRIDE, &walkState);
+		while (NULL != next) {
+			while ((expected < rangeCount) && (NULL == reference[expected])) {
+				expected += 1;
+			}
+			if ((expected == rangeCount) || (next != reference[expected])) {
+				return -6;
+			}
+			expected += 1;
+			next = (TestRange *)btree_next_do(&walkState);
+		}
+		while ((expected < rangeCount) && (NULL == reference[expected])) {
+			expected += 1;
+		}
+		if (expected != rangeCount) {
+			return -7;
+		}
+	}
+	return 0;
+}
+
+int32_t
+verifyBTree(OMRPortLibrary *portLib, uintptr_t rangeCount, uintptr_t operationCount)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	J9BTree *tree = NULL;
+	TestRange *ranges = NULL;
+	TestRange **reference = NULL;
+	uintptr_t random = 1;
+	uintptr_t i = 0;
+	int32_t result = 0;
+
+	tree = btree_new(portLib, OMRMEM_CATEGORY_VM, rangeKey, rangeComparator, NULL);
+	ranges = (TestRange *)omrmem_allocate_memory(rangeCount * sizeof(TestRange), OMRMEM_CATEGORY_VM);
+	reference = (TestRange **)omrmem_allocate_memory(rangeCount * sizeof(TestRange *), OMRMEM_CATEGORY_VM);
+	if ((NULL == tree) || (NULL == ranges) || (NULL == reference)) {
+		result = -100;
+		goto done;
+	}
+	for (i = 0; i < rangeCount; i++) {
+		ranges[i].start = i * RANGE_STRIDE;
+		ranges[i].end = ranges[i].start + RANGE_LENGTH;
+		reference[i] = NULL;
+	}
+
+	for (i = 0; i < operationCount; i++) {
+		uintptr_t index = nextRandom(&random) % rangeCount;
+		TestRange *range = &ranges[index];
+
+		if (NULL == reference[index]) {
+			if (range != btree_insert(tree, range)) {
+				result = -101;
+				goto done;
+			}
+			reference[index] = range;
+		} else if (0 == (nextRandom(&random) % 3)) {
+			/* inserting again finds the element that is there */
+			if (range != btree_insert(tree, range)) {
+				result = -102;
+				goto done;
+			}
+		} else {
+			if (range != btree_delete(tree, range)) {
+				result = -103;
+				goto done;
+			}
+			reference[index] = NULL;
+			if (NULL != btree_delete(tree, range)) {
+				result = -104;
+				goto done;
+			}
+		}
+		if (0 == (i % (operationCount / 8))) {
+			result = verifyAgainstReference(tree, reference, rangeCount);
+			if (0 != result) {
+				goto done;
+			}
+			btree_reclaim(tree);
+		}
+	}
+	result = verifyAgainstReference(tree, reference, rangeCount);
+	if (0 != result) {
+		goto done;
+	}
+
+	/* empty the tree */
+	for (i = 0; i < rangeCount; i++) {
+		if ((NULL != reference[i]) && (reference[i] != btree_delete(tree, reference[i]))) {
+			result = -105;
+			goto done;
+		}
+		reference[i] = NULL;
+	}
+	if ((0 != btree_get_count(tree)) || (NULL != tree->rootNode) || (NULL != btree_floor(tree, UINTPTR_MAX))) {
+		result = -106;
+	}
+done:
+	btree_free(tree);
+	omrmem_free_memory(reference);
+	omrmem_free_memory(ranges);
+	return result;
+}
+
+int32_t
+verifyBTreeBulkLoad(OMRPortLibrary *portLib, uintptr_t rangeCount)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	J9BTree *tree = NULL;
+	TestRange *ranges = NULL;
+	TestRange **reference = NULL;
+	void *swap = NULL;
+	uintptr_t i = 0;
+	int32_t result = 0;
+
+	tree = btree_new(portLib, OMRMEM_CATEGORY_VM, rangeKey, rangeComparator, NULL);
+	ranges = (TestRange *)omrmem_allocate_memory(rangeCount * sizeof(TestRange), OMRMEM_CATEGORY_VM);
+	reference = (TestRange **)omrmem_allocate_memory(rangeCount * sizeof(TestRange *), OMRMEM_CATEGORY_VM);
+	if ((NULL == tree) || (NULL == ranges) || (NULL == reference)) {
+		result = -100;
+		goto done;
+	}
+	for (i = 0; i < rangeCount; i++) {
+		ranges[i].start = i * RANGE_STRIDE;
+		ranges[i].end = ranges[i].start + RANGE_LENGTH;
+		reference[i] = &ranges[i];
+	}
+
+	/* unsorted elements are refused */
+	swap = reference[0];
+	reference[0] = reference[1];
+	reference[1] = (TestRange *)swap;
+	if ((0 == btree_bulk_load(tree, (void **)reference, rangeCount)) || (NULL != tree->rootNode)) {
+		result = -101;
+		goto done;
+	}
+	reference[1] = reference[0];
+	reference[0] = (TestRange *)swap;
+
+	if (0 != btree_bulk_load(tree, (void **)reference, rangeCount)) {
+		result = -102;
+		goto done;
+	}
+	/* a tree that is not empty cannot be loaded */
+	if (0 == btree_bulk_load(tree, (void **)reference, rangeCount)) {
+		result = -103;
+		goto done;
+	}
+	result = verifyAgainstReference(tree, reference, rangeCount);
+	if (0 != result) {
+		goto done;
+	}
+
+	/* the loaded tree is updated like any other */
+	for (i = 0; i < rangeCount; i += 3) {
+		if (reference[i] != btree_delete(tree, reference[i])) {
+			result = -104;
+			goto done;
+		}
+		reference[i] = NULL;
+	}
+	result = verifyAgainstReference(tree, reference, rangeCount);
+	if (0 != result) {
+		goto done;
+	}
+	for (i = 0; i < rangeCount; i += 3) {
+		reference[i] = &ranges[i];
+		if (reference[i] != btree_insert(tree, reference[i])) {
+			result = -105;
+			goto done;
+		}
+	}
+	result = verifyAgainstReference(tree, reference, rangeCount);
+done:
+	btree_free(tree);
+	omrmem_free_memory(reference);
+	omrmem_free_memory(ranges);
+	return result;
+}
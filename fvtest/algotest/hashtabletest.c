@@ -203,6 +203,10 @@ allocateHashtable(OMRPortLibrary *portLib, HashtableInputData *inputData)
 	uint32_t flags = 0;
 	void *userData = (void *)(uintptr_t)inputData->forceCollisions;
 
+	if (TRUE == inputData->openAddressing) {
+		flags = J9HASH_TABLE_OPEN_ADDRESSING;
+	}
+
 	if (TRUE == inputData->collisionResistant) {
 		hashtable = collisionResilientHashTableNew(portLib,
 				tableName,
@@ -221,7 +225,7 @@ allocateHashtable(OMRPortLibrary *portLib, HashtableInputData *inputData)
 				tableSize,
 				entrySize,
 				sizeof(char *),
-				flags | J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION,
+				(TRUE == inputData->openAddressing) ? flags : (flags | J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION),
 				OMRMEM_CATEGORY_VM,
 				hashFn,
 				hashEqualFn,
@@ -259,3 +263,409 @@ fail:
 	hashTableFree(table);
 	return result;
 }
+
+typedef struct LargeEntry {
+	uintptr_t key;
+	uintptr_t payload[5];
+} LargeEntry;
+
+static uintptr_t
+largeEntryHashFn(void *entry, void *userData)
+{
+	return ((LargeEntry *)entry)->key;
+}
+
+static uintptr_t
+largeEntryEqualFn(void *leftEntry, void *rightEntry, void *userData)
+{
+	return ((LargeEntry *)leftEntry)->key == ((LargeEntry *)rightEntry)->key;
+}
+
+static uintptr_t
+removeMultiplesOfThree(void *entry, void *userData)
+{
+	return (0 == (((LargeEntry *)entry)->key % 3)) ? TRUE : FALSE;
+}
+
+int32_t
+verifyOpenAddressingHashtable(OMRPortLibrary *portLib, uintptr_t entryCount)
+{
+	J9HashTable *table = NULL;
+	J9HashTableState walkState;
+	LargeEntry entry;
+	LargeEntry *firstEntry = NULL;
+	LargeEntry *next = NULL;
+	uintptr_t i = 0;
+	uintptr_t count = 0;
+	int32_t result = 0;
+
+	table = hashTableNew(portLib, "openAddressing", 0, sizeof(LargeEntry), 0, J9HASH_TABLE_OPEN_ADDRESSING, OMRMEM_CATEGORY_VM, largeEntryHashFn, largeEntryEqualFn, NULL, NULL);
+	if (NULL == table) {
+		return -1;
+	}
+
+	memset(&entry, 0, sizeof(entry));
+	for (i = 0; i < entryCount; i++) {
+		LargeEntry *added = NULL;
+		entry.key = i;
+		entry.payload[4] = i * 7;
+		added = hashTableAdd(table, &entry);
+		if ((NULL == added) || (added->key != i) || (added->payload[4] != (i * 7))) {
+			result = -2;
+			goto fail;
+		}
+		if (0 == i) {
+			firstEntry = added;
+		}
+	}
+	/* large entries are out of line, so their addresses survive growth */
+	entry.key = 0;
+	if ((hashTableGetCount(table) != entryCount) || (hashTableFind(table, &entry) != firstEntry) || (hashTableAdd(table, &entry) != firstEntry)) {
+		result = -3;
+		goto fail;
+	}
+
+	/* remove the odd entries while iterating */
+	next = hashTableStartDo(table, &walkState);
+	while (NULL != next) {
+		count += 1;
+		if (1 == (next->key & 1)) {
+			if ((0 != hashTableDoRemove(&walkState)) || (0 == hashTableDoRemove(&walkState))) {
+				result = -4;
+				goto fail;
+			}
+		}
+		next = hashTableNextDo(&walkState);
+	}
+	if ((count != entryCount) || (hashTableGetCount(table) != ((entryCount + 1) / 2))) {
+		result = -5;
+		goto fail;
+	}
+
+	hashTableForEachDo(table, removeMultiplesOfThree, NULL);
+	hashTableRehash(table);
+	for (i = 0; i < entryCount; i++) {
+		BOOLEAN expected = ((0 == (i & 1)) && (0 != (i % 3)));
+		entry.key = i;
+		next = hashTableFind(table, &entry);
+		if (expected != (NULL != next)) {
+			result = -6;
+			goto fail;
+		}
+		if ((NULL != next) && (next->payload[4] != (i * 7))) {
+			result = -7;
+			goto fail;
+		}
+	}
+
+	/* churn through the deleted slots so they are reused and purged */
+	for (i = 0; i < entryCount; i++) {
+		entry.key = entryCount + i;
+		if (NULL == hashTableAdd(table, &entry)) {
+			result = -8;
+			goto fail;
+		}
+		if (0 != hashTableRemove(table, &entry)) {
+			result = -9;
+			goto fail;
+		}
+	}
+	count = 0;
+	next = hashTableStartDo(table, &walkState);
+	while (NULL != next) {
+		count += 1;
+		next = hashTableNextDo(&walkState);
+	}
+	if (count != hashTableGetCount(table)) {
+		result = -10;
+		goto fail;
+	}
+fail:
+	hashTableFree(table);
+	return result;
+}
+
+#define FIXED_CAPACITY_TEST_ENTRIES 1000
+
+int32_t
+verifyOpenAddressingFixedCapacity(OMRPortLibrary *portLib, uint32_t fixedCapacityFlag)
+{
+	J9HashTable *table = NULL;
+	uintptr_t entry = 0;
+	uintptr_t added = 0;
+	uintptr_t i = 0;
+	int32_t result = 0;
+
+	/* a chained table stops adding when full only if it can not grow; otherwise it keeps adding to its chains */
+	table = hashTableNew(portLib, "chainedFixedCapacity", 16, sizeof(uintptr_t), 0, fixedCapacityFlag, OMRMEM_CATEGORY_VM, hashFn, hashEqualFn, NULL, NULL);
+	if (NULL == table) {
+		return -1;
+	}
+	for (added = 0; added < FIXED_CAPACITY_TEST_ENTRIES; added++) {
+		entry = added;
+		if (NULL == hashTableAdd(table, &entry)) {
+			break;
+		}
+	}
+	if ((J9HASH_TABLE_DO_NOT_GROW == fixedCapacityFlag) == (FIXED_CAPACITY_TEST_ENTRIES == added)) {
+		result = -2;
+		goto fail;
+	}
+	hashTableFree(table);
+
+	table = hashTableNew(portLib, "openAddressingFixedCapacity", 16, sizeof(uintptr_t), 0, J9HASH_TABLE_OPEN_ADDRESSING | fixedCapacityFlag, OMRMEM_CATEGORY_VM, hashFn, hashEqualFn, NULL, NULL);
+	if (NULL == table) {
+		return -3;
+	}
+	for (added = 0; added < FIXED_CAPACITY_TEST_ENTRIES; added++) {
+		entry = added;
+		if (NULL == hashTableAdd(table, &entry)) {
+			break;
+		}
+	}
+	if ((0 == added) || (FIXED_CAPACITY_TEST_ENTRIES == added) || (hashTableGetCount(table) != added)) {
+		result = -4;
+		goto fail;
+	}
+	/* the entries that fit are still there, and can still be found and added again */
+	for (i = 0; i < added; i++) {
+		entry = i;
+		if ((NULL == hashTableFind(table, &entry)) || (NULL == hashTableAdd(table, &entry))) {
+			result = -5;
+			goto fail;
+		}
+	}
+
+	hashTableResetFlag(table, fixedCapacityFlag);
+	for (i = added; i < FIXED_CAPACITY_TEST_ENTRIES; i++) {
+		entry = i;
+		if (NULL == hashTableAdd(table, &entry)) {
+			result = -6;
+			goto fail;
+		}
+	}
+	if (hashTableGetCount(table) != FIXED_CAPACITY_TEST_ENTRIES) {
+		result = -7;
+		goto fail;
+	}
+fail:
+	hashTableFree(table);
+	return result;
+}
+
+/*
+ * Testing the following functions of J9ConcurrentHashTable:
+ * 		concurrentHashTableAdd()
+ * 		concurrentHashTableGetCount()
+ * 		concurrentHashTableFind()
+ * 		concurrentHashTableStartDo()
+ * 		concurrentHashTableNextDo()
+ * 		concurrentHashTableDoRemove()
+ * 		concurrentHashTableRemove()
+ * 		concurrentHashTableReclaim()
+ */
+
+static BOOLEAN
+checkConcurrentHashtableIntegrity(J9ConcurrentHashTable *table, const uintptr_t *data, uintptr_t dataLength, uintptr_t removeOffset, uintptr_t i)
+{
+	uintptr_t count, j;
+	uintptr_t dup[256];
+	J9ConcurrentHashTableState walkState;
+	uintptr_t *next;
+
+	count = concurrentHashTableGetCount(table);
+	if (count != dataLength - (i + 1)) {
+		return FALSE;
+	}
+
+	/* walk all the elements, checking for duplicates and ensuring the elements are valid */
+	memset(dup, 0, sizeof(dup));
+	count = 0;
+	next = concurrentHashTableStartDo(table, &walkState);
+	while (next != NULL) {
+		uintptr_t *node;
+		BOOLEAN found = FALSE;
+		count++;
+		if (*next >= sizeof(dup) / sizeof(uintptr_t)) {
+			return FALSE;
+		}
+		if (dup[*next]) {
+			return FALSE;
+		}
+		dup[*next] = 1;
+		for (j = i + 1; j < dataLength; j++) {
+			if (*next == data[dataOffset(removeOffset, dataLength, j)]) {
+				found = TRUE;
+				break;
+			}
+		}
+		if (!found) {
+			return FALSE;
+		}
+
+		node = concurrentHashTableFind(table, next);
+		if (node != next) {
+			return FALSE;
+		}
+
+		next = concurrentHashTableNextDo(&walkState);
+	}
+	if (count != dataLength - (i + 1)) {
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+static int32_t
+runConcurrentHashtableTests(J9ConcurrentHashTable *table, const uintptr_t *data, uintptr_t dataLength, uintptr_t removeOffset)
+{
+	uintptr_t i = 0;
+	uintptr_t entry = 0;
+
+	/* add all the data elements; adding an element twice must return the first copy */
+	for (i = 0; i < dataLength; i++) {
+		uintptr_t *node = NULL;
+		entry = data[i];
+		node = concurrentHashTableAdd(table, &entry);
+		if ((node == NULL) || (*node != entry) || (concurrentHashTableAdd(table, &entry) != node)) {
+			return -1;
+		}
+	}
+
+	/* ensure the count is correct */
+	if (concurrentHashTableGetCount(table) != dataLength) {
+		return -2;
+	}
+
+	/* find all the elements */
+	for (i = 0; i < dataLength; i++) {
+		uintptr_t *node = NULL;
+		entry = data[i];
+		node = concurrentHashTableFind(table, &entry);
+		if (node == NULL || *node != entry) {
+			return -3;
+		}
+	}
+
+	if (checkConcurrentHashtableIntegrity(table, data, dataLength, 0, -1) == FALSE) {
+		return -4;
+	}
+
+	/* remove all elements verifying the integrity */
+	for (i = 0; i < dataLength; i++) {
+		entry = data[dataOffset(removeOffset, dataLength, i)];
+		if (concurrentHashTableRemove(table, &entry) != 0) {
+			return -5;
+		}
+		if (concurrentHashTableRemove(table, &entry) != 1) {
+			return -5;
+		}
+		if (checkConcurrentHashtableIntegrity(table, data, dataLength, removeOffset, i) == FALSE) {
+			return -6;
+		}
+	}
+
+	if (concurrentHashTableReclaim(table) != dataLength) {
+		return -7;
+	}
+
+	return 0;
+}
+
+int32_t
+buildAndVerifyConcurrentHashtable(OMRPortLibrary *portLib, HashtableInputData *inputData)
+{
+	J9ConcurrentHashTable *table = NULL;
+	uintptr_t i = 0;
+	int32_t result = 0;
+
+	table = concurrentHashTableNew(portLib,
+			inputData->hashtableName,
+			0,
+			sizeof(uintptr_t),
+			OMRMEM_CATEGORY_VM,
+			hashFn,
+			hashEqualFn,
+			NULL,
+			(void *)(uintptr_t)inputData->forceCollisions);
+	if (NULL == table) {
+		result = -1;
+		goto fail;
+	}
+
+	if (0 != runConcurrentHashtableTests(table, inputData->data, inputData->dataLength, REVERSE)) {
+		result = -2;
+		goto fail;
+	}
+	for (i = 0; i < inputData->dataLength; i++) {
+		if (0 != runConcurrentHashtableTests(table, inputData->data, inputData->dataLength, i)) {
+			result = -3;
+			goto fail;
+		}
+	}
+fail:
+	concurrentHashTableFree(table);
+	return result;
+}
+
+int32_t
+verifyConcurrentHashtableGrowth(OMRPortLibrary *portLib, uintptr_t entryCount)
+{
+	J9ConcurrentHashTable *table = NULL;
+	J9ConcurrentHashTableState walkState;
+	uintptr_t *next = NULL;
+	uintptr_t i = 0;
+	uintptr_t count = 0;
+	int32_t result = 0;
+
+	table = concurrentHashTableNew(portLib, "growth", 0, sizeof(uintptr_t), OMRMEM_CATEGORY_VM, hashFn, hashEqualFn, NULL, (void *)(uintptr_t)FALSE);
+	if (NULL == table) {
+		return -1;
+	}
+
+	for (i = 0; i < entryCount; i++) {
+		if (NULL == concurrentHashTableAdd(table, &i)) {
+			result = -2;
+			goto fail;
+		}
+	}
+	if (table->bucketCount <= table->initialBucketCount) {
+		result = -3;
+		goto fail;
+	}
+	for (i = 0; i < entryCount; i++) {
+		uintptr_t *node = concurrentHashTableFind(table, &i);
+		if ((NULL == node) || (*node != i)) {
+			result = -4;
+			goto fail;
+		}
+	}
+
+	/* remove the odd entries while iterating */
+	next = concurrentHashTableStartDo(table, &walkState);
+	while (NULL != next) {
+		count += 1;
+		if (1 == (*next & 1)) {
+			if (0 != concurrentHashTableDoRemove(&walkState)) {
+				result = -5;
+				goto fail;
+			}
+		}
+		next = concurrentHashTableNextDo(&walkState);
+	}
+	if ((count != entryCount) || (concurrentHashTableGetCount(table) != ((entryCount + 1) / 2))) {
+		result = -6;
+		goto fail;
+	}
+	for (i = 0; i < entryCount; i++) {
+		BOOLEAN present = (NULL != concurrentHashTableFind(table, &i));
+		if (present != (0 == (i & 1))) {
+			result = -7;
+			goto fail;
+		}
+	}
+fail:
+	concurrentHashTableFree(table);
+	return result;
+}
@@ -36,6 +36,19 @@ static void testDispatch(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_
 static uintptr_t testAllocateAgentID(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface);
 static void hookNormalEvent(J9HookInterface **hook, uintptr_t eventNum, void *voidEventData, void *userData);
 static void hookOrderedEvent(J9HookInterface **hook, uintptr_t eventNum, void *voidEventData, void *userData);
+static void testBatchedListener(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface);
+static void hookBatchedEvent(J9HookInterface **hook, uintptr_t eventNum, void *eventDataArray, uintptr_t eventCount, void *userData);
+static void testRetiredSnapshots(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface);
+
+#define BATCH_TEST_SIZE 4
+#define BATCH_TEST_EVENTS 10
+#define SNAPSHOT_TEST_REGISTRATIONS 1000
+
+typedef struct BatchTestState {
+	uintptr_t batches;
+	uintptr_t events;
+	uintptr_t outOfOrder;
+} BatchTestState;
 
 static SampleHookInterface sampleHookInterface;
 
@@ -58,6 +71,26 @@ verifyHookable(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCou
 		(*hookInterface)->J9HookShutdownInterface(hookInterface);
 	}
 
+	/* the same again, dispatching from the listener snapshots */
+	if (0 == rc) {
+		if (J9HookInitializeInterface(hookInterface, portLib, sizeof(sampleHookInterface))) {
+			(*failCount)++;
+			rc = -1;
+		} else if (0 != (*hookInterface)->J9HookEnableCompiledDispatch(hookInterface)) {
+			omrtty_printf("J9HookEnableCompiledDispatch failed.\n");
+			(*failCount)++;
+			(*hookInterface)->J9HookShutdownInterface(hookInterface);
+			rc = -1;
+		} else {
+			(*passCount)++;
+			rc = testHookInterface(portLib, passCount, failCount, hookInterface);
+			testBatchedListener(portLib, passCount, failCount, hookInterface);
+			testRetiredSnapshots(portLib, passCount, failCount, hookInterface);
+
+			(*hookInterface)->J9HookShutdownInterface(hookInterface);
+		}
+	}
+
 	omrtty_printf("Finished testing hookable interface.\n");
 
 	return rc;
@@ -369,3 +402,121 @@ hookOrderedEvent(J9HookInterface **hook, uintptr_t eventNum, void *voidEventData
 	}
 
 }
+
+static void
+testBatchedListener(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	BatchTestState state = {0, 0, 0};
+	uintptr_t count = 0;
+	uintptr_t i = 0;
+
+	if (0 != (*hookInterface)->J9HookRegisterBatched(hookInterface, TESTHOOK_EVENT2, hookBatchedEvent, sizeof(TestHookEvent2), BATCH_TEST_SIZE, &state)) {
+		omrtty_printf("J9HookRegisterBatched failed.\n");
+		(*failCount)++;
+		return;
+	}
+	/* registering it again has no effect */
+	(*hookInterface)->J9HookRegisterBatched(hookInterface, TESTHOOK_EVENT2, hookBatchedEvent, sizeof(TestHookEvent2), BATCH_TEST_SIZE, &state);
+	/* a normal listener on the same event still sees each event as it happens */
+	testRegister(portLib, passCount, failCount, hookInterface, TESTHOOK_EVENT2, 0);
+
+	for (i = 0; i < BATCH_TEST_EVENTS; i++) {
+		count = 0;
+		TRIGGER_TESTHOOK_EVENT2(sampleHookInterface, i, count, -1);
+		if (1 != count) {
+			omrtty_printf("Event 0x%zx reached %zu immediate listeners, expected 1.\n", (uintptr_t)TESTHOOK_EVENT2, count);
+			(*failCount)++;
+		}
+	}
+	if ((2 == state.batches) && ((BATCH_TEST_SIZE * 2) == state.events)) {
+		(*passCount)++;
+	} else {
+		omrtty_printf("Got %zu batches of %zu events before flushing, expected 2 of %d.\n", state.batches, state.events, BATCH_TEST_SIZE * 2);
+		(*failCount)++;
+	}
+
+	(*hookInterface)->J9HookFlushBatches(hookInterface);
+	if ((3 == state.batches) && (BATCH_TEST_EVENTS == state.events) && (0 == state.outOfOrder)) {
+		(*passCount)++;
+	} else {
+		omrtty_printf("Got %zu batches of %zu events (%zu out of order) after flushing, expected 3 of %d.\n", state.batches, state.events, state.outOfOrder, BATCH_TEST_EVENTS);
+		(*failCount)++;
+	}
+
+	/* nothing is delivered once the listener is gone */
+	(*hookInterface)->J9HookUnregisterBatched(hookInterface, TESTHOOK_EVENT2, hookBatchedEvent, &state);
+	testUnregister(portLib, passCount, failCount, hookInterface, TESTHOOK_EVENT2);
+	TRIGGER_TESTHOOK_EVENT2(sampleHookInterface, BATCH_TEST_EVENTS, count, -1);
+	(*hookInterface)->J9HookFlushBatches(hookInterface);
+	if (BATCH_TEST_EVENTS == state.events) {
+		(*passCount)++;
+	} else {
+		omrtty_printf("Got %zu events after unregistering, expected %d.\n", state.events, BATCH_TEST_EVENTS);
+		(*failCount)++;
+	}
+}
+
+/*
+ * Each registration and unregistration replaces the event's snapshot. With no event being reported
+ * concurrently, the replaced snapshots must be freed rather than kept until shutdown.
+ */
+static void
+testRetiredSnapshots(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	uintptr_t initialBytes = 0;
+	uintptr_t initialBlocks = 0;
+	uintptr_t bytes = 0;
+	uintptr_t blocks = 0;
+	uintptr_t missed = 0;
+	uintptr_t count = 0;
+	uintptr_t i = 0;
+
+	/* the first registration may allocate a record */
+	testRegister(portLib, passCount, failCount, hookInterface, TESTHOOK_EVENT2, 0);
+	testUnregister(portLib, passCount, failCount, hookInterface, TESTHOOK_EVENT2);
+	omrmem_get_category_counters(OMRMEM_CATEGORY_VM, &initialBytes, &initialBlocks);
+
+	for (i = 0; i < SNAPSHOT_TEST_REGISTRATIONS; i++) {
+		(*hookInterface)->J9HookRegisterWithCallSite(hookInterface, TESTHOOK_EVENT2, hookNormalEvent, OMR_GET_CALLSITE(), NULL);
+		count = 0;
+		TRIGGER_TESTHOOK_EVENT2(sampleHookInterface, i, count, -1);
+		if (1 != count) {
+			missed += 1;
+		}
+		testUnregister(portLib, passCount, failCount, hookInterface, TESTHOOK_EVENT2);
+	}
+
+	if (0 == missed) {
+		(*passCount)++;
+	} else {
+		omrtty_printf("%zu of %d events did not reach their listener.\n", missed, SNAPSHOT_TEST_REGISTRATIONS);
+		(*failCount)++;
+	}
+
+	omrmem_get_category_counters(OMRMEM_CATEGORY_VM, &bytes, &blocks);
+	if (blocks <= initialBlocks) {
+		(*passCount)++;
+	} else {
+		omrtty_printf("%zu blocks were left after replacing %d snapshots, expected no more than %zu.\n", blocks, SNAPSHOT_TEST_REGISTRATIONS * 2, initialBlocks);
+		(*failCount)++;
+	}
+}
+
+static void
+hookBatchedEvent(J9HookInterface **hook, uintptr_t eventNum, void *eventDataArray, uintptr_t eventCount, void *userData)
+{
+	BatchTestState *state = (BatchTestState *)userData;
+	TestHookEvent2 *events = (TestHookEvent2 *)eventDataArray;
+	uintptr_t i = 0;
+
+	state->batches += 1;
+	for (i = 0; i < eventCount; i++) {
+		/* dummy1 carries the index of the event */
+		if (events[i].dummy1 != state->events) {
+			state->outOfOrder += 1;
+		}
+		state->events += 1;
+	}
+}
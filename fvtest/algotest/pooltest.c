@@ -401,3 +401,133 @@ error:
 
 	return result;
 }
+
+#define NUM_MAGAZINES 3
+#define NUM_MAGAZINE_ELEMENTS 2000
+
+static void
+countPoolElement(void *anElement, void *userData)
+{
+	*(uintptr_t *)userData += 1;
+}
+
+int32_t
+testPoolMagazines(OMRPortLibrary *portLib)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	J9PoolMagazine magazines[NUM_MAGAZINES];
+	uintptr_t **elements = NULL;
+	uintptr_t *element = NULL;
+	uintptr_t count = 0;
+	uintptr_t index = 0;
+	int32_t result = 0;
+	J9Pool *pool = pool_new(2 * sizeof(uintptr_t), 0, 0, POOL_USES_MAGAZINES, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(portLib));
+
+	if (NULL == pool) {
+		return -1;
+	}
+	elements = (uintptr_t **)omrmem_allocate_memory(NUM_MAGAZINE_ELEMENTS * sizeof(uintptr_t *), OMRMEM_CATEGORY_VM);
+	if (NULL == elements) {
+		result = -2;
+		goto done;
+	}
+	for (index = 0; index < NUM_MAGAZINES; index++) {
+		pool_magazineInit(pool, &magazines[index]);
+	}
+
+	/* Allocate round robin through the magazines, so each of them refills from the puddles. */
+	for (index = 0; index < NUM_MAGAZINE_ELEMENTS; index++) {
+		element = (uintptr_t *)pool_magazineNewElement(&magazines[index % NUM_MAGAZINES]);
+		if ((NULL == element) || (0 != element[0]) || (0 != element[1])) {
+			result = -3;
+			goto done;
+		}
+		element[0] = index;
+		elements[index] = element;
+	}
+	count = 0;
+	pool_do(pool, countPoolElement, &count);
+	if ((NUM_MAGAZINE_ELEMENTS != count) || (NUM_MAGAZINE_ELEMENTS != pool_numElements(pool))) {
+		result = -4;
+		goto done;
+	}
+
+	/* Free the even elements through other magazines than the ones that allocated them, filling the depot. */
+	for (index = 0; index < NUM_MAGAZINE_ELEMENTS; index += 2) {
+		pool_magazineRemoveElement(&magazines[(index + 1) % NUM_MAGAZINES], elements[index]);
+		if (pool_includesElement(pool, elements[index])) {
+			result = -5;
+			goto done;
+		}
+	}
+	/* Freeing an element a second time is ignored, through either path. */
+	pool_magazineRemoveElement(&magazines[0], elements[0]);
+	pool_removeElement(pool, elements[0]);
+	count = 0;
+	pool_do(pool, countPoolElement, &count);
+	if (((NUM_MAGAZINE_ELEMENTS / 2) != count) || ((NUM_MAGAZINE_ELEMENTS / 2) != pool_numElements(pool))) {
+		result = -6;
+		goto done;
+	}
+	for (index = 1; index < NUM_MAGAZINE_ELEMENTS; index += 2) {
+		if (!pool_includesElement(pool, elements[index]) || (index != elements[index][0])) {
+			result = -7;
+			goto done;
+		}
+	}
+
+	/* Reallocate the even elements, mostly out of the depot, mixed with the locked paths. */
+	for (index = 0; index < NUM_MAGAZINE_ELEMENTS; index += 2) {
+		if (0 == (index % 10)) {
+			element = (uintptr_t *)pool_newElement(pool);
+		} else {
+			element = (uintptr_t *)pool_magazineNewElement(&magazines[index % NUM_MAGAZINES]);
+		}
+		if ((NULL == element) || (0 != element[0]) || (0 != element[1])) {
+			result = -8;
+			goto done;
+		}
+		elements[index] = element;
+	}
+	if ((NUM_MAGAZINE_ELEMENTS != pool_numElements(pool)) || (pool_capacity(pool) < NUM_MAGAZINE_ELEMENTS)) {
+		result = -9;
+		goto done;
+	}
+
+	/* Free everything and flush the magazines; the pool must be empty. */
+	for (index = 0; index < NUM_MAGAZINE_ELEMENTS; index++) {
+		if (0 == (index % 7)) {
+			pool_removeElement(pool, elements[index]);
+		} else {
+			pool_magazineRemoveElement(&magazines[index % NUM_MAGAZINES], elements[index]);
+		}
+	}
+	for (index = 0; index < NUM_MAGAZINES; index++) {
+		pool_magazineFlush(&magazines[index]);
+	}
+	count = 0;
+	pool_do(pool, countPoolElement, &count);
+	if ((0 != count) || (0 != pool_numElements(pool))) {
+		result = -10;
+		goto done;
+	}
+
+	/* After a clear, the magazines must be reset before they are used again. */
+	pool_clear(pool);
+	for (index = 0; index < NUM_MAGAZINES; index++) {
+		pool_magazineInit(pool, &magazines[index]);
+		if (NULL == pool_magazineNewElement(&magazines[index])) {
+			result = -11;
+			goto done;
+		}
+	}
+	if (NUM_MAGAZINES != pool_numElements(pool)) {
+		result = -12;
+		goto done;
+	}
+
+done:
+	omrmem_free_memory(elements);
+	pool_kill(pool);
+	return result;
+}
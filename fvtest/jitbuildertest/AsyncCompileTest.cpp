@@ -0,0 +1,188 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+#include <atomic>
+
+/* the compiler's CompilationReturnCodes */
+#define COMPILATION_SUCCEEDED 0
+#define COMPILATION_REQUESTED 1
+
+class ConstantMethod : public OMR::JitBuilder::MethodBuilder
+   {
+   public:
+
+   ConstantMethod(OMR::JitBuilder::TypeDictionary *types, int32_t value)
+      : OMR::JitBuilder::MethodBuilder(types), _value(value)
+      {
+      DefineLine(LINETOSTR(__LINE__));
+      DefineFile(__FILE__);
+      DefineName("constant");
+      DefineReturnType(Int32);
+      }
+
+   virtual bool buildIL()
+      {
+      Return(ConstInt32(_value));
+      return true;
+      }
+
+   private:
+
+   int32_t _value;
+   };
+
+typedef int32_t (*ConstantFunction)();
+
+/*
+ * Each method has its own TypeDictionary, since a TypeDictionary must not be used while
+ * a method built from it is being compiled.
+ */
+struct AsyncMethod
+   {
+   AsyncMethod(int32_t value) : _types(), _builder(&_types, value), _request(NULL) {}
+
+   OMR::JitBuilder::TypeDictionary _types;
+   ConstantMethod _builder;
+   void *_request;
+   };
+
+static std::atomic<int32_t> completions;
+static std::atomic<bool> blockCallback;
+static std::atomic<bool> inCallback;
+static std::atomic<int32_t> completionOrder[4];
+static std::atomic<int32_t> completionCount;
+
+static void
+countCompletion(void *request, int32_t rc, void *entryPoint, void *userData)
+   {
+   completions += 1;
+   }
+
+static void
+recordCompletion(void *request, int32_t rc, void *entryPoint, void *userData)
+   {
+   inCallback = true;
+   while (blockCallback)
+      {
+      }
+   completionOrder[completionCount++] = ((ConstantFunction)entryPoint)();
+   }
+
+class AsyncCompileTest : public JitBuilderTest
+   {
+   public:
+
+   static void SetUpTestCase()
+      {
+      JitBuilderTest::SetUpTestCase();
+      // a single thread and a short queue, so that the tests can fill it
+      ASSERT_TRUE(startCompilationThreads(1, 2)) << "Failed to start the compilation threads.";
+      ASSERT_FALSE(startCompilationThreads(1, 2)) << "Compilation threads started twice.";
+      }
+   };
+
+TEST_F(AsyncCompileTest, WaitForCompilations)
+   {
+   const int32_t count = 16;
+   AsyncMethod *methods[count];
+
+   completions = 0;
+   for (int32_t i = 0; i < count; i++)
+      {
+      methods[i] = new AsyncMethod(i * 3);
+      // the queue holds two requests, so most submissions wait for room
+      methods[i]->_request = compileMethodBuilderAsync(&methods[i]->_builder, 0, true, (void *)countCompletion, NULL);
+      ASSERT_TRUE(NULL != methods[i]->_request);
+      }
+   for (int32_t i = 0; i < count; i++)
+      {
+      void *entry = NULL;
+      ASSERT_EQ(COMPILATION_SUCCEEDED, waitForCompilation(methods[i]->_request, &entry));
+      ASSERT_TRUE(NULL != entry);
+      ASSERT_EQ(i * 3, ((ConstantFunction)entry)());
+      releaseCompilation(methods[i]->_request);
+      }
+   // completions are counted after the result is published
+   while (completions < count)
+      {
+      }
+   for (int32_t i = 0; i < count; i++)
+      delete methods[i];
+   }
+
+TEST_F(AsyncCompileTest, PollCompilation)
+   {
+   AsyncMethod method(42);
+   void *entry = NULL;
+   int32_t rc = COMPILATION_REQUESTED;
+
+   method._request = compileMethodBuilderAsync(&method._builder, 0, false, NULL, NULL);
+   ASSERT_TRUE(NULL != method._request);
+   while (COMPILATION_REQUESTED == (rc = pollCompilation(method._request, &entry)))
+      {
+      }
+   ASSERT_EQ(COMPILATION_SUCCEEDED, rc);
+   ASSERT_EQ(42, ((ConstantFunction)entry)());
+   releaseCompilation(method._request);
+   }
+
+TEST_F(AsyncCompileTest, PriorityAndFullQueue)
+   {
+   AsyncMethod blocker(1);
+   AsyncMethod low(2);
+   AsyncMethod high(3);
+   AsyncMethod rejected(4);
+   void *entry = NULL;
+
+   completionCount = 0;
+   blockCallback = true;
+   inCallback = false;
+
+   // keep the only compilation thread busy in the callback of the first request
+   blocker._request = compileMethodBuilderAsync(&blocker._builder, 0, false, (void *)recordCompletion, NULL);
+   ASSERT_TRUE(NULL != blocker._request);
+   while (!inCallback)
+      {
+      }
+
+   low._request = compileMethodBuilderAsync(&low._builder, 0, false, (void *)recordCompletion, NULL);
+   ASSERT_TRUE(NULL != low._request);
+   high._request = compileMethodBuilderAsync(&high._builder, 10, false, (void *)recordCompletion, NULL);
+   ASSERT_TRUE(NULL != high._request);
+   rejected._request = compileMethodBuilderAsync(&rejected._builder, 20, false, (void *)recordCompletion, NULL);
+   ASSERT_TRUE(NULL == rejected._request) << "A request was queued beyond the capacity of the queue.";
+
+   blockCallback = false;
+   ASSERT_EQ(COMPILATION_SUCCEEDED, waitForCompilation(low._request, &entry));
+   while (completionCount < 3)
+      {
+      }
+   ASSERT_EQ(1, completionOrder[0]);
+   ASSERT_EQ(3, completionOrder[1]);
+   ASSERT_EQ(2, completionOrder[2]);
+
+   releaseCompilation(blocker._request);
+   releaseCompilation(low._request);
+   releaseCompilation(high._request);
+   }
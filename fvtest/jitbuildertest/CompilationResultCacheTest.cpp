@@ -0,0 +1,179 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+#include <thread>
+
+#define COMPILATION_SUCCEEDED 0
+#define THREADS 4
+
+/*
+ * Returns n * scale + offset
+ */
+class ScaleMethod : public OMR::JitBuilder::MethodBuilder
+   {
+   public:
+
+   ScaleMethod(OMR::JitBuilder::TypeDictionary *types, int32_t scale, int32_t offset)
+      : OMR::JitBuilder::MethodBuilder(types), _scale(scale), _offset(offset)
+      {
+      DefineLine(LINETOSTR(__LINE__));
+      DefineFile(__FILE__);
+      DefineName("scale");
+      DefineParameter("n", Int32);
+      DefineReturnType(Int32);
+      }
+
+   virtual bool buildIL()
+      {
+      Return(
+         Add(
+            Mul(
+               Load("n"),
+               ConstInt32(_scale)),
+            ConstInt32(_offset)));
+      return true;
+      }
+
+   private:
+
+   int32_t _scale;
+   int32_t _offset;
+   };
+
+typedef int32_t (*ScaleFunction)(int32_t);
+
+static void *
+compileScale(int32_t scale, int32_t offset)
+   {
+   OMR::JitBuilder::TypeDictionary types;
+   ScaleMethod method(&types, scale, offset);
+   void *entry = NULL;
+   if (COMPILATION_SUCCEEDED != compileMethodBuilder(&method, &entry))
+      return NULL;
+   return entry;
+   }
+
+class CompilationResultCacheTest : public JitBuilderTest
+   {
+   protected:
+
+   virtual void TearDown()
+      {
+      disableCompilationResultCache();
+      }
+   };
+
+TEST_F(CompilationResultCacheTest, IdenticalILIsCompiledOnce)
+   {
+   ASSERT_TRUE(enableCompilationResultCache(false));
+
+   void *first = compileScale(3, 7);
+   void *second = compileScale(3, 7);
+   ASSERT_TRUE(NULL != first);
+   ASSERT_TRUE(first == second) << "The second MethodBuilder was compiled again.";
+   ASSERT_EQ(1, getCompilationResultCacheHits());
+   ASSERT_EQ(1, getCompilationResultCacheMisses());
+   ASSERT_EQ(37, ((ScaleFunction)second)(10));
+   }
+
+TEST_F(CompilationResultCacheTest, DifferentILIsCompiled)
+   {
+   ASSERT_TRUE(enableCompilationResultCache(false));
+
+   void *first = compileScale(3, 7);
+   void *second = compileScale(3, 8);
+   ASSERT_TRUE(NULL != first);
+   ASSERT_TRUE(NULL != second);
+   ASSERT_TRUE(first != second);
+   ASSERT_EQ(0, getCompilationResultCacheHits());
+   ASSERT_EQ(2, getCompilationResultCacheMisses());
+   ASSERT_EQ(37, ((ScaleFunction)first)(10));
+   ASSERT_EQ(38, ((ScaleFunction)second)(10));
+   }
+
+TEST_F(CompilationResultCacheTest, VerifyIL)
+   {
+   ASSERT_TRUE(enableCompilationResultCache(true));
+
+   void *first = compileScale(5, -1);
+   void *second = compileScale(5, -1);
+   void *third = compileScale(6, -1);
+   ASSERT_TRUE(NULL != first);
+   ASSERT_TRUE(first == second);
+   ASSERT_TRUE(first != third);
+   ASSERT_EQ(1, getCompilationResultCacheHits());
+   ASSERT_EQ(2, getCompilationResultCacheMisses());
+   ASSERT_EQ(59, ((ScaleFunction)third)(10));
+   }
+
+TEST_F(CompilationResultCacheTest, ResultsAreNotKeptOnceDisabled)
+   {
+   ASSERT_TRUE(enableCompilationResultCache(false));
+   ASSERT_FALSE(enableCompilationResultCache(false));
+   void *first = compileScale(2, 2);
+   disableCompilationResultCache();
+
+   ASSERT_TRUE(enableCompilationResultCache(false));
+   void *second = compileScale(2, 2);
+   ASSERT_TRUE(NULL != second);
+   ASSERT_TRUE(first != second);
+   ASSERT_EQ(0, getCompilationResultCacheHits());
+   }
+
+static void
+compileScales(int32_t iterations, void **entries, int32_t *failures)
+   {
+   for (int32_t i = 0; i < iterations; i++)
+      {
+      entries[i] = compileScale(i, i);
+      if ((NULL == entries[i]) || (((ScaleFunction)entries[i])(3) != 4 * i))
+         (*failures)++;
+      }
+   }
+
+TEST_F(CompilationResultCacheTest, ConcurrentCompilations)
+   {
+   const int32_t iterations = 10;
+   ASSERT_TRUE(enableCompilationResultCache(true));
+
+   void *entries[THREADS][iterations];
+   int32_t failures[THREADS] = { 0 };
+   std::thread threads[THREADS];
+   for (int32_t i = 0; i < THREADS; i++)
+      threads[i] = std::thread(compileScales, iterations, entries[i], &failures[i]);
+   for (int32_t i = 0; i < THREADS; i++)
+      threads[i].join();
+
+   for (int32_t i = 0; i < THREADS; i++)
+      ASSERT_EQ(0, failures[i]) << "Thread " << i << " got wrong code.";
+   ASSERT_EQ(THREADS * iterations, getCompilationResultCacheHits() + getCompilationResultCacheMisses());
+   ASSERT_GE(getCompilationResultCacheMisses(), iterations);
+
+   // every later compilation of the same IL gets the code of the first one
+   void *entry = compileScale(iterations - 1, iterations - 1);
+   bool found = false;
+   for (int32_t i = 0; i < THREADS; i++)
+      found = found || (entry == entries[i][iterations - 1]);
+   ASSERT_TRUE(found);
+   }
@@ -0,0 +1,189 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+#include <thread>
+
+#define COMPILATION_SUCCEEDED 0
+
+/*
+ * Sums i + addend for i from 0 to n - 1. The loop, the comparison and the stores give
+ * the optimizer and the register allocator some work in every compilation.
+ */
+class SumMethod : public OMR::JitBuilder::MethodBuilder
+   {
+   public:
+
+   SumMethod(OMR::JitBuilder::TypeDictionary *types, int32_t addend)
+      : OMR::JitBuilder::MethodBuilder(types), _addend(addend)
+      {
+      DefineLine(LINETOSTR(__LINE__));
+      DefineFile(__FILE__);
+      DefineName("sum");
+      DefineParameter("n", Int32);
+      DefineReturnType(Int32);
+      }
+
+   virtual bool buildIL()
+      {
+      Store("total", ConstInt32(0));
+
+      OMR::JitBuilder::IlBuilder *loop = NULL;
+      ForLoopUp((char *)"i", &loop, ConstInt32(0), Load("n"), ConstInt32(1));
+      loop->Store("total",
+      loop->   Add(
+      loop->      Load("total"),
+      loop->      Add(
+      loop->         Load("i"),
+      loop->         ConstInt32(_addend))));
+
+      OMR::JitBuilder::IlBuilder *negative = NULL;
+      IfThen(&negative, LessThan(Load("total"), ConstInt32(0)));
+      negative->Return(negative->ConstInt32(-1));
+
+      Return(Load("total"));
+      return true;
+      }
+
+   private:
+
+   int32_t _addend;
+   };
+
+typedef int32_t (*SumFunction)(int32_t);
+
+static int32_t
+expectedSum(int32_t n, int32_t addend)
+   {
+   return (n * (n - 1) / 2) + (n * addend);
+   }
+
+static const int32_t THREADS = 4;
+static const int32_t METHODS_PER_THREAD = 64;
+
+/*
+ * Compile METHODS_PER_THREAD methods, each with its own TypeDictionary, and count the ones
+ * that fail to compile or compute the wrong result.
+ */
+static void
+compileMethods(int32_t thread, int32_t *failures)
+   {
+   for (int32_t i = 0; i < METHODS_PER_THREAD; i++)
+      {
+      int32_t addend = (thread * METHODS_PER_THREAD) + i;
+      OMR::JitBuilder::TypeDictionary types;
+      SumMethod method(&types, addend);
+      void *entry = NULL;
+
+      if ((COMPILATION_SUCCEEDED != compileMethodBuilder(&method, &entry))
+         || (expectedSum(100, addend) != ((SumFunction)entry)(100)))
+         {
+         *failures += 1;
+         }
+      }
+   }
+
+class ConcurrentCompileTest : public JitBuilderTest
+   {
+   public:
+
+   static void SetUpTestCase()
+      {
+      JitBuilderTest::SetUpTestCase();
+      ASSERT_TRUE(startCompilationThreads(THREADS, 16)) << "Failed to start the compilation threads.";
+      }
+   };
+
+TEST_F(ConcurrentCompileTest, CallerThreads)
+   {
+   std::thread threads[THREADS];
+   int32_t failures[THREADS] = {0};
+
+   for (int32_t i = 0; i < THREADS; i++)
+      threads[i] = std::thread(compileMethods, i, &failures[i]);
+   for (int32_t i = 0; i < THREADS; i++)
+      threads[i].join();
+
+   for (int32_t i = 0; i < THREADS; i++)
+      EXPECT_EQ(0, failures[i]) << "thread " << i;
+   }
+
+TEST_F(ConcurrentCompileTest, CompilationThreads)
+   {
+   const int32_t count = THREADS * METHODS_PER_THREAD;
+   OMR::JitBuilder::TypeDictionary *types[count];
+   SumMethod *methods[count];
+   void *requests[count];
+
+   for (int32_t i = 0; i < count; i++)
+      {
+      types[i] = new OMR::JitBuilder::TypeDictionary();
+      methods[i] = new SumMethod(types[i], i);
+      requests[i] = compileMethodBuilderAsync(methods[i], i % 3, true, NULL, NULL);
+      ASSERT_TRUE(NULL != requests[i]);
+      }
+   for (int32_t i = 0; i < count; i++)
+      {
+      void *entry = NULL;
+      ASSERT_EQ(COMPILATION_SUCCEEDED, waitForCompilation(requests[i], &entry)) << "method " << i;
+      EXPECT_EQ(expectedSum(100, i), ((SumFunction)entry)(100)) << "method " << i;
+      releaseCompilation(requests[i]);
+      }
+   for (int32_t i = 0; i < count; i++)
+      {
+      delete methods[i];
+      delete types[i];
+      }
+   }
+
+TEST_F(ConcurrentCompileTest, MixedCallers)
+   {
+   const int32_t count = METHODS_PER_THREAD;
+   OMR::JitBuilder::TypeDictionary *types[count];
+   SumMethod *methods[count];
+   void *requests[count];
+   int32_t failures = 0;
+
+   for (int32_t i = 0; i < count; i++)
+      {
+      types[i] = new OMR::JitBuilder::TypeDictionary();
+      methods[i] = new SumMethod(types[i], 1000 + i);
+      requests[i] = compileMethodBuilderAsync(methods[i], 0, true, NULL, NULL);
+      ASSERT_TRUE(NULL != requests[i]);
+      }
+   // compile on this thread while the compilation threads work through the queue
+   compileMethods(THREADS, &failures);
+   EXPECT_EQ(0, failures);
+   for (int32_t i = 0; i < count; i++)
+      {
+      void *entry = NULL;
+      ASSERT_EQ(COMPILATION_SUCCEEDED, waitForCompilation(requests[i], &entry)) << "method " << i;
+      EXPECT_EQ(expectedSum(100, 1000 + i), ((SumFunction)entry)(100)) << "method " << i;
+      releaseCompilation(requests[i]);
+      }
+   for (int32_t i = 0; i < count; i++)
+      {
+      delete methods[i];
+      delete types[i];
+      }
+   }
@@ -0,0 +1,161 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+#include <stdio.h>
+#include <string>
+#include <unistd.h>
+
+#define COMPILATION_SUCCEEDED 0
+#define CACHE_SIZE (1024 * 1024)
+
+/*
+ * Sums i for i from 0 to n - 1, or returns -1 when n is larger than limit
+ */
+class CachedSumMethod : public OMR::JitBuilder::MethodBuilder
+   {
+   public:
+
+   CachedSumMethod(OMR::JitBuilder::TypeDictionary *types, int32_t limit)
+      : OMR::JitBuilder::MethodBuilder(types), _limit(limit)
+      {
+      DefineLine(LINETOSTR(__LINE__));
+      DefineFile(__FILE__);
+      DefineName("cachedSum");
+      DefineParameter("n", Int32);
+      DefineReturnType(Int32);
+      }
+
+   virtual bool buildIL()
+      {
+      OMR::JitBuilder::IlBuilder *tooLarge = NULL;
+      IfThen(&tooLarge, GreaterThan(Load("n"), ConstInt32(_limit)));
+      tooLarge->Return(tooLarge->ConstInt32(-1));
+
+      Store("total", ConstInt32(0));
+
+      OMR::JitBuilder::IlBuilder *loop = NULL;
+      ForLoopUp((char *)"i", &loop, ConstInt32(0), Load("n"), ConstInt32(1));
+      loop->Store("total",
+      loop->   Add(
+      loop->      Load("total"),
+      loop->      Load("i")));
+
+      Return(Load("total"));
+      return true;
+      }
+
+   private:
+
+   int32_t _limit;
+   };
+
+typedef int32_t (*CachedSumFunction)(int32_t);
+
+class PersistentCodeCacheTest : public JitBuilderTest
+   {
+   protected:
+
+   virtual void SetUp()
+      {
+      char path[64];
+      snprintf(path, sizeof(path), "jbcodecache.%d", (int)getpid());
+      _path = path;
+      unlink(_path.c_str());
+      }
+
+   virtual void TearDown()
+      {
+      closePersistentCodeCache();
+      unlink(_path.c_str());
+      }
+
+   void *compileSum(int32_t limit)
+      {
+      OMR::JitBuilder::TypeDictionary types;
+      CachedSumMethod method(&types, limit);
+      void *entry = NULL;
+      EXPECT_EQ(COMPILATION_SUCCEEDED, compileMethodBuilder(&method, &entry));
+      return entry;
+      }
+
+   std::string _path;
+   };
+
+TEST_F(PersistentCodeCacheTest, ReuseCodeFromEarlierRun)
+   {
+   ASSERT_TRUE(openPersistentCodeCache(_path.c_str(), CACHE_SIZE));
+   void *compiled = compileSum(1000);
+   ASSERT_TRUE(NULL != compiled);
+   ASSERT_EQ(0, getPersistentCodeCacheHits());
+   ASSERT_EQ(1, getPersistentCodeCacheMisses());
+   closePersistentCodeCache();
+
+   ASSERT_TRUE(openPersistentCodeCache(_path.c_str(), CACHE_SIZE));
+   void *installed = compileSum(1000);
+   ASSERT_TRUE(NULL != installed);
+#if defined(__x86_64__)
+   ASSERT_EQ(1, getPersistentCodeCacheHits());
+   ASSERT_EQ(0, getPersistentCodeCacheMisses());
+   ASSERT_TRUE(compiled != installed) << "The code from the file was not copied into the code cache.";
+#endif
+
+   for (int32_t i = 0; i < 100; i++)
+      ASSERT_EQ(((CachedSumFunction)compiled)(i), ((CachedSumFunction)installed)(i));
+   ASSERT_EQ(-1, ((CachedSumFunction)installed)(1001));
+   }
+
+TEST_F(PersistentCodeCacheTest, DifferentILIsCompiled)
+   {
+   ASSERT_TRUE(openPersistentCodeCache(_path.c_str(), CACHE_SIZE));
+   void *compiled = compileSum(1000);
+   ASSERT_TRUE(NULL != compiled);
+   closePersistentCodeCache();
+
+   ASSERT_TRUE(openPersistentCodeCache(_path.c_str(), CACHE_SIZE));
+   void *other = compileSum(10);
+   ASSERT_TRUE(NULL != other);
+   ASSERT_EQ(0, getPersistentCodeCacheHits());
+   ASSERT_EQ(1, getPersistentCodeCacheMisses());
+
+   ASSERT_EQ(45, ((CachedSumFunction)other)(10));
+   ASSERT_EQ(-1, ((CachedSumFunction)other)(11));
+   ASSERT_EQ(55, ((CachedSumFunction)compiled)(11));
+   }
+
+TEST_F(PersistentCodeCacheTest, OnlyOneCacheIsOpen)
+   {
+   ASSERT_TRUE(openPersistentCodeCache(_path.c_str(), CACHE_SIZE));
+   ASSERT_FALSE(openPersistentCodeCache(_path.c_str(), CACHE_SIZE));
+   }
+
+TEST_F(PersistentCodeCacheTest, RejectFileThatIsNotACache)
+   {
+   FILE *file = fopen(_path.c_str(), "w");
+   ASSERT_TRUE(NULL != file);
+   for (int32_t i = 0; i < 1024; i++)
+      fputs("not a code cache ", file);
+   fclose(file);
+
+   ASSERT_FALSE(openPersistentCodeCache(_path.c_str(), CACHE_SIZE));
+   }
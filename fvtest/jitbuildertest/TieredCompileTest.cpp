@@ -0,0 +1,203 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+#include <chrono>
+#include <thread>
+
+#define COMPILATION_SUCCEEDED 0
+
+/*
+ * Sums i for i from 0 to n - 1, or returns -1 when n is larger than limit. The large n
+ * path is not taken while the method is profiled in the tests, so it is cold in the
+ * recompiled method.
+ */
+class TieredSumMethod : public OMR::JitBuilder::MethodBuilder
+   {
+   public:
+
+   TieredSumMethod(OMR::JitBuilder::TypeDictionary *types, int32_t limit)
+      : OMR::JitBuilder::MethodBuilder(types), _limit(limit)
+      {
+      DefineLine(LINETOSTR(__LINE__));
+      DefineFile(__FILE__);
+      DefineName("tieredSum");
+      DefineParameter("n", Int32);
+      DefineReturnType(Int32);
+      }
+
+   virtual bool buildIL()
+      {
+      OMR::JitBuilder::IlBuilder *tooLarge = NULL;
+      IfThen(&tooLarge, GreaterThan(Load("n"), ConstInt32(_limit)));
+      tooLarge->Return(tooLarge->ConstInt32(-1));
+
+      Store("total", ConstInt32(0));
+
+      OMR::JitBuilder::IlBuilder *loop = NULL;
+      ForLoopUp((char *)"i", &loop, ConstInt32(0), Load("n"), ConstInt32(1));
+      loop->Store("total",
+      loop->   Add(
+      loop->      Load("total"),
+      loop->      Load("i")));
+
+      Return(Load("total"));
+      return true;
+      }
+
+   private:
+
+   int32_t _limit;
+   };
+
+typedef int32_t (*TieredSumFunction)(int32_t);
+
+static int32_t
+expectedSum(int32_t n)
+   {
+   return n * (n - 1) / 2;
+   }
+
+/*
+ * The method is recompiled on the thread that reaches the threshold unless the compilation
+ * threads have been started by another test, so wait for the entry point to change.
+ */
+static bool
+waitForRecompilation(void * volatile *entry, void *profilingEntry)
+   {
+   std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::seconds(60);
+   while (*entry == profilingEntry)
+      {
+      if (std::chrono::steady_clock::now() > deadline)
+         return false;
+      std::this_thread::yield();
+      }
+   return true;
+   }
+
+/*
+ * Releases a tiered method before the MethodBuilder it was compiled from goes out of
+ * scope, including when an assertion returns from the test early
+ */
+class TieredMethodReleaser
+   {
+   public:
+
+   TieredMethodReleaser(OMR::JitBuilder::MethodBuilder *method) : _method(method) {}
+   ~TieredMethodReleaser() { releaseTieredMethod(_method); }
+
+   private:
+
+   OMR::JitBuilder::MethodBuilder *_method;
+   };
+
+class TieredCompileTest : public JitBuilderTest {};
+
+TEST_F(TieredCompileTest, RecompileAfterInvocations)
+   {
+   OMR::JitBuilder::TypeDictionary types;
+   TieredSumMethod method(&types, 1000);
+   void * volatile entry = NULL;
+   TieredMethodReleaser releaser(&method);
+
+   ASSERT_EQ(COMPILATION_SUCCEEDED, compileMethodBuilderTiered(&method, 10, 1000000, (void **)&entry));
+   void *profilingEntry = entry;
+   ASSERT_TRUE(NULL != profilingEntry);
+
+   for (int32_t i = 0; i < 9; i++)
+      ASSERT_EQ(expectedSum(i), ((TieredSumFunction)entry)(i));
+   ASSERT_TRUE(profilingEntry == entry) << "Recompiled before the invocation threshold was reached.";
+
+   ASSERT_EQ(expectedSum(20), ((TieredSumFunction)entry)(20));
+   ASSERT_TRUE(waitForRecompilation(&entry, profilingEntry)) << "The method was not recompiled.";
+
+   for (int32_t i = 0; i < 100; i++)
+      ASSERT_EQ(expectedSum(i), ((TieredSumFunction)entry)(i));
+   // the path the profile never saw taken
+   ASSERT_EQ(-1, ((TieredSumFunction)entry)(1001));
+   }
+
+TEST_F(TieredCompileTest, RecompileAfterLoopIterations)
+   {
+   OMR::JitBuilder::TypeDictionary types;
+   TieredSumMethod method(&types, 100000);
+   void * volatile entry = NULL;
+   TieredMethodReleaser releaser(&method);
+
+   ASSERT_EQ(COMPILATION_SUCCEEDED, compileMethodBuilderTiered(&method, 1000000, 5000, (void **)&entry));
+   void *profilingEntry = entry;
+   ASSERT_TRUE(NULL != profilingEntry);
+
+   ASSERT_EQ(expectedSum(100), ((TieredSumFunction)entry)(100));
+   ASSERT_TRUE(profilingEntry == entry) << "Recompiled before the back edge threshold was reached.";
+
+   // the threshold is reached in the middle of the loop, which runs to completion in the profiling code
+   ASSERT_EQ(expectedSum(10000), ((TieredSumFunction)entry)(10000));
+   ASSERT_TRUE(waitForRecompilation(&entry, profilingEntry)) << "The method was not recompiled.";
+
+   ASSERT_EQ(expectedSum(10000), ((TieredSumFunction)entry)(10000));
+   ASSERT_EQ(-1, ((TieredSumFunction)entry)(100001));
+   }
+
+TEST_F(TieredCompileTest, ReleaseBeforeThreshold)
+   {
+   OMR::JitBuilder::TypeDictionary types;
+   TieredSumMethod method(&types, 1000);
+   void * volatile entry = NULL;
+
+   ASSERT_EQ(COMPILATION_SUCCEEDED, compileMethodBuilderTiered(&method, 10, 1000000, (void **)&entry));
+   void *profilingEntry = entry;
+   for (int32_t i = 0; i < 5; i++)
+      ASSERT_EQ(expectedSum(i), ((TieredSumFunction)entry)(i));
+
+   releaseTieredMethod(&method);
+   ASSERT_TRUE(profilingEntry == entry) << "Recompiled before the invocation threshold was reached.";
+   // releasing it again, or a MethodBuilder that was never compiled tiered, does nothing
+   releaseTieredMethod(&method);
+   }
+
+TEST_F(TieredCompileTest, ReleaseWaitsForRecompilation)
+   {
+   OMR::JitBuilder::TypeDictionary types;
+   TieredSumMethod method(&types, 1000);
+   void * volatile entry = NULL;
+
+   ASSERT_EQ(COMPILATION_SUCCEEDED, compileMethodBuilderTiered(&method, 1, 1000000, (void **)&entry));
+   void *profilingEntry = entry;
+   ASSERT_EQ(expectedSum(10), ((TieredSumFunction)entry)(10));
+
+   // the recompilation started on the call above, and may still be running on the compile queue
+   releaseTieredMethod(&method);
+   ASSERT_TRUE(profilingEntry != entry) << "The recompiled code was not installed before the method was released.";
+   ASSERT_EQ(expectedSum(100), ((TieredSumFunction)entry)(100));
+   }
+
+TEST_F(TieredCompileTest, InvalidThresholds)
+   {
+   OMR::JitBuilder::TypeDictionary types;
+   TieredSumMethod method(&types, 1000);
+   void *entry = NULL;
+
+   ASSERT_NE(COMPILATION_SUCCEEDED, compileMethodBuilderTiered(&method, 0, 100, &entry));
+   ASSERT_NE(COMPILATION_SUCCEEDED, compileMethodBuilderTiered(&method, 100, -1, &entry));
+   }
@@ -0,0 +1,505 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup PortTest
+ * @brief Verify port library asynchronous file I/O.
+ *
+ * Exercise the API for port library asynchronous file operations, found in @ref omrfileaio.c,
+ * with both the io_uring and worker thread backends, and compare their throughput with omrfile_write.
+ */
+#include <string.h>
+#if !defined(OMR_OS_WINDOWS)
+#include <poll.h>
+#endif /* !defined(OMR_OS_WINDOWS) */
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "testHelpers.hpp"
+
+#define AIO_TEST_BLOCK_SIZE 4096
+#define AIO_TEST_BLOCKS 64
+#define AIO_TEST_QUEUE_DEPTH 16
+#define AIO_THROUGHPUT_BLOCK_SIZE (64 * 1024)
+#define AIO_THROUGHPUT_BLOCKS 256
+
+static void
+countCompletion(struct OMRPortLibrary *portLibrary, OMRFileAIORequest *request)
+{
+	*(uintptr_t *)request->userData += 1;
+}
+
+static void
+fillBlock(uint8_t *block, uintptr_t length, uintptr_t blockNumber)
+{
+	uintptr_t i = 0;
+
+	for (i = 0; i < length; i++) {
+		block[i] = (uint8_t)(blockNumber + (i * 7));
+	}
+}
+
+static void
+initRequest(OMRFileAIORequest *request, intptr_t fd, uint32_t opcode, int64_t offset)
+{
+	memset(request, 0, sizeof(*request));
+	request->fd = fd;
+	request->opcode = opcode;
+	request->offset = offset;
+	request->fixedBufferIndex = OMRPORT_FILE_AIO_NO_FIXED_BUFFER;
+}
+
+/**
+ * Create a context, treating platforms without asynchronous file I/O as a pass.
+ *
+ * @return TRUE if a context was created
+ */
+static BOOLEAN
+createContext(struct OMRPortLibrary *portLibrary, const char *testName, uint32_t flags, OMRFileAIOContext **context)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	int32_t rc = omrfile_aio_create(AIO_TEST_QUEUE_DEPTH, flags, context);
+
+	if (OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM == rc) {
+		portTestEnv->log("Asynchronous file I/O is not supported on this platform\n");
+		return FALSE;
+	}
+	if (0 != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_aio_create(%u) failed, rc=%d\n", flags, rc);
+		return FALSE;
+	}
+	return TRUE;
+}
+
+/**
+ * Write a file with a batch of positioned writes, then read it back with vectored reads and with
+ * reads into registered buffers, checking callbacks, results and the event descriptor.
+ */
+static void
+batchedReadWrite(struct OMRPortLibrary *portLibrary, const char *testName, uint32_t flags)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	const char *fileName = "omrfileaio_batch.tst";
+	OMRFileAIOContext *context = NULL;
+	OMRFileAIORequest requests[AIO_TEST_BLOCKS];
+	OMRFileAIORequest *batch[AIO_TEST_BLOCKS];
+	OMRFileAIOVec vecs[AIO_TEST_BLOCKS][2];
+	OMRFileAIOVec fixed;
+	uint8_t *writeData = NULL;
+	uint8_t *readData = NULL;
+	uintptr_t completions = 0;
+	uintptr_t submitted = 0;
+	uintptr_t reaped = 0;
+	intptr_t fd = -1;
+	intptr_t rc = 0;
+	uintptr_t i = 0;
+
+	if (!createContext(OMRPORTLIB, testName, flags, &context)) {
+		return;
+	}
+	portTestEnv->log("backend=%u\n", omrfile_aio_backend(context));
+
+	writeData = (uint8_t *)omrmem_allocate_memory(AIO_TEST_BLOCKS * AIO_TEST_BLOCK_SIZE, OMRMEM_CATEGORY_PORT_LIBRARY);
+	readData = (uint8_t *)omrmem_allocate_memory(AIO_TEST_BLOCKS * AIO_TEST_BLOCK_SIZE, OMRMEM_CATEGORY_PORT_LIBRARY);
+	if ((NULL == writeData) || (NULL == readData)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrmem_allocate_memory failed\n");
+		goto exit;
+	}
+	fd = omrfile_open(fileName, EsOpenCreate | EsOpenRead | EsOpenWrite | EsOpenTruncate, 0666);
+	if (-1 == fd) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_open(\"%s\") failed\n", fileName);
+		goto exit;
+	}
+
+	/* writes, submitted in batches as the queue allows, completing out of order */
+	for (i = 0; i < AIO_TEST_BLOCKS; i++) {
+		uintptr_t block = AIO_TEST_BLOCKS - 1 - i;
+
+		fillBlock(writeData + (block * AIO_TEST_BLOCK_SIZE), AIO_TEST_BLOCK_SIZE, block);
+		initRequest(&requests[i], fd, OMRPORT_FILE_AIO_WRITE, (int64_t)(block * AIO_TEST_BLOCK_SIZE));
+		requests[i].buffer = writeData + (block * AIO_TEST_BLOCK_SIZE);
+		requests[i].length = AIO_TEST_BLOCK_SIZE;
+		requests[i].callback = countCompletion;
+		requests[i].userData = &completions;
+		batch[i] = &requests[i];
+	}
+	while (submitted < AIO_TEST_BLOCKS) {
+		rc = omrfile_aio_submit(context, &batch[submitted], AIO_TEST_BLOCKS - submitted);
+		if (rc < 0) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_aio_submit failed, rc=%zd\n", rc);
+			goto exit;
+		}
+		if (rc > AIO_TEST_QUEUE_DEPTH) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_aio_submit accepted %zd requests, more than the queue depth\n", rc);
+		}
+		submitted += (uintptr_t)rc;
+		rc = omrfile_aio_reap(context, 1);
+		if (rc < 1) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_aio_reap failed, rc=%zd\n", rc);
+			goto exit;
+		}
+		reaped += (uintptr_t)rc;
+	}
+	rc = omrfile_aio_reap(context, AIO_TEST_BLOCKS);
+	if (rc < 0) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_aio_reap failed, rc=%zd\n", rc);
+		goto exit;
+	}
+	reaped += (uintptr_t)rc;
+	if ((AIO_TEST_BLOCKS != reaped) || (AIO_TEST_BLOCKS != completions)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "reaped %zu writes and ran %zu callbacks, expected %d\n", reaped, completions, AIO_TEST_BLOCKS);
+	}
+	for (i = 0; i < AIO_TEST_BLOCKS; i++) {
+		if ((OMRPORT_FILE_AIO_STATE_COMPLETE != requests[i].state) || (AIO_TEST_BLOCK_SIZE != requests[i].result)) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "write %zu state=%zu result=%zd\n", i, requests[i].state, requests[i].result);
+		}
+	}
+	if (AIO_TEST_BLOCKS * AIO_TEST_BLOCK_SIZE != omrfile_flength(fd)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "file length %lld after writes\n", omrfile_flength(fd));
+	}
+
+	/* an fsync, with the event descriptor signalled when it completes */
+	initRequest(&requests[0], fd, OMRPORT_FILE_AIO_FSYNC, 0);
+	batch[0] = &requests[0];
+	if (1 != omrfile_aio_submit(context, batch, 1)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_aio_submit(fsync) failed\n");
+		goto exit;
+	}
+#if !defined(OMR_OS_WINDOWS)
+	{
+		struct pollfd pfd;
+
+		pfd.fd = (int)omrfile_aio_get_event_fd(context);
+		pfd.events = POLLIN;
+		pfd.revents = 0;
+		if ((1 != poll(&pfd, 1, 10000)) || (0 == (pfd.revents & POLLIN))) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "event descriptor not readable after a completion\n");
+		}
+	}
+#endif /* !defined(OMR_OS_WINDOWS) */
+	if ((1 != omrfile_aio_reap(context, 1)) || (0 != requests[0].result)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "fsync failed, result=%zd\n", requests[0].result);
+	}
+	if (0 != omrfile_aio_reap(context, 0)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_aio_reap found a completion with nothing in flight\n");
+	}
+
+	/* vectored reads, each block split in two uneven pieces */
+	memset(readData, 0, AIO_TEST_BLOCKS * AIO_TEST_BLOCK_SIZE);
+	completions = 0;
+	for (i = 0; i < AIO_TEST_QUEUE_DEPTH; i++) {
+		uintptr_t block = i * (AIO_TEST_BLOCKS / AIO_TEST_QUEUE_DEPTH);
+
+		vecs[i][0].buffer = readData + (block * AIO_TEST_BLOCK_SIZE);
+		vecs[i][0].length = 100;
+		vecs[i][1].buffer = readData + (block * AIO_TEST_BLOCK_SIZE) + 100;
+		vecs[i][1].length = AIO_TEST_BLOCK_SIZE - 100;
+		initRequest(&requests[i], fd, OMRPORT_FILE_AIO_READV, (int64_t)(block * AIO_TEST_BLOCK_SIZE));
+		requests[i].vecs = vecs[i];
+		requests[i].vecCount = 2;
+		requests[i].callback = countCompletion;
+		requests[i].userData = &completions;
+		batch[i] = &requests[i];
+	}
+	if (AIO_TEST_QUEUE_DEPTH != omrfile_aio_submit(context, batch, AIO_TEST_QUEUE_DEPTH)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_aio_submit(readv) did not accept a full queue\n");
+		goto exit;
+	}
+	if (AIO_TEST_QUEUE_DEPTH != omrfile_aio_reap(context, AIO_TEST_QUEUE_DEPTH)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_aio_reap(readv) did not reap a full queue\n");
+	}
+	for (i = 0; i < AIO_TEST_QUEUE_DEPTH; i++) {
+		uintptr_t block = i * (AIO_TEST_BLOCKS / AIO_TEST_QUEUE_DEPTH);
+
+		if (AIO_TEST_BLOCK_SIZE != requests[i].result) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "readv %zu result=%zd\n", i, requests[i].result);
+		} else if (0 != memcmp(readData + (block * AIO_TEST_BLOCK_SIZE), writeData + (block * AIO_TEST_BLOCK_SIZE), AIO_TEST_BLOCK_SIZE)) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "readv of block %zu returned the wrong data\n", block);
+		}
+	}
+
+	/* reads into a registered buffer */
+	fixed.buffer = readData;
+	fixed.length = AIO_TEST_BLOCKS * AIO_TEST_BLOCK_SIZE;
+	rc = omrfile_aio_register_buffers(context, &fixed, 1);
+	if (0 != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_aio_register_buffers failed, rc=%zd\n", rc);
+		goto exit;
+	}
+	memset(readData, 0, AIO_TEST_BLOCKS * AIO_TEST_BLOCK_SIZE);
+	for (i = 0; i < AIO_TEST_QUEUE_DEPTH; i++) {
+		uintptr_t length = AIO_TEST_BLOCKS * AIO_TEST_BLOCK_SIZE / AIO_TEST_QUEUE_DEPTH;
+
+		initRequest(&requests[i], fd, OMRPORT_FILE_AIO_READ, (int64_t)(i * length));
+		requests[i].buffer = readData + (i * length);
+		requests[i].length = length;
+		requests[i].fixedBufferIndex = 0;
+		batch[i] = &requests[i];
+	}
+	if (AIO_TEST_QUEUE_DEPTH != omrfile_aio_submit(context, batch, AIO_TEST_QUEUE_DEPTH)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_aio_submit(fixed read) did not accept a full queue\n");
+		goto exit;
+	}
+	omrfile_aio_reap(context, AIO_TEST_QUEUE_DEPTH);
+	for (i = 0; i < AIO_TEST_QUEUE_DEPTH; i++) {
+		if (OMRPORT_FILE_AIO_STATE_COMPLETE != requests[i].state) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "fixed read %zu was not reaped\n", i);
+		}
+	}
+	if (0 != memcmp(readData, writeData, AIO_TEST_BLOCKS * AIO_TEST_BLOCK_SIZE)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "fixed reads returned the wrong data\n");
+	}
+
+	/* invalid requests are refused as a batch, failed ones complete with an error */
+	initRequest(&requests[0], fd, OMRPORT_FILE_AIO_READ, 0);
+	requests[0].buffer = readData;
+	requests[0].length = 1;
+	requests[0].fixedBufferIndex = 1;
+	initRequest(&requests[1], fd, 99, 0);
+	batch[0] = &requests[0];
+	batch[1] = &requests[1];
+	if (OMRPORT_ERROR_FILE_INVAL != omrfile_aio_submit(context, batch, 2)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_aio_submit accepted invalid requests\n");
+		goto exit;
+	}
+	initRequest(&requests[0], -1, OMRPORT_FILE_AIO_READ, 0);
+	requests[0].buffer = readData;
+	requests[0].length = 1;
+	if ((1 != omrfile_aio_submit(context, batch, 1)) || (1 != omrfile_aio_reap(context, 1))) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "read from a bad descriptor was not submitted and reaped\n");
+	} else if (OMRPORT_ERROR_FILE_BADF != requests[0].result) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "read from a bad descriptor returned %zd\n", requests[0].result);
+	}
+
+exit:
+	omrfile_aio_destroy(context);
+	if (-1 != fd) {
+		omrfile_close(fd);
+		omrfile_unlink(fileName);
+	}
+	omrmem_free_memory(writeData);
+	omrmem_free_memory(readData);
+}
+
+/**
+ * @return the time taken to write the file through the context, in nanoseconds, or 0 on error
+ */
+static uint64_t
+timeAsyncWrites(struct OMRPortLibrary *portLibrary, const char *testName, OMRFileAIOContext *context, const char *fileName, uint8_t *data)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	OMRFileAIORequest requests[AIO_TEST_QUEUE_DEPTH];
+	OMRFileAIORequest *idle[AIO_TEST_QUEUE_DEPTH];
+	uintptr_t idleCount = AIO_TEST_QUEUE_DEPTH;
+	uintptr_t next = 0;
+	uintptr_t done = 0;
+	uint64_t start = 0;
+	uint64_t elapsed = 0;
+	intptr_t fd = omrfile_open(fileName, EsOpenCreate | EsOpenWrite | EsOpenTruncate, 0666);
+	uintptr_t i = 0;
+
+	if (-1 == fd) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_open(\"%s\") failed\n", fileName);
+		return 0;
+	}
+	for (i = 0; i < AIO_TEST_QUEUE_DEPTH; i++) {
+		initRequest(&requests[i], fd, OMRPORT_FILE_AIO_WRITE, 0);
+		idle[i] = &requests[i];
+	}
+
+	start = omrtime_nano_time();
+	while (done < AIO_THROUGHPUT_BLOCKS) {
+		intptr_t rc = 0;
+
+		/* keep the queue full, recycling requests as they are reaped */
+		for (i = 0; (i < idleCount) && (next + i < AIO_THROUGHPUT_BLOCKS); i++) {
+			OMRFileAIORequest *request = idle[i];
+
+			initRequest(request, fd, OMRPORT_FILE_AIO_WRITE, (int64_t)((next + i) * AIO_THROUGHPUT_BLOCK_SIZE));
+			request->buffer = data;
+			request->length = AIO_THROUGHPUT_BLOCK_SIZE;
+		}
+		rc = omrfile_aio_submit(context, idle, i);
+		if (rc < 0) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_aio_submit failed, rc=%zd\n", rc);
+			break;
+		}
+		next += (uintptr_t)rc;
+		memmove(idle, idle + rc, (idleCount - (uintptr_t)rc) * sizeof(idle[0]));
+		idleCount -= (uintptr_t)rc;
+
+		rc = omrfile_aio_reap(context, 1);
+		if (rc < 0) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_aio_reap failed, rc=%zd\n", rc);
+			break;
+		}
+		for (i = 0; i < AIO_TEST_QUEUE_DEPTH; i++) {
+			if (OMRPORT_FILE_AIO_STATE_COMPLETE == requests[i].state) {
+				if (AIO_THROUGHPUT_BLOCK_SIZE != requests[i].result) {
+					outputErrorMessage(PORTTEST_ERROR_ARGS, "write result=%zd\n", requests[i].result);
+				}
+				requests[i].state = OMRPORT_FILE_AIO_STATE_IDLE;
+				idle[idleCount] = &requests[i];
+				idleCount += 1;
+				done += 1;
+			}
+		}
+	}
+	elapsed = omrtime_nano_time() - start;
+
+	omrfile_close(fd);
+	omrfile_unlink(fileName);
+	return (done == AIO_THROUGHPUT_BLOCKS) ? elapsed : 0;
+}
+
+static void
+logThroughput(const char *what, uint64_t nanos)
+{
+	uint64_t bytes = (uint64_t)AIO_THROUGHPUT_BLOCKS * AIO_THROUGHPUT_BLOCK_SIZE;
+
+	if (0 != nanos) {
+		portTestEnv->log("%-28s %8llu MB/s\n", what, (unsigned long long)((bytes * 1000) / nanos));
+	}
+}
+
+/**
+ * Verify the blocking async operations work, where they are plain file operations.
+ */
+TEST(PortFileAIOTest, file_aio_test_blockingasync)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrfile_aio_test_blockingasync";
+	const char *fileName = "omrfileaio_blocking.tst";
+	char buffer[32];
+	intptr_t fd = -1;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	fd = omrfile_blockingasync_open(fileName, EsOpenCreate | EsOpenRead | EsOpenWrite | EsOpenTruncate, 0666);
+	if (-1 == fd) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_blockingasync_open(\"%s\") failed\n", fileName);
+		goto exit;
+	}
+	if (11 != omrfile_blockingasync_write(fd, "hello world", 11)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_blockingasync_write failed\n");
+	}
+	if (11 != omrfile_blockingasync_flength(fd)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_blockingasync_flength returned %lld\n", omrfile_blockingasync_flength(fd));
+	}
+	if (0 != omrfile_blockingasync_set_length(fd, 5)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_blockingasync_set_length failed\n");
+	}
+	omrfile_seek(fd, 0, EsSeekSet);
+	memset(buffer, 0, sizeof(buffer));
+	if ((5 != omrfile_blockingasync_read(fd, buffer, sizeof(buffer))) || (0 != strcmp(buffer, "hello"))) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_blockingasync_read returned \"%s\"\n", buffer);
+	}
+	if (0 != omrfile_blockingasync_close(fd)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_blockingasync_close failed\n");
+	}
+	omrfile_unlink(fileName);
+
+exit:
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+/**
+ * Verify batched, vectored and fixed buffer requests with the default backend.
+ */
+TEST(PortFileAIOTest, file_aio_test_default_backend)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrfile_aio_test_default_backend";
+
+	reportTestEntry(OMRPORTLIB, testName);
+	batchedReadWrite(OMRPORTLIB, testName, 0);
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+/**
+ * Verify batched, vectored and fixed buffer requests with worker threads.
+ */
+TEST(PortFileAIOTest, file_aio_test_thread_backend)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrfile_aio_test_thread_backend";
+
+	reportTestEntry(OMRPORTLIB, testName);
+	batchedReadWrite(OMRPORTLIB, testName, OMRPORT_FILE_AIO_FORCE_THREADS);
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+/**
+ * Compare the throughput of asynchronous writes with omrfile_write. Timings are reported, not checked.
+ */
+TEST(PortFileAIOTest, file_aio_test_throughput)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrfile_aio_test_throughput";
+	const char *fileName = "omrfileaio_throughput.tst";
+	OMRFileAIOContext *context = NULL;
+	uint8_t *data = NULL;
+	uint64_t start = 0;
+	intptr_t fd = -1;
+	uintptr_t i = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	data = (uint8_t *)omrmem_allocate_memory(AIO_THROUGHPUT_BLOCK_SIZE, OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == data) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrmem_allocate_memory failed\n");
+		goto exit;
+	}
+	fillBlock(data, AIO_THROUGHPUT_BLOCK_SIZE, 0);
+
+	fd = omrfile_open(fileName, EsOpenCreate | EsOpenWrite | EsOpenTruncate, 0666);
+	if (-1 == fd) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_open(\"%s\") failed\n", fileName);
+		goto exit;
+	}
+	start = omrtime_nano_time();
+	for (i = 0; i < AIO_THROUGHPUT_BLOCKS; i++) {
+		if (AIO_THROUGHPUT_BLOCK_SIZE != omrfile_write(fd, data, AIO_THROUGHPUT_BLOCK_SIZE)) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_write failed\n");
+			break;
+		}
+	}
+	logThroughput("omrfile_write", omrtime_nano_time() - start);
+	omrfile_close(fd);
+	omrfile_unlink(fileName);
+
+	if (createContext(OMRPORTLIB, testName, 0, &context)) {
+		logThroughput((OMRPORT_FILE_AIO_BACKEND_IO_URING == omrfile_aio_backend(context)) ? "omrfile_aio (io_uring)" : "omrfile_aio (threads)",
+				timeAsyncWrites(OMRPORTLIB, testName, context, fileName, data));
+		omrfile_aio_destroy(context);
+		context = NULL;
+	}
+	if (createContext(OMRPORTLIB, testName, OMRPORT_FILE_AIO_FORCE_THREADS, &context)) {
+		logThroughput("omrfile_aio (threads)", timeAsyncWrites(OMRPORTLIB, testName, context, fileName, data));
+		omrfile_aio_destroy(context);
+	}
+
+exit:
+	omrmem_free_memory(data);
+	reportTestExit(OMRPORTLIB, testName);
+}
@@ -38,10 +38,12 @@
  */
 #include <stdlib.h>
 #include <string.h>
+#include <thread>
 #include "omrmemcategories.h"
 
 #include "testHelpers.hpp"
 #include "omrport.h"
+#include "omrthread.h"
 
 extern PortTestEnvironment *portTestEnv;
 
@@ -1517,6 +1519,309 @@ TEST(PortMemTest, mem_test9_category_walk)
 	reportTestExit(OMRPORTLIB, testName);
 }
 
+/**
+ * Verify arena allocation, mark and rewind, reset, and that category accounting is charged per chunk.
+ */
+TEST(PortMemTest, mem_test10_arena)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrmem_test10_arena";
+	struct CategoriesState categoriesState;
+	OMRMemArena *arena = NULL;
+	OMRMemArenaMark mark;
+	uintptr_t initialBlocks = 0;
+	uint8_t *first = NULL;
+	uint8_t *previous = NULL;
+	uintptr_t i = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	omrport_control(OMRPORT_CTLDATA_MEM_CATEGORIES_SET, 0);
+
+	arena = omrmem_arena_create(4096, OMRMEM_CATEGORY_PORT_LIBRARY, NULL);
+	if (NULL == arena) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrmem_arena_create failed\n");
+		goto exit;
+	}
+
+	getCategoriesState(OMRPORTLIB, &categoriesState);
+	initialBlocks = categoriesState.portLibraryBlocks;
+
+	/* many small allocations from one chunk cost a single block */
+	for (i = 0; i < 100; i++) {
+		uint8_t *ptr = (uint8_t *)omrmem_arena_allocate(arena, 13);
+		if (NULL == ptr) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrmem_arena_allocate failed\n");
+			goto exit;
+		}
+		if (0 != ((uintptr_t)ptr & (sizeof(uint64_t) - 1))) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "arena allocation %p is not 8-byte aligned\n", ptr);
+		}
+		if ((NULL != previous) && (ptr != (previous + 16))) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "arena allocation %p does not follow %p\n", ptr, previous);
+		}
+		memset(ptr, 0xAB, 13);
+		if (NULL == first) {
+			first = ptr;
+		}
+		previous = ptr;
+	}
+	getCategoriesState(OMRPORTLIB, &categoriesState);
+	if ((initialBlocks + 1) != categoriesState.portLibraryBlocks) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Expected %zu blocks after 100 arena allocations, got %zu\n", initialBlocks + 1, categoriesState.portLibraryBlocks);
+	}
+
+	/* allocations after a mark are discarded by rewinding, including ones that spilled into new chunks */
+	omrmem_arena_mark(arena, &mark);
+	previous = (uint8_t *)omrmem_arena_allocate(arena, 8);
+	for (i = 0; i < 10; i++) {
+		if (NULL == omrmem_arena_allocate(arena, 1000)) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrmem_arena_allocate failed\n");
+			goto exit;
+		}
+	}
+	if (NULL == omrmem_arena_allocate(arena, 100000)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "large omrmem_arena_allocate failed\n");
+		goto exit;
+	}
+	omrmem_arena_rewind(arena, &mark);
+	if (previous != omrmem_arena_allocate(arena, 8)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "rewind did not restore the arena position\n");
+	}
+	getCategoriesState(OMRPORTLIB, &categoriesState);
+	if ((initialBlocks + 1) != categoriesState.portLibraryBlocks) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Expected %zu blocks after rewind, got %zu\n", initialBlocks + 1, categoriesState.portLibraryBlocks);
+	}
+
+	/* reset keeps the first chunk and starts over from its beginning */
+	omrmem_arena_reset(arena);
+	if (first != omrmem_arena_allocate(arena, 1)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "reset did not rewind to the first chunk\n");
+	}
+
+	/* release gives every chunk back */
+	omrmem_arena_release(arena);
+	getCategoriesState(OMRPORTLIB, &categoriesState);
+	if (initialBlocks != categoriesState.portLibraryBlocks) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Expected %zu blocks after release, got %zu\n", initialBlocks, categoriesState.portLibraryBlocks);
+	}
+
+exit:
+	omrmem_arena_destroy(arena);
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+/**
+ * Verify that arenas sharing a pool recycle chunks rather than freeing them.
+ */
+TEST(PortMemTest, mem_test11_arena_pool)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrmem_test11_arena_pool";
+	OMRMemArenaPool *pool = NULL;
+	OMRMemArena *arena1 = NULL;
+	OMRMemArena *arena2 = NULL;
+	void *chunkMemory = NULL;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	pool = omrmem_arena_pool_create(4096, 4, OMRMEM_CATEGORY_PORT_LIBRARY);
+	arena1 = omrmem_arena_create(0, OMRMEM_CATEGORY_UNKNOWN, pool);
+	arena2 = omrmem_arena_create(0, OMRMEM_CATEGORY_UNKNOWN, pool);
+	if ((NULL == pool) || (NULL == arena1) || (NULL == arena2)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "failed to create the pool or arenas\n");
+		goto exit;
+	}
+
+	chunkMemory = omrmem_arena_allocate(arena1, 64);
+	if (NULL == chunkMemory) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrmem_arena_allocate failed\n");
+		goto exit;
+	}
+	omrmem_arena_release(arena1);
+	if (chunkMemory != omrmem_arena_allocate(arena2, 64)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "the released chunk was not reused from the pool\n");
+	}
+
+exit:
+	omrmem_arena_destroy(arena1);
+	omrmem_arena_destroy(arena2);
+	omrmem_arena_pool_destroy(pool);
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+/**
+ * Verify that each thread has one scratch arena.
+ */
+TEST(PortMemTest, mem_test12_arena_thread_scratch)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrmem_test12_arena_thread_scratch";
+	OMRMemArena *arena = omrmem_arena_thread_scratch();
+	OMRMemArenaMark mark;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	if (NULL == arena) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrmem_arena_thread_scratch failed\n");
+	} else {
+		if (arena != omrmem_arena_thread_scratch()) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrmem_arena_thread_scratch returned a different arena\n");
+		}
+		omrmem_arena_mark(arena, &mark);
+		if (NULL == omrmem_arena_allocate(arena, 128)) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "scratch arena allocation failed\n");
+		}
+		omrmem_arena_rewind(arena, &mark);
+	}
+
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+#define CATEGORY_COUNTER_BLOCKS 3000
+
+typedef struct CategoryCounterThreadData {
+	OMRPortLibrary *portLibrary;
+	void *blocks[CATEGORY_COUNTER_BLOCKS];
+} CategoryCounterThreadData;
+
+static int J9THREAD_PROC
+categoryCounterAllocator(void *entryArg)
+{
+	CategoryCounterThreadData *data = (CategoryCounterThreadData *)entryArg;
+	OMRPORT_ACCESS_FROM_OMRPORT(data->portLibrary);
+	uintptr_t i = 0;
+
+	for (i = 0; i < CATEGORY_COUNTER_BLOCKS; i++) {
+		data->blocks[i] = omrmem_allocate_memory(16, OMRMEM_CATEGORY_PORT_LIBRARY);
+	}
+	return 0;
+}
+
+/**
+ * Verify that counters updated through the per thread caches are exact when queried, including
+ * blocks allocated by a thread that has since exited and freed by another thread.
+ */
+TEST(PortMemTest, mem_test13_category_counters)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrmem_test13_category_counters";
+	CategoryCounterThreadData *data = NULL;
+	omrthread_t thread = NULL;
+	omrthread_attr_t attr = NULL;
+	uintptr_t initialBytes = 0;
+	uintptr_t initialBlocks = 0;
+	uintptr_t bytes = 0;
+	uintptr_t blocks = 0;
+	uintptr_t i = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	if (OMRPORT_ERROR_INVALID_ARGUMENTS != omrmem_get_category_counters(OMRMEM_CATEGORY_PORT_LIBRARY, NULL, &blocks)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrmem_get_category_counters accepted a NULL pointer\n");
+	}
+
+	data = (CategoryCounterThreadData *)omrmem_allocate_memory(sizeof(CategoryCounterThreadData), OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == data) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Unexpected native OOM\n");
+		goto exit;
+	}
+	memset(data, 0, sizeof(CategoryCounterThreadData));
+	data->portLibrary = OMRPORTLIB;
+	omrmem_get_category_counters(OMRMEM_CATEGORY_PORT_LIBRARY, &initialBytes, &initialBlocks);
+
+	if ((J9THREAD_SUCCESS != omrthread_attr_init(&attr))
+		|| (J9THREAD_SUCCESS != omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE))
+		|| (J9THREAD_SUCCESS != omrthread_create_ex(&thread, &attr, 0, categoryCounterAllocator, data))) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Failed to create the allocating thread\n");
+		omrthread_attr_destroy(&attr);
+		goto exit;
+	}
+	omrthread_attr_destroy(&attr);
+	omrthread_join(thread);
+
+	omrmem_get_category_counters(OMRMEM_CATEGORY_PORT_LIBRARY, &bytes, &blocks);
+	if (blocks != (initialBlocks + CATEGORY_COUNTER_BLOCKS)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Expected %zu blocks after the thread exited, got %zu\n", initialBlocks + CATEGORY_COUNTER_BLOCKS, blocks);
+	}
+	if (bytes < (initialBytes + (CATEGORY_COUNTER_BLOCKS * 16))) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Expected at least %zu bytes after the thread exited, got %zu\n", initialBytes + (CATEGORY_COUNTER_BLOCKS * 16), bytes);
+	}
+
+	for (i = 0; i < CATEGORY_COUNTER_BLOCKS; i++) {
+		omrmem_free_memory(data->blocks[i]);
+	}
+	omrmem_get_category_counters(OMRMEM_CATEGORY_PORT_LIBRARY, &bytes, &blocks);
+	if ((blocks != initialBlocks) || (bytes != initialBytes)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Expected %zu blocks and %zu bytes after freeing, got %zu and %zu\n", initialBlocks, initialBytes, blocks, bytes);
+	}
+
+exit:
+	omrmem_free_memory(data);
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+typedef struct UnattachedCategoryData {
+	OMRPortLibrary *portLibrary;
+	uintptr_t categoriesWalked;
+	int32_t queryResult;
+	uintptr_t bytes;
+	uintptr_t blocks;
+} UnattachedCategoryData;
+
+static uintptr_t
+unattachedCategoryWalkFunction(uint32_t categoryCode, const char *categoryName, uintptr_t liveBytes, uintptr_t liveAllocations, BOOLEAN isRoot, uint32_t parentCategoryCode, OMRMemCategoryWalkState *walkState)
+{
+	((UnattachedCategoryData *)walkState->userData1)->categoriesWalked += 1;
+	return J9MEM_CATEGORIES_KEEP_ITERATING;
+}
+
+static void
+unattachedCategoryQuery(UnattachedCategoryData *data)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(data->portLibrary);
+	OMRMemCategoryWalkState walkState;
+	void *block = NULL;
+
+	memset(&walkState, 0, sizeof(OMRMemCategoryWalkState));
+	walkState.userData1 = data;
+	walkState.walkFunction = &unattachedCategoryWalkFunction;
+	omrmem_walk_categories(&walkState);
+
+	block = omrmem_allocate_memory(16, OMRMEM_CATEGORY_PORT_LIBRARY);
+	data->queryResult = omrmem_get_category_counters(OMRMEM_CATEGORY_PORT_LIBRARY, &data->bytes, &data->blocks);
+	omrmem_free_memory(block);
+}
+
+/**
+ * Verify that a thread that is not attached to the thread library can walk and query the
+ * memory categories, and allocate and free in them.
+ */
+TEST(PortMemTest, mem_test14_category_counters_unattached)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrmem_test14_category_counters_unattached";
+	UnattachedCategoryData data;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	memset(&data, 0, sizeof(UnattachedCategoryData));
+	data.portLibrary = OMRPORTLIB;
+	data.queryResult = -1;
+
+	std::thread unattachedThread(unattachedCategoryQuery, &data);
+	unattachedThread.join();
+
+	if (0 == data.categoriesWalked) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "The walk from an unattached thread visited no categories\n");
+	}
+	if (0 != data.queryResult) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrmem_get_category_counters from an unattached thread returned %d\n", data.queryResult);
+	}
+
+	reportTestExit(OMRPORTLIB, testName);
+}
+
 /* attempt to free all mem pointers stored in memPtrs array with length */
 static void
 freeMemPointers(struct OMRPortLibrary *portLibrary, void **memPtrs, uintptr_t length)
@@ -2180,6 +2180,217 @@ TEST_F(PortMmapTest, mmap_testDontNeed)
 	reportTestExit(OMRPORTLIB, testName);
 }
 
+/**
+ * Create filename holding length bytes of a pattern that identifies each byte's offset.
+ *
+ * @return TRUE on success
+ */
+static BOOLEAN
+createPatternFile(struct OMRPortLibrary *portLibrary, const char *testName, const char *filename, uintptr_t length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	uint8_t buffer[4096];
+	uintptr_t written = 0;
+	intptr_t fd = -1;
+
+	omrfile_unlink(filename);
+	fd = omrfile_open(filename, EsOpenCreateNew | EsOpenRead | EsOpenWrite, 0660);
+	if (-1 == fd) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Create of file %s failed: lastErrorNumber=%d, lastErrorMessage=%s\n", filename, omrerror_last_error_number(), omrerror_last_error_message());
+		return FALSE;
+	}
+	while (written < length) {
+		uintptr_t chunk = OMR_MIN(length - written, sizeof(buffer));
+		uintptr_t i = 0;
+		for (i = 0; i < chunk; i++) {
+			uintptr_t offset = written + i;
+			buffer[i] = (uint8_t)(offset ^ (offset >> 8) ^ (offset >> 16));
+		}
+		if ((intptr_t)chunk != omrfile_write(fd, buffer, (intptr_t)chunk)) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "Write to file %s failed: lastErrorNumber=%d, lastErrorMessage=%s\n", filename, omrerror_last_error_number(), omrerror_last_error_message());
+			omrfile_close(fd);
+			return FALSE;
+		}
+		written += chunk;
+	}
+	omrfile_close(fd);
+	return TRUE;
+}
+
+/**
+ * @return TRUE if the length bytes at data match the pattern written by createPatternFile for offset
+ */
+static BOOLEAN
+matchesPattern(const uint8_t *data, uint64_t offset, uintptr_t length)
+{
+	uintptr_t i = 0;
+	for (i = 0; i < length; i++) {
+		uint64_t fileOffset = offset + i;
+		if ((uint8_t)(fileOffset ^ (fileOffset >> 8) ^ (fileOffset >> 16)) != data[i]) {
+			return FALSE;
+		}
+	}
+	return TRUE;
+}
+
+/**
+ * Verify port memory mapping.
+ *
+ * Verify @ref omrmmap.c::omrmmap_map_file "omrmmap_map_file()" maps the file with access
+ * hints and population requested, and @ref omrmmap.c::omrmmap_advise "omrmmap_advise()"
+ * accepts the hints the platform reports it supports.
+ */
+TEST_F(PortMmapTest, mmap_testAdvise)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrmmap_testAdvise";
+	const char *filename = "mmapTestAdvise.tst";
+	const uintptr_t fileLength = 3 * 4096 + 17;
+	uintptr_t capabilities = omrmmap_capabilities();
+	J9MmapHandle *mmapHandle = NULL;
+	intptr_t fd = -1;
+	int32_t rc = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	if (!createPatternFile(OMRPORTLIB, testName, filename, fileLength)) {
+		goto exit;
+	}
+	fd = omrfile_open(filename, EsOpenRead, 0660);
+	if (-1 == fd) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Open of file %s for mapping failed: lastErrorNumber=%d, lastErrorMessage=%s\n", filename, omrerror_last_error_number(), omrerror_last_error_message());
+		goto exit;
+	}
+
+	mmapHandle = omrmmap_map_file(fd, 0, fileLength, NULL,
+			OMRPORT_MMAP_FLAG_READ | OMRPORT_MMAP_FLAG_ADVISE_SEQUENTIAL | OMRPORT_MMAP_FLAG_ADVISE_WILLNEED | OMRPORT_MMAP_FLAG_POPULATE,
+			OMRMEM_CATEGORY_PORT_LIBRARY);
+	if ((NULL == mmapHandle) || (NULL == mmapHandle->pointer)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Mmap_map_file of file %s failed: lastErrorNumber=%d, lastErrorMessage=%s\n", filename, omrerror_last_error_number(), omrerror_last_error_message());
+		omrfile_close(fd);
+		goto exit;
+	}
+	omrfile_close(fd);
+
+	if (!matchesPattern((uint8_t *)mmapHandle->pointer, 0, fileLength)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Data does not match in mapped area\n");
+	}
+
+	rc = omrmmap_advise(mmapHandle->pointer, fileLength, OMRPORT_MMAP_FLAG_ADVISE_SEQUENTIAL | OMRPORT_MMAP_FLAG_ADVISE_RANDOM);
+	if (OMRPORT_ERROR_MMAP_MAP_FILE_INVALIDFLAGS != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrmmap_advise accepted conflicting hints: rc=%d\n", rc);
+	}
+	rc = omrmmap_advise((uint8_t *)mmapHandle->pointer + 4096 + 1, 4096, OMRPORT_MMAP_FLAG_ADVISE_RANDOM | OMRPORT_MMAP_FLAG_ADVISE_WILLNEED);
+	if (OMR_ARE_ANY_BITS_SET(capabilities, OMRPORT_MMAP_CAPABILITY_ADVISE)) {
+		if (0 != rc) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrmmap_advise failed: rc=%d, lastErrorMessage=%s\n", rc, omrerror_last_error_message());
+		}
+	} else if (OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrmmap_advise returned %d without OMRPORT_MMAP_CAPABILITY_ADVISE\n", rc);
+	}
+	/* huge pages depend on the file system, so only check the hint is harmless */
+	omrmmap_advise(mmapHandle->pointer, fileLength, OMRPORT_MMAP_FLAG_HUGE_PAGES);
+
+	if (!matchesPattern((uint8_t *)mmapHandle->pointer, 0, fileLength)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Data does not match in mapped area after advice\n");
+	}
+
+	omrmmap_unmap_file(mmapHandle);
+
+exit:
+	omrfile_unlink(filename);
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+/**
+ * Verify port memory mapping.
+ *
+ * Verify @ref omrmmapwindow.c::omrmmap_window_map "omrmmap_window_map()" returns the file
+ * data at each offset asked for as the window slides through the file sequentially, and
+ * when it is moved back and forth across window boundaries.
+ */
+TEST_F(PortMmapTest, mmap_testWindow)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrmmap_testWindow";
+	const char *filename = "mmapTestWindow.tst";
+	const uintptr_t fileLength = 5 * OMRPORT_MMAP_WINDOW_ALIGNMENT + 123;
+	const uint64_t randomOffsets[] = { 3 * OMRPORT_MMAP_WINDOW_ALIGNMENT - 10, 10, fileLength - 1, OMRPORT_MMAP_WINDOW_ALIGNMENT, 2 * OMRPORT_MMAP_WINDOW_ALIGNMENT + 7 };
+	const uint32_t windowFlags[] = { OMRPORT_MMAP_FLAG_READ | OMRPORT_MMAP_FLAG_ADVISE_SEQUENTIAL, OMRPORT_MMAP_FLAG_READ | OMRPORT_MMAP_FLAG_ADVISE_RANDOM };
+	J9MmapWindow *window = NULL;
+	intptr_t fd = -1;
+	uintptr_t i = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	if (OMR_ARE_NO_BITS_SET(omrmmap_capabilities(), OMRPORT_MMAP_CAPABILITY_READ)) {
+		portTestEnv->log("omrmmap windows are not supported on this platform\n");
+		goto exit;
+	}
+	if (!createPatternFile(OMRPORTLIB, testName, filename, fileLength)) {
+		goto exit;
+	}
+	fd = omrfile_open(filename, EsOpenRead, 0660);
+	if (-1 == fd) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Open of file %s for mapping failed: lastErrorNumber=%d, lastErrorMessage=%s\n", filename, omrerror_last_error_number(), omrerror_last_error_message());
+		goto exit;
+	}
+
+	for (i = 0; i < sizeof(windowFlags) / sizeof(windowFlags[0]); i++) {
+		uint64_t offset = 0;
+		uintptr_t length = 0;
+		uintptr_t j = 0;
+		uint8_t *data = NULL;
+
+		window = omrmmap_window_open(fd, OMRPORT_MMAP_WINDOW_ALIGNMENT, windowFlags[i], OMRMEM_CATEGORY_PORT_LIBRARY);
+		if (NULL == window) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrmmap_window_open failed: lastErrorNumber=%d, lastErrorMessage=%s\n", omrerror_last_error_number(), omrerror_last_error_message());
+			break;
+		}
+
+		/* read through the file in records that straddle window boundaries */
+		while (offset < fileLength) {
+			length = 1000;
+			data = (uint8_t *)omrmmap_window_map(window, offset, &length);
+			if ((NULL == data) || (length < OMR_MIN(1000, fileLength - offset))) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "omrmmap_window_map at %llu returned %p, length %zu\n", (unsigned long long)offset, data, length);
+				break;
+			}
+			if (!matchesPattern(data, offset, OMR_MIN(1000, length))) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "Data does not match at offset %llu\n", (unsigned long long)offset);
+				break;
+			}
+			offset += 1000;
+		}
+
+		for (j = 0; j < sizeof(randomOffsets) / sizeof(randomOffsets[0]); j++) {
+			length = 64;
+			data = (uint8_t *)omrmmap_window_map(window, randomOffsets[j], &length);
+			if ((NULL == data) || (length < OMR_MIN(64, fileLength - randomOffsets[j])) || (length > (fileLength - randomOffsets[j]))) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "omrmmap_window_map at %llu returned %p, length %zu\n", (unsigned long long)randomOffsets[j], data, length);
+			} else if (!matchesPattern(data, randomOffsets[j], OMR_MIN(64, length))) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "Data does not match at offset %llu\n", (unsigned long long)randomOffsets[j]);
+			}
+		}
+
+		length = 16;
+		if (NULL != omrmmap_window_map(window, fileLength, &length)) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrmmap_window_map returned data past the end of the file\n");
+		}
+		if (0 != length) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrmmap_window_map returned length %zu past the end of the file\n", length);
+		}
+
+		omrmmap_window_close(window);
+		window = NULL;
+	}
+	omrfile_close(fd);
+
+exit:
+	omrfile_unlink(filename);
+	reportTestExit(OMRPORTLIB, testName);
+}
+
 int32_t
 omrmmap_runTests(struct OMRPortLibrary *portLibrary, char *argv0, char *omrmmap_child)
 {
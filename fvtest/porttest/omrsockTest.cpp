@@ -24,6 +24,7 @@
 #include "omrporterror.h"
 #include "omrportsock.h"
 #include "omrportsocktypes.h"
+#include "omrthread.h"
 #include "testHelpers.hpp"
 
 /**
@@ -157,6 +158,16 @@ TEST(PortSockTest, library_function_pointers_not_null)
 	EXPECT_NE(OMRPORTLIB->sock_getsockopt_int, (void *)NULL);
 	EXPECT_NE(OMRPORTLIB->sock_getsockopt_linger, (void *)NULL);
 	EXPECT_NE(OMRPORTLIB->sock_getsockopt_timeval, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_eventloop_create, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_eventloop_add, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_eventloop_modify, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_eventloop_remove, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_eventloop_wait, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_eventloop_wakeup, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_eventloop_destroy, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_sendmmsg, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_recvmmsg, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_zerocopy_complete, (void *)NULL);
 }
 
 /**
@@ -1324,3 +1335,493 @@ TEST(PortSockTest, poll_functionality_many_sockets)
 		EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &sockets[i]), 0);
 	}
 }
+
+/**
+ * Test @ref omrsock_eventloop_wait with a loopback connection.
+ *
+ * The server end of the connection is watched edge triggered, so it is reported once per
+ * message sent by the client, not for as long as there is data to read. It is then watched
+ * one shot for OMRSOCK_POLLOUT, which is reported once until the socket is re-armed.
+ * Finally, @ref omrsock_eventloop_wakeup must make a wait without a timeout return.
+ */
+TEST(PortSockTest, eventloop_edge_triggered_and_oneshot)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	OMRSockAddrStorage serverSockAddr;
+	omrsock_socket_t serverSocket = NULL;
+	OMRSockAddrStorage clientSockAddr;
+	omrsock_socket_t clientSocket = NULL;
+	OMRSockAddrStorage connectedServerSockAddr;
+	omrsock_socket_t connectedServerSocket = NULL;
+	omrsock_eventloop_t loop = NULL;
+	OMRSockEvent events[4];
+	uint16_t port = 4930;
+	uint32_t inaddrAny;
+	uint8_t serverAddr[4];
+	int32_t userData = 0;
+	int32_t rc = 0;
+
+	rc = OMRPORTLIB->sock_eventloop_create(OMRPORTLIB, &loop);
+	if (OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM == rc) {
+		portTestEnv->log("omrsock event loops are not supported on this platform\n");
+		return;
+	}
+	ASSERT_EQ(rc, 0);
+
+	/* To Create a Server Socket and Address */
+	inaddrAny = OMRPORTLIB->sock_htonl(OMRPORTLIB, OMRSOCK_INADDR_ANY);
+	memcpy(serverAddr, &inaddrAny, 4);
+	EXPECT_EQ(OMRPORTLIB->sock_sockaddr_init(OMRPORTLIB, &serverSockAddr, OMRSOCK_AF_INET, serverAddr, OMRPORTLIB->sock_htons(OMRPORTLIB, port)), 0);
+	start_server(OMRPORTLIB, OMRSOCK_AF_INET, OMRSOCK_STREAM, &serverSocket, &serverSockAddr);
+
+	/* To Create a Client Socket and Address */
+	connect_client_to_server(OMRPORTLIB, "localhost", NULL, OMRSOCK_AF_INET, OMRSOCK_STREAM, &clientSocket, &clientSockAddr, &serverSockAddr);
+
+	/* Accept Connection */
+	ASSERT_EQ(OMRPORTLIB->sock_accept(OMRPORTLIB, serverSocket, &connectedServerSockAddr, &connectedServerSocket), 0);
+	ASSERT_EQ(OMRPORTLIB->sock_fcntl(OMRPORTLIB, connectedServerSocket, OMRSOCK_O_NONBLOCK), 0);
+
+	ASSERT_EQ(OMRPORTLIB->sock_eventloop_add(OMRPORTLIB, loop, connectedServerSocket, OMRSOCK_POLLIN | OMRSOCK_EVENT_EDGE_TRIGGERED, &userData), 0);
+	/* A socket can only be added once. */
+	EXPECT_EQ(OMRPORTLIB->sock_eventloop_add(OMRPORTLIB, loop, connectedServerSocket, OMRSOCK_POLLIN, NULL), OMRPORT_ERROR_INVALID_ARGUMENTS);
+	EXPECT_EQ(OMRPORTLIB->sock_eventloop_wait(OMRPORTLIB, loop, events, 4, 100), 0);
+
+	const char *msg = "This is an omrsock test for event loops.";
+	int32_t msgLength = strlen(msg) + 1;
+	char buf[100] = {0};
+
+	for (int32_t round = 0; round < 2; round++) {
+		ASSERT_EQ(OMRPORTLIB->sock_send(OMRPORTLIB, clientSocket, (uint8_t *)msg, msgLength, 0), msgLength);
+
+		/* Give the message up to 10 waits to arrive. */
+		for (int32_t i = 0; i < 10; i++) {
+			if (0 != (rc = OMRPORTLIB->sock_eventloop_wait(OMRPORTLIB, loop, events, 4, 1000))) {
+				break;
+			}
+		}
+		ASSERT_EQ(rc, 1);
+		EXPECT_EQ(events[0].socket, connectedServerSocket);
+		EXPECT_EQ(events[0].userData, (void *)&userData);
+		EXPECT_NE(events[0].events & OMRSOCK_POLLIN, 0U);
+
+		/* The data has not been read, but the socket is not reported again until more arrives. */
+		EXPECT_EQ(OMRPORTLIB->sock_eventloop_wait(OMRPORTLIB, loop, events, 4, 100), 0);
+
+		/* Read until the socket would block, as edge triggered sockets must be. */
+		int32_t bytesRecv = 0;
+		int32_t totalRecv = 0;
+		while (0 < (bytesRecv = OMRPORTLIB->sock_recv(OMRPORTLIB, connectedServerSocket, (uint8_t *)buf + totalRecv, sizeof(buf) - totalRecv, 0))) {
+			totalRecv += bytesRecv;
+		}
+		EXPECT_EQ(OMRPORTLIB->error_last_error_number(OMRPORTLIB), OMRPORT_ERROR_SOCKET_WOULDBLOCK);
+		EXPECT_EQ(totalRecv, msgLength);
+		EXPECT_STREQ(msg, buf);
+	}
+
+	/* One shot: OMRSOCK_POLLOUT is reported once, then again after the socket is re-armed. */
+	ASSERT_EQ(OMRPORTLIB->sock_eventloop_modify(OMRPORTLIB, loop, connectedServerSocket, OMRSOCK_POLLOUT | OMRSOCK_EVENT_ONESHOT, NULL), 0);
+	ASSERT_EQ(OMRPORTLIB->sock_eventloop_wait(OMRPORTLIB, loop, events, 4, 1000), 1);
+	EXPECT_EQ(events[0].socket, connectedServerSocket);
+	EXPECT_EQ(events[0].userData, (void *)NULL);
+	EXPECT_NE(events[0].events & OMRSOCK_POLLOUT, 0U);
+	EXPECT_EQ(OMRPORTLIB->sock_eventloop_wait(OMRPORTLIB, loop, events, 4, 100), 0);
+	ASSERT_EQ(OMRPORTLIB->sock_eventloop_modify(OMRPORTLIB, loop, connectedServerSocket, OMRSOCK_POLLOUT | OMRSOCK_EVENT_ONESHOT, &userData), 0);
+	ASSERT_EQ(OMRPORTLIB->sock_eventloop_wait(OMRPORTLIB, loop, events, 4, 1000), 1);
+	EXPECT_EQ(events[0].userData, (void *)&userData);
+
+	/* A wakeup makes a wait without a timeout return without events. */
+	EXPECT_EQ(OMRPORTLIB->sock_eventloop_wakeup(OMRPORTLIB, loop), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_eventloop_wait(OMRPORTLIB, loop, events, 4, -1), 0);
+
+	EXPECT_EQ(OMRPORTLIB->sock_eventloop_remove(OMRPORTLIB, loop, connectedServerSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_eventloop_remove(OMRPORTLIB, loop, connectedServerSocket), OMRPORT_ERROR_INVALID_ARGUMENTS);
+	EXPECT_EQ(OMRPORTLIB->sock_eventloop_destroy(OMRPORTLIB, &loop), 0);
+	EXPECT_EQ(loop, (omrsock_eventloop_t)NULL);
+
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &serverSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &clientSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &connectedServerSocket), 0);
+}
+
+typedef struct EventLoopWaiterData {
+	OMRPortLibrary *portLibrary;
+	omrsock_eventloop_t loop;
+	omrsock_socket_t socket;
+	void *userData;
+	volatile uintptr_t stop;
+	uintptr_t badEvents;
+} EventLoopWaiterData;
+
+static int J9THREAD_PROC
+eventLoopWaiter(void *entryArg)
+{
+	EventLoopWaiterData *data = (EventLoopWaiterData *)entryArg;
+	OMRPortLibrary *portLibrary = data->portLibrary;
+	OMRSockEvent events[4];
+
+	while (0 == data->stop) {
+		int32_t numEvents = portLibrary->sock_eventloop_wait(portLibrary, data->loop, events, 4, 100);
+		for (int32_t i = 0; i < numEvents; i++) {
+			if ((events[i].socket != data->socket) || (events[i].userData != data->userData)) {
+				data->badEvents += 1;
+			}
+		}
+	}
+	return 0;
+}
+
+/**
+ * Test @ref omrsock_eventloop_remove while another thread waits on the loop.
+ *
+ * The server end of a loopback connection has unread data, so the waiting thread is given it
+ * almost every time it waits, while this thread removes it and adds it again. Every event must
+ * still report the socket and user data it was added with.
+ */
+TEST(PortSockTest, eventloop_remove_while_waiting)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	OMRSockAddrStorage serverSockAddr;
+	omrsock_socket_t serverSocket = NULL;
+	OMRSockAddrStorage clientSockAddr;
+	omrsock_socket_t clientSocket = NULL;
+	OMRSockAddrStorage connectedServerSockAddr;
+	omrsock_socket_t connectedServerSocket = NULL;
+	omrsock_eventloop_t loop = NULL;
+	EventLoopWaiterData data;
+	omrthread_attr_t attr = NULL;
+	omrthread_t waiter = NULL;
+	uint16_t port = 4930;
+	uint32_t inaddrAny;
+	uint8_t serverAddr[4];
+	int32_t userData = 0;
+	int32_t rc = 0;
+
+	rc = OMRPORTLIB->sock_eventloop_create(OMRPORTLIB, &loop);
+	if (OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM == rc) {
+		portTestEnv->log("omrsock event loops are not supported on this platform\n");
+		return;
+	}
+	ASSERT_EQ(rc, 0);
+
+	/* To Create a Server Socket and Address */
+	inaddrAny = OMRPORTLIB->sock_htonl(OMRPORTLIB, OMRSOCK_INADDR_ANY);
+	memcpy(serverAddr, &inaddrAny, 4);
+	EXPECT_EQ(OMRPORTLIB->sock_sockaddr_init(OMRPORTLIB, &serverSockAddr, OMRSOCK_AF_INET, serverAddr, OMRPORTLIB->sock_htons(OMRPORTLIB, port)), 0);
+	start_server(OMRPORTLIB, OMRSOCK_AF_INET, OMRSOCK_STREAM, &serverSocket, &serverSockAddr);
+
+	/* To Create a Client Socket and Address */
+	connect_client_to_server(OMRPORTLIB, "localhost", NULL, OMRSOCK_AF_INET, OMRSOCK_STREAM, &clientSocket, &clientSockAddr, &serverSockAddr);
+
+	/* Accept Connection */
+	ASSERT_EQ(OMRPORTLIB->sock_accept(OMRPORTLIB, serverSocket, &connectedServerSockAddr, &connectedServerSocket), 0);
+
+	const char *msg = "This is an omrsock test for event loops.";
+	int32_t msgLength = strlen(msg) + 1;
+	ASSERT_EQ(OMRPORTLIB->sock_send(OMRPORTLIB, clientSocket, (uint8_t *)msg, msgLength, 0), msgLength);
+	ASSERT_EQ(OMRPORTLIB->sock_eventloop_add(OMRPORTLIB, loop, connectedServerSocket, OMRSOCK_POLLIN, &userData), 0);
+
+	memset(&data, 0, sizeof(data));
+	data.portLibrary = OMRPORTLIB;
+	data.loop = loop;
+	data.socket = connectedServerSocket;
+	data.userData = &userData;
+	ASSERT_EQ(omrthread_attr_init(&attr), J9THREAD_SUCCESS);
+	ASSERT_EQ(omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE), J9THREAD_SUCCESS);
+	ASSERT_EQ(omrthread_create_ex(&waiter, &attr, 0, eventLoopWaiter, &data), J9THREAD_SUCCESS);
+	omrthread_attr_destroy(&attr);
+
+	for (int32_t i = 0; i < 10000; i++) {
+		EXPECT_EQ(OMRPORTLIB->sock_eventloop_remove(OMRPORTLIB, loop, connectedServerSocket), 0);
+		EXPECT_EQ(OMRPORTLIB->sock_eventloop_add(OMRPORTLIB, loop, connectedServerSocket, OMRSOCK_POLLIN, &userData), 0);
+	}
+
+	data.stop = 1;
+	EXPECT_EQ(OMRPORTLIB->sock_eventloop_wakeup(OMRPORTLIB, loop), 0);
+	omrthread_join(waiter);
+	EXPECT_EQ(data.badEvents, 0U);
+
+	EXPECT_EQ(OMRPORTLIB->sock_eventloop_remove(OMRPORTLIB, loop, connectedServerSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_eventloop_destroy(OMRPORTLIB, &loop), 0);
+
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &serverSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &clientSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &connectedServerSocket), 0);
+}
+
+#define EVENTLOOP_RECLAIM_WAITERS 2
+
+/**
+ * Test that the registrations of removed sockets are freed while other threads keep waiting on
+ * the loop.
+ *
+ * The waiting threads are never given an event, and start at different times, so each returns when
+ * it times out while the others are still waiting. The port library blocks left live after a socket
+ * is removed and added again many times must drop back to the ones the loop had to begin with.
+ */
+TEST(PortSockTest, eventloop_remove_frees_while_waiting)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	OMRSockAddrStorage serverSockAddr;
+	omrsock_socket_t serverSocket = NULL;
+	OMRSockAddrStorage clientSockAddr;
+	omrsock_socket_t clientSocket = NULL;
+	OMRSockAddrStorage connectedServerSockAddr;
+	omrsock_socket_t connectedServerSocket = NULL;
+	omrsock_eventloop_t loop = NULL;
+	EventLoopWaiterData data[EVENTLOOP_RECLAIM_WAITERS];
+	omrthread_t waiters[EVENTLOOP_RECLAIM_WAITERS];
+	omrthread_attr_t attr = NULL;
+	uint16_t port = 4930;
+	uint32_t inaddrAny;
+	uint8_t serverAddr[4];
+	int32_t userData = 0;
+	uintptr_t initialBytes = 0;
+	uintptr_t initialBlocks = 0;
+	uintptr_t bytes = 0;
+	uintptr_t blocks = 0;
+	int32_t rc = 0;
+	int32_t i = 0;
+
+	rc = OMRPORTLIB->sock_eventloop_create(OMRPORTLIB, &loop);
+	if (OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM == rc) {
+		portTestEnv->log("omrsock event loops are not supported on this platform\n");
+		return;
+	}
+	ASSERT_EQ(rc, 0);
+
+	/* To Create a Server Socket and Address */
+	inaddrAny = OMRPORTLIB->sock_htonl(OMRPORTLIB, OMRSOCK_INADDR_ANY);
+	memcpy(serverAddr, &inaddrAny, 4);
+	EXPECT_EQ(OMRPORTLIB->sock_sockaddr_init(OMRPORTLIB, &serverSockAddr, OMRSOCK_AF_INET, serverAddr, OMRPORTLIB->sock_htons(OMRPORTLIB, port)), 0);
+	start_server(OMRPORTLIB, OMRSOCK_AF_INET, OMRSOCK_STREAM, &serverSocket, &serverSockAddr);
+
+	/* To Create a Client Socket and Address */
+	connect_client_to_server(OMRPORTLIB, "localhost", NULL, OMRSOCK_AF_INET, OMRSOCK_STREAM, &clientSocket, &clientSockAddr, &serverSockAddr);
+
+	/* Accept Connection */
+	ASSERT_EQ(OMRPORTLIB->sock_accept(OMRPORTLIB, serverSocket, &connectedServerSockAddr, &connectedServerSocket), 0);
+
+	ASSERT_EQ(OMRPORTLIB->sock_eventloop_add(OMRPORTLIB, loop, connectedServerSocket, OMRSOCK_POLLIN, &userData), 0);
+	ASSERT_EQ(OMRPORTLIB->mem_get_category_counters(OMRPORTLIB, OMRMEM_CATEGORY_PORT_LIBRARY, &initialBytes, &initialBlocks), 0);
+
+	memset(data, 0, sizeof(data));
+	for (i = 0; i < EVENTLOOP_RECLAIM_WAITERS; i++) {
+		data[i].portLibrary = OMRPORTLIB;
+		data[i].loop = loop;
+		data[i].socket = connectedServerSocket;
+		data[i].userData = &userData;
+		ASSERT_EQ(omrthread_attr_init(&attr), J9THREAD_SUCCESS);
+		ASSERT_EQ(omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE), J9THREAD_SUCCESS);
+		ASSERT_EQ(omrthread_create_ex(&waiters[i], &attr, 0, eventLoopWaiter, &data[i]), J9THREAD_SUCCESS);
+		omrthread_attr_destroy(&attr);
+		omrthread_sleep(100 / EVENTLOOP_RECLAIM_WAITERS);
+	}
+
+	for (i = 0; i < 10000; i++) {
+		EXPECT_EQ(OMRPORTLIB->sock_eventloop_remove(OMRPORTLIB, loop, connectedServerSocket), 0);
+		EXPECT_EQ(OMRPORTLIB->sock_eventloop_add(OMRPORTLIB, loop, connectedServerSocket, OMRSOCK_POLLIN, &userData), 0);
+	}
+
+	/*
+	 * Every waiting thread times out and waits again between these, so the loop moves to the next
+	 * epoch each time. Only the registrations removed in the last two epochs are left.
+	 */
+	for (i = 0; i < 50; i++) {
+		omrthread_sleep(100);
+		EXPECT_EQ(OMRPORTLIB->sock_eventloop_remove(OMRPORTLIB, loop, connectedServerSocket), 0);
+		EXPECT_EQ(OMRPORTLIB->sock_eventloop_add(OMRPORTLIB, loop, connectedServerSocket, OMRSOCK_POLLIN, &userData), 0);
+		ASSERT_EQ(OMRPORTLIB->mem_get_category_counters(OMRPORTLIB, OMRMEM_CATEGORY_PORT_LIBRARY, &bytes, &blocks), 0);
+		if (blocks <= (initialBlocks + 2)) {
+			break;
+		}
+	}
+	EXPECT_LE(blocks, initialBlocks + 2);
+
+	for (i = 0; i < EVENTLOOP_RECLAIM_WAITERS; i++) {
+		data[i].stop = 1;
+	}
+	EXPECT_EQ(OMRPORTLIB->sock_eventloop_wakeup(OMRPORTLIB, loop), 0);
+	for (i = 0; i < EVENTLOOP_RECLAIM_WAITERS; i++) {
+		omrthread_join(waiters[i]);
+		EXPECT_EQ(data[i].badEvents, 0U);
+	}
+
+	EXPECT_EQ(OMRPORTLIB->sock_eventloop_remove(OMRPORTLIB, loop, connectedServerSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_eventloop_destroy(OMRPORTLIB, &loop), 0);
+
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &serverSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &clientSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &connectedServerSocket), 0);
+}
+
+/**
+ * Test @ref omrsock_sendmmsg and @ref omrsock_recvmmsg by sending a batch of datagrams
+ * over loopback, and receiving them with their sender's address.
+ */
+TEST(PortSockTest, batched_datagram_communication)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	OMRSockAddrStorage serverSockAddr;
+	omrsock_socket_t serverSocket = NULL;
+	omrsock_socket_t clientSocket = NULL;
+	uint16_t port = 4930;
+	uint8_t serverAddr[4];
+	const uint32_t numMsgs = 12;
+
+	/* To Create a Server Socket and Address */
+	EXPECT_EQ(OMRPORTLIB->sock_inet_pton(OMRPORTLIB, OMRSOCK_AF_INET, "127.0.0.1", serverAddr), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_sockaddr_init(OMRPORTLIB, &serverSockAddr, OMRSOCK_AF_INET, serverAddr, OMRPORTLIB->sock_htons(OMRPORTLIB, port)), 0);
+	start_server(OMRPORTLIB, OMRSOCK_AF_INET, OMRSOCK_DGRAM, &serverSocket, &serverSockAddr);
+	ASSERT_EQ(OMRPORTLIB->sock_socket(OMRPORTLIB, &clientSocket, OMRSOCK_AF_INET, OMRSOCK_DGRAM, OMRSOCK_IPPROTO_DEFAULT), 0);
+
+	OMRTimeval timeRecv;
+	EXPECT_EQ(OMRPORTLIB->sock_timeval_init(OMRPORTLIB, &timeRecv, 3, 0), 0);
+	ASSERT_EQ(OMRPORTLIB->sock_setsockopt_timeval(OMRPORTLIB, serverSocket, OMRSOCK_SOL_SOCKET, OMRSOCK_SO_RCVTIMEO, &timeRecv), 0);
+
+	/* More messages than are described on the stack, so that the batch is allocated. */
+	char sendBufs[numMsgs][32];
+	OMRSockMsg sendMsgs[numMsgs];
+	for (uint32_t i = 0; i < numMsgs; i++) {
+		int32_t length = OMRPORTLIB->str_printf(OMRPORTLIB, sendBufs[i], sizeof(sendBufs[i]), "omrsock datagram %u", i);
+		sendMsgs[i].buf = (uint8_t *)sendBufs[i];
+		sendMsgs[i].nbyte = length + 1;
+		sendMsgs[i].length = 0;
+		sendMsgs[i].addr = &serverSockAddr;
+	}
+	uint32_t numSent = 0;
+	while (numSent < numMsgs) {
+		int32_t rc = OMRPORTLIB->sock_sendmmsg(OMRPORTLIB, clientSocket, sendMsgs + numSent, numMsgs - numSent, 0);
+		ASSERT_GT(rc, 0);
+		for (int32_t i = 0; i < rc; i++) {
+			EXPECT_EQ(sendMsgs[numSent + i].length, sendMsgs[numSent + i].nbyte);
+		}
+		numSent += rc;
+	}
+
+	char recvBufs[numMsgs][32];
+	OMRSockAddrStorage senderAddrs[numMsgs];
+	OMRSockMsg recvMsgs[numMsgs];
+	for (uint32_t i = 0; i < numMsgs; i++) {
+		memset(recvBufs[i], 0, sizeof(recvBufs[i]));
+		recvMsgs[i].buf = (uint8_t *)recvBufs[i];
+		recvMsgs[i].nbyte = sizeof(recvBufs[i]);
+		recvMsgs[i].length = 0;
+		recvMsgs[i].addr = &senderAddrs[i];
+	}
+	uint32_t numRecv = 0;
+	while (numRecv < numMsgs) {
+		int32_t rc = OMRPORTLIB->sock_recvmmsg(OMRPORTLIB, serverSocket, recvMsgs + numRecv, numMsgs - numRecv, OMRSOCK_MSG_WAITFORONE);
+		ASSERT_GT(rc, 0);
+		numRecv += rc;
+	}
+
+	/* Loopback datagrams arrive in order. */
+	for (uint32_t i = 0; i < numMsgs; i++) {
+		EXPECT_EQ(recvMsgs[i].length, sendMsgs[i].nbyte);
+		EXPECT_STREQ(sendBufs[i], recvBufs[i]);
+		EXPECT_EQ(senderAddrs[i].data.ss_family, serverSockAddr.data.ss_family);
+	}
+
+	/* Nothing more to receive. */
+	EXPECT_LT(OMRPORTLIB->sock_recvmmsg(OMRPORTLIB, serverSocket, recvMsgs, 1, OMRSOCK_MSG_DONTWAIT), 0);
+	EXPECT_EQ(OMRPORTLIB->error_last_error_number(OMRPORTLIB), OMRPORT_ERROR_SOCKET_WOULDBLOCK);
+
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &clientSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &serverSocket), 0);
+}
+
+/**
+ * Test zero-copy sends over a loopback connection. The data must arrive intact and
+ * @ref omrsock_zerocopy_complete must report the completion of every send. Loopback
+ * connections copy the data after all, so whether it was copied is not checked.
+ */
+TEST(PortSockTest, zerocopy_stream_send)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	OMRSockAddrStorage serverSockAddr;
+	omrsock_socket_t serverSocket = NULL;
+	OMRSockAddrStorage clientSockAddr;
+	omrsock_socket_t clientSocket = NULL;
+	OMRSockAddrStorage connectedServerSockAddr;
+	omrsock_socket_t connectedServerSocket = NULL;
+	uint16_t port = 4930;
+	uint32_t inaddrAny;
+	uint8_t serverAddr[4];
+	int32_t flag = 1;
+	int32_t rc = 0;
+
+	/* To Create a Server Socket and Address */
+	inaddrAny = OMRPORTLIB->sock_htonl(OMRPORTLIB, OMRSOCK_INADDR_ANY);
+	memcpy(serverAddr, &inaddrAny, 4);
+	EXPECT_EQ(OMRPORTLIB->sock_sockaddr_init(OMRPORTLIB, &serverSockAddr, OMRSOCK_AF_INET, serverAddr, OMRPORTLIB->sock_htons(OMRPORTLIB, port)), 0);
+	start_server(OMRPORTLIB, OMRSOCK_AF_INET, OMRSOCK_STREAM, &serverSocket, &serverSockAddr);
+
+	/* To Create a Client Socket and Address */
+	connect_client_to_server(OMRPORTLIB, "localhost", NULL, OMRSOCK_AF_INET, OMRSOCK_STREAM, &clientSocket, &clientSockAddr, &serverSockAddr);
+
+	/* Accept Connection */
+	ASSERT_EQ(OMRPORTLIB->sock_accept(OMRPORTLIB, serverSocket, &connectedServerSockAddr, &connectedServerSocket), 0);
+
+	rc = OMRPORTLIB->sock_setsockopt_int(OMRPORTLIB, connectedServerSocket, OMRSOCK_SOL_SOCKET, OMRSOCK_SO_ZEROCOPY, &flag);
+	if (0 == rc) {
+		const uint32_t numMsgs = 3;
+		uint8_t sendBufs[numMsgs][4096];
+		OMRSockMsg msgs[numMsgs];
+		uint32_t numSent = 0;
+
+		for (uint32_t i = 0; i < numMsgs; i++) {
+			memset(sendBufs[i], 'a' + i, sizeof(sendBufs[i]));
+			msgs[i].buf = sendBufs[i];
+			msgs[i].nbyte = sizeof(sendBufs[i]);
+			msgs[i].length = 0;
+			msgs[i].addr = NULL;
+		}
+		while (numSent < numMsgs) {
+			rc = OMRPORTLIB->sock_sendmmsg(OMRPORTLIB, connectedServerSocket, msgs + numSent, numMsgs - numSent, OMRSOCK_MSG_ZEROCOPY);
+			ASSERT_GT(rc, 0);
+			/* Each message fits in the send buffer, so none are sent in part. */
+			for (int32_t i = 0; i < rc; i++) {
+				EXPECT_EQ(msgs[numSent + i].length, msgs[numSent + i].nbyte);
+			}
+			numSent += rc;
+		}
+
+		uint8_t recvBuf[sizeof(sendBufs)];
+		uint32_t totalRecv = 0;
+		while (totalRecv < sizeof(recvBuf)) {
+			int32_t bytesRecv = OMRPORTLIB->sock_recv(OMRPORTLIB, clientSocket, recvBuf + totalRecv, sizeof(recvBuf) - totalRecv, 0);
+			ASSERT_GT(bytesRecv, 0);
+			totalRecv += bytesRecv;
+		}
+		EXPECT_EQ(memcmp(recvBuf, sendBufs, sizeof(recvBuf)), 0);
+
+		/* Collect completions until every send has been reported. */
+		uint32_t nextSend = 0;
+		for (int32_t i = 0; (i < 100) && (nextSend < numMsgs); i++) {
+			uint32_t first = 0;
+			uint32_t last = 0;
+			BOOLEAN copied = FALSE;
+
+			rc = OMRPORTLIB->sock_zerocopy_complete(OMRPORTLIB, connectedServerSocket, &first, &last, &copied);
+			if (OMRPORT_ERROR_SOCKET_WOULDBLOCK == rc) {
+				OMRPollFd pollFd;
+				ASSERT_EQ(OMRPORTLIB->sock_pollfd_init(OMRPORTLIB, &pollFd, connectedServerSocket, OMRSOCK_POLLERR), 0);
+				OMRPORTLIB->sock_poll(OMRPORTLIB, &pollFd, 1, 100);
+				continue;
+			}
+			ASSERT_EQ(rc, 0);
+			EXPECT_EQ(first, nextSend);
+			EXPECT_LE(first, last);
+			nextSend = last + 1;
+		}
+		EXPECT_EQ(nextSend, numMsgs);
+	} else {
+		EXPECT_TRUE((OMRPORT_ERROR_SOCK_OPTION_UNSUPPORTED == rc) || (OMRPORT_ERROR_SOCKET_OPERATION_NOT_PERMITTED == rc) || (OMRPORT_ERROR_INVALID_ARGUMENTS == rc))
+			<< "Unexpected error setting OMRSOCK_SO_ZEROCOPY: " << ::testing::PrintToString(rc);
+		portTestEnv->log("Zero-copy sends are not supported on this platform\n");
+	}
+
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &serverSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &clientSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &connectedServerSocket), 0);
+}
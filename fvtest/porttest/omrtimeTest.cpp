@@ -126,6 +126,21 @@ TEST(PortTimeTest, time_test0)
 		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->time_hires_delta is NULL\n");
 	}
 
+	/* omrtime_test_fast_ticks */
+	if (NULL == OMRPORTLIB->time_fast_ticks) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->time_fast_ticks is NULL\n");
+	}
+
+	/* omrtime_test_fast_ticks */
+	if (NULL == OMRPORTLIB->time_fast_ticks_frequency) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->time_fast_ticks_frequency is NULL\n");
+	}
+
+	/* omrtime_test_fast_ticks */
+	if (NULL == OMRPORTLIB->time_fast_ticks_delta) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->time_fast_ticks_delta is NULL\n");
+	}
+
 	reportTestExit(OMRPORTLIB, testName);
 }
 
@@ -760,3 +775,101 @@ TEST(PortTimeTest, time_test_hires_delta_rounding)
 exit:
 	reportTestExit(OMRPORTLIB, testName);
 }
+
+/**
+ * Time a busy wait with both omrtime_fast_ticks and omrtime_hires_clock, and check that they agree.
+ */
+static void
+omrtime_test_fast_ticks_interval(struct OMRPortLibrary *portLibrary, const char *testName)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	const uint64_t intervalMicros = 20000;
+	uint64_t fastStart = omrtime_fast_ticks();
+	uint64_t hiresStart = omrtime_hires_clock();
+	uint64_t fastNow = fastStart;
+	uint64_t hiresMicros = 0;
+	uint64_t fastMicros = 0;
+	double error = 0.0;
+
+	do {
+		uint64_t fastPrevious = fastNow;
+
+		fastNow = omrtime_fast_ticks();
+		if (fastNow < fastPrevious) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrtime_fast_ticks went backwards: %llu then %llu\n", fastPrevious, fastNow);
+			return;
+		}
+		hiresMicros = omrtime_hires_delta(hiresStart, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	} while (hiresMicros < intervalMicros);
+	fastMicros = omrtime_fast_ticks_delta(fastStart, omrtime_fast_ticks(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+	error = omrtime_test_compute_error_pct((double)hiresMicros, (double)fastMicros);
+	portTestEnv->log("fast ticks: %llu us, hires clock: %llu us, error: %lf\n", fastMicros, hiresMicros, error);
+	if (error > 0.02) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrtime_fast_ticks_delta returned %llu us, expected %llu us\n", fastMicros, hiresMicros);
+	}
+}
+
+/**
+ * Verify that fast ticks measure time like omrtime_hires_clock, whether they read the CPU counter or not,
+ * and that the source cannot be changed once fast ticks have been taken.
+ *
+ * The counter is selected in a separate port library, since this test's port library may already
+ * have handed out fast ticks.
+ *
+ * Functions verified by this test:
+ * @arg @ref omrtimeticks.c::omrtime_fast_ticks "omrtime_fast_ticks()"
+ * @arg @ref omrtimeticks.c::omrtime_fast_ticks_frequency "omrtime_fast_ticks_frequency()"
+ * @arg @ref omrtimeticks.c::omrtime_fast_ticks_delta "omrtime_fast_ticks_delta()"
+ */
+TEST(PortTimeTest, time_test_fast_ticks)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrtime_test_fast_ticks";
+	OMRPortLibrary counterPortLibrary;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	if (omrtime_fast_ticks_frequency() != omrtime_hires_frequency()) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "fast ticks do not use omrtime_hires_clock by default\n");
+	}
+	omrtime_test_fast_ticks_interval(OMRPORTLIB, testName);
+	if (0 == omrport_control(OMRPORT_CTLDATA_TIME_FAST_TICKS, 1)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "fast ticks switched to the CPU counter after ticks were taken\n");
+	}
+	if (0 != omrport_control(OMRPORT_CTLDATA_TIME_FAST_TICKS, 0)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "selecting the source already in use failed\n");
+	}
+	if (omrtime_fast_ticks_frequency() != omrtime_hires_frequency()) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "fast ticks no longer use omrtime_hires_clock\n");
+	}
+
+	if (0 != omrport_init_library(&counterPortLibrary, sizeof(OMRPortLibrary))) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrport_init_library failed\n");
+		goto exit;
+	}
+	if (0 == counterPortLibrary.port_control(&counterPortLibrary, OMRPORT_CTLDATA_TIME_FAST_TICKS, 1)) {
+		uint64_t frequency = counterPortLibrary.time_fast_ticks_frequency(&counterPortLibrary);
+
+		portTestEnv->log("fast ticks read the CPU counter, frequency: %llu\n", frequency);
+		if (0 == frequency) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "invalid fast ticks frequency\n");
+		}
+		if (counterPortLibrary.time_fast_ticks_delta(&counterPortLibrary, 0, frequency, OMRPORT_TIME_DELTA_IN_MILLISECONDS) != 1000) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrtime_fast_ticks_delta did not convert one second of ticks\n");
+		}
+		omrtime_test_fast_ticks_interval(&counterPortLibrary, testName);
+		if (0 == counterPortLibrary.port_control(&counterPortLibrary, OMRPORT_CTLDATA_TIME_FAST_TICKS, 0)) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "fast ticks left the CPU counter after ticks were taken\n");
+		}
+		if (counterPortLibrary.time_fast_ticks_frequency(&counterPortLibrary) != frequency) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "fast ticks frequency changed after ticks were taken\n");
+		}
+	} else {
+		portTestEnv->log("the CPU counter cannot be used, fast ticks use omrtime_hires_clock\n");
+	}
+	counterPortLibrary.port_shutdown_library(&counterPortLibrary);
+
+exit:
+	reportTestExit(OMRPORTLIB, testName);
+}
@@ -22,6 +22,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "AtomicSupport.hpp"
 #include "omrport.h"
 #include "omrthread.h"
 #include "omr.h"
@@ -38,6 +39,9 @@
 #define NUM_THREADS 10
 #define STRESS_ITERATIONS_BUFFER 1000
 #define STRESS_ITERATIONS_THREAD 50
+#define REGISTRATION_ITERATIONS 100
+/* The fork is delayed by this much more in each iteration, to land at a different point of the registration */
+#define REGISTRATION_DELAY_STEP_NANOS 2000
 
 /*
  * The executable for this test is omrsubscribertest
@@ -68,7 +72,11 @@ static void runTest(omrthread_entrypoint_t entrypoint);
 static void preforkSetup(OMR_VMThread **vmthread, struct OMR_Agent **agent, OMRTestVM *testVM, int pipedata[2]);
 static void postForkChild(OMR_VMThread *vmthread, struct OMR_Agent *agent, OMRTestVM *testVM, int pipedata[2]);
 static void postForkParent(OMR_VMThread *vmthread, struct OMR_Agent *agent, OMRTestVM *testVM, int pipedata[2]);
+static void forkDuringRegistration(int64_t delayNanos);
+static void waitForChildResult(int pipedata[2]);
 static int duringForkBufferTest(void *entryArg);
+static int duringForkRegistrationTest(void *entryArg);
+static omr_error_t ignoreRecord(UtSubscription *subscriptionID);
 static int duringForkThreadTest(void *entryArg);
 static int doNothing(void *entryArg);
 static omr_error_t setupTestData(TestData *testData, OMRTestVM *testVM, int32_t threadCount);
@@ -97,6 +105,14 @@ TEST(RASSubscriberForkTest, SubscriberAgentForkBufferTest)
 	runTest(duringForkBufferTest);
 }
 
+/* Fork while the first subscriber is being registered, which starts the trace writer thread. */
+TEST(RASSubscriberForkTest, SubscriberRegistrationForkTest)
+{
+	for (int32_t i = 0; i < REGISTRATION_ITERATIONS; i += 1) {
+		ASSERT_NO_FATAL_FAILURE(forkDuringRegistration(i * REGISTRATION_DELAY_STEP_NANOS));
+	}
+}
+
 /* Create a group of test threads which will test one of several conditions
  * concurrently to a fork call.
  */
@@ -148,6 +164,62 @@ runTest(omrthread_entrypoint_t entrypoint)
 	}
 }
 
+/* Start trace without any subscribers, then fork while a test thread registers one. */
+static void
+forkDuringRegistration(int64_t delayNanos)
+{
+	int pipedata[2];
+	OMRTestVM testVM;
+	OMR_VMThread *vmthread = NULL;
+	TestData newTestData;
+	TestSiblingThreadData threadData;
+	OMRPORT_ACCESS_FROM_OMRPORT(rasTestEnv->getPortLibrary());
+	char *datDir = getTraceDatDir(rasTestEnv->_argc, (const char **)rasTestEnv->_argv);
+
+	OMRTEST_ASSERT_ERROR_NONE(omrTestVMInit(&testVM, OMRPORTLIB));
+	OMRTEST_ASSERT_ERROR_NONE(OMR_Thread_Init(&testVM.omrVM, NULL, &vmthread, "subscriberForkTest"));
+	OMRTEST_ASSERT_ERROR_NONE(omr_ras_initTraceEngine(&testVM.omrVM, "maximal=all:buffers=1k", datDir));
+	OMRTEST_ASSERT_ERROR_NONE(omr_trc_startThreadTrace(vmthread, "initialization thread"));
+	UT_OMR_TEST_MODULE_LOADED(testVM.omrVM._trcEngine->utIntf);
+	ASSERT_EQ(0, pipe(pipedata)) << "Failure occurred calling pipe";
+
+	OMRTEST_ASSERT_ERROR_NONE(setupTestData(&newTestData, &testVM, 1));
+	threadData.testData = &newTestData;
+	threadData.threadRc = &newTestData.siblingRc[0];
+	ASSERT_NO_FATAL_FAILURE(createThread(&newTestData.threads[0], FALSE, J9THREAD_CREATE_JOINABLE, duringForkRegistrationTest, &threadData));
+	OMRTEST_ASSERT_ERROR_NONE(waitForThreadsReady(&newTestData));
+
+	uint64_t start = omrtime_nano_time();
+	while ((int64_t)(omrtime_nano_time() - start) < delayNanos) {
+		VM_AtomicSupport::yieldCPU();
+	}
+	omr_vm_preFork(&testVM.omrVM);
+	if (0 == fork()) {
+		OMRTraceSubscriberForkTestResult result;
+		result.rc = OMR_ERROR_NONE;
+
+		omr_vm_postForkChild(&testVM.omrVM);
+		Trc_OMR_Test_Init();
+		Trc_OMR_Test_Int(vmthread, 10);
+
+		/* The registering thread does not exist in the child, so the VM can't be cleaned up. */
+		J9_IGNORE_RETURNVAL(write(pipedata[1], (int *)&result, sizeof(result)));
+		close(pipedata[0]);
+		close(pipedata[1]);
+		_exit(0);
+	}
+	omr_vm_postForkParent(&testVM.omrVM);
+	OMRTEST_ASSERT_ERROR_NONE(waitForThreadsDone(&newTestData));
+	omrthread_monitor_destroy(newTestData.readyCond);
+
+	Trc_OMR_Test_Int(vmthread, 99);
+	OMRTEST_ASSERT_ERROR_NONE(omr_ras_cleanupTraceEngine(vmthread));
+	OMRTEST_ASSERT_ERROR_NONE(OMR_Thread_Free(vmthread));
+	OMRTEST_ASSERT_ERROR_NONE(omrTestVMFini(&testVM));
+
+	waitForChildResult(pipedata);
+}
+
 /* Setup the omr vm and load an agent pre fork. */
 static void
 preforkSetup(OMR_VMThread **vmthread, struct OMR_Agent **agent, OMRTestVM *testVM, int pipedata[2])
@@ -273,7 +345,13 @@ postForkParent(OMR_VMThread *vmthread, struct OMR_Agent *agent, OMRTestVM *testV
 	/*  Now clear up the VM we started for this test case. */
 	OMRTEST_ASSERT_ERROR_NONE(omrTestVMFini(testVM));
 
-	/* Wait on pipe for child process to complete. */
+	waitForChildResult(pipedata);
+}
+
+/* Wait on pipe for child process to complete, and check its result. */
+static void
+waitForChildResult(int pipedata[2])
+{
 	OMRTraceSubscriberForkTestResult result;
 	fd_set set;
 	struct timeval timeout;
@@ -324,6 +402,49 @@ duringForkBufferTest(void *entryArg)
 	return 0;
 }
 
+/* Register the first subscriber concurrently to fork. */
+static int
+duringForkRegistrationTest(void *entryArg)
+{
+	omr_error_t siblingRc = OMR_ERROR_NONE;
+	TestSiblingThreadData *threadData = (TestSiblingThreadData *)entryArg;
+	OMRTestVM *testVM = threadData->testData->testVM;
+	OMRPORT_ACCESS_FROM_OMRPORT(testVM->portLibrary);
+	/* Not through OMR_TI, which holds a lock that omr_vm_preFork also takes */
+	OMR_TraceInterface *traceIntf = &testVM->omrVM._trcEngine->omrTraceIntfS;
+	UtSubscription *subscriptionID = NULL;
+
+	OMR_VMThread *vmthread = NULL;
+	siblingRc = OMRTEST_PRINT_ERROR(OMR_Thread_Init(&testVM->omrVM, NULL, &vmthread, "traceTestRegistration-child"));
+	if (OMR_ERROR_NONE == siblingRc) {
+		siblingRc = OMRTEST_PRINT_ERROR(notifyThreadReadyAndWait(threadData));
+	}
+	if (OMR_ERROR_NONE == siblingRc) {
+		siblingRc = OMRTEST_PRINT_ERROR(traceIntf->RegisterRecordSubscriber(OMR_TRACE_THREAD_FROM_VMTHREAD(vmthread), "duringForkRegistration", ignoreRecord, NULL, NULL, &subscriptionID));
+	}
+	if (OMR_ERROR_NONE == siblingRc) {
+		Trc_OMR_Test_Init();
+		siblingRc = OMRTEST_PRINT_ERROR(traceIntf->DeregisterRecordSubscriber(OMR_TRACE_THREAD_FROM_VMTHREAD(vmthread), subscriptionID));
+	}
+	if (NULL != vmthread) {
+		omr_error_t freeRc = OMRTEST_PRINT_ERROR(OMR_Thread_Free(vmthread));
+		if (OMR_ERROR_NONE == siblingRc) {
+			siblingRc = freeRc;
+		}
+	}
+
+	if (OMR_ERROR_NONE != siblingRc) {
+		*threadData->threadRc = siblingRc;
+	}
+	return 0;
+}
+
+static omr_error_t
+ignoreRecord(UtSubscription *subscriptionID)
+{
+	return OMR_ERROR_NONE;
+}
+
 /* Stress repeatedly creating threads during fork. */
 static int
 duringForkThreadTest(void *entryArg)
@@ -27,6 +27,7 @@
 #include "omrTest.h"
 #include "omrTestHelpers.h"
 #include "omrtrace.h"
+#include "omrtraceformat.h"
 #include "omrvm.h"
 #include "ut_omr_test.h"
 
@@ -40,10 +41,14 @@
  * - Filling trace buffers
  * - Wrapping tracepoints across multiple trace buffers
  * - Verifies the contents of trace records sent to subscribers
+ * - Verifies that generated tracepoint writers lay out records as the generic path does
+ * - Formats the trace file in time stamp order on multiple threads, with filters
  */
 
 #define TRACE_BUFFER_BYTES 1024
 #define NUM_CHILD_THREADS 4
+#define MAX_FORMATTED_TRACEPOINTS 16384
+#define FORMATTED_TEXT_LENGTH 128
 
 /* Test data */
 typedef struct TestChildThreadData {
@@ -64,6 +69,29 @@ typedef struct FailingSubscriberData {
 	uint32_t alarmCount;
 } FailingSubscriberData;
 
+typedef struct FixedLayoutTestData {
+	OMRTestVM *testVM;
+	omr_error_t childRc;
+	omrthread_t osThread;
+
+	uint32_t recordCount;
+	uint32_t parameterDataLength[2];
+	uint8_t parameterData[2][64];
+	PerThreadWrapBuffer wrapBuffer;
+} FixedLayoutTestData;
+
+typedef struct FormattedTraceData {
+	uint32_t count;
+	uint32_t capacity;
+	uint64_t *timeStamps;
+	uint64_t *threadIds;
+	char (*text)[FORMATTED_TEXT_LENGTH];
+	uint64_t lastTimeStamp;
+	const char *expectedText;
+	BOOLEAN outOfOrder;
+	BOOLEAN unexpectedText;
+} FormattedTraceData;
+
 static void startChildThread(OMRTestVM *testVM, omrthread_t *childThread, omrthread_entrypoint_t entryProc, TestChildThreadData *childData);
 static omr_error_t waitForChildThread(OMRTestVM *testVM, omrthread_t childThread, TestChildThreadData *childData);
 static int J9THREAD_PROC childThreadMain(void *entryArg);
@@ -75,6 +103,18 @@ static omr_error_t countTracepointsIter(void *userData, const char *tpMod, const
 static omr_error_t failOnSecondCall(UtSubscription *subscriptionID);
 static void failOnSecondCallAlarm(UtSubscription *subscriptionID);
 
+static int J9THREAD_PROC fixedLayoutThreadMain(void *entryArg);
+static omr_error_t collectFixedLayout(UtSubscription *subscriptionID);
+static omr_error_t collectFixedLayoutIter(void *userData, const char *tpMod, const uint32_t tpModLength, const uint32_t tpId,
+										  const UtTraceRecord *record, uint32_t firstParameterOffset, uint32_t parameterDataLength,
+										  int32_t isBigEndian);
+
+static char *getTestFormatString(const char *componentName, int32_t tracepoint);
+static omr_error_t collectFormattedTracePoint(void *userData, uint64_t threadId, uint64_t timeStamp, const char *tracePoint);
+static void initFormattedTraceData(OMRPortLibrary *portLib, FormattedTraceData *data, uint32_t capacity, const char *expectedText);
+static void freeFormattedTraceData(OMRPortLibrary *portLib, FormattedTraceData *data);
+static void verifyFormattedTraceFile(OMRPortLibrary *portLib, const char *fileName, int expectedCount);
+
 static const char *lowercaseAlpha = "abcdefghijklmnopqrstuvwxyz";
 static const char *uppercaseAlpha = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
 
@@ -240,10 +280,83 @@ TEST(TraceLogTest, stressTraceBufferManagement)
 	/* Implementation detail: The callCount is guaranteed because subscriber callbacks are invoked under mutex. */
 	ASSERT_EQ((uint32_t)2, failData.callCount);
 
+	int totalLoggedCount = 0;
+	for (size_t i = 0; i < NUM_CHILD_THREADS; i += 1) {
+		totalLoggedCount += childData[i].loggedCount;
+	}
+	ASSERT_NO_FATAL_FAILURE(verifyFormattedTraceFile(OMRPORTLIB, "traceLogTest.trc", totalLoggedCount));
+
 	/* Clean up trace file */
 	omrfile_unlink("traceLogTest.trc");
 }
 
+/*
+ * Trc_OMR_Test_FixedLayout only has fixed size arguments, so its generated writer passes them to
+ * TraceData already laid out. The record must match the one the generic Trace path writes.
+ */
+TEST(TraceLogTest, fixedLayoutTracepoint)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(rasTestEnv->getPortLibrary());
+	OMRTestVM testVM;
+	OMR_VMThread *vmthread = NULL;
+	const OMR_TI *ti = omr_agent_getTI();
+	UtSubscription *subscriptionID = NULL;
+	omrthread_t childThread = NULL;
+	FixedLayoutTestData testData;
+	const uint32_t expectedLength = sizeof(char) + sizeof(int16_t) + sizeof(int32_t) + sizeof(int64_t) + sizeof(void *) + sizeof(double);
+
+	memset(&testData, 0, sizeof(testData));
+	testData.testVM = &testVM;
+	testData.childRc = OMR_ERROR_NONE;
+	initWrapBuffer(&testData.wrapBuffer);
+
+	OMRTEST_ASSERT_ERROR_NONE(omrTestVMInit(&testVM, OMRPORTLIB));
+	OMRTEST_ASSERT_ERROR_NONE(omr_ras_initTraceEngine(&testVM.omrVM, "maximal=all:maximal=!j9thr", NULL));
+	OMRTEST_ASSERT_ERROR_NONE(OMR_Thread_Init(&testVM.omrVM, NULL, &vmthread, "fixedLayoutTracepoint"));
+
+	UT_OMR_TEST_MODULE_LOADED(testVM.omrVM._trcEngine->utIntf);
+
+	ASSERT_NO_FATAL_FAILURE(createThread(&childThread, TRUE, J9THREAD_CREATE_JOINABLE, fixedLayoutThreadMain, &testData));
+	testData.osThread = childThread;
+	OMRTEST_ASSERT_ERROR_NONE(
+		ti->RegisterRecordSubscriber(vmthread, "fixedLayout", collectFixedLayout, NULL, (void *)&testData, &subscriptionID));
+	ASSERT_EQ(1, omrthread_resume(childThread));
+	ASSERT_EQ(J9THREAD_SUCCESS, joinThread(childThread));
+	OMRTEST_ASSERT_ERROR_NONE(testData.childRc);
+
+	/* Deregistering delivers the buffer the child thread published when it stopped tracing */
+	OMRTEST_ASSERT_ERROR_NONE(ti->DeregisterRecordSubscriber(vmthread, subscriptionID));
+
+	UT_OMR_TEST_MODULE_UNLOADED(testVM.omrVM._trcEngine->utIntf);
+	OMRTEST_ASSERT_ERROR_NONE(omr_ras_cleanupTraceEngine(vmthread));
+	OMRTEST_ASSERT_ERROR_NONE(OMR_Thread_Free(vmthread));
+	OMRTEST_ASSERT_ERROR_NONE(omrTestVMFini(&testVM));
+	freeWrapBuffer(&testData.wrapBuffer);
+
+	ASSERT_EQ((uint32_t)2, testData.recordCount);
+	ASSERT_EQ(expectedLength, testData.parameterDataLength[0]);
+	ASSERT_EQ(expectedLength, testData.parameterDataLength[1]);
+	ASSERT_EQ(0, memcmp(testData.parameterData[0], testData.parameterData[1], expectedLength));
+
+	{
+		const uint8_t *data = testData.parameterData[0];
+		int16_t shortValue = 0;
+		int32_t intValue = 0;
+		int64_t longValue = 0;
+		double doubleValue = 0.0;
+
+		ASSERT_EQ('x', (char)data[0]);
+		memcpy(&shortValue, data + 1, sizeof(shortValue));
+		ASSERT_EQ(-2, shortValue);
+		memcpy(&intValue, data + 3, sizeof(intValue));
+		ASSERT_EQ(-3, intValue);
+		memcpy(&longValue, data + 7, sizeof(longValue));
+		ASSERT_EQ(-4, longValue);
+		memcpy(&doubleValue, data + 15 + sizeof(void *), sizeof(doubleValue));
+		ASSERT_EQ(0.5, doubleValue);
+	}
+}
+
 static void
 startChildThread(OMRTestVM *testVM, omrthread_t *childThread, omrthread_entrypoint_t entryProc, TestChildThreadData *childData)
 {
@@ -384,3 +497,194 @@ failOnSecondCallAlarm(UtSubscription *subscriptionID)
 
 	VM_AtomicSupport::addU32(&failData->alarmCount, 1);
 }
+
+static int J9THREAD_PROC
+fixedLayoutThreadMain(void *entryArg)
+{
+	omr_error_t rc = OMR_ERROR_NONE;
+	FixedLayoutTestData *testData = (FixedLayoutTestData *)entryArg;
+	OMR_VMThread *vmthread = NULL;
+	OMRPORT_ACCESS_FROM_OMRPORT(testData->testVM->portLibrary);
+
+	rc = OMRTEST_PRINT_ERROR(OMR_Thread_Init(&testData->testVM->omrVM, NULL, &vmthread, "fixedLayoutThreadMain"));
+	if (OMR_ERROR_NONE != rc) {
+		testData->childRc = rc;
+		return -1;
+	}
+
+	/* Once through the generated writer, and once through Trace with the same arguments */
+	Trc_OMR_Test_FixedLayout(vmthread, 'x', -2, -3, -4, vmthread, 0.5);
+	omr_test_UtModuleInfo.intf->Trace(UT_THREAD(vmthread), &omr_test_UtModuleInfo, ((6u << 8) | omr_test_UtActive[6]),
+		"\1\2\4\10\6\7", 'x', -2, -3, (int64_t)-4, vmthread, 0.5);
+
+	rc = OMRTEST_PRINT_ERROR(OMR_Thread_Free(vmthread));
+	if (OMR_ERROR_NONE != rc) {
+		testData->childRc = rc;
+		return -1;
+	}
+	return 0;
+}
+
+/*
+ * Save the parameter data of each Trc_OMR_Test_FixedLayout tracepoint
+ */
+static omr_error_t
+collectFixedLayoutIter(void *userData, const char *tpMod, const uint32_t tpModLength, const uint32_t tpId,
+					   const UtTraceRecord *record, uint32_t firstParameterOffset, uint32_t parameterDataLength, int32_t isBigEndian)
+{
+	FixedLayoutTestData *testData = (FixedLayoutTestData *)userData;
+	const uint32_t omr_test_len = sizeof("omr_test") - 1;
+
+	/* The fixed layout tracepoint is omr_test.6 */
+	if ((omr_test_len == tpModLength) && (0 == memcmp("omr_test", tpMod, omr_test_len)) && (6 == tpId)) {
+		if ((testData->recordCount < 2) && (parameterDataLength <= sizeof(testData->parameterData[0]))) {
+			memcpy(testData->parameterData[testData->recordCount], (uint8_t *)record + firstParameterOffset, parameterDataLength);
+			testData->parameterDataLength[testData->recordCount] = parameterDataLength;
+		}
+		testData->recordCount += 1;
+	}
+	return OMR_ERROR_NONE;
+}
+
+static omr_error_t
+collectFixedLayout(UtSubscription *subscriptionID)
+{
+	FixedLayoutTestData *testData = (FixedLayoutTestData *)subscriptionID->userData;
+	const UtTraceRecord *traceRecord = (const UtTraceRecord *)subscriptionID->data;
+
+	if ((omrthread_t)(uintptr_t)traceRecord->threadSyn1 == testData->osThread) {
+		processTraceRecord(&testData->wrapBuffer, subscriptionID, collectFixedLayoutIter, subscriptionID->userData);
+	}
+	return OMR_ERROR_NONE;
+}
+
+static char *
+getTestFormatString(const char *componentName, int32_t tracepoint)
+{
+	/* Trc_OMR_Test_String is omr_test.1 */
+	if ((0 == strcmp("omr_test", componentName)) && (1 == tracepoint)) {
+		return (char *)"String: %s";
+	}
+	return (char *)"UNKNOWN TRACEPOINT ID";
+}
+
+static void
+initFormattedTraceData(OMRPortLibrary *portLib, FormattedTraceData *data, uint32_t capacity, const char *expectedText)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+
+	memset(data, 0, sizeof(*data));
+	data->expectedText = expectedText;
+	if (0 != capacity) {
+		data->timeStamps = (uint64_t *)omrmem_allocate_memory(capacity * sizeof(uint64_t), OMRMEM_CATEGORY_VM);
+		data->threadIds = (uint64_t *)omrmem_allocate_memory(capacity * sizeof(uint64_t), OMRMEM_CATEGORY_VM);
+		data->text = (char (*)[FORMATTED_TEXT_LENGTH])omrmem_allocate_memory(capacity * FORMATTED_TEXT_LENGTH, OMRMEM_CATEGORY_VM);
+		ASSERT_FALSE((NULL == data->timeStamps) || (NULL == data->threadIds) || (NULL == data->text));
+		data->capacity = capacity;
+	}
+}
+
+static void
+freeFormattedTraceData(OMRPortLibrary *portLib, FormattedTraceData *data)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+
+	omrmem_free_memory(data->timeStamps);
+	omrmem_free_memory(data->threadIds);
+	omrmem_free_memory(data->text);
+}
+
+/*
+ * Record each formatted tracepoint, checking that they arrive in time stamp order
+ */
+static omr_error_t
+collectFormattedTracePoint(void *userData, uint64_t threadId, uint64_t timeStamp, const char *tracePoint)
+{
+	FormattedTraceData *data = (FormattedTraceData *)userData;
+
+	if (timeStamp < data->lastTimeStamp) {
+		data->outOfOrder = TRUE;
+	}
+	data->lastTimeStamp = timeStamp;
+	if ((NULL != data->expectedText) && (NULL == strstr(tracePoint, data->expectedText))) {
+		data->unexpectedText = TRUE;
+	}
+	if (data->count < data->capacity) {
+		/* The wall clock prefix depends on when the file was formatted, so only keep the rest */
+		const char *text = strstr(tracePoint, " GMT ");
+
+		data->timeStamps[data->count] = timeStamp;
+		data->threadIds[data->count] = threadId;
+		strncpy(data->text[data->count], (NULL == text) ? tracePoint : text, FORMATTED_TEXT_LENGTH - 1);
+		data->text[data->count][FORMATTED_TEXT_LENGTH - 1] = '\0';
+	} else if (0 != data->capacity) {
+		return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+	}
+	data->count += 1;
+	return OMR_ERROR_NONE;
+}
+
+/*
+ * Format the trace file written by the sampleSubscriber agent with different numbers of
+ * threads and filters, and check that the results agree.
+ */
+static void
+verifyFormattedTraceFile(OMRPortLibrary *portLib, const char *fileName, int expectedCount)
+{
+	FormattedTraceData all;
+	FormattedTraceData serial;
+	FormattedTraceData parallel;
+	FormattedTraceData window;
+	UtTraceFormatFilter filter;
+	uint32_t expectedWindowCount = 0;
+
+	/* Everything, including the port library's tracepoints */
+	ASSERT_NO_FATAL_FAILURE(initFormattedTraceData(portLib, &all, 0, NULL));
+	OMRTEST_ASSERT_ERROR_NONE(omr_trc_formatTraceFile(portLib, fileName, getTestFormatString, NULL, 4, collectFormattedTracePoint, &all));
+	ASSERT_FALSE(all.outOfOrder);
+	ASSERT_LT((uint32_t)0, all.count);
+
+	/* Trc_OMR_Test_String only, formatted on the calling thread and on several threads */
+	filter.componentName = "omr_test";
+	filter.tracePointId = 1;
+	filter.startTime = 0;
+	filter.endTime = 0;
+	ASSERT_NO_FATAL_FAILURE(initFormattedTraceData(portLib, &serial, MAX_FORMATTED_TRACEPOINTS, " omr_test.1 - String: "));
+	OMRTEST_ASSERT_ERROR_NONE(omr_trc_formatTraceFile(portLib, fileName, getTestFormatString, &filter, 1, collectFormattedTracePoint, &serial));
+	ASSERT_FALSE(serial.outOfOrder);
+	ASSERT_FALSE(serial.unexpectedText);
+	/* Tracepoints that wrap from one buffer into the next can't be formatted */
+	ASSERT_LT((uint32_t)0, serial.count);
+	ASSERT_GE((uint32_t)expectedCount, serial.count);
+
+	ASSERT_NO_FATAL_FAILURE(initFormattedTraceData(portLib, &parallel, MAX_FORMATTED_TRACEPOINTS, " omr_test.1 - String: "));
+	OMRTEST_ASSERT_ERROR_NONE(omr_trc_formatTraceFile(portLib, fileName, getTestFormatString, &filter, 4, collectFormattedTracePoint, &parallel));
+	ASSERT_FALSE(parallel.outOfOrder);
+	ASSERT_EQ(serial.count, parallel.count);
+	for (uint32_t i = 0; i < serial.count; i += 1) {
+		ASSERT_EQ(serial.timeStamps[i], parallel.timeStamps[i]);
+		ASSERT_EQ(serial.threadIds[i], parallel.threadIds[i]);
+		ASSERT_STREQ(serial.text[i], parallel.text[i]);
+	}
+
+	/* A time window covering the second quarter of the tracepoints */
+	filter.startTime = serial.timeStamps[serial.count / 4];
+	filter.endTime = serial.timeStamps[serial.count / 2];
+	ASSERT_NO_FATAL_FAILURE(initFormattedTraceData(portLib, &window, MAX_FORMATTED_TRACEPOINTS, " omr_test.1 - String: "));
+	OMRTEST_ASSERT_ERROR_NONE(omr_trc_formatTraceFile(portLib, fileName, getTestFormatString, &filter, 3, collectFormattedTracePoint, &window));
+	ASSERT_FALSE(window.outOfOrder);
+	for (uint32_t i = 0; i < serial.count; i += 1) {
+		if ((serial.timeStamps[i] >= filter.startTime) && (serial.timeStamps[i] <= filter.endTime)) {
+			ASSERT_GT(window.count, expectedWindowCount);
+			ASSERT_EQ(serial.timeStamps[i], window.timeStamps[expectedWindowCount]);
+			ASSERT_STREQ(serial.text[i], window.text[expectedWindowCount]);
+			expectedWindowCount += 1;
+		}
+	}
+	ASSERT_EQ(expectedWindowCount, window.count);
+
+	freeFormattedTraceData(portLib, &all);
+	freeFormattedTraceData(portLib, &serial);
+	freeFormattedTraceData(portLib, &parallel);
+	freeFormattedTraceData(portLib, &window);
+}
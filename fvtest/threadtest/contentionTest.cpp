@@ -0,0 +1,125 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include <string.h>
+#include <string>
+
+#include "omrTest.h"
+#include "omrutilbase.h"
+#include "thread_api.h"
+
+#define CONTENTION_HOLD_MILLIS 50
+
+typedef struct ContentionData {
+	omrthread_monitor_t monitor;
+	volatile uintptr_t entered;
+	volatile uintptr_t released;
+	volatile uintptr_t finished;
+} ContentionData;
+
+static int J9THREAD_PROC
+contendingThread(void *arg)
+{
+	ContentionData *data = (ContentionData *)arg;
+
+	omrthread_monitor_enter(data->monitor);
+	omrthread_monitor_exit(data->monitor);
+	addAtomic(&data->entered, 1);
+	/* stay alive until the dump is taken; the rings of exited threads are dropped */
+	while (0 == data->released) {
+		omrthread_yield();
+	}
+	addAtomic(&data->finished, 1);
+	return 0;
+}
+
+static intptr_t
+appendToString(void *userData, const void *buffer, uintptr_t length)
+{
+	((std::string *)userData)->append((const char *)buffer, (size_t)length);
+	return 0;
+}
+
+/**
+ * A thread that blocks on a held monitor is sampled, and the report names the monitor
+ */
+TEST(ContentionTest, RecordAndReport)
+{
+	ContentionData data;
+	omrthread_t thread = NULL;
+	std::string dump;
+	std::string report;
+	const J9ThreadContentionDumpHeader *header = NULL;
+
+	data.monitor = NULL;
+	data.entered = 0;
+	data.released = 0;
+	data.finished = 0;
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&data.monitor, 0, "contentionTestMonitor"));
+	omrthread_contention_set_sample_interval(1);
+	ASSERT_EQ((uintptr_t)1, omrthread_contention_get_sample_interval());
+
+	omrthread_monitor_enter(data.monitor);
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create(&thread, 0, J9THREAD_PRIORITY_NORMAL, 0, contendingThread, &data));
+	omrthread_sleep(CONTENTION_HOLD_MILLIS);
+	omrthread_monitor_exit(data.monitor);
+	while (0 == data.entered) {
+		omrthread_yield();
+	}
+
+	ASSERT_EQ(0, omrthread_contention_dump(appendToString, &dump));
+	data.released = 1;
+	while (0 == data.finished) {
+		omrthread_yield();
+	}
+	ASSERT_GE(dump.size(), sizeof(J9ThreadContentionDumpHeader));
+	header = (const J9ThreadContentionDumpHeader *)dump.data();
+	ASSERT_EQ((uint32_t)J9THREAD_CONTENTION_DUMP_MAGIC, header->magic);
+	ASSERT_EQ((uint32_t)J9THREAD_CONTENTION_DUMP_VERSION, header->version);
+
+	ASSERT_EQ(0, omrthread_contention_report(dump.data(), dump.size(), 10, appendToString, &report));
+	EXPECT_NE(std::string::npos, report.find("contentionTestMonitor")) << report;
+
+	omrthread_contention_set_sample_interval(J9THREAD_CONTENTION_DEFAULT_SAMPLE_INTERVAL);
+	omrthread_monitor_destroy(data.monitor);
+}
+
+/**
+ * Sampling is on from the start
+ */
+TEST(ContentionTest, SamplingOnByDefault)
+{
+	ASSERT_EQ((uintptr_t)J9THREAD_CONTENTION_DEFAULT_SAMPLE_INTERVAL, omrthread_contention_get_sample_interval());
+	ASSERT_NE((uintptr_t)0, omrthread_contention_get_sample_interval());
+}
+
+/**
+ * The report rejects input that is not a contention dump
+ */
+TEST(ContentionTest, ReportRejectsBadDump)
+{
+	uint64_t garbage[4] = {0, 0, 0, 0};
+	std::string report;
+
+	ASSERT_NE(0, omrthread_contention_report(garbage, sizeof(garbage), 10, appendToString, &report));
+}
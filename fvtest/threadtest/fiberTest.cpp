@@ -0,0 +1,227 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "omrTest.h"
+#include "omrutilbase.h"
+#include "thread_api.h"
+
+#if defined(LINUX)
+
+#define FIBER_COUNT 2000
+#define FIBER_YIELDS 10
+#define PING_PONG_ROUNDS 1000
+
+static volatile uintptr_t fiberTestCounter;
+
+static int J9THREAD_PROC
+countingFiber(void *arg)
+{
+	uintptr_t i = 0;
+
+	EXPECT_TRUE(NULL != omrthread_fiber_self());
+	for (i = 0; i < FIBER_YIELDS; i++) {
+		addAtomic(&fiberTestCounter, 1);
+		omrthread_fiber_yield();
+	}
+	return 0;
+}
+
+/**
+ * Run many more fibers than carriers, each yielding repeatedly
+ */
+TEST(FiberTest, ManyFibers)
+{
+	omrthread_fiber_scheduler_t scheduler = NULL;
+	uintptr_t i = 0;
+
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_fiber_scheduler_create(&scheduler, 4, 0));
+	fiberTestCounter = 0;
+	for (i = 0; i < FIBER_COUNT; i++) {
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_fiber_create(NULL, scheduler, countingFiber, NULL));
+	}
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_fiber_scheduler_shutdown(scheduler));
+	ASSERT_EQ((uintptr_t)(FIBER_COUNT * FIBER_YIELDS), fiberTestCounter);
+	ASSERT_TRUE(NULL == omrthread_fiber_self());
+}
+
+typedef struct PingPongData {
+	omrthread_fiber_t peer;
+	volatile uintptr_t *turn;
+	uintptr_t myTurn;
+	uintptr_t rounds;
+} PingPongData;
+
+static int J9THREAD_PROC
+pingPongFiber(void *arg)
+{
+	PingPongData *data = (PingPongData *)arg;
+	uintptr_t i = 0;
+
+	for (i = 0; i < PING_PONG_ROUNDS; i++) {
+		while (*data->turn != data->myTurn) {
+			omrthread_fiber_park();
+		}
+		data->rounds += 1;
+		*data->turn = 1 - data->myTurn;
+		issueReadWriteBarrier();
+		/* if the peer isn't known yet, the test's own unpark of the peer comes after this point */
+		if (NULL != data->peer) {
+			omrthread_fiber_unpark(data->peer);
+		}
+	}
+	return 0;
+}
+
+/**
+ * Two fibers hand a token back and forth using park and unpark
+ */
+TEST(FiberTest, ParkUnpark)
+{
+	omrthread_fiber_scheduler_t scheduler = NULL;
+	volatile uintptr_t turn = 0;
+	PingPongData data[2];
+	omrthread_fiber_t handles[2];
+	uintptr_t i = 0;
+
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_fiber_scheduler_create(&scheduler, 2, 0));
+	for (i = 0; i < 2; i++) {
+		data[i].peer = NULL;
+		data[i].turn = &turn;
+		data[i].myTurn = i;
+		data[i].rounds = 0;
+	}
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_fiber_create(&handles[0], scheduler, pingPongFiber, &data[0]));
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_fiber_create(&handles[1], scheduler, pingPongFiber, &data[1]));
+	/* the fibers may already be running; publishing the peers and then unparking both avoids a lost wakeup */
+	data[0].peer = handles[1];
+	data[1].peer = handles[0];
+	issueReadWriteBarrier();
+	omrthread_fiber_unpark(handles[0]);
+	omrthread_fiber_unpark(handles[1]);
+
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_fiber_scheduler_shutdown(scheduler));
+	ASSERT_EQ((uintptr_t)PING_PONG_ROUNDS, data[0].rounds);
+	ASSERT_EQ((uintptr_t)PING_PONG_ROUNDS, data[1].rounds);
+}
+
+static omrthread_tls_key_t fiberTestKey;
+static volatile uintptr_t fiberTestFinalized;
+
+static void J9THREAD_PROC
+fiberTlsFinalizer(void *value)
+{
+	addAtomic(&fiberTestFinalized, (uintptr_t)value);
+}
+
+static int J9THREAD_PROC
+tlsFiber(void *arg)
+{
+	omrthread_fiber_t self = omrthread_fiber_self();
+
+	EXPECT_TRUE(NULL == omrthread_fiber_tls_get(self, fiberTestKey));
+	omrthread_fiber_tls_set(self, fiberTestKey, arg);
+	omrthread_fiber_yield();
+	EXPECT_EQ(arg, omrthread_fiber_tls_get(self, fiberTestKey));
+	return 0;
+}
+
+/**
+ * Fiber TLS values are private to each fiber and finalized when the fiber ends
+ */
+TEST(FiberTest, FiberLocalStorage)
+{
+	omrthread_fiber_scheduler_t scheduler = NULL;
+	uintptr_t i = 0;
+	uintptr_t expected = 0;
+
+	ASSERT_EQ(0, omrthread_tls_alloc_with_finalizer(&fiberTestKey, fiberTlsFinalizer));
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_fiber_scheduler_create(&scheduler, 2, 0));
+	fiberTestFinalized = 0;
+	for (i = 1; i <= 100; i++) {
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_fiber_create(NULL, scheduler, tlsFiber, (void *)i));
+		expected += i;
+	}
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_fiber_scheduler_shutdown(scheduler));
+	ASSERT_EQ(expected, fiberTestFinalized);
+	ASSERT_EQ(0, omrthread_tls_free(fiberTestKey));
+}
+
+static int J9THREAD_PROC
+floatingPointFiber(void *arg)
+{
+	double *result = (double *)arg;
+	double sum = 0.0;
+	char buffer[64];
+	uintptr_t i = 0;
+
+	for (i = 1; i <= FIBER_YIELDS; i++) {
+		sum += 1.0 / (double)i;
+		omrthread_fiber_yield();
+	}
+	/* formatting a double uses aligned SSE stores on x86-64, so this also checks the fiber's stack alignment */
+	snprintf(buffer, sizeof(buffer), "%.6f", sum);
+	*result = strtod(buffer, NULL);
+	return 0;
+}
+
+/**
+ * Floating point values held in registers survive switches between fibers
+ */
+TEST(FiberTest, FloatingPointAcrossSwitches)
+{
+	omrthread_fiber_scheduler_t scheduler = NULL;
+	double results[FIBER_YIELDS];
+	double expected = 0.0;
+	char buffer[64];
+	uintptr_t i = 0;
+
+	for (i = 1; i <= FIBER_YIELDS; i++) {
+		expected += 1.0 / (double)i;
+	}
+	snprintf(buffer, sizeof(buffer), "%.6f", expected);
+	expected = strtod(buffer, NULL);
+
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_fiber_scheduler_create(&scheduler, 2, 0));
+	for (i = 0; i < FIBER_YIELDS; i++) {
+		results[i] = 0.0;
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_fiber_create(NULL, scheduler, floatingPointFiber, &results[i]));
+	}
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_fiber_scheduler_shutdown(scheduler));
+	for (i = 0; i < FIBER_YIELDS; i++) {
+		ASSERT_EQ(expected, results[i]);
+	}
+}
+
+#else /* defined(LINUX) */
+
+TEST(FiberTest, Unsupported)
+{
+	omrthread_fiber_scheduler_t scheduler = NULL;
+
+	ASSERT_EQ(J9THREAD_ERR_UNSUPPORTED_PLAT, omrthread_fiber_scheduler_create(&scheduler, 1, 0));
+	ASSERT_TRUE(NULL == omrthread_fiber_self());
+}
+
+#endif /* defined(LINUX) */
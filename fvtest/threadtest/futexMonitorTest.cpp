@@ -0,0 +1,234 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Contended enter/exit, notifyAll handoff and wait/notify. These run against whichever
+ * blocking scheme the thread library was built with; the JLM park, wakeup and handoff
+ * counters are only checked when it was built with OMR_THR_FUTEX_MONITORS.
+ */
+
+#include <string.h>
+#include <string>
+
+#include "omrTest.h"
+#include "omrutilbase.h"
+#include "thread_api.h"
+
+#define FUTEX_TEST_THREADS 4
+#define FUTEX_TEST_ITERATIONS 10000
+#define FUTEX_TEST_ROUNDS 1000
+#define FUTEX_TEST_HOLD_MILLIS 50
+
+typedef struct FutexTestData {
+	omrthread_monitor_t monitor;
+	uintptr_t counter; /* protected by monitor */
+	uintptr_t turn; /* protected by monitor */
+	volatile uintptr_t started;
+	volatile uintptr_t finished;
+} FutexTestData;
+
+class FutexMonitorTest : public ::testing::Test
+{
+protected:
+	FutexTestData _data;
+
+	virtual void
+	SetUp()
+	{
+		memset(&_data, 0, sizeof(_data));
+#if defined(OMR_THR_JLM)
+		ASSERT_EQ(0, omrthread_jlm_init(J9THREAD_LIB_FLAG_JLM_ENABLED));
+#endif /* defined(OMR_THR_JLM) */
+		ASSERT_EQ(0, omrthread_monitor_init_with_name(&_data.monitor, 0, "futexMonitorTestMonitor"));
+	}
+
+	virtual void
+	TearDown()
+	{
+		omrthread_monitor_destroy(_data.monitor);
+#if defined(OMR_THR_JLM)
+		omrthread_jlm_init(0);
+#endif /* defined(OMR_THR_JLM) */
+	}
+
+	void
+	startThreads(omrthread_entrypoint_t entrypoint, uintptr_t count)
+	{
+		for (uintptr_t i = 0; i < count; i++) {
+			omrthread_t thread = NULL;
+			ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create(&thread, 0, J9THREAD_PRIORITY_NORMAL, 0, entrypoint, &_data));
+		}
+	}
+
+	void
+	waitFor(volatile uintptr_t *count, uintptr_t expected)
+	{
+		while (expected != compareAndSwapUDATA((uintptr_t *)count, 0, 0)) {
+			omrthread_yield();
+		}
+	}
+};
+
+static int J9THREAD_PROC
+enterExitThread(void *arg)
+{
+	FutexTestData *data = (FutexTestData *)arg;
+
+	addAtomic(&data->started, 1);
+	for (uintptr_t i = 0; i < FUTEX_TEST_ITERATIONS; i++) {
+		omrthread_monitor_enter(data->monitor);
+		data->counter += 1;
+		omrthread_monitor_exit(data->monitor);
+	}
+	addAtomic(&data->finished, 1);
+	return 0;
+}
+
+static int J9THREAD_PROC
+notifiedThread(void *arg)
+{
+	FutexTestData *data = (FutexTestData *)arg;
+
+	omrthread_monitor_enter(data->monitor);
+	addAtomic(&data->started, 1);
+	omrthread_monitor_wait(data->monitor);
+	data->counter += 1;
+	omrthread_monitor_exit(data->monitor);
+	addAtomic(&data->finished, 1);
+	return 0;
+}
+
+static int J9THREAD_PROC
+pongThread(void *arg)
+{
+	FutexTestData *data = (FutexTestData *)arg;
+
+	omrthread_monitor_enter(data->monitor);
+	addAtomic(&data->started, 1);
+	for (uintptr_t i = 0; i < FUTEX_TEST_ROUNDS; i++) {
+		while (1 != data->turn) {
+			omrthread_monitor_wait(data->monitor);
+		}
+		data->turn = 0;
+		data->counter += 1;
+		omrthread_monitor_notify(data->monitor);
+	}
+	omrthread_monitor_exit(data->monitor);
+	addAtomic(&data->finished, 1);
+	return 0;
+}
+
+/**
+ * Threads that block while the monitor is held, and then contend for it, all get in
+ */
+TEST_F(FutexMonitorTest, ContendedEnterExit)
+{
+	omrthread_monitor_enter(_data.monitor);
+	startThreads(enterExitThread, FUTEX_TEST_THREADS);
+	waitFor(&_data.started, FUTEX_TEST_THREADS);
+	omrthread_sleep(FUTEX_TEST_HOLD_MILLIS);
+	omrthread_monitor_exit(_data.monitor);
+	waitFor(&_data.finished, FUTEX_TEST_THREADS);
+
+	ASSERT_EQ((uintptr_t)(FUTEX_TEST_THREADS * FUTEX_TEST_ITERATIONS), _data.counter);
+#if defined(OMR_THR_JLM) && defined(OMR_THR_FUTEX_MONITORS)
+	{
+		J9ThreadMonitorTracing *tracing = omrthread_monitor_get_tracing(_data.monitor);
+		ASSERT_TRUE(NULL != tracing);
+		EXPECT_LE((uintptr_t)1, tracing->park_count);
+		EXPECT_EQ(tracing->park_count, tracing->wakeup_count);
+	}
+#endif /* defined(OMR_THR_JLM) && defined(OMR_THR_FUTEX_MONITORS) */
+}
+
+/**
+ * notifyAll wakes every waiter; with futex monitors each one wakes the next
+ */
+TEST_F(FutexMonitorTest, NotifyAllHandoff)
+{
+	startThreads(notifiedThread, FUTEX_TEST_THREADS);
+	waitFor(&_data.started, FUTEX_TEST_THREADS);
+
+	/* each thread counted itself while holding the monitor, so all of them are waiting once we get it */
+	omrthread_monitor_enter(_data.monitor);
+	ASSERT_EQ((uintptr_t)FUTEX_TEST_THREADS, omrthread_monitor_num_waiting(_data.monitor));
+	omrthread_monitor_notify_all(_data.monitor);
+	omrthread_monitor_exit(_data.monitor);
+	waitFor(&_data.finished, FUTEX_TEST_THREADS);
+
+	ASSERT_EQ((uintptr_t)FUTEX_TEST_THREADS, _data.counter);
+#if defined(OMR_THR_JLM) && defined(OMR_THR_FUTEX_MONITORS)
+	{
+		J9ThreadMonitorTracing *tracing = omrthread_monitor_get_tracing(_data.monitor);
+		ASSERT_TRUE(NULL != tracing);
+		EXPECT_EQ((uintptr_t)(FUTEX_TEST_THREADS - 1), tracing->notify_handoff_count);
+	}
+#endif /* defined(OMR_THR_JLM) && defined(OMR_THR_FUTEX_MONITORS) */
+}
+
+/**
+ * Two threads take turns, each notifying the other and waiting for its turn
+ */
+TEST_F(FutexMonitorTest, WaitNotify)
+{
+	startThreads(pongThread, 1);
+	waitFor(&_data.started, 1);
+
+	omrthread_monitor_enter(_data.monitor);
+	for (uintptr_t i = 0; i < FUTEX_TEST_ROUNDS; i++) {
+		_data.turn = 1;
+		omrthread_monitor_notify(_data.monitor);
+		while (0 != _data.turn) {
+			omrthread_monitor_wait(_data.monitor);
+		}
+	}
+	omrthread_monitor_exit(_data.monitor);
+	waitFor(&_data.finished, 1);
+
+	ASSERT_EQ((uintptr_t)FUTEX_TEST_ROUNDS, _data.counter);
+}
+
+#if defined(OMR_THR_JLM)
+static intptr_t
+appendToString(void *userData, const void *buffer, uintptr_t length)
+{
+	((std::string *)userData)->append((const char *)buffer, (size_t)length);
+	return 0;
+}
+
+/**
+ * The JLM dump has a line for a monitor that was entered, with the futex counters when they are kept
+ */
+TEST_F(FutexMonitorTest, JlmDump)
+{
+	std::string dump;
+
+	omrthread_monitor_enter(_data.monitor);
+	omrthread_monitor_exit(_data.monitor);
+
+	ASSERT_EQ(0, omrthread_jlm_dump(appendToString, &dump));
+	EXPECT_NE(std::string::npos, dump.find("futexMonitorTestMonitor")) << dump;
+#if defined(OMR_THR_FUTEX_MONITORS)
+	EXPECT_NE(std::string::npos, dump.find("handoffs")) << dump;
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+}
+#endif /* defined(OMR_THR_JLM) */
@@ -91,10 +91,11 @@ runRequest(SupportThreadInfo *info)
  * @param functionsToRun an array of functions pointers. Each function will be run one in sequence synchronized
  *        using the monitor within the SupporThreadInfo
  * @param numberFunctions the number of functions in the functionsToRun array
+ * @param rwmutexFlags the flags passed to omrthread_rwmutex_init
  * @returns a pointer to the newly created SupporThreadInfo
  */
 SupportThreadInfo *
-createSupportThreadInfo(omrthread_entrypoint_t *functionsToRun, uintptr_t numberFunctions)
+createSupportThreadInfoWithFlags(omrthread_entrypoint_t *functionsToRun, uintptr_t numberFunctions, uintptr_t rwmutexFlags)
 {
 	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
 	SupportThreadInfo *info = (SupportThreadInfo *)omrmem_allocate_memory(sizeof(SupportThreadInfo), OMRMEM_CATEGORY_THREADS);
@@ -103,11 +104,24 @@ createSupportThreadInfo(omrthread_entrypoint_t *functionsToRun, uintptr_t number
 	info->functionsToRun = functionsToRun;
 	info->numberFunctions = numberFunctions;
 	info->done = FALSE;
-	omrthread_rwmutex_init((omrthread_rwmutex_t *)&info->handle, 0, "supportThreadInfo rwmutex");
+	omrthread_rwmutex_init((omrthread_rwmutex_t *)&info->handle, rwmutexFlags, "supportThreadInfo rwmutex");
 	omrthread_monitor_init_with_name(&info->synchronization, 0, "supportThreadAInfo monitor");
 	return info;
 }
 
+/**
+ * This method is called to create a SupportThreadInfo for a test using a default rwmutex.
+ *
+ * @param functionsToRun an array of functions pointers
+ * @param numberFunctions the number of functions in the functionsToRun array
+ * @returns a pointer to the newly created SupporThreadInfo
+ */
+SupportThreadInfo *
+createSupportThreadInfo(omrthread_entrypoint_t *functionsToRun, uintptr_t numberFunctions)
+{
+	return createSupportThreadInfoWithFlags(functionsToRun, numberFunctions, 0);
+}
+
 /**
  * This method free the internal structures and memory for a SupportThreadInfo
  * @param info the SupportThreadInfo instance to be freed
@@ -1136,3 +1150,145 @@ TEST(RWMutex, WritersExcludedByWriterNonBlockTest)
 	triggerNextStepDone(info);
 	freeSupportThreadInfo(info);
 }
+
+/**
+ * Validate that we can enter/exit a distributed RWMutex for read, recursively and from
+ * within a write, and that it reports the write locked state
+ */
+TEST(RWMutex, DistributedEnterExitTest)
+{
+	intptr_t result;
+	omrthread_rwmutex_t handle;
+	const char *mutexName = "test_mutex";
+
+	result = omrthread_rwmutex_init(&handle, J9THREAD_RWMUTEX_DISTRIBUTED, mutexName);
+	ASSERT_TRUE(0 == result);
+
+	ASSERT_TRUE(0 == omrthread_rwmutex_enter_read(handle));
+	ASSERT_TRUE(0 == omrthread_rwmutex_enter_read(handle));
+	ASSERT_TRUE(FALSE == omrthread_rwmutex_is_writelocked(handle));
+	ASSERT_TRUE(J9THREAD_RWMUTEX_WOULDBLOCK == omrthread_rwmutex_try_enter_write(handle));
+	ASSERT_TRUE(0 == omrthread_rwmutex_exit_read(handle));
+	ASSERT_TRUE(0 == omrthread_rwmutex_exit_read(handle));
+
+	ASSERT_TRUE(0 == omrthread_rwmutex_enter_write(handle));
+	ASSERT_TRUE(TRUE == omrthread_rwmutex_is_writelocked(handle));
+	ASSERT_TRUE(0 == omrthread_rwmutex_enter_read(handle));
+	ASSERT_TRUE(0 == omrthread_rwmutex_exit_read(handle));
+	ASSERT_TRUE(0 == omrthread_rwmutex_exit_write(handle));
+	ASSERT_TRUE(FALSE == omrthread_rwmutex_is_writelocked(handle));
+
+	ASSERT_TRUE(0 == omrthread_rwmutex_try_enter_write(handle));
+	ASSERT_TRUE(0 == omrthread_rwmutex_exit_write(handle));
+
+	/* clean up */
+	result = omrthread_rwmutex_destroy(handle);
+	ASSERT_TRUE(0 == result);
+}
+
+/**
+ * validates that readers do not exclude each other on a distributed rwmutex
+ */
+TEST(RWMutex, DistributedMultipleReadersTest)
+{
+	SupportThreadInfo *info;
+	omrthread_entrypoint_t functionsToRun[2];
+	functionsToRun[0] = (omrthread_entrypoint_t) &enter_rwmutex_read;
+	functionsToRun[1] = (omrthread_entrypoint_t) &exit_rwmutex_read;
+	info = createSupportThreadInfoWithFlags(functionsToRun, 2, J9THREAD_RWMUTEX_DISTRIBUTED);
+	startConcurrentThread(info);
+
+	ASSERT_TRUE(1 == info->readCounter);
+	omrthread_rwmutex_enter_read(info->handle);
+	ASSERT_TRUE(1 == info->readCounter);
+	omrthread_rwmutex_exit_read(info->handle);
+
+	triggerNextStepDone(info);
+	ASSERT_TRUE(0 == info->readCounter);
+	freeSupportThreadInfo(info);
+}
+
+/**
+ * validates the following for a distributed rwmutex
+ *
+ * readers are excluded while another thread holds the rwmutex for write
+ * once writer exits, reader can enter
+ */
+TEST(RWMutex, DistributedReadersExcludedTest)
+{
+	SupportThreadInfo *info;
+	omrthread_entrypoint_t functionsToRun[2];
+	functionsToRun[0] = (omrthread_entrypoint_t) &enter_rwmutex_read;
+	functionsToRun[1] = (omrthread_entrypoint_t) &exit_rwmutex_read;
+	info = createSupportThreadInfoWithFlags(functionsToRun, 2, J9THREAD_RWMUTEX_DISTRIBUTED);
+
+	ASSERT_TRUE(0 == info->readCounter);
+	omrthread_rwmutex_enter_write(info->handle);
+
+	startConcurrentThread(info);
+	ASSERT_TRUE(0 == info->readCounter);
+
+	omrthread_monitor_enter(info->synchronization);
+	omrthread_rwmutex_exit_write(info->handle);
+	omrthread_monitor_wait_interruptable(info->synchronization, MILLI_TIMEOUT, NANO_TIMEOUT);
+	omrthread_monitor_exit(info->synchronization);
+	ASSERT_TRUE(1 == info->readCounter);
+
+	triggerNextStepDone(info);
+	ASSERT_TRUE(0 == info->readCounter);
+	freeSupportThreadInfo(info);
+}
+
+/**
+ * validates the following for a distributed rwmutex
+ *
+ * a writer waits for readers to drain, and a second reader arriving while the
+ * writer is draining still gets in and keeps the writer out
+ */
+TEST(RWMutex, DistributedSecondReaderExcludesWrite)
+{
+	omrthread_rwmutex_t saveHandle;
+	SupportThreadInfo *info;
+	SupportThreadInfo *infoReader;
+	omrthread_entrypoint_t functionsToRun[2];
+	omrthread_entrypoint_t functionsToRunReader[2];
+
+	functionsToRun[0] = (omrthread_entrypoint_t) &enter_rwmutex_write;
+	functionsToRun[1] = (omrthread_entrypoint_t) &exit_rwmutex_write;
+	functionsToRunReader[0] = (omrthread_entrypoint_t) &enter_rwmutex_read;
+	functionsToRunReader[1] = (omrthread_entrypoint_t) &exit_rwmutex_read;
+
+	info = createSupportThreadInfoWithFlags(functionsToRun, 2, J9THREAD_RWMUTEX_DISTRIBUTED);
+	infoReader = createSupportThreadInfoWithFlags(functionsToRunReader, 2, J9THREAD_RWMUTEX_DISTRIBUTED);
+
+	saveHandle = infoReader->handle;
+	infoReader->handle = info->handle;
+
+	ASSERT_TRUE(0 == info->writeCounter);
+	omrthread_rwmutex_enter_read(info->handle);
+
+	startConcurrentThread(info);
+	ASSERT_TRUE(0 == info->writeCounter);
+
+	startConcurrentThread(infoReader);
+	ASSERT_TRUE(1 == infoReader->readCounter);
+
+	omrthread_monitor_enter(info->synchronization);
+	omrthread_rwmutex_exit_read(infoReader->handle);
+	ASSERT_TRUE(0 == info->writeCounter);
+	ASSERT_TRUE(1 == infoReader->readCounter);
+
+	triggerNextStepDone(infoReader);
+	ASSERT_TRUE(0 == infoReader->readCounter);
+
+	omrthread_monitor_wait_interruptable(info->synchronization, MILLI_TIMEOUT, NANO_TIMEOUT);
+	omrthread_monitor_exit(info->synchronization);
+	ASSERT_TRUE(1 == info->writeCounter);
+
+	triggerNextStepDone(info);
+	ASSERT_TRUE(0 == info->writeCounter);
+
+	infoReader->handle = saveHandle;
+	freeSupportThreadInfo(info);
+	freeSupportThreadInfo(infoReader);
+}
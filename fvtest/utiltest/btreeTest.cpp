@@ -0,0 +1,194 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include "avl_api.h"
+#include "omrTest.h"
+#include "omrthread.h"
+#include "omrutilbase.h"
+#include "testEnvironment.hpp"
+
+extern PortEnvironment *omrTestEnv;
+
+/*
+ * Readers search and walk a J9BTree without locks while a writer inserts and deletes elements.
+ * The even ranges are never removed, so readers must always find them, and walks must always be
+ * in ascending order.
+ */
+
+#define STRESS_READERS 3
+#define STRESS_RANGES 8192
+#define STRESS_ROUNDS 8
+#define STRESS_STRIDE 16
+#define STRESS_LENGTH 8
+
+typedef struct StressRange {
+	uintptr_t start;
+	uintptr_t end;
+} StressRange;
+
+typedef struct StressData {
+	J9BTree *tree;
+	StressRange *ranges;
+	volatile uintptr_t *writerDone;
+	volatile uintptr_t *finishedCount;
+	uintptr_t seed;
+	uintptr_t failures;
+} StressData;
+
+static uintptr_t
+stressKey(J9BTree *tree, void *element)
+{
+	return ((StressRange *)element)->start;
+}
+
+static intptr_t
+stressComparator(J9BTree *tree, uintptr_t searchValue, void *element)
+{
+	StressRange *range = (StressRange *)element;
+
+	if (searchValue < range->start) {
+		return -1;
+	}
+	return (searchValue < range->end) ? 0 : 1;
+}
+
+static int J9THREAD_PROC
+stressWriter(void *arg)
+{
+	StressData *data = (StressData *)arg;
+	uintptr_t round = 0;
+
+	for (round = 0; round < STRESS_ROUNDS; round++) {
+		uintptr_t i = 0;
+
+		for (i = 1; i < STRESS_RANGES; i += 2) {
+			if (&data->ranges[i] != btree_insert(data->tree, &data->ranges[i])) {
+				data->failures += 1;
+			}
+		}
+		for (i = 1; i < STRESS_RANGES; i += 2) {
+			if (&data->ranges[i] != btree_delete(data->tree, &data->ranges[i])) {
+				data->failures += 1;
+			}
+		}
+	}
+	*data->writerDone = 1;
+	addAtomic(data->finishedCount, 1);
+	return 0;
+}
+
+static int J9THREAD_PROC
+stressReader(void *arg)
+{
+	StressData *data = (StressData *)arg;
+	uintptr_t random = data->seed;
+
+	while (0 == *data->writerDone) {
+		J9BTreeWalkState walkState;
+		StressRange *range = NULL;
+		uintptr_t previous = 0;
+		uintptr_t walked = 0;
+		uintptr_t i = 0;
+
+		for (i = 0; i < 64; i++) {
+			uintptr_t index = 0;
+
+			random = (random * 1103515245) + 12345;
+			index = ((random >> 8) % STRESS_RANGES) & ~(uintptr_t)1;
+			if (&data->ranges[index] != btree_search(data->tree, data->ranges[index].start + STRESS_LENGTH - 1)) {
+				data->failures += 1;
+			}
+			if (&data->ranges[index] != btree_floor(data->tree, data->ranges[index].start)) {
+				data->failures += 1;
+			}
+		}
+
+		random = (random * 1103515245) + 12345;
+		range = (StressRange *)btree_start_do(data->tree, ((random >> 8) % STRESS_RANGES) * STRESS_STRIDE, &walkState);
+		while ((NULL != range) && (walked < 256)) {
+			if ((0 != walked) && (range->start <= previous)) {
+				data->failures += 1;
+			}
+			/* no even range may be skipped */
+			if ((0 != walked) && ((range->start - previous) > (2 * STRESS_STRIDE))) {
+				data->failures += 1;
+			}
+			previous = range->start;
+			walked += 1;
+			range = (StressRange *)btree_next_do(&walkState);
+		}
+	}
+	addAtomic(data->finishedCount, 1);
+	return 0;
+}
+
+TEST(UtilTest, btreeConcurrentReaders)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	StressData data[STRESS_READERS + 1];
+	StressRange *ranges = NULL;
+	void **stable = NULL;
+	J9BTree *tree = NULL;
+	volatile uintptr_t writerDone = 0;
+	volatile uintptr_t finishedCount = 0;
+	uintptr_t i = 0;
+
+	tree = btree_new(OMRPORTLIB, OMRMEM_CATEGORY_VM, stressKey, stressComparator, NULL);
+	ASSERT_TRUE(NULL != tree);
+	ranges = (StressRange *)omrmem_allocate_memory(STRESS_RANGES * sizeof(StressRange), OMRMEM_CATEGORY_VM);
+	ASSERT_TRUE(NULL != ranges);
+	stable = (void **)omrmem_allocate_memory((STRESS_RANGES / 2) * sizeof(void *), OMRMEM_CATEGORY_VM);
+	ASSERT_TRUE(NULL != stable);
+	for (i = 0; i < STRESS_RANGES; i++) {
+		ranges[i].start = i * STRESS_STRIDE;
+		ranges[i].end = ranges[i].start + STRESS_LENGTH;
+		if (0 == (i & 1)) {
+			stable[i / 2] = &ranges[i];
+		}
+	}
+	ASSERT_EQ(0, btree_bulk_load(tree, stable, STRESS_RANGES / 2));
+
+	for (i = 0; i <= STRESS_READERS; i++) {
+		data[i].tree = tree;
+		data[i].ranges = ranges;
+		data[i].writerDone = &writerDone;
+		data[i].finishedCount = &finishedCount;
+		data[i].seed = i + 1;
+		data[i].failures = 0;
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create(NULL, 0, J9THREAD_PRIORITY_NORMAL, 0, (0 == i) ? stressWriter : stressReader, &data[i]));
+	}
+	while ((STRESS_READERS + 1) != finishedCount) {
+		omrthread_sleep(1);
+	}
+	for (i = 0; i <= STRESS_READERS; i++) {
+		EXPECT_EQ((uintptr_t)0, data[i].failures) << "thread " << i;
+	}
+
+	ASSERT_EQ((uintptr_t)(STRESS_RANGES / 2), btree_get_count(tree));
+	ASSERT_LT((uintptr_t)0, btree_reclaim(tree));
+	ASSERT_EQ((uintptr_t)0, btree_reclaim(tree));
+
+	omrmem_free_memory(stable);
+	omrmem_free_memory(ranges);
+	btree_free(tree);
+}
@@ -0,0 +1,289 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "hashtable_api.h"
+#include "omrTest.h"
+#include "omrthread.h"
+#include "omrutilbase.h"
+#include "testEnvironment.hpp"
+
+extern PortEnvironment *omrTestEnv;
+
+/*
+ * Contention benchmark comparing J9ConcurrentHashTable against a J9HashTable guarded by a monitor,
+ * which is how concurrent users of J9HashTable have to use it. Each thread runs a read-mostly mix:
+ * lookups of preloaded keys, plus adds and removes of keys private to the thread. The results are
+ * checked so the benchmark doubles as a stress test.
+ */
+
+#define BENCHMARK_THREADS 4
+#define BENCHMARK_PRELOADED_KEYS 4096
+#define BENCHMARK_PRIVATE_KEYS 2048
+#define BENCHMARK_LOOKUPS_PER_UPDATE 16
+#define BENCHMARK_ROUNDS 4
+
+typedef struct BenchmarkTables {
+	J9ConcurrentHashTable *concurrentTable;
+	J9HashTable *lockedTable;
+	omrthread_monitor_t lockedTableMonitor;
+} BenchmarkTables;
+
+typedef struct BenchmarkThreadData {
+	BenchmarkTables *tables;
+	uintptr_t threadIndex;
+	BOOLEAN useConcurrentTable;
+	volatile uintptr_t *startFlag;
+	volatile uintptr_t *finishedCount;
+	uintptr_t failures;
+} BenchmarkThreadData;
+
+static uintptr_t
+benchmarkHashFn(void *entry, void *userData)
+{
+	return *(uintptr_t *)entry;
+}
+
+static uintptr_t
+benchmarkEqualFn(void *leftEntry, void *rightEntry, void *userData)
+{
+	return *(uintptr_t *)leftEntry == *(uintptr_t *)rightEntry;
+}
+
+static void *
+benchmarkFind(BenchmarkThreadData *data, uintptr_t key)
+{
+	BenchmarkTables *tables = data->tables;
+	void *result = NULL;
+
+	if (data->useConcurrentTable) {
+		result = concurrentHashTableFind(tables->concurrentTable, &key);
+	} else {
+		omrthread_monitor_enter(tables->lockedTableMonitor);
+		result = hashTableFind(tables->lockedTable, &key);
+		omrthread_monitor_exit(tables->lockedTableMonitor);
+	}
+	return result;
+}
+
+static void *
+benchmarkAdd(BenchmarkThreadData *data, uintptr_t key)
+{
+	BenchmarkTables *tables = data->tables;
+	void *result = NULL;
+
+	if (data->useConcurrentTable) {
+		result = concurrentHashTableAdd(tables->concurrentTable, &key);
+	} else {
+		omrthread_monitor_enter(tables->lockedTableMonitor);
+		result = hashTableAdd(tables->lockedTable, &key);
+		omrthread_monitor_exit(tables->lockedTableMonitor);
+	}
+	return result;
+}
+
+static uint32_t
+benchmarkRemove(BenchmarkThreadData *data, uintptr_t key)
+{
+	BenchmarkTables *tables = data->tables;
+	uint32_t result = 0;
+
+	if (data->useConcurrentTable) {
+		result = concurrentHashTableRemove(tables->concurrentTable, &key);
+	} else {
+		omrthread_monitor_enter(tables->lockedTableMonitor);
+		result = hashTableRemove(tables->lockedTable, &key);
+		omrthread_monitor_exit(tables->lockedTableMonitor);
+	}
+	return result;
+}
+
+static int J9THREAD_PROC
+benchmarkThread(void *arg)
+{
+	BenchmarkThreadData *data = (BenchmarkThreadData *)arg;
+	uintptr_t privateBase = BENCHMARK_PRELOADED_KEYS + (data->threadIndex * BENCHMARK_PRIVATE_KEYS);
+	uintptr_t random = data->threadIndex + 1;
+	uintptr_t round = 0;
+
+	while (0 == *data->startFlag) {
+		omrthread_yield();
+	}
+	for (round = 0; round < BENCHMARK_ROUNDS; round++) {
+		uintptr_t i = 0;
+
+		for (i = 0; i < BENCHMARK_PRIVATE_KEYS; i++) {
+			uintptr_t key = privateBase + i;
+			uintptr_t *entry = (uintptr_t *)benchmarkAdd(data, key);
+			uintptr_t j = 0;
+
+			if ((NULL == entry) || (*entry != key)) {
+				data->failures += 1;
+			}
+			for (j = 0; j < BENCHMARK_LOOKUPS_PER_UPDATE; j++) {
+				random = (random * 1103515245) + 12345;
+				key = (random >> 8) % BENCHMARK_PRELOADED_KEYS;
+				entry = (uintptr_t *)benchmarkFind(data, key);
+				if ((NULL == entry) || (*entry != key)) {
+					data->failures += 1;
+				}
+			}
+		}
+		for (i = 0; i < BENCHMARK_PRIVATE_KEYS; i++) {
+			if (0 != benchmarkRemove(data, privateBase + i)) {
+				data->failures += 1;
+			}
+		}
+	}
+	addAtomic(data->finishedCount, 1);
+	return 0;
+}
+
+/**
+ * Run the benchmark mix on one kind of table and return the elapsed time in nanoseconds
+ */
+static uint64_t
+runBenchmark(BenchmarkTables *tables, BOOLEAN useConcurrentTable)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	BenchmarkThreadData data[BENCHMARK_THREADS];
+	volatile uintptr_t startFlag = 0;
+	volatile uintptr_t finishedCount = 0;
+	uint64_t start = 0;
+	uintptr_t i = 0;
+
+	for (i = 0; i < BENCHMARK_THREADS; i++) {
+		data[i].tables = tables;
+		data[i].threadIndex = i;
+		data[i].useConcurrentTable = useConcurrentTable;
+		data[i].startFlag = &startFlag;
+		data[i].finishedCount = &finishedCount;
+		data[i].failures = 0;
+		EXPECT_EQ(J9THREAD_SUCCESS, omrthread_create(NULL, 0, J9THREAD_PRIORITY_NORMAL, 0, benchmarkThread, &data[i]));
+	}
+	start = omrtime_nano_time();
+	startFlag = 1;
+	while (BENCHMARK_THREADS != finishedCount) {
+		omrthread_sleep(1);
+	}
+	for (i = 0; i < BENCHMARK_THREADS; i++) {
+		EXPECT_EQ((uintptr_t)0, data[i].failures) << "thread " << i;
+	}
+	return omrtime_nano_time() - start;
+}
+
+TEST(UtilTest, concurrentHashtableContention)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	BenchmarkTables tables;
+	uint64_t concurrentTime = 0;
+	uint64_t lockedTime = 0;
+	uintptr_t key = 0;
+
+	tables.concurrentTable = concurrentHashTableNew(OMRPORTLIB, "benchmark", 0, sizeof(uintptr_t), OMRMEM_CATEGORY_VM, benchmarkHashFn, benchmarkEqualFn, NULL, NULL);
+	ASSERT_TRUE(NULL != tables.concurrentTable);
+	tables.lockedTable = hashTableNew(OMRPORTLIB, "benchmark", 0, sizeof(uintptr_t), 0, 0, OMRMEM_CATEGORY_VM, benchmarkHashFn, benchmarkEqualFn, NULL, NULL);
+	ASSERT_TRUE(NULL != tables.lockedTable);
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&tables.lockedTableMonitor, 0, "benchmark table"));
+
+	for (key = 0; key < BENCHMARK_PRELOADED_KEYS; key++) {
+		ASSERT_TRUE(NULL != concurrentHashTableAdd(tables.concurrentTable, &key));
+		ASSERT_TRUE(NULL != hashTableAdd(tables.lockedTable, &key));
+	}
+
+	lockedTime = runBenchmark(&tables, FALSE);
+	concurrentTime = runBenchmark(&tables, TRUE);
+
+	ASSERT_EQ((uintptr_t)BENCHMARK_PRELOADED_KEYS, concurrentHashTableGetCount(tables.concurrentTable));
+	ASSERT_EQ((uint32_t)BENCHMARK_PRELOADED_KEYS, hashTableGetCount(tables.lockedTable));
+	ASSERT_EQ((uintptr_t)(BENCHMARK_THREADS * BENCHMARK_PRIVATE_KEYS * BENCHMARK_ROUNDS), concurrentHashTableReclaim(tables.concurrentTable));
+
+	omrtty_printf("%d threads: monitor-guarded J9HashTable %llu ms, J9ConcurrentHashTable %llu ms\n",
+		BENCHMARK_THREADS, lockedTime / 1000000, concurrentTime / 1000000);
+
+	omrthread_monitor_destroy(tables.lockedTableMonitor);
+	hashTableFree(tables.lockedTable);
+	concurrentHashTableFree(tables.concurrentTable);
+}
+
+typedef struct RacingAddData {
+	J9ConcurrentHashTable *table;
+	volatile uintptr_t *startFlag;
+	volatile uintptr_t *finishedCount;
+	void *results[BENCHMARK_PRIVATE_KEYS];
+} RacingAddData;
+
+static int J9THREAD_PROC
+racingAddThread(void *arg)
+{
+	RacingAddData *data = (RacingAddData *)arg;
+	uintptr_t key = 0;
+
+	while (0 == *data->startFlag) {
+		omrthread_yield();
+	}
+	for (key = 0; key < BENCHMARK_PRIVATE_KEYS; key++) {
+		data->results[key] = concurrentHashTableAdd(data->table, &key);
+	}
+	addAtomic(data->finishedCount, 1);
+	return 0;
+}
+
+TEST(UtilTest, concurrentHashtableRacingAdds)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	J9ConcurrentHashTable *table = NULL;
+	RacingAddData *data = NULL;
+	volatile uintptr_t startFlag = 0;
+	volatile uintptr_t finishedCount = 0;
+	uintptr_t i = 0;
+	uintptr_t key = 0;
+
+	/* start small so the racing adds also race with growth */
+	table = concurrentHashTableNew(OMRPORTLIB, "racing", 0, sizeof(uintptr_t), OMRMEM_CATEGORY_VM, benchmarkHashFn, benchmarkEqualFn, NULL, NULL);
+	ASSERT_TRUE(NULL != table);
+	data = (RacingAddData *)omrmem_allocate_memory(sizeof(RacingAddData) * BENCHMARK_THREADS, OMRMEM_CATEGORY_VM);
+	ASSERT_TRUE(NULL != data);
+
+	for (i = 0; i < BENCHMARK_THREADS; i++) {
+		data[i].table = table;
+		data[i].startFlag = &startFlag;
+		data[i].finishedCount = &finishedCount;
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create(NULL, 0, J9THREAD_PRIORITY_NORMAL, 0, racingAddThread, &data[i]));
+	}
+	startFlag = 1;
+	while (BENCHMARK_THREADS != finishedCount) {
+		omrthread_sleep(1);
+	}
+
+	/* every thread must have been given the single copy of each entry */
+	ASSERT_EQ((uintptr_t)BENCHMARK_PRIVATE_KEYS, concurrentHashTableGetCount(table));
+	for (key = 0; key < BENCHMARK_PRIVATE_KEYS; key++) {
+		void *entry = concurrentHashTableFind(table, &key);
+		ASSERT_TRUE(NULL != entry);
+		for (i = 0; i < BENCHMARK_THREADS; i++) {
+			ASSERT_EQ(entry, data[i].results[key]);
+		}
+	}
+
+	omrmem_free_memory(data);
+	concurrentHashTableFree(table);
+}
@@ -0,0 +1,162 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "omrTest.h"
+#include "omrutil.h"
+#include "testEnvironment.hpp"
+
+extern PortEnvironment *omrTestEnv;
+
+#define CRC_TEST_BUFFER_SIZE (64 * 1024 + 64)
+#define CRC_BENCHMARK_BUFFER_SIZE (1024 * 1024)
+#define CRC_BENCHMARK_ROUNDS 64
+
+static const U_32 implementations[] = { OMRCRC32_BYTEWISE, OMRCRC32_SLICE_BY_8, OMRCRC32_HARDWARE };
+static const char *const implementationNames[] = { "bytewise", "slice-by-8", "hardware" };
+
+static void
+fillTestBuffer(U_8 *buffer, UDATA size)
+{
+	U_32 seed = 12345;
+	UDATA i = 0;
+
+	for (i = 0; i < size; i++) {
+		seed = (seed * 1103515245) + 12345;
+		buffer[i] = (U_8)(seed >> 16);
+	}
+}
+
+/**
+ * Check values from the CRC catalogue, and RFC 3720 for CRC-32C
+ */
+TEST(UtilTest, crc32KnownValues)
+{
+	U_8 check[] = "123456789";
+	U_8 zeros[32];
+	U_8 ones[32];
+	UDATA i = 0;
+
+	memset(zeros, 0, sizeof(zeros));
+	memset(ones, 0xff, sizeof(ones));
+	for (i = 0; i < sizeof(implementations) / sizeof(implementations[0]); i++) {
+		U_32 impl = implementations[i];
+
+		EXPECT_EQ(0xcbf43926U, omrcrc32UsingImplementation(0, check, 9, FALSE, impl)) << implementationNames[i];
+		EXPECT_EQ(0x190a55adU, omrcrc32UsingImplementation(0, zeros, 32, FALSE, impl)) << implementationNames[i];
+		EXPECT_EQ(0xe3069283U, omrcrc32UsingImplementation(0, check, 9, TRUE, impl)) << implementationNames[i];
+		EXPECT_EQ(0x8a9136aaU, omrcrc32UsingImplementation(0, zeros, 32, TRUE, impl)) << implementationNames[i];
+		EXPECT_EQ(0x62a8ab43U, omrcrc32UsingImplementation(0, ones, 32, TRUE, impl)) << implementationNames[i];
+		EXPECT_EQ(0U, omrcrc32UsingImplementation(0, check, 0, FALSE, impl)) << implementationNames[i];
+	}
+	EXPECT_EQ(0xcbf43926U, omrcrc32(0, check, 9));
+	EXPECT_EQ(0xe3069283U, omrcrc32c(0, check, 9));
+	EXPECT_EQ(0U, omrcrc32(0, NULL, 9));
+	EXPECT_EQ(0U, omrcrc32c(0, NULL, 9));
+}
+
+/**
+ * Every implementation agrees with the bytewise one, for all alignments and lengths around the
+ * block sizes, and when a buffer is checksummed in pieces using different implementations
+ */
+TEST(UtilTest, crc32CrossCheck)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	U_8 *buffer = (U_8 *)omrmem_allocate_memory(CRC_TEST_BUFFER_SIZE, OMRMEM_CATEGORY_VM);
+	const U_32 lengths[] = { 1, 7, 8, 15, 16, 17, 63, 64, 65, 127, 128, 129, 255, 1000, 4096, 65536 };
+	UDATA castagnoli = 0;
+
+	ASSERT_TRUE(NULL != buffer);
+	fillTestBuffer(buffer, CRC_TEST_BUFFER_SIZE);
+
+	for (castagnoli = 0; castagnoli < 2; castagnoli++) {
+		UDATA offset = 0;
+
+		for (offset = 0; offset < 16; offset++) {
+			UDATA l = 0;
+
+			for (l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+				U_32 expected = omrcrc32UsingImplementation(0x1234, buffer + offset, lengths[l], (BOOLEAN)castagnoli, OMRCRC32_BYTEWISE);
+				UDATA i = 0;
+
+				for (i = 1; i < sizeof(implementations) / sizeof(implementations[0]); i++) {
+					ASSERT_EQ(expected, omrcrc32UsingImplementation(0x1234, buffer + offset, lengths[l], (BOOLEAN)castagnoli, implementations[i]))
+						<< implementationNames[i] << " castagnoli=" << castagnoli << " offset=" << offset << " length=" << lengths[l];
+				}
+			}
+		}
+
+		{
+			U_32 whole = omrcrc32UsingImplementation(0, buffer, CRC_TEST_BUFFER_SIZE, (BOOLEAN)castagnoli, OMRCRC32_BYTEWISE);
+			U_32 split = 0;
+
+			split = omrcrc32UsingImplementation(0, buffer, 1000, (BOOLEAN)castagnoli, OMRCRC32_HARDWARE);
+			split = omrcrc32UsingImplementation(split, buffer + 1000, 3, (BOOLEAN)castagnoli, OMRCRC32_BYTEWISE);
+			split = omrcrc32UsingImplementation(split, buffer + 1003, 20000, (BOOLEAN)castagnoli, OMRCRC32_SLICE_BY_8);
+			if (castagnoli) {
+				split = omrcrc32c(split, buffer + 21003, CRC_TEST_BUFFER_SIZE - 21003);
+			} else {
+				split = omrcrc32(split, buffer + 21003, CRC_TEST_BUFFER_SIZE - 21003);
+			}
+			ASSERT_EQ(whole, split) << "castagnoli=" << castagnoli;
+		}
+	}
+
+	omrmem_free_memory(buffer);
+}
+
+/**
+ * Report the throughput of each implementation
+ */
+TEST(UtilTest, crc32Throughput)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	U_8 *buffer = (U_8 *)omrmem_allocate_memory(CRC_BENCHMARK_BUFFER_SIZE, OMRMEM_CATEGORY_VM);
+	UDATA castagnoli = 0;
+
+	ASSERT_TRUE(NULL != buffer);
+	fillTestBuffer(buffer, CRC_BENCHMARK_BUFFER_SIZE);
+
+	for (castagnoli = 0; castagnoli < 2; castagnoli++) {
+		UDATA i = 0;
+
+		for (i = 0; i < sizeof(implementations) / sizeof(implementations[0]); i++) {
+			U_64 start = omrtime_nano_time();
+			U_64 elapsed = 0;
+			U_32 crc = 0;
+			UDATA round = 0;
+
+			if ((OMRCRC32_HARDWARE == implementations[i]) && (OMRCRC32_HARDWARE != omrcrc32Implementation((BOOLEAN)castagnoli))) {
+				continue;
+			}
+			for (round = 0; round < CRC_BENCHMARK_ROUNDS; round++) {
+				crc = omrcrc32UsingImplementation(crc, buffer, CRC_BENCHMARK_BUFFER_SIZE, (BOOLEAN)castagnoli, implementations[i]);
+			}
+			elapsed = omrtime_nano_time() - start;
+			omrtty_printf("%s %s: %llu MB/s (crc %08x)\n", castagnoli ? "crc32c" : "crc32", implementationNames[i],
+				(elapsed > 0) ? ((U_64)CRC_BENCHMARK_ROUNDS * CRC_BENCHMARK_BUFFER_SIZE * 1000 / elapsed) : 0, crc);
+		}
+	}
+
+	omrmem_free_memory(buffer);
+}
@@ -25,13 +25,20 @@
 #include "omrutil.h"
 
 #include "omrTest.h"
+#include "testEnvironment.hpp"
+
+PortEnvironment *omrTestEnv;
 
 int
 main(int argc, char **argv, char **envp)
 {
 	::testing::InitGoogleTest(&argc, argv);
 	OMREventListener::setDefaultTestListener();
-	return RUN_ALL_TESTS();
+	INITIALIZE_THREADLIBRARY_AND_ATTACH();
+	omrTestEnv = (PortEnvironment *)testing::AddGlobalTestEnvironment(new PortEnvironment(argc, argv));
+	int rc = RUN_ALL_TESTS();
+	DETACH_AND_DESTROY_THREADLIBRARY();
+	return rc;
 }
 
 TEST(UtilTest, detectVMDirectory)
@@ -0,0 +1,162 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrTest.h"
+#include "omrthread.h"
+#include "omrutil.h"
+#include "omrutilbase.h"
+#include "pool_api.h"
+#include "testEnvironment.hpp"
+
+extern PortEnvironment *omrTestEnv;
+
+/*
+ * Threads allocate and free through their own magazines of a shared POOL_USES_MAGAZINES pool. Half
+ * of each thread's elements are handed to its neighbour to free, so elements regularly travel between
+ * magazines through the depot. Every element carries its owner's tag, which would be clobbered if an
+ * element were ever handed out twice.
+ */
+
+#define MAGAZINE_THREADS 4
+#define MAGAZINE_ELEMENTS_PER_ROUND 300
+#define MAGAZINE_ROUNDS 50
+
+typedef struct MagazineThreadData {
+	J9Pool *pool;
+	uintptr_t threadIndex;
+	struct MagazineThreadData *neighbour;
+	volatile uintptr_t *startFlag;
+	volatile uintptr_t *finishedCount;
+	/* elements allocated by the neighbour for this thread to free */
+	void * volatile handoff[MAGAZINE_ELEMENTS_PER_ROUND];
+	volatile uintptr_t handoffReady;
+	uintptr_t failures;
+} MagazineThreadData;
+
+static int J9THREAD_PROC
+magazineThread(void *arg)
+{
+	MagazineThreadData *data = (MagazineThreadData *)arg;
+	uintptr_t *elements[MAGAZINE_ELEMENTS_PER_ROUND];
+	J9PoolMagazine magazine;
+	uintptr_t round = 0;
+	uintptr_t i = 0;
+
+	pool_magazineInit(data->pool, &magazine);
+	while (0 == *data->startFlag) {
+		omrthread_yield();
+	}
+	for (round = 0; round < MAGAZINE_ROUNDS; round++) {
+		uintptr_t tag = (data->threadIndex << 16) | round;
+
+		for (i = 0; i < MAGAZINE_ELEMENTS_PER_ROUND; i++) {
+			elements[i] = (uintptr_t *)pool_magazineNewElement(&magazine);
+			if (NULL == elements[i]) {
+				/* out of memory: give up, the test will hang rather than report a bogus count */
+				data->failures += 1;
+				return 0;
+			}
+			if (0 != elements[i][0]) {
+				data->failures += 1;
+			}
+			elements[i][0] = tag;
+		}
+		/* wait for the neighbour to take the previous round's handoff */
+		while (0 != data->neighbour->handoffReady) {
+			omrthread_yield();
+		}
+		for (i = 0; i < MAGAZINE_ELEMENTS_PER_ROUND; i++) {
+			if (tag != elements[i][0]) {
+				data->failures += 1;
+			}
+			if (0 == (i % 2)) {
+				pool_magazineRemoveElement(&magazine, elements[i]);
+			} else {
+				data->neighbour->handoff[i] = elements[i];
+			}
+		}
+		issueWriteBarrier();
+		data->neighbour->handoffReady = 1;
+
+		/* free what the other neighbour handed to this thread */
+		while (0 == data->handoffReady) {
+			omrthread_yield();
+		}
+		issueReadBarrier();
+		for (i = 1; i < MAGAZINE_ELEMENTS_PER_ROUND; i += 2) {
+			pool_magazineRemoveElement(&magazine, data->handoff[i]);
+		}
+		data->handoffReady = 0;
+	}
+	pool_magazineFlush(&magazine);
+	addAtomic(data->finishedCount, 1);
+	return 0;
+}
+
+static void
+countMagazinePoolElement(void *anElement, void *userData)
+{
+	*(uintptr_t *)userData += 1;
+}
+
+TEST(UtilTest, poolMagazinesAcrossThreads)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	MagazineThreadData *data = NULL;
+	volatile uintptr_t startFlag = 0;
+	volatile uintptr_t finishedCount = 0;
+	uintptr_t count = 0;
+	uintptr_t i = 0;
+	J9Pool *pool = pool_new(2 * sizeof(uintptr_t), 0, 0, POOL_USES_MAGAZINES, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(OMRPORTLIB));
+
+	ASSERT_TRUE(NULL != pool);
+	data = (MagazineThreadData *)omrmem_allocate_memory(sizeof(MagazineThreadData) * MAGAZINE_THREADS, OMRMEM_CATEGORY_VM);
+	ASSERT_TRUE(NULL != data);
+	memset(data, 0, sizeof(MagazineThreadData) * MAGAZINE_THREADS);
+
+	for (i = 0; i < MAGAZINE_THREADS; i++) {
+		data[i].pool = pool;
+		data[i].threadIndex = i + 1;
+		data[i].neighbour = &data[(i + 1) % MAGAZINE_THREADS];
+		data[i].startFlag = &startFlag;
+		data[i].finishedCount = &finishedCount;
+	}
+	for (i = 0; i < MAGAZINE_THREADS; i++) {
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create(NULL, 0, J9THREAD_PRIORITY_NORMAL, 0, magazineThread, &data[i]));
+	}
+	startFlag = 1;
+	while (MAGAZINE_THREADS != finishedCount) {
+		omrthread_sleep(1);
+	}
+
+	for (i = 0; i < MAGAZINE_THREADS; i++) {
+		ASSERT_EQ((uintptr_t)0, data[i].failures);
+	}
+	/* every element was freed, wherever it is cached */
+	ASSERT_EQ((uintptr_t)0, pool_numElements(pool));
+	pool_do(pool, countMagazinePoolElement, &count);
+	ASSERT_EQ((uintptr_t)0, count);
+	ASSERT_TRUE(pool_capacity(pool) >= (uintptr_t)(MAGAZINE_THREADS * MAGAZINE_ELEMENTS_PER_ROUND / 2));
+
+	omrmem_free_memory(data);
+	pool_kill(pool);
+}
@@ -0,0 +1,320 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "omrTest.h"
+#include "omrutil.h"
+#include "testEnvironment.hpp"
+
+extern PortEnvironment *omrTestEnv;
+
+#define UTF8_TEST_CHARS 1000
+#define UTF8_BENCHMARK_CHARS (256 * 1024)
+#define UTF8_BENCHMARK_ROUNDS 32
+
+/**
+ * Fill a buffer with UTF-16 characters, mostly ASCII in runs of varying length when asciiPercent is high
+ */
+static void
+fillTestChars(U_16 *buffer, UDATA count, U_32 asciiPercent)
+{
+	U_32 seed = 12345;
+	UDATA i = 0;
+
+	for (i = 0; i < count; i++) {
+		seed = (seed * 1103515245) + 12345;
+		if (((seed >> 8) % 100) < asciiPercent) {
+			buffer[i] = (U_16)(0x20 + ((seed >> 16) % 0x5f));
+		} else {
+			switch ((seed >> 16) % 4) {
+			case 0:
+				buffer[i] = 0;
+				break;
+			case 1:
+				buffer[i] = (U_16)(0x80 + ((seed >> 18) % 0x780));
+				break;
+			case 2:
+				buffer[i] = (U_16)(0x800 + ((seed >> 14) % 0xf800));
+				break;
+			default:
+				buffer[i] = (U_16)(0x01 + ((seed >> 20) % 0x7f));
+				break;
+			}
+		}
+	}
+}
+
+/**
+ * Encode characters one at a time
+ */
+static UDATA
+encodeCharByChar(const U_16 *chars, UDATA count, U_8 *output)
+{
+	UDATA produced = 0;
+	UDATA i = 0;
+
+	for (i = 0; i < count; i++) {
+		produced += encodeUTF8CharN(chars[i], output + produced, 3);
+	}
+	return produced;
+}
+
+TEST(UtilTest, utf8KnownValues)
+{
+	const U_8 mixed[] = { 'a', 0xc0, 0x80, 0xc3, 0xa9, 0xe2, 0x82, 0xac, 'z' };
+	const U_16 mixedChars[] = { 'a', 0, 0xe9, 0x20ac, 'z' };
+	const U_8 rawNul[] = { 'a', 0, 'b' };
+	const U_8 fourByte[] = { 0xf0, 0x9f, 0x98, 0x80 };
+	const U_8 truncated[] = { 'a', 0xe2, 0x82 };
+	const U_8 badContinuation[] = { 0xc3, 0x41 };
+	U_16 chars[16];
+	U_8 bytes[32];
+	const U_8 *input = mixed;
+	UDATA inputLength = sizeof(mixed);
+	const U_16 *charInput = mixedChars;
+	UDATA charsRemaining = 5;
+
+	EXPECT_EQ(5, validateUTF8String(mixed, sizeof(mixed)));
+	EXPECT_EQ(0, validateUTF8String(mixed, 0));
+	EXPECT_EQ(-1, validateUTF8String(rawNul, sizeof(rawNul)));
+	EXPECT_EQ(-1, validateUTF8String(fourByte, sizeof(fourByte)));
+	EXPECT_EQ(-1, validateUTF8String(truncated, sizeof(truncated)));
+	EXPECT_EQ(-1, validateUTF8String(badContinuation, sizeof(badContinuation)));
+	EXPECT_EQ(1U, scanUTF8ASCII(mixed, sizeof(mixed)));
+	EXPECT_EQ(1U, scanUTF8ASCII(rawNul, sizeof(rawNul)));
+
+	ASSERT_EQ(5, decodeUTF8String(&input, &inputLength, chars, 16));
+	EXPECT_EQ(0U, inputLength);
+	EXPECT_EQ(0, memcmp(chars, mixedChars, sizeof(mixedChars)));
+
+	/* the output buffer limits how much is decoded */
+	input = mixed;
+	inputLength = sizeof(mixed);
+	ASSERT_EQ(3, decodeUTF8String(&input, &inputLength, chars, 3));
+	EXPECT_EQ(mixed + 5, input);
+	EXPECT_EQ(sizeof(mixed) - 5, inputLength);
+
+	/* an error leaves the input at the bad character */
+	input = truncated;
+	inputLength = sizeof(truncated);
+	EXPECT_EQ(-1, decodeUTF8String(&input, &inputLength, chars, 16));
+	EXPECT_EQ(truncated + 1, input);
+
+	EXPECT_EQ(sizeof(mixed), encodedUTF8Length(mixedChars, 5));
+	ASSERT_EQ(sizeof(mixed), encodeUTF8String(&charInput, &charsRemaining, bytes, sizeof(bytes)));
+	EXPECT_EQ(0U, charsRemaining);
+	EXPECT_EQ(0, memcmp(bytes, mixed, sizeof(mixed)));
+
+	/* a character which does not fit is not split */
+	charInput = mixedChars;
+	charsRemaining = 5;
+	ASSERT_EQ(5U, encodeUTF8String(&charInput, &charsRemaining, bytes, 7));
+	EXPECT_EQ(2U, charsRemaining);
+	EXPECT_EQ(mixedChars + 3, charInput);
+}
+
+/**
+ * The bulk functions agree with the per-character ones, for all alignments and for
+ * lengths around the block sizes, and can be resumed when the output buffer is full
+ */
+TEST(UtilTest, utf8CrossCheck)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	const U_32 asciiPercents[] = { 100, 99, 90, 50, 0 };
+	const UDATA lengths[] = { 1, 15, 16, 17, 31, 32, 33, 63, 64, 65, 200, UTF8_TEST_CHARS - 16 };
+	U_16 *chars = (U_16 *)omrmem_allocate_memory(UTF8_TEST_CHARS * sizeof(U_16), OMRMEM_CATEGORY_VM);
+	U_16 *decoded = (U_16 *)omrmem_allocate_memory((UTF8_TEST_CHARS + 1) * sizeof(U_16), OMRMEM_CATEGORY_VM);
+	U_8 *expected = (U_8 *)omrmem_allocate_memory(UTF8_TEST_CHARS * 3, OMRMEM_CATEGORY_VM);
+	U_8 *encoded = (U_8 *)omrmem_allocate_memory(UTF8_TEST_CHARS * 3 + 16, OMRMEM_CATEGORY_VM);
+	UDATA p = 0;
+
+	ASSERT_TRUE(NULL != chars);
+	ASSERT_TRUE(NULL != decoded);
+	ASSERT_TRUE(NULL != expected);
+	ASSERT_TRUE(NULL != encoded);
+
+	for (p = 0; p < sizeof(asciiPercents) / sizeof(asciiPercents[0]); p++) {
+		UDATA offset = 0;
+
+		fillTestChars(chars, UTF8_TEST_CHARS, asciiPercents[p]);
+		for (offset = 0; offset < 16; offset++) {
+			UDATA l = 0;
+
+			for (l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+				const U_16 *source = chars + offset;
+				UDATA count = lengths[l];
+				UDATA expectedLength = encodeCharByChar(source, count, expected);
+				const U_16 *charCursor = source;
+				UDATA charsRemaining = count;
+				const U_8 *byteCursor = NULL;
+				UDATA bytesRemaining = 0;
+				UDATA encodedLength = 0;
+				UDATA decodedCount = 0;
+				UDATA i = 0;
+
+				ASSERT_EQ(expectedLength, encodedUTF8Length(source, count));
+				ASSERT_EQ(expectedLength, encodeUTF8String(&charCursor, &charsRemaining, encoded + offset, expectedLength))
+					<< "ascii=" << asciiPercents[p] << " offset=" << offset << " length=" << count;
+				ASSERT_EQ(0U, charsRemaining);
+				ASSERT_EQ(0, memcmp(expected, encoded + offset, expectedLength));
+
+				ASSERT_EQ((IDATA)count, validateUTF8String(expected, expectedLength));
+				for (i = 0; i < expectedLength; i++) {
+					if ((0 == expected[i]) || (expected[i] >= 0x80)) {
+						break;
+					}
+				}
+				ASSERT_EQ(i, scanUTF8ASCII(expected, expectedLength));
+
+				byteCursor = expected;
+				bytesRemaining = expectedLength;
+				ASSERT_EQ((IDATA)count, decodeUTF8String(&byteCursor, &bytesRemaining, decoded + (offset % 2), count + 1));
+				ASSERT_EQ(0U, bytesRemaining);
+				ASSERT_EQ(0, memcmp(source, decoded + (offset % 2), count * sizeof(U_16)))
+					<< "ascii=" << asciiPercents[p] << " offset=" << offset << " length=" << count;
+
+				/* resume with small output buffers */
+				charCursor = source;
+				charsRemaining = count;
+				while (charsRemaining > 0) {
+					UDATA produced = encodeUTF8String(&charCursor, &charsRemaining, encoded + encodedLength, 5 + (encodedLength % 23));
+					ASSERT_TRUE(0 != produced);
+					encodedLength += produced;
+				}
+				ASSERT_EQ(expectedLength, encodedLength);
+				ASSERT_EQ(0, memcmp(expected, encoded, expectedLength));
+
+				byteCursor = expected;
+				bytesRemaining = expectedLength;
+				while (bytesRemaining > 0) {
+					IDATA result = decodeUTF8String(&byteCursor, &bytesRemaining, decoded + decodedCount, 1 + (decodedCount % 37));
+					ASSERT_TRUE(result > 0);
+					decodedCount += result;
+				}
+				ASSERT_EQ(count, decodedCount);
+				ASSERT_EQ(0, memcmp(source, decoded, count * sizeof(U_16)));
+
+				/* a bad byte anywhere is found */
+				if (expectedLength > 2) {
+					UDATA bad = (offset * 7919) % expectedLength;
+					U_8 saved = expected[bad];
+					U_16 unused = 0;
+					UDATA position = 0;
+					BOOLEAN valid = TRUE;
+
+					expected[bad] = 0xf8;
+					while (position < expectedLength) {
+						U_32 consumed = decodeUTF8CharN(expected + position, &unused, expectedLength - position);
+						if (0 == consumed) {
+							valid = FALSE;
+							break;
+						}
+						position += consumed;
+					}
+					ASSERT_FALSE(valid);
+					ASSERT_EQ(-1, validateUTF8String(expected, expectedLength));
+					byteCursor = expected;
+					bytesRemaining = expectedLength;
+					ASSERT_EQ(-1, decodeUTF8String(&byteCursor, &bytesRemaining, decoded, count + 1));
+					ASSERT_EQ(expected + position, byteCursor);
+					expected[bad] = saved;
+				}
+			}
+		}
+	}
+
+	omrmem_free_memory(encoded);
+	omrmem_free_memory(expected);
+	omrmem_free_memory(decoded);
+	omrmem_free_memory(chars);
+}
+
+/**
+ * Report the throughput of the bulk and per-character conversions
+ */
+TEST(UtilTest, utf8Throughput)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	const U_32 asciiPercents[] = { 100, 90 };
+	U_16 *chars = (U_16 *)omrmem_allocate_memory(UTF8_BENCHMARK_CHARS * sizeof(U_16), OMRMEM_CATEGORY_VM);
+	U_8 *bytes = (U_8 *)omrmem_allocate_memory(UTF8_BENCHMARK_CHARS * 3, OMRMEM_CATEGORY_VM);
+	UDATA p = 0;
+
+	ASSERT_TRUE(NULL != chars);
+	ASSERT_TRUE(NULL != bytes);
+
+	for (p = 0; p < sizeof(asciiPercents) / sizeof(asciiPercents[0]); p++) {
+		UDATA length = 0;
+		U_64 start = 0;
+		U_64 charByChar = 0;
+		U_64 bulk = 0;
+		UDATA round = 0;
+
+		fillTestChars(chars, UTF8_BENCHMARK_CHARS, asciiPercents[p]);
+		length = encodeCharByChar(chars, UTF8_BENCHMARK_CHARS, bytes);
+
+		start = omrtime_nano_time();
+		for (round = 0; round < UTF8_BENCHMARK_ROUNDS; round++) {
+			UDATA position = 0;
+			UDATA count = 0;
+			while (position < length) {
+				position += decodeUTF8CharN(bytes + position, chars + count, length - position);
+				count += 1;
+			}
+		}
+		charByChar = omrtime_nano_time() - start;
+
+		start = omrtime_nano_time();
+		for (round = 0; round < UTF8_BENCHMARK_ROUNDS; round++) {
+			const U_8 *cursor = bytes;
+			UDATA remaining = length;
+			decodeUTF8String(&cursor, &remaining, chars, UTF8_BENCHMARK_CHARS);
+		}
+		bulk = omrtime_nano_time() - start;
+
+		omrtty_printf("decode %u%% ascii: per-char %llu MB/s, bulk %llu MB/s\n", asciiPercents[p],
+			(charByChar > 0) ? ((U_64)UTF8_BENCHMARK_ROUNDS * length * 1000 / charByChar) : 0,
+			(bulk > 0) ? ((U_64)UTF8_BENCHMARK_ROUNDS * length * 1000 / bulk) : 0);
+
+		start = omrtime_nano_time();
+		for (round = 0; round < UTF8_BENCHMARK_ROUNDS; round++) {
+			encodeCharByChar(chars, UTF8_BENCHMARK_CHARS, bytes);
+		}
+		charByChar = omrtime_nano_time() - start;
+
+		start = omrtime_nano_time();
+		for (round = 0; round < UTF8_BENCHMARK_ROUNDS; round++) {
+			const U_16 *cursor = chars;
+			UDATA remaining = UTF8_BENCHMARK_CHARS;
+			encodeUTF8String(&cursor, &remaining, bytes, UTF8_BENCHMARK_CHARS * 3);
+		}
+		bulk = omrtime_nano_time() - start;
+
+		omrtty_printf("encode %u%% ascii: per-char %llu MB/s, bulk %llu MB/s\n", asciiPercents[p],
+			(charByChar > 0) ? ((U_64)UTF8_BENCHMARK_ROUNDS * length * 1000 / charByChar) : 0,
+			(bulk > 0) ? ((U_64)UTF8_BENCHMARK_ROUNDS * length * 1000 / bulk) : 0);
+	}
+
+	omrmem_free_memory(bytes);
+	omrmem_free_memory(chars);
+}
@@ -71,6 +71,131 @@ avl_insert(J9AVLTree *tree, J9AVLTreeNode *nodeToInsert);
 J9AVLTreeNode *
 avl_search(J9AVLTree *tree, uintptr_t searchValue);
 
+/* ---------------- btree.c ---------------- */
+
+/**
+* @brief
+* @param *portLibrary
+* @param memoryCategory
+* @param keyFunction
+* @param searchComparator
+* @param *userData
+* @return J9BTree *
+*/
+J9BTree *
+btree_new(OMRPortLibrary *portLibrary, uint32_t memoryCategory,
+	uintptr_t (*keyFunction)(J9BTree *tree, void *element),
+	intptr_t (*searchComparator)(J9BTree *tree, uintptr_t searchValue, void *element),
+	void *userData);
+
+
+/**
+* @brief
+* @param *tree
+* @return void
+*/
+void
+btree_free(J9BTree *tree);
+
+
+/**
+* @brief
+* @param *tree
+* @param *element
+* @return void *
+*/
+void *
+btree_insert(J9BTree *tree, void *element);
+
+
+/**
+* @brief
+* @param *tree
+* @param *element
+* @return void *
+*/
+void *
+btree_delete(J9BTree *tree, void *element);
+
+
+/**
+* @brief
+* @param *tree
+* @param **elements
+* @param count
+* @return intptr_t
+*/
+intptr_t
+btree_bulk_load(J9BTree *tree, void **elements, uintptr_t count);
+
+
+/**
+* @brief
+* @param *tree
+* @param searchValue
+* @return void *
+*/
+void *
+btree_search(J9BTree *tree, uintptr_t searchValue);
+
+
+/**
+* @brief
+* @param *tree
+* @param key
+* @return void *
+*/
+void *
+btree_floor(J9BTree *tree, uintptr_t key);
+
+
+/**
+* @brief
+* @param *tree
+* @param key
+* @return void *
+*/
+void *
+btree_ceiling(J9BTree *tree, uintptr_t key);
+
+
+/**
+* @brief
+* @param *tree
+* @param fromKey
+* @param *state
+* @return void *
+*/
+void *
+btree_start_do(J9BTree *tree, uintptr_t fromKey, J9BTreeWalkState *state);
+
+
+/**
+* @brief
+* @param *state
+* @return void *
+*/
+void *
+btree_next_do(J9BTreeWalkState *state);
+
+
+/**
+* @brief
+* @param *tree
+* @return uintptr_t
+*/
+uintptr_t
+btree_get_count(J9BTree *tree);
+
+
+/**
+* @brief
+* @param *tree
+* @return uintptr_t
+*/
+uintptr_t
+btree_reclaim(J9BTree *tree);
+
 
 #ifdef __cplusplus
 }
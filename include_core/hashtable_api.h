@@ -200,6 +200,118 @@ void *
 hashTableStartDo(J9HashTable *table,  J9HashTableState *handle);
 
 
+/* ---------------- concurrenthashtable.c ---------------- */
+
+/**
+* @brief
+* @param *table
+* @param *entry
+* @return void *
+*/
+void *
+concurrentHashTableAdd(J9ConcurrentHashTable *table, void *entry);
+
+
+/**
+* @brief
+* @param *handle
+* @return uintptr_t
+*/
+uintptr_t
+concurrentHashTableDoRemove(J9ConcurrentHashTableState *handle);
+
+
+/**
+* @brief
+* @param *table
+* @param *entry
+* @return void *
+*/
+void *
+concurrentHashTableFind(J9ConcurrentHashTable *table, void *entry);
+
+
+/**
+* @brief
+* @param *table
+* @return void
+*/
+void
+concurrentHashTableFree(J9ConcurrentHashTable *table);
+
+
+/**
+* @brief
+* @param *table
+* @return uintptr_t
+*/
+uintptr_t
+concurrentHashTableGetCount(J9ConcurrentHashTable *table);
+
+
+/**
+* @brief
+* @param *portLibrary
+* @param *tableName
+* @param tableSize
+* @param entrySize
+* @param memoryCategory
+* @param hashFn
+* @param hashEqualFn
+* @param printFn
+* @param *functionUserData
+* @return J9ConcurrentHashTable *
+*/
+J9ConcurrentHashTable *
+concurrentHashTableNew(
+	OMRPortLibrary *portLibrary,
+	const char *tableName,
+	uint32_t tableSize,
+	uint32_t entrySize,
+	uint32_t memoryCategory,
+	J9HashTableHashFn hashFn,
+	J9HashTableEqualFn hashEqualFn,
+	J9HashTablePrintFn printFn,
+	void *functionUserData);
+
+
+/**
+* @brief
+* @param *handle
+* @return void *
+*/
+void *
+concurrentHashTableNextDo(J9ConcurrentHashTableState *handle);
+
+
+/**
+* @brief
+* @param *table
+* @return uintptr_t
+*/
+uintptr_t
+concurrentHashTableReclaim(J9ConcurrentHashTable *table);
+
+
+/**
+* @brief
+* @param *table
+* @param *entry
+* @return uint32_t
+*/
+uint32_t
+concurrentHashTableRemove(J9ConcurrentHashTable *table, void *entry);
+
+
+/**
+* @brief
+* @param *table
+* @param *handle
+* @return void *
+*/
+void *
+concurrentHashTableStartDo(J9ConcurrentHashTable *table, J9ConcurrentHashTableState *handle);
+
 
 #ifdef __cplusplus
 }
@@ -79,17 +79,45 @@ typedef struct J9Pool {
 	uint16_t alignment;
 	uint16_t flags;
 	uint32_t memoryCategory;
+	struct J9PoolMagazineDepot *depot;
 } J9Pool;
 
 #define POOL_NO_ZERO  8
 #define POOL_ROUND_TO_PAGE_SIZE  16
 #define POOL_USES_HOLES  32
+#define POOL_USES_MAGAZINES  64
 #define POOL_NEVER_FREE_PUDDLES  2
 #define POOL_ALLOC_TYPE_PUDDLE  1
 #define POOL_ALWAYS_KEEP_SORTED  4
 #define POOL_ALLOC_TYPE_PUDDLE_LIST  2
 #define POOL_ALLOC_TYPE_POOL  0
 
+/*
+ * @ddr_namespace: map_to_type=J9PoolMagazine
+ */
+
+#define J9POOL_MAGAZINE_SIZE  32
+#define J9POOL_DEPOT_MAGAZINES  16
+
+/**
+ * A cache of free elements owned by a single thread, for pools created with POOL_USES_MAGAZINES.
+ * See pool_magazineNewElement.
+ */
+typedef struct J9PoolMagazine {
+	struct J9Pool *pool;
+	uintptr_t count;
+	void *elements[J9POOL_MAGAZINE_SIZE];
+} J9PoolMagazine;
+
+/**
+ * Full magazines shared by all threads of a pool created with POOL_USES_MAGAZINES.
+ */
+typedef struct J9PoolMagazineDepot {
+	volatile uintptr_t lock;
+	uintptr_t fullCount;
+	void *full[J9POOL_DEPOT_MAGAZINES][J9POOL_MAGAZINE_SIZE];
+} J9PoolMagazineDepot;
+
 /*
  * @ddr_namespace: map_to_type=J9PoolState
  */
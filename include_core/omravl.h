@@ -38,6 +38,48 @@ extern "C" {
 
 #include "j9nongenerated.h"
 
+/**
+ * A J9BTree node is J9BTREE_NODE_SIZE bytes, allocated on a cache line boundary. Its keys are
+ * contiguous, so that a search reads few cache lines per level rather than one node per comparison.
+ */
+#define J9BTREE_NODE_SIZE 256
+#define J9BTREE_NODE_ALIGNMENT 64
+#if defined(OMR_ENV_DATA64)
+#define J9BTREE_NODE_SLOTS 15
+#else /* defined(OMR_ENV_DATA64) */
+#define J9BTREE_NODE_SLOTS 30
+#endif /* defined(OMR_ENV_DATA64) */
+/* Nodes hold at least J9BTREE_NODE_SLOTS / 2 entries when they are split, which bounds the height */
+#define J9BTREE_MAX_HEIGHT 24
+
+typedef struct J9BTreeNode {
+	uint32_t count;
+	uint32_t level; /* 0 for leaves, whose values are elements; the values of other nodes are child nodes */
+	struct J9BTreeNode *retiredNext;
+	uintptr_t keys[J9BTREE_NODE_SLOTS]; /* ascending; in interior nodes, the smallest key of each child */
+	void *values[J9BTREE_NODE_SLOTS];
+} J9BTreeNode;
+
+typedef struct J9BTree {
+	uintptr_t (*keyFunction)(struct J9BTree *tree, void *element) ;
+	intptr_t (*searchComparator)(struct J9BTree *tree, uintptr_t searchValue, void *element) ;
+	struct J9BTreeNode *volatile rootNode;
+	uintptr_t elementCount;
+	uintptr_t retiredCount;
+	struct J9BTreeNode *retiredNodes;
+	struct J9Pool *nodePool;
+	struct OMRPortLibrary *portLibrary;
+	uint32_t memoryCategory;
+	void *userData;
+} J9BTree;
+
+typedef struct J9BTreeWalkState {
+	struct J9BTree *tree;
+	uintptr_t depth; /* levels in path, 0 once the walk is complete */
+	struct J9BTreeNode *path[J9BTREE_MAX_HEIGHT];
+	uintptr_t index[J9BTREE_MAX_HEIGHT];
+} J9BTreeWalkState;
+
 #ifdef __cplusplus
 }
 #endif
@@ -51,6 +51,18 @@ extern "C" {
 #define J9HASH_TABLE_ALLOCATE_ELEMENTS_USING_MALLOC32	0x00000004	/*!< Allocate table elements using the malloc32 function */
 #define J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION	0x00000008	/*!< Allow space optimized hashTable, some functions not supported */
 #define J9HASH_TABLE_DO_NOT_REHASH	0x00000010	/*!< Do not rehash the table while set */
+#define J9HASH_TABLE_OPEN_ADDRESSING	0x00000020	/*!< Store entries in an open-addressed array probed by control-byte groups instead of chaining */
+
+/*
+ * Open-addressed tables differ from chained tables in two ways callers can see:
+ * - All entries live in the slot array, so once it reaches its load limit hashTableAdd returns NULL
+ *   while J9HASH_TABLE_DO_NOT_GROW or J9HASH_TABLE_DO_NOT_REHASH is set. Chained tables also stop
+ *   adding when full while J9HASH_TABLE_DO_NOT_GROW is set, but keep adding to their chains while
+ *   only J9HASH_TABLE_DO_NOT_REHASH is set.
+ * - Entries of up to four pointers are stored in the slot array, so the pointers hashTableAdd and
+ *   hashTableFind return for them move when the table grows or is rehashed. Larger entries are
+ *   allocated separately and do not move.
+ */
 
 /*
  * This used to include a cast to uintptr_t, but ddrgen doesn't
@@ -86,7 +98,8 @@ extern "C" {
 /**
 * Hash table state queries
 */
-#define hashTableIsSpaceOptimized(table) (NULL == table->listNodePool)
+#define hashTableIsOpenAddressing(table) (J9HASH_TABLE_OPEN_ADDRESSING == ((table)->flags & J9HASH_TABLE_OPEN_ADDRESSING))
+#define hashTableIsSpaceOptimized(table) ((NULL == (table)->listNodePool) && !hashTableIsOpenAddressing(table))
 
 
 struct J9HashTable; /* Forward struct declaration */
@@ -108,7 +121,10 @@ typedef struct J9HashTable {
 	uint32_t flags;
 	uint32_t memoryCategory;
 	uint32_t listToTreeThreshold;
+	uint32_t slotSize;
+	uint32_t growthLeft;
 	void **nodes;
+	uint8_t *controlBytes;
 	struct J9Pool *listNodePool;
 	struct J9Pool *treeNodePool;
 	struct J9Pool *treePool;
@@ -132,6 +148,37 @@ typedef struct J9HashTableState {
 	uintptr_t flags;
 } J9HashTableState;
 
+/**
+ * Number of bucket segments in a J9ConcurrentHashTable. Segment 0 holds the initial buckets and each
+ * later segment doubles the bucket count, so a table never copies its bucket array when it grows.
+ * A table stops growing once its last segment is in use.
+ */
+#define J9CONCURRENT_HASH_TABLE_SEGMENT_COUNT 24
+
+typedef struct J9ConcurrentHashTable {
+	const char *tableName;
+	uint32_t entrySize;
+	uint32_t nodeSize;
+	uint32_t memoryCategory;
+	uintptr_t initialBucketCount;
+	volatile uintptr_t bucketCount;
+	volatile uintptr_t numberOfNodes;
+	volatile uintptr_t retiredNodes;
+	void *volatile segments[J9CONCURRENT_HASH_TABLE_SEGMENT_COUNT];
+	uintptr_t (*hashFn)(void *key, void *userData) ;
+	uintptr_t (*hashEqualFn)(void *leftKey, void *rightKey, void *userData) ;
+	void (*printFn)(OMRPortLibrary *portLibrary, void *key, void *userData) ;
+	struct OMRPortLibrary *portLibrary;
+	void *equalFnUserData;
+	void *hashFnUserData;
+} J9ConcurrentHashTable;
+
+typedef struct J9ConcurrentHashTableState {
+	struct J9ConcurrentHashTable *table;
+	void *currentNode;
+	uintptr_t didDeleteCurrentNode;
+} J9ConcurrentHashTableState;
+
 #ifdef __cplusplus
 }
 #endif
@@ -49,6 +49,8 @@ omrhook_lib_control(const char *key, uintptr_t value);
 
 struct J9HookInterface; /* Forward struct declaration */
 typedef void (*J9HookFunction)(struct J9HookInterface **hookInterface, uintptr_t eventNum, void *eventData, void *userData); /* Forward struct declaration */
+/* receives eventCount copies of the event data, each eventDataSize bytes, in the order they were reported by one thread */
+typedef void (*J9HookBatchFunction)(struct J9HookInterface **hookInterface, uintptr_t eventNum, void *eventDataArray, uintptr_t eventCount, void *userData);
 typedef struct J9HookInterface {
 	void (*J9HookDispatch)(struct J9HookInterface **hookInterface, uintptr_t eventNum, void *eventData);
 	intptr_t (*J9HookDisable)(struct J9HookInterface **hookInterface, uintptr_t eventNum);
@@ -61,6 +63,10 @@ typedef struct J9HookInterface {
 	intptr_t (*J9HookIsEnabled)(struct J9HookInterface **hookInterface, uintptr_t eventNum);
 	uintptr_t (*J9HookAllocateAgentID)(struct J9HookInterface **hookInterface);
 	void (*J9HookDeallocateAgentID)(struct J9HookInterface **hookInterface, uintptr_t agentID);
+	intptr_t (*J9HookEnableCompiledDispatch)(struct J9HookInterface **hookInterface);
+	intptr_t (*J9HookRegisterBatched)(struct J9HookInterface **hookInterface, uintptr_t eventNum, J9HookBatchFunction function, uintptr_t eventDataSize, uintptr_t batchSize, void *userData);
+	void (*J9HookUnregisterBatched)(struct J9HookInterface **hookInterface, uintptr_t eventNum, J9HookBatchFunction function, void *userData);
+	void (*J9HookFlushBatches)(struct J9HookInterface **hookInterface);
 } J9HookInterface;
 
 
@@ -109,6 +115,14 @@ typedef struct J9CommonHookInterface {
 	struct OMRPortLibrary *portLib;		/* for accessing PortLibrary  */
 	uint64_t threshold4Trace;			/* the threshold for triggering tracepoint */
 	uintptr_t eventSize;				/* how many events supported by this hook interface */
+	volatile uintptr_t compiledDispatch;	/* dispatch from the listener snapshots instead of the records */
+	struct J9HookSnapshot * volatile *snapshots;	/* per-event immutable listener arrays, see J9HookEnableCompiledDispatch */
+	struct J9HookSnapshot *retiredSnapshots;	/* replaced snapshots, most recently replaced first, freed once no dispatch can hold them */
+	volatile uintptr_t snapshotEpoch;	/* advanced by rebuilds once no dispatch from the epoch before it is in progress */
+	volatile uintptr_t snapshotDispatches[2];	/* dispatches in progress, indexed by the parity of the epoch they started in */
+	struct J9HookBatchListener *batchListeners;	/* every batched listener registered, freed when the interface is shut down */
+	struct J9HookThreadBatches *threadBatches;	/* per-thread batch buffers */
+	omrthread_tls_key_t batchKey;			/* TLS key of the per-thread batch buffers, or 0 */
 } J9CommonHookInterface;
 
 
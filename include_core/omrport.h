@@ -888,6 +888,7 @@ typedef struct J9ProcessorInfos {
 #define OMRPORT_CTLDATA_VMEM_HUGE_PAGES_MMAP_ENABLED "VMEM_HUGE_PAGES_MMAP_ENABLED"
 #define OMRPORT_CTLDATA_CRIU_SUPPORT_FLAGS "CRIU_SUPPORT_FLAGS"
 #define OMRPORT_CTLDATA_MEM_32BIT "MEM_32BIT_FLAGS"
+#define OMRPORT_CTLDATA_TIME_FAST_TICKS  "TIME_FAST_TICKS"
 
 /* OMRPORT_CTLDATA_MEM_32BIT Flags */
 #define OMRPORT_MEM_32BIT_FLAGS_TMP_FILE_BACKED_VMEM 0x1
@@ -912,6 +913,9 @@ typedef struct J9ProcessorInfos {
 #define OMRPORT_MMAP_CAPABILITY_UMAP_REQUIRES_SIZE  8
 #define OMRPORT_MMAP_CAPABILITY_MSYNC  16
 #define OMRPORT_MMAP_CAPABILITY_PROTECT  32
+#define OMRPORT_MMAP_CAPABILITY_ADVISE  64
+#define OMRPORT_MMAP_CAPABILITY_POPULATE  128
+#define OMRPORT_MMAP_CAPABILITY_HUGE_PAGES  256
 #define OMRPORT_MMAP_FLAG_CREATE_FILE  1
 #define OMRPORT_MMAP_FLAG_READ  2
 #define OMRPORT_MMAP_FLAG_WRITE  4
@@ -928,6 +932,17 @@ typedef struct J9ProcessorInfos {
 #if defined(J9ZOS390)
 #define OMRPORT_MMAP_FLAG_ZOS_READ_MAPFILE  0x800
 #endif /* defined(J9ZOS390) */
+/* Access pattern hints, accepted by omrmmap_map_file and omrmmap_advise */
+#define OMRPORT_MMAP_FLAG_ADVISE_SEQUENTIAL  0x1000
+#define OMRPORT_MMAP_FLAG_ADVISE_RANDOM  0x2000
+#define OMRPORT_MMAP_FLAG_ADVISE_WILLNEED  0x4000
+/* Fault the whole mapping in before omrmmap_map_file returns */
+#define OMRPORT_MMAP_FLAG_POPULATE  0x8000
+/* Back the mapping with huge pages where the file system supports it */
+#define OMRPORT_MMAP_FLAG_HUGE_PAGES  0x10000
+#define OMRPORT_MMAP_ADVICE_MASK (OMRPORT_MMAP_FLAG_ADVISE_SEQUENTIAL | OMRPORT_MMAP_FLAG_ADVISE_RANDOM | OMRPORT_MMAP_FLAG_ADVISE_WILLNEED | OMRPORT_MMAP_FLAG_HUGE_PAGES)
+/* Offsets of the windows mapped by omrmmap_window_map are multiples of this */
+#define OMRPORT_MMAP_WINDOW_ALIGNMENT  ((uintptr_t)64 * 1024)
 
 /* Signal classification bits. */
 #define OMRPORT_SIG_FLAG_MAY_RETURN             ((uint32_t)0x01)
@@ -1250,6 +1265,9 @@ typedef struct J9MmapHandle {
 	OMRMemCategory *category;
 } J9MmapHandle;
 
+/* A sliding window over a file, see omrmmap_window_open */
+typedef struct J9MmapWindow J9MmapWindow;
+
 #if !defined(OMR_OS_WINDOWS)
 #if defined(OSX)
 #define _XOPEN_SOURCE
@@ -1886,6 +1904,85 @@ struct omrshmem_handle;
 struct OMRPortLibrary;
 typedef struct J9Heap J9Heap;
 
+/**
+ * @name Memory Arenas
+ * Bump allocation for short-lived scratch memory. An arena is owned by a single thread;
+ * a pool may be shared by many arenas, and threads, to recycle chunks.
+ * @{
+ */
+typedef struct OMRMemArena OMRMemArena;
+typedef struct OMRMemArenaPool OMRMemArenaPool;
+
+/* Opaque position in an arena, see omrmem_arena_mark and omrmem_arena_rewind */
+typedef struct OMRMemArenaMark {
+	void *chunk;
+	void *largeChunk;
+	uint8_t *alloc;
+} OMRMemArenaMark;
+
+#define OMRPORT_MEM_ARENA_DEFAULT_CHUNK_SIZE ((uintptr_t)64 * 1024)
+/** @} */
+
+/**
+ * @name Asynchronous File I/O
+ * Requests are queued on a context and complete in the background, either through io_uring
+ * or a pool of worker threads. A context is owned by one thread, which submits and reaps.
+ * @{
+ */
+typedef struct OMRFileAIOContext OMRFileAIOContext;
+
+/* Layout compatible with struct iovec */
+typedef struct OMRFileAIOVec {
+	void *buffer;
+	uintptr_t length;
+} OMRFileAIOVec;
+
+struct OMRFileAIORequest;
+typedef void (*omrfile_aio_callback)(struct OMRPortLibrary *portLibrary, struct OMRFileAIORequest *request);
+
+typedef struct OMRFileAIORequest {
+	intptr_t fd;
+	uint32_t opcode;
+	/* index of a buffer from omrfile_aio_register_buffers, or OMRPORT_FILE_AIO_NO_FIXED_BUFFER */
+	int32_t fixedBufferIndex;
+	/* file offset, or -1 for the current file position */
+	int64_t offset;
+	/* OMRPORT_FILE_AIO_READ and OMRPORT_FILE_AIO_WRITE */
+	void *buffer;
+	uintptr_t length;
+	/* OMRPORT_FILE_AIO_READV and OMRPORT_FILE_AIO_WRITEV */
+	OMRFileAIOVec *vecs;
+	uintptr_t vecCount;
+	/* called on the reaping thread, may be NULL */
+	omrfile_aio_callback callback;
+	void *userData;
+	/* bytes transferred, or a negative portable error code */
+	intptr_t result;
+	volatile uintptr_t state;
+	/* private to the port library */
+	struct OMRFileAIORequest *next;
+} OMRFileAIORequest;
+
+#define OMRPORT_FILE_AIO_READ 1
+#define OMRPORT_FILE_AIO_WRITE 2
+#define OMRPORT_FILE_AIO_READV 3
+#define OMRPORT_FILE_AIO_WRITEV 4
+#define OMRPORT_FILE_AIO_FSYNC 5
+
+#define OMRPORT_FILE_AIO_NO_FIXED_BUFFER -1
+
+#define OMRPORT_FILE_AIO_STATE_IDLE 0
+#define OMRPORT_FILE_AIO_STATE_PENDING 1
+#define OMRPORT_FILE_AIO_STATE_COMPLETE 2
+
+/* flags for omrfile_aio_create */
+#define OMRPORT_FILE_AIO_FORCE_THREADS 0x1
+
+/* values returned by omrfile_aio_backend */
+#define OMRPORT_FILE_AIO_BACKEND_THREADS 1
+#define OMRPORT_FILE_AIO_BACKEND_IO_URING 2
+/** @} */
+
 typedef uintptr_t (*omrsig_protected_fn)(struct OMRPortLibrary *portLib, void *handler_arg);
 typedef uintptr_t (*omrsig_handler_fn)(struct OMRPortLibrary *portLib, uint32_t gpType, void *gpInfo, void *handler_arg);
 
@@ -2610,6 +2707,76 @@ typedef struct OMRPortLibrary {
 	int32_t (*sock_getsockopt_linger)(struct OMRPortLibrary *portLibrary, omrsock_socket_t handle, int32_t optlevel, int32_t optname, omrsock_linger_t optval) ;
 	/** see @ref omrsock.c::omrsock_getsockopt_timeval "omrsock_getsockopt_timeval"*/
 	int32_t (*sock_getsockopt_timeval)(struct OMRPortLibrary *portLibrary, omrsock_socket_t handle, int32_t optlevel, int32_t optname, omrsock_timeval_t optval) ;
+	/** see @ref omrmemarena.c::omrmem_arena_pool_create "omrmem_arena_pool_create"*/
+	OMRMemArenaPool *(*mem_arena_pool_create)(struct OMRPortLibrary *portLibrary, uintptr_t chunkSize, uintptr_t maxFreeChunks, uint32_t category) ;
+	/** see @ref omrmemarena.c::omrmem_arena_pool_destroy "omrmem_arena_pool_destroy"*/
+	void (*mem_arena_pool_destroy)(struct OMRPortLibrary *portLibrary, OMRMemArenaPool *pool) ;
+	/** see @ref omrmemarena.c::omrmem_arena_create "omrmem_arena_create"*/
+	OMRMemArena *(*mem_arena_create)(struct OMRPortLibrary *portLibrary, uintptr_t chunkSize, uint32_t category, OMRMemArenaPool *pool) ;
+	/** see @ref omrmemarena.c::omrmem_arena_destroy "omrmem_arena_destroy"*/
+	void (*mem_arena_destroy)(struct OMRPortLibrary *portLibrary, OMRMemArena *arena) ;
+	/** see @ref omrmemarena.c::omrmem_arena_allocate "omrmem_arena_allocate"*/
+	void *(*mem_arena_allocate)(struct OMRPortLibrary *portLibrary, OMRMemArena *arena, uintptr_t byteAmount) ;
+	/** see @ref omrmemarena.c::omrmem_arena_mark "omrmem_arena_mark"*/
+	void (*mem_arena_mark)(struct OMRPortLibrary *portLibrary, OMRMemArena *arena, OMRMemArenaMark *mark) ;
+	/** see @ref omrmemarena.c::omrmem_arena_rewind "omrmem_arena_rewind"*/
+	void (*mem_arena_rewind)(struct OMRPortLibrary *portLibrary, OMRMemArena *arena, const OMRMemArenaMark *mark) ;
+	/** see @ref omrmemarena.c::omrmem_arena_reset "omrmem_arena_reset"*/
+	void (*mem_arena_reset)(struct OMRPortLibrary *portLibrary, OMRMemArena *arena) ;
+	/** see @ref omrmemarena.c::omrmem_arena_release "omrmem_arena_release"*/
+	void (*mem_arena_release)(struct OMRPortLibrary *portLibrary, OMRMemArena *arena) ;
+	/** see @ref omrmemarena.c::omrmem_arena_thread_scratch "omrmem_arena_thread_scratch"*/
+	OMRMemArena *(*mem_arena_thread_scratch)(struct OMRPortLibrary *portLibrary) ;
+	/** see @ref omrmemcategories.c::omrmem_get_category_counters "omrmem_get_category_counters"*/
+	int32_t (*mem_get_category_counters)(struct OMRPortLibrary *portLibrary, uint32_t categoryCode, uintptr_t *liveBytes, uintptr_t *liveAllocations) ;
+	/** see @ref omrfileaio.c::omrfile_aio_create "omrfile_aio_create"*/
+	int32_t (*file_aio_create)(struct OMRPortLibrary *portLibrary, uint32_t queueDepth, uint32_t flags, OMRFileAIOContext **context) ;
+	/** see @ref omrfileaio.c::omrfile_aio_destroy "omrfile_aio_destroy"*/
+	void (*file_aio_destroy)(struct OMRPortLibrary *portLibrary, OMRFileAIOContext *context) ;
+	/** see @ref omrfileaio.c::omrfile_aio_register_buffers "omrfile_aio_register_buffers"*/
+	int32_t (*file_aio_register_buffers)(struct OMRPortLibrary *portLibrary, OMRFileAIOContext *context, OMRFileAIOVec *buffers, uint32_t count) ;
+	/** see @ref omrfileaio.c::omrfile_aio_submit "omrfile_aio_submit"*/
+	intptr_t (*file_aio_submit)(struct OMRPortLibrary *portLibrary, OMRFileAIOContext *context, OMRFileAIORequest **requests, uintptr_t count) ;
+	/** see @ref omrfileaio.c::omrfile_aio_reap "omrfile_aio_reap"*/
+	intptr_t (*file_aio_reap)(struct OMRPortLibrary *portLibrary, OMRFileAIOContext *context, uintptr_t minCompletions) ;
+	/** see @ref omrfileaio.c::omrfile_aio_get_event_fd "omrfile_aio_get_event_fd"*/
+	intptr_t (*file_aio_get_event_fd)(struct OMRPortLibrary *portLibrary, OMRFileAIOContext *context) ;
+	/** see @ref omrfileaio.c::omrfile_aio_backend "omrfile_aio_backend"*/
+	uint32_t (*file_aio_backend)(struct OMRPortLibrary *portLibrary, OMRFileAIOContext *context) ;
+	/** see @ref omrmmap.c::omrmmap_advise "omrmmap_advise"*/
+	int32_t (*mmap_advise)(struct OMRPortLibrary *portLibrary, void *startAddress, uintptr_t length, uint32_t advice) ;
+	/** see @ref omrmmapwindow.c::omrmmap_window_open "omrmmap_window_open"*/
+	J9MmapWindow *(*mmap_window_open)(struct OMRPortLibrary *portLibrary, intptr_t file, uintptr_t windowSize, uint32_t flags, uint32_t category) ;
+	/** see @ref omrmmapwindow.c::omrmmap_window_map "omrmmap_window_map"*/
+	void *(*mmap_window_map)(struct OMRPortLibrary *portLibrary, J9MmapWindow *window, uint64_t offset, uintptr_t *length) ;
+	/** see @ref omrmmapwindow.c::omrmmap_window_close "omrmmap_window_close"*/
+	void (*mmap_window_close)(struct OMRPortLibrary *portLibrary, J9MmapWindow *window) ;
+	/** see @ref omrsock.c::omrsock_eventloop_create "omrsock_eventloop_create"*/
+	int32_t (*sock_eventloop_create)(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t *loop) ;
+	/** see @ref omrsock.c::omrsock_eventloop_add "omrsock_eventloop_add"*/
+	int32_t (*sock_eventloop_add)(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock, uint32_t events, void *userData) ;
+	/** see @ref omrsock.c::omrsock_eventloop_modify "omrsock_eventloop_modify"*/
+	int32_t (*sock_eventloop_modify)(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock, uint32_t events, void *userData) ;
+	/** see @ref omrsock.c::omrsock_eventloop_remove "omrsock_eventloop_remove"*/
+	int32_t (*sock_eventloop_remove)(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock) ;
+	/** see @ref omrsock.c::omrsock_eventloop_wait "omrsock_eventloop_wait"*/
+	int32_t (*sock_eventloop_wait)(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_event_t events, uint32_t maxEvents, int32_t timeoutMs) ;
+	/** see @ref omrsock.c::omrsock_eventloop_wakeup "omrsock_eventloop_wakeup"*/
+	int32_t (*sock_eventloop_wakeup)(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop) ;
+	/** see @ref omrsock.c::omrsock_eventloop_destroy "omrsock_eventloop_destroy"*/
+	int32_t (*sock_eventloop_destroy)(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t *loop) ;
+	/** see @ref omrsock.c::omrsock_sendmmsg "omrsock_sendmmsg"*/
+	int32_t (*sock_sendmmsg)(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, omrsock_msg_t msgs, uint32_t count, int32_t flags) ;
+	/** see @ref omrsock.c::omrsock_recvmmsg "omrsock_recvmmsg"*/
+	int32_t (*sock_recvmmsg)(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, omrsock_msg_t msgs, uint32_t count, int32_t flags) ;
+	/** see @ref omrsock.c::omrsock_zerocopy_complete "omrsock_zerocopy_complete"*/
+	int32_t (*sock_zerocopy_complete)(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, uint32_t *first, uint32_t *last, BOOLEAN *copied) ;
+	/** see @ref omrtimeticks.c::omrtime_fast_ticks "omrtime_fast_ticks"*/
+	uint64_t (*time_fast_ticks)(struct OMRPortLibrary *portLibrary) ;
+	/** see @ref omrtimeticks.c::omrtime_fast_ticks_frequency "omrtime_fast_ticks_frequency"*/
+	uint64_t (*time_fast_ticks_frequency)(struct OMRPortLibrary *portLibrary) ;
+	/** see @ref omrtimeticks.c::omrtime_fast_ticks_delta "omrtime_fast_ticks_delta"*/
+	uint64_t (*time_fast_ticks_delta)(struct OMRPortLibrary *portLibrary, uint64_t startTicks, uint64_t endTicks, uint64_t requiredResolution) ;
 #if defined(OMR_OPT_CUDA)
 	/** CUDA configuration data */
 	J9CudaConfig *cuda_configData;
@@ -3187,6 +3354,41 @@ extern J9_CFUNC int32_t omrport_getVersion(struct OMRPortLibrary *portLibrary);
 #define omrsock_getsockopt_int(param1,param2,param3,param4) privateOmrPortLibrary->sock_getsockopt_int(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
 #define omrsock_getsockopt_linger(param1,param2,param3,param4) privateOmrPortLibrary->sock_getsockopt_linger(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
 #define omrsock_getsockopt_timeval(param1,param2,param3,param4) privateOmrPortLibrary->sock_getsockopt_timeval(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrmem_arena_pool_create(param1,param2,param3) privateOmrPortLibrary->mem_arena_pool_create(privateOmrPortLibrary, (param1), (param2), (param3))
+#define omrmem_arena_pool_destroy(param1) privateOmrPortLibrary->mem_arena_pool_destroy(privateOmrPortLibrary, (param1))
+#define omrmem_arena_create(param1,param2,param3) privateOmrPortLibrary->mem_arena_create(privateOmrPortLibrary, (param1), (param2), (param3))
+#define omrmem_arena_destroy(param1) privateOmrPortLibrary->mem_arena_destroy(privateOmrPortLibrary, (param1))
+#define omrmem_arena_allocate(param1,param2) privateOmrPortLibrary->mem_arena_allocate(privateOmrPortLibrary, (param1), (param2))
+#define omrmem_arena_mark(param1,param2) privateOmrPortLibrary->mem_arena_mark(privateOmrPortLibrary, (param1), (param2))
+#define omrmem_arena_rewind(param1,param2) privateOmrPortLibrary->mem_arena_rewind(privateOmrPortLibrary, (param1), (param2))
+#define omrmem_arena_reset(param1) privateOmrPortLibrary->mem_arena_reset(privateOmrPortLibrary, (param1))
+#define omrmem_arena_release(param1) privateOmrPortLibrary->mem_arena_release(privateOmrPortLibrary, (param1))
+#define omrmem_arena_thread_scratch() privateOmrPortLibrary->mem_arena_thread_scratch(privateOmrPortLibrary)
+#define omrmem_get_category_counters(param1,param2,param3) privateOmrPortLibrary->mem_get_category_counters(privateOmrPortLibrary, (param1), (param2), (param3))
+#define omrfile_aio_create(param1,param2,param3) privateOmrPortLibrary->file_aio_create(privateOmrPortLibrary, (param1), (param2), (param3))
+#define omrfile_aio_destroy(param1) privateOmrPortLibrary->file_aio_destroy(privateOmrPortLibrary, (param1))
+#define omrfile_aio_register_buffers(param1,param2,param3) privateOmrPortLibrary->file_aio_register_buffers(privateOmrPortLibrary, (param1), (param2), (param3))
+#define omrfile_aio_submit(param1,param2,param3) privateOmrPortLibrary->file_aio_submit(privateOmrPortLibrary, (param1), (param2), (param3))
+#define omrfile_aio_reap(param1,param2) privateOmrPortLibrary->file_aio_reap(privateOmrPortLibrary, (param1), (param2))
+#define omrfile_aio_get_event_fd(param1) privateOmrPortLibrary->file_aio_get_event_fd(privateOmrPortLibrary, (param1))
+#define omrfile_aio_backend(param1) privateOmrPortLibrary->file_aio_backend(privateOmrPortLibrary, (param1))
+#define omrmmap_advise(param1,param2,param3) privateOmrPortLibrary->mmap_advise(privateOmrPortLibrary, (param1), (param2), (param3))
+#define omrmmap_window_open(param1,param2,param3,param4) privateOmrPortLibrary->mmap_window_open(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrmmap_window_map(param1,param2,param3) privateOmrPortLibrary->mmap_window_map(privateOmrPortLibrary, (param1), (param2), (param3))
+#define omrmmap_window_close(param1) privateOmrPortLibrary->mmap_window_close(privateOmrPortLibrary, (param1))
+#define omrsock_eventloop_create(param1) privateOmrPortLibrary->sock_eventloop_create(privateOmrPortLibrary, (param1))
+#define omrsock_eventloop_add(param1,param2,param3,param4) privateOmrPortLibrary->sock_eventloop_add(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrsock_eventloop_modify(param1,param2,param3,param4) privateOmrPortLibrary->sock_eventloop_modify(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrsock_eventloop_remove(param1,param2) privateOmrPortLibrary->sock_eventloop_remove(privateOmrPortLibrary, (param1), (param2))
+#define omrsock_eventloop_wait(param1,param2,param3,param4) privateOmrPortLibrary->sock_eventloop_wait(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrsock_eventloop_wakeup(param1) privateOmrPortLibrary->sock_eventloop_wakeup(privateOmrPortLibrary, (param1))
+#define omrsock_eventloop_destroy(param1) privateOmrPortLibrary->sock_eventloop_destroy(privateOmrPortLibrary, (param1))
+#define omrsock_sendmmsg(param1,param2,param3,param4) privateOmrPortLibrary->sock_sendmmsg(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrsock_recvmmsg(param1,param2,param3,param4) privateOmrPortLibrary->sock_recvmmsg(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrsock_zerocopy_complete(param1,param2,param3,param4) privateOmrPortLibrary->sock_zerocopy_complete(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrtime_fast_ticks() privateOmrPortLibrary->time_fast_ticks(privateOmrPortLibrary)
+#define omrtime_fast_ticks_frequency() privateOmrPortLibrary->time_fast_ticks_frequency(privateOmrPortLibrary)
+#define omrtime_fast_ticks_delta(param1,param2,param3) privateOmrPortLibrary->time_fast_ticks_delta(privateOmrPortLibrary, (param1), (param2), (param3))
 
 #if defined(OMR_OPT_CUDA)
 #define omrcuda_startup() \
@@ -210,6 +210,7 @@
 #define OMRPORT_ERROR_MMAP_MSYNC_INVALIDFLAGS (OMRPORT_ERROR_MMAP_BASE-6)
 #define OMRPORT_ERROR_MMAP_MSYNC_FAILED (OMRPORT_ERROR_MMAP_BASE-7)
 #define OMRPORT_ERROR_MMAP_MAP_FILE_STATFAILED (OMRPORT_ERROR_MMAP_BASE-8)
+#define OMRPORT_ERROR_MMAP_ADVISE_FAILED (OMRPORT_ERROR_MMAP_BASE-9)
 /** @} */
 
 /**
@@ -46,6 +46,15 @@ typedef struct OMRTimeval *omrsock_timeval_t;
 /* Pointer to OMRLinger, a struct that contains struct linger.*/
 typedef struct OMRLinger *omrsock_linger_t;
 
+/* Pointer to OMRSockEventLoop, an opaque struct that watches sockets for readiness. */
+typedef struct OMRSockEventLoop *omrsock_eventloop_t;
+
+/* Pointer to OMRSockEvent, a struct that reports the readiness of one socket. */
+typedef struct OMRSockEvent *omrsock_event_t;
+
+/* Pointer to OMRSockMsg, a struct that describes one message of a batched send or receive. */
+typedef struct OMRSockMsg *omrsock_msg_t;
+
 /* Bind to all available interfaces */
 #define OMRSOCK_INADDR_ANY ((uint32_t)0)
 
@@ -72,6 +81,7 @@ typedef struct OMRLinger *omrsock_linger_t;
 #define OMRSOCK_SO_RCVTIMEO 4
 #define OMRSOCK_SO_SNDTIMEO 5
 #define OMRSOCK_TCP_NODELAY 6
+#define OMRSOCK_SO_ZEROCOPY 7
 
 /* Socket Flags */
 #define OMRSOCK_O_ASYNC 0x0100
@@ -87,4 +97,13 @@ typedef struct OMRLinger *omrsock_linger_t;
 #define OMRSOCK_POLLHUP 0x0010
 #endif
 
+/* Event Loop Flags, combined with the poll constants in @ref omrsock_eventloop_add */
+#define OMRSOCK_EVENT_EDGE_TRIGGERED 0x0100
+#define OMRSOCK_EVENT_ONESHOT 0x0200
+
+/* Message Flags for @ref omrsock_sendmmsg and @ref omrsock_recvmmsg */
+#define OMRSOCK_MSG_DONTWAIT 0x0001
+#define OMRSOCK_MSG_WAITFORONE 0x0002
+#define OMRSOCK_MSG_ZEROCOPY 0x0004
+
 #endif /* !defined(OMRPORTSOCK_H_) */
@@ -148,6 +148,52 @@ typedef struct OMRLinger {
 	struct linger data;
 } OMRLinger;
 
+/**
+ * A struct for a socket that is ready for I/O. Filled in by @ref omrsock_eventloop_wait.
+ */
+typedef struct OMRSockEvent {
+	/**
+	 * The socket, as passed to @ref omrsock_eventloop_add.
+	 */
+	struct OMRSocket *socket;
+
+	/**
+	 * The user data registered with the socket.
+	 */
+	void *userData;
+
+	/**
+	 * The OMRSOCK_POLL* conditions the socket is in.
+	 */
+	uint32_t events;
+} OMRSockEvent;
+
+/**
+ * A struct for one message of @ref omrsock_sendmmsg or @ref omrsock_recvmmsg.
+ */
+typedef struct OMRSockMsg {
+	/**
+	 * The message data, or the buffer to receive it in.
+	 */
+	uint8_t *buf;
+
+	/**
+	 * The number of bytes in buf.
+	 */
+	uint32_t nbyte;
+
+	/**
+	 * Filled in with the number of bytes sent or received.
+	 */
+	uint32_t length;
+
+	/**
+	 * The address to send the message to, or to fill in with the sender's address. May be NULL
+	 * for connected sockets.
+	 */
+	struct OMRSockAddrStorage *addr;
+} OMRSockMsg;
+
 /* Additional constants: Set maximum backlog for listen */
 #define OMRSOCK_MAXCONN SOMAXCONN
 
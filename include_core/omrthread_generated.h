@@ -180,11 +180,17 @@ typedef struct J9ThreadTracing {
 #define J9_ABSTRACT_THREAD_FIELDS_4
 #endif /* defined(OMR_THR_MCS_LOCKS) */
 
+/* contentionRing is allocated on the thread's first sampled contended monitor enter */
+#define J9_ABSTRACT_THREAD_FIELDS_5 \
+	struct J9ThreadContentionRing *contentionRing; \
+	uintptr_t contentionSampleCountdown;
+
 #define J9_ABSTRACT_THREAD_FIELDS \
 	J9_ABSTRACT_THREAD_FIELDS_1 \
 	J9_ABSTRACT_THREAD_FIELDS_2 \
 	J9_ABSTRACT_THREAD_FIELDS_3 \
-	J9_ABSTRACT_THREAD_FIELDS_4
+	J9_ABSTRACT_THREAD_FIELDS_4 \
+	J9_ABSTRACT_THREAD_FIELDS_5
 
 typedef struct J9ThreadMonitorTracing {
 	char *monitor_name;
@@ -200,6 +206,11 @@ typedef struct J9ThreadMonitorTracing {
 	uintptr_t volatile holdtime_count;
 	uintptr_t enter_pause_count;
 #endif /* OMR_THR_JLM_HOLD_TIMES */
+#if defined(OMR_THR_FUTEX_MONITORS)
+	uintptr_t park_count;
+	uintptr_t wakeup_count;
+	uintptr_t notify_handoff_count;
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 } J9ThreadMonitorTracing;
 
 #define J9_ABSTRACT_MONITOR_FIELDS_1 \
@@ -259,6 +270,15 @@ typedef struct J9ThreadMonitorTracing {
 #define J9_ABSTRACT_MONITOR_FIELDS_8
 #endif /* defined(OMR_THR_MCS_LOCKS) */
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+#define J9_ABSTRACT_MONITOR_FIELDS_9 \
+	volatile uint32_t futexSequence; \
+	volatile uintptr_t notifiedWaiters; \
+	uintptr_t adaptiveSpinCount3;
+#else /* defined(OMR_THR_FUTEX_MONITORS) */
+#define J9_ABSTRACT_MONITOR_FIELDS_9
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 #define J9_ABSTRACT_MONITOR_FIELDS \
 	J9_ABSTRACT_MONITOR_FIELDS_1 \
 	J9_ABSTRACT_MONITOR_FIELDS_2 \
@@ -267,7 +287,8 @@ typedef struct J9ThreadMonitorTracing {
 	J9_ABSTRACT_MONITOR_FIELDS_5 \
 	J9_ABSTRACT_MONITOR_FIELDS_6 \
 	J9_ABSTRACT_MONITOR_FIELDS_7 \
-	J9_ABSTRACT_MONITOR_FIELDS_8
+	J9_ABSTRACT_MONITOR_FIELDS_8 \
+	J9_ABSTRACT_MONITOR_FIELDS_9
 
 /*
  * @ddr_namespace: map_to_type=J9ThreadAbstractMonitor
@@ -163,6 +163,59 @@ uint64_t omr_trc_getBufferIteratorThreadId(UtTracePointIterator *iter);
  */
 uint32_t omr_trc_getBufferIteratorThreadName(UtTracePointIterator *iter, char *buffer, uint32_t buffLen);
 
+/**
+ * Selects the trace points omr_trc_formatTraceFile passes to its callback.
+ *
+ * Time stamps are the raw values recorded by the trace engine, i.e. omrtime_hires_clock()
+ * ticks, as passed to FormattedTracePointCallback.
+ */
+typedef struct UtTraceFormatFilter {
+	const char *componentName; /**< Only format trace points of this component, e.g. j9mm. NULL for all components. */
+	int32_t tracePointId; /**< Only format the trace point with this number. -1 for all trace points. */
+	uint64_t startTime; /**< Only format trace points logged at or after this time stamp. */
+	uint64_t endTime; /**< Only format trace points logged at or before this time stamp. 0 for no upper bound. */
+} UtTraceFormatFilter;
+
+/**
+ * A callback that receives formatted trace points from omr_trc_formatTraceFile.
+ *
+ * @param[in] userData the userData passed to omr_trc_formatTraceFile
+ * @param[in] threadId the id of the thread that logged the trace point
+ * @param[in] timeStamp the raw time stamp of the trace point
+ * @param[in] tracePoint the formatted trace point. It is only valid for the duration of the call.
+ *
+ * @return OMR_ERROR_NONE to continue formatting, any other value to stop
+ */
+typedef omr_error_t (*FormattedTracePointCallback)(void *userData, uint64_t threadId, uint64_t timeStamp, const char *tracePoint);
+
+/**
+ * Format the trace points in the trace file named in fileName, in time stamp order
+ * across all the threads that logged them.
+ *
+ * The file is memory mapped and its buffers are formatted by formatThreads threads,
+ * with the results merged by time stamp before they are passed to callback on the
+ * calling thread. Buffers that cannot hold trace points inside the filter's time
+ * window are not read.
+ *
+ * getFormatString is called concurrently when formatThreads is greater than 1.
+ *
+ * @param[in] portLib An initialized OMRPortLibraryStructure.
+ * @param[in] fileName The name of the trace file to format.
+ * @param[in] getFormatString A callback the formatter can use to obtain a format string for a trace point id in a named module.
+ * @param[in] filter The trace points to format, or NULL to format all of them.
+ * @param[in] formatThreads The number of threads to format buffers on. 0 or 1 formats on the calling thread.
+ * @param[in] callback The callback to pass formatted trace points to.
+ * @param[in] userData Data passed to callback.
+ *
+ * @return OMR_ERROR_NONE on success
+ * @return OMR_ERROR_FILE_UNAVAILABLE if the specified file cannot be opened
+ * @return OMR_ERROR_ILLEGAL_ARGUMENT if the specified file does not contain valid trace data
+ * @return OMR_ERROR_OUT_OF_NATIVE_MEMORY if memory for formatting cannot be allocated
+ * @return the return value of callback if it stopped formatting
+ */
+omr_error_t omr_trc_formatTraceFile(OMRPortLibrary *portLib, const char *fileName, FormatStringCallback getFormatString,
+	const UtTraceFormatFilter *filter, uint32_t formatThreads, FormattedTracePointCallback callback, void *userData);
+
 #ifdef __cplusplus
 }
 #endif
@@ -59,6 +59,62 @@ void *getdsa(void);
 #endif
 
 
+/* ---------------- utf8bulk.c ---------------- */
+
+/**
+* @brief Answer the length of the run of characters 0x01 to 0x7F at the start of a UTF-8 string.
+* @param input
+* @param length
+* @return uintptr_t
+*/
+uintptr_t
+scanUTF8ASCII(const uint8_t *input, uintptr_t length);
+
+
+/**
+* @brief Validate a modified UTF-8 string.
+* @param input
+* @param length
+* @return intptr_t the number of UTF-16 characters, or -1 if invalid
+*/
+intptr_t
+validateUTF8String(const uint8_t *input, uintptr_t length);
+
+
+/**
+* @brief Decode a modified UTF-8 string to UTF-16.
+* @param input
+* @param inputLength
+* @param output
+* @param outputLength
+* @return intptr_t the number of UTF-16 characters stored, or -1 if invalid
+*/
+intptr_t
+decodeUTF8String(const uint8_t **input, uintptr_t *inputLength, uint16_t *output, uintptr_t outputLength);
+
+
+/**
+* @brief Answer the number of bytes needed to encode UTF-16 characters as modified UTF-8.
+* @param input
+* @param length
+* @return uintptr_t
+*/
+uintptr_t
+encodedUTF8Length(const uint16_t *input, uintptr_t length);
+
+
+/**
+* @brief Encode UTF-16 characters as modified UTF-8.
+* @param input
+* @param inputLength
+* @param output
+* @param outputLength
+* @return uintptr_t the number of bytes stored
+*/
+uintptr_t
+encodeUTF8String(const uint16_t **input, uintptr_t *inputLength, uint8_t *output, uintptr_t outputLength);
+
+
 /* ---------------- utf8decode.c ---------------- */
 
 /**
@@ -431,6 +487,38 @@ U_32 omrcrc32(U_32 crc, U_8 *bytes, U_32 len);
 */
 U_32 omrcrcSparse32(U_32 crc, U_8 *bytes, U_32 len, U_32 step);
 
+#define OMRCRC32_BYTEWISE 0
+#define OMRCRC32_SLICE_BY_8 1
+#define OMRCRC32_HARDWARE 2
+
+/**
+* @brief Compute a CRC-32C (Castagnoli), in the same way omrcrc32 computes a CRC-32
+* @param crc
+* @param *bytes
+* @param len
+* @return U_32
+*/
+U_32 omrcrc32c(U_32 crc, U_8 *bytes, U_32 len);
+
+/**
+* @brief Answer which implementation omrcrc32, or omrcrc32c, uses on this machine
+* @param castagnoli TRUE for omrcrc32c
+* @return OMRCRC32_HARDWARE or OMRCRC32_SLICE_BY_8
+*/
+U_32 omrcrc32Implementation(BOOLEAN castagnoli);
+
+/**
+* @brief Compute a CRC-32, or CRC-32C, with a particular implementation, for testing and benchmarking.
+* OMRCRC32_HARDWARE falls back to OMRCRC32_SLICE_BY_8 where it isn't supported.
+* @param crc
+* @param *bytes
+* @param len
+* @param castagnoli TRUE for CRC-32C
+* @param implementation One of OMRCRC32_BYTEWISE, OMRCRC32_SLICE_BY_8 or OMRCRC32_HARDWARE
+* @return U_32
+*/
+U_32 omrcrc32UsingImplementation(U_32 crc, U_8 *bytes, U_32 len, BOOLEAN castagnoli, U_32 implementation);
+
 /* ---------------- archinfo.c ---------------- */
 /**
  * @brief
@@ -199,6 +199,45 @@ pool_ensureCapacity(J9Pool *aPool, uintptr_t newCapacity);
 uintptr_t
 pool_includesElement(J9Pool *aPool, void *anElement);
 
+/* ---------------- pool_magazine.cpp ---------------- */
+
+/**
+* @brief Initialize a magazine for a pool created with POOL_USES_MAGAZINES
+* @param *aPool
+* @param *magazine
+* @return void
+*/
+void
+pool_magazineInit(J9Pool *aPool, J9PoolMagazine *magazine);
+
+
+/**
+* @brief Allocate an element through a magazine
+* @param *magazine
+* @return void *
+*/
+void *
+pool_magazineNewElement(J9PoolMagazine *magazine);
+
+
+/**
+* @brief Free an element through a magazine
+* @param *magazine
+* @param *anElement
+* @return void
+*/
+void
+pool_magazineRemoveElement(J9PoolMagazine *magazine, void *anElement);
+
+
+/**
+* @brief Return all elements cached in a magazine to the pool
+* @param *magazine
+* @return void
+*/
+void
+pool_magazineFlush(J9PoolMagazine *magazine);
+
 #ifdef __cplusplus
 }
 #endif
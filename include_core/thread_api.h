@@ -51,6 +51,9 @@ extern "C" {
 #define J9THREAD_RWMUTEX_FAIL	 	 1
 #define J9THREAD_RWMUTEX_WOULDBLOCK -1
 
+/* omrthread_rwmutex_init flags */
+#define J9THREAD_RWMUTEX_DISTRIBUTED 0x1 /* readers count into per-thread slots rather than one shared count */
+
 /* Define conversions for units of time used in thrprof.c */
 #define SEC_TO_NANO_CONVERSION_CONSTANT		(1000 * 1000 * 1000)
 #define MICRO_TO_NANO_CONVERSION_CONSTANT	1000
@@ -1410,6 +1413,198 @@ omrthread_numa_set_enabled(BOOLEAN enabled);
 uintptr_t
 omrthread_numa_get_current_node();
 
+/* -------------- omrthreadcontention.c ------------------- */
+
+/*
+ * Contention dump format, written in native byte order: a J9ThreadContentionDumpHeader,
+ * then one J9ThreadContentionDumpRecord per sample. Each record is followed by depth
+ * uint64_t return addresses and nameLength bytes of monitor name (not NUL terminated),
+ * padded with zeros to a multiple of 8 bytes.
+ */
+#define J9THREAD_CONTENTION_DUMP_MAGIC 0x43524D4F /* "OMRC" */
+#define J9THREAD_CONTENTION_DUMP_VERSION 1
+
+/* Sampling interval the thread library starts with, see omrthread_contention_set_sample_interval */
+#define J9THREAD_CONTENTION_DEFAULT_SAMPLE_INTERVAL 64
+
+typedef struct J9ThreadContentionDumpHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint64_t sampleInterval;
+} J9ThreadContentionDumpHeader;
+
+typedef struct J9ThreadContentionDumpRecord {
+	uint64_t tid; /* the waiting thread */
+	uint64_t ownerTid; /* the monitor's owner when the thread blocked, or 0 */
+	uint64_t monitor; /* monitor address */
+	uint64_t waitTime; /* in omrthread_get_hires_clock units (nanoseconds on Linux) */
+	uint64_t timestamp; /* when the monitor was acquired, in the same units */
+	uint32_t depth;
+	uint32_t nameLength;
+} J9ThreadContentionDumpRecord;
+
+/**
+ * Receives dump or report output. Return 0 to continue, anything else to stop.
+ */
+typedef intptr_t (*omrthread_contention_writer_t)(void *userData, const void *buffer, uintptr_t length);
+
+/**
+* @brief
+* @param interval
+* @return void
+*/
+void
+omrthread_contention_set_sample_interval(uintptr_t interval);
+
+/**
+* @brief
+* @return uintptr_t
+*/
+uintptr_t
+omrthread_contention_get_sample_interval(void);
+
+/**
+* @brief
+* @param writer
+* @param userData
+* @return intptr_t
+*/
+intptr_t
+omrthread_contention_dump(omrthread_contention_writer_t writer, void *userData);
+
+/**
+* @brief
+* @param writer
+* @param userData
+* @return intptr_t
+*/
+intptr_t
+omrthread_contention_dump_no_locking(omrthread_contention_writer_t writer, void *userData);
+
+/**
+* @brief
+* @param dump
+* @param length
+* @param maxMonitors
+* @param writer
+* @param userData
+* @return intptr_t
+*/
+intptr_t
+omrthread_contention_report(const void *dump, uintptr_t length, uintptr_t maxMonitors, omrthread_contention_writer_t writer, void *userData);
+
+/* -------------- omrthreadjlm.c ------------------- */
+
+#if defined(OMR_THR_JLM)
+/**
+* @brief
+* @param writer
+* @param userData
+* @return intptr_t
+*/
+intptr_t
+omrthread_jlm_dump(omrthread_contention_writer_t writer, void *userData);
+#endif /* defined(OMR_THR_JLM) */
+
+/* -------------- omrthreadfiber.c ------------------- */
+
+/**
+* @struct
+*/
+struct J9ThreadFiberScheduler;
+
+/**
+*@typedef
+*/
+typedef struct J9ThreadFiberScheduler *omrthread_fiber_scheduler_t;
+
+/**
+* @struct
+*/
+struct J9ThreadFiber;
+
+/**
+*@typedef
+*/
+typedef struct J9ThreadFiber *omrthread_fiber_t;
+
+/**
+* @brief
+* @param handle
+* @param carrierCount
+* @param stackSize
+* @return intptr_t
+*/
+intptr_t
+omrthread_fiber_scheduler_create(omrthread_fiber_scheduler_t *handle, uintptr_t carrierCount, uintptr_t stackSize);
+
+/**
+* @brief
+* @param scheduler
+* @return intptr_t
+*/
+intptr_t
+omrthread_fiber_scheduler_shutdown(omrthread_fiber_scheduler_t scheduler);
+
+/**
+* @brief
+* @param handle
+* @param scheduler
+* @param entrypoint
+* @param entryarg
+* @return intptr_t
+*/
+intptr_t
+omrthread_fiber_create(omrthread_fiber_t *handle, omrthread_fiber_scheduler_t scheduler, omrthread_entrypoint_t entrypoint, void *entryarg);
+
+/**
+* @brief
+* @return omrthread_fiber_t
+*/
+omrthread_fiber_t
+omrthread_fiber_self(void);
+
+/**
+* @brief
+* @return void
+*/
+void
+omrthread_fiber_yield(void);
+
+/**
+* @brief
+* @return intptr_t
+*/
+intptr_t
+omrthread_fiber_park(void);
+
+/**
+* @brief
+* @param fiber
+* @return void
+*/
+void
+omrthread_fiber_unpark(omrthread_fiber_t fiber);
+
+/**
+* @brief
+* @param fiber
+* @param key
+* @param value
+* @return intptr_t
+*/
+intptr_t
+omrthread_fiber_tls_set(omrthread_fiber_t fiber, omrthread_tls_key_t key, void *value);
+
+/**
+* @brief
+* @param fiber
+* @param key
+* @return void*
+*/
+void *
+omrthread_fiber_tls_get(omrthread_fiber_t fiber, omrthread_tls_key_t key);
+
 /* -------------- rasthrsup.c ------------------- */
 /**
  * @brief
@@ -137,6 +137,8 @@ typedef struct J9ThreadLibrary {
 	OMRMemCategory condvarCategory;
 #endif /* defined(OMR_THR_FORK_SUPPORT) */
 	omrthread_monitor_t globalMonitor;
+	/* sample one in this many contended monitor enters per thread; 0 disables sampling */
+	uintptr_t contentionSampleInterval;
 #if defined(OMR_THR_YIELD_ALG)
 	uintptr_t yieldAlgorithm;
 	uintptr_t yieldUsleepMultiplier;
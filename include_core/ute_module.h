@@ -58,6 +58,13 @@ extern "C" {
 
 #define UT_SPECIAL_ASSERTION 0x00400000
 
+/*
+ * Set in the active byte of a tracepoint that is printed when it is hit. Printing
+ * formats the arguments from a va_list, so the generated writers use Trace rather
+ * than TraceData for these tracepoints.
+ */
+#define UT_TRACE_PRINT_ACTIVE 0x08
+
 /*
  * =============================================================================
  *   Forward declarations
@@ -142,6 +149,10 @@ struct  UtModuleInterface {
 	void (*TraceState)(void *env, UtModuleInfo *modInfo, uint32_t traceId, const char *, ...);
 	void (*TraceInit)(void *env, UtModuleInfo *mod);
 	void (*TraceTerm)(void *env, UtModuleInfo *mod);
+	/* Takes a tracepoint whose arguments the generated writer has already laid out
+	 * in the trace record format, so no spec parsing or va_list is needed.
+	 */
+	void (*TraceData)(void *env, UtModuleInfo *modInfo, uint32_t traceId, const void *data, uint32_t length);
 };
 
 #ifdef  __cplusplus
@@ -225,6 +225,7 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
     $(JIT_OMR_DIRTY_DIR)/env/OMRKnownObjectTable.cpp \
     $(JIT_OMR_DIRTY_DIR)/env/Globals.cpp \
     $(JIT_OMR_DIRTY_DIR)/ilgen/IlInjector.cpp \
+    $(JIT_OMR_DIRTY_DIR)/ilgen/MethodBuilderCodeStore.cpp \
     $(JIT_OMR_DIRTY_DIR)/ilgen/OMRBytecodeBuilder.cpp \
     $(JIT_OMR_DIRTY_DIR)/ilgen/OMRIlBuilder.cpp \
     $(JIT_OMR_DIRTY_DIR)/ilgen/OMRIlType.cpp \
@@ -250,7 +251,11 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
     $(JIT_OMR_DIRTY_DIR)/env/OMRCompilerEnv.cpp \
     $(JIT_OMR_DIRTY_DIR)/env/PersistentAllocator.cpp \
     $(JIT_PRODUCT_DIR)/compile/ResolvedMethod.cpp \
+    $(JIT_PRODUCT_DIR)/control/CompilationResultCache.cpp \
+    $(JIT_PRODUCT_DIR)/control/CompileQueue.cpp \
     $(JIT_PRODUCT_DIR)/control/Jit.cpp \
+    $(JIT_PRODUCT_DIR)/control/PersistentCodeCache.cpp \
+    $(JIT_PRODUCT_DIR)/control/TieredCompilation.cpp \
     $(JIT_PRODUCT_DIR)/ilgen/JBIlGeneratorMethodDetails.cpp \
     $(JIT_PRODUCT_DIR)/optimizer/JBOptimizer.cpp \
     $(JIT_PRODUCT_DIR)/runtime/JBCodeCacheManager.cpp \
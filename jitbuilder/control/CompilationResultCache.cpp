@@ -0,0 +1,188 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <new>
+#include <string.h>
+#include "AtomicSupport.hpp"
+#include "codegen/CodeGenerator.hpp"
+#include "compile/Compilation.hpp"
+#include "control/CompilationResultCache.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/RawAllocator.hpp"
+
+#define NUM_BUCKETS 1024
+
+namespace JitBuilder
+{
+
+struct CompilationResult
+   {
+   CompilationResult *_next;
+   uint64_t _ilHash[2];
+   uint64_t _ilSize;
+   void *_entryPoint;
+   // followed by the canonical IL when the cache verifies IL
+
+   const uint8_t *il() const { return reinterpret_cast<const uint8_t *>(this + 1); }
+   };
+
+} // namespace JitBuilder
+
+JitBuilder::CompilationResultCache::CompilationResultCache(bool verifyIL, CompilationResult * volatile *buckets)
+   : _verifyIL(verifyIL),
+     _next(NULL),
+     _buckets(buckets)
+   {
+   memset(&_statistics, 0, sizeof(_statistics));
+   }
+
+JitBuilder::CompilationResultCache *
+JitBuilder::CompilationResultCache::create(bool verifyIL)
+   {
+   TR::RawAllocator rawAllocator = TR::Compiler->rawAllocator;
+   size_t bucketsSize = NUM_BUCKETS * sizeof(CompilationResult *);
+   void *buckets = rawAllocator.allocate(bucketsSize, std::nothrow);
+   void *cacheMemory = rawAllocator.allocate(sizeof(CompilationResultCache), std::nothrow);
+   if ((NULL == buckets) || (NULL == cacheMemory))
+      {
+      rawAllocator.deallocate(buckets);
+      rawAllocator.deallocate(cacheMemory);
+      return NULL;
+      }
+
+   memset(buckets, 0, bucketsSize);
+   return new (cacheMemory) CompilationResultCache(verifyIL, static_cast<CompilationResult * volatile *>(buckets));
+   }
+
+void
+JitBuilder::CompilationResultCache::destroy(CompilationResultCache *cache)
+   {
+   TR::RawAllocator rawAllocator = TR::Compiler->rawAllocator;
+   for (uint32_t i = 0; i < NUM_BUCKETS; i++)
+      {
+      CompilationResult *result = cache->_buckets[i];
+      while (NULL != result)
+         {
+         CompilationResult *next = result->_next;
+         rawAllocator.deallocate(result);
+         result = next;
+         }
+      }
+   rawAllocator.deallocate((void *)cache->_buckets);
+   cache->~CompilationResultCache();
+   rawAllocator.deallocate(cache);
+   }
+
+JitBuilder::CompilationResult * volatile *
+JitBuilder::CompilationResultCache::bucketOf(const OMR::MethodBuilderIL &il)
+   {
+   return &_buckets[il.getHash()[0] & (NUM_BUCKETS - 1)];
+   }
+
+JitBuilder::CompilationResult *
+JitBuilder::CompilationResultCache::find(CompilationResult *first, const OMR::MethodBuilderIL &il)
+   {
+   for (CompilationResult *result = first; NULL != result; result = result->_next)
+      {
+      if ((result->_ilHash[0] != il.getHash()[0]) || (result->_ilHash[1] != il.getHash()[1]) || (result->_ilSize != il.getSize()))
+         continue;
+
+      if (_verifyIL && !il.equals(result->il(), (size_t)result->_ilSize))
+         {
+         VM_AtomicSupport::addU64((volatile uint64_t *)&_statistics._collisions, 1);
+         continue;
+         }
+      return result;
+      }
+   return NULL;
+   }
+
+// Results are pushed on the front of their list once they are complete, so the lists
+// can be walked without locking them
+void
+JitBuilder::CompilationResultCache::add(const OMR::MethodBuilderIL &il, void *entryPoint)
+   {
+   size_t ilSize = _verifyIL ? il.getSize() : 0;
+   CompilationResult *result = static_cast<CompilationResult *>(TR::Compiler->rawAllocator.allocate(sizeof(CompilationResult) + ilSize, std::nothrow));
+   if (NULL == result)
+      return;
+
+   result->_ilHash[0] = il.getHash()[0];
+   result->_ilHash[1] = il.getHash()[1];
+   result->_ilSize = il.getSize();
+   result->_entryPoint = entryPoint;
+   memcpy(result + 1, il.getBytes(), ilSize);
+
+   CompilationResult * volatile *bucket = bucketOf(il);
+   CompilationResult *head;
+   do
+      {
+      head = *bucket;
+      VM_AtomicSupport::readBarrier();
+      // another thread compiled the same IL at the same time
+      if (NULL != find(head, il))
+         {
+         TR::Compiler->rawAllocator.deallocate(result);
+         return;
+         }
+      result->_next = head;
+      }
+   while ((uintptr_t)head != VM_AtomicSupport::lockCompareExchange((volatile uintptr_t *)bucket, (uintptr_t)head, (uintptr_t)result));
+
+   VM_AtomicSupport::addU64((volatile uint64_t *)&_statistics._results, 1);
+   }
+
+void *
+JitBuilder::CompilationResultCache::lookup(TR::Compilation *comp, const OMR::MethodBuilderIL &il)
+   {
+   CompilationResult *head = *bucketOf(il);
+   VM_AtomicSupport::readBarrier();
+   CompilationResult *result = find(head, il);
+   if (NULL != result)
+      {
+      VM_AtomicSupport::addU64((volatile uint64_t *)&_statistics._hits, 1);
+      return result->_entryPoint;
+      }
+
+   VM_AtomicSupport::addU64((volatile uint64_t *)&_statistics._misses, 1);
+   if (NULL == _next)
+      return NULL;
+
+   void *entryPoint = _next->lookup(comp, il);
+   if (NULL != entryPoint)
+      add(il, entryPoint);
+   return entryPoint;
+   }
+
+void
+JitBuilder::CompilationResultCache::store(TR::Compilation *comp, const OMR::MethodBuilderIL &il)
+   {
+   add(il, comp->cg()->getCodeStart());
+   if (NULL != _next)
+      _next->store(comp, il);
+   }
+
+void
+JitBuilder::CompilationResultCache::getStatistics(CompilationResultCacheStatistics &statistics)
+   {
+   statistics = _statistics;
+   }
@@ -0,0 +1,101 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#ifndef JITBUILDER_COMPILATIONRESULTCACHE_INCL
+#define JITBUILDER_COMPILATIONRESULTCACHE_INCL
+
+#include <stdint.h>
+#include "ilgen/MethodBuilderCodeStore.hpp"
+
+namespace JitBuilder
+{
+
+struct CompilationResult;
+
+/**
+ * @brief Counters kept by a CompilationResultCache
+ */
+struct CompilationResultCacheStatistics
+   {
+   uint64_t _hits;         ///< compilations that returned code already compiled in this process
+   uint64_t _misses;
+   uint64_t _collisions;   ///< results with the same hash whose IL was not the same
+   uint64_t _results;      ///< compiled methods in the cache
+   };
+
+/**
+ * @brief The entry points of methods compiled in this process, found by the canonical form
+ * of the IL they were compiled from
+ *
+ * A MethodBuilder that generates the same IL as one compiled before is given the code that
+ * was compiled for it, without optimizing or compiling the method again. Results are found
+ * by the 128 bit hash of the IL. When the cache verifies IL, it also keeps a copy of the IL
+ * of each result and compares it with the IL being compiled.
+ *
+ * Lookups do not lock; results are added to a fixed number of lists with compare and swap
+ * and are only removed when the cache is destroyed. Code that is found in the next store and
+ * not in the cache is added to the cache, and code compiled after a miss is given to both.
+ */
+class CompilationResultCache : public OMR::MethodBuilderCodeStore
+   {
+   public:
+
+   /**
+    * @brief Create a cache
+    * @param verifyIL Compare the IL of a result with the IL being compiled, and not just its hash
+    * @return the cache, or NULL if it could not be allocated
+    */
+   static CompilationResultCache *create(bool verifyIL);
+
+   /**
+    * @brief Free a cache. The code of its results stays in the code cache.
+    */
+   static void destroy(CompilationResultCache *cache);
+
+   /**
+    * @brief Set the store looked up on a miss. Must not be called while compilations are in progress.
+    */
+   void setNext(OMR::MethodBuilderCodeStore *next) { _next = next; }
+
+   virtual void *lookup(TR::Compilation *comp, const OMR::MethodBuilderIL &il);
+   virtual void store(TR::Compilation *comp, const OMR::MethodBuilderIL &il);
+
+   void getStatistics(CompilationResultCacheStatistics &statistics);
+
+   private:
+
+   CompilationResultCache(bool verifyIL, CompilationResult * volatile *buckets);
+
+   CompilationResult * volatile *bucketOf(const OMR::MethodBuilderIL &il);
+   CompilationResult *find(CompilationResult *first, const OMR::MethodBuilderIL &il);
+   void add(const OMR::MethodBuilderIL &il, void *entryPoint);
+
+   bool _verifyIL;
+   OMR::MethodBuilderCodeStore *_next;
+   CompilationResult * volatile *_buckets;   ///< lists of results, by hash
+   CompilationResultCacheStatistics _statistics;
+   };
+
+} // namespace JitBuilder
+
+#endif // !defined(JITBUILDER_COMPILATIONRESULTCACHE_INCL)
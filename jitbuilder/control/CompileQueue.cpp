@@ -0,0 +1,400 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include <new>
+#include <string.h>
+#include "compile/Compilation.hpp"
+#include "control/CompileQueue.hpp"
+#include "env/CompilerEnv.hpp"
+#include "ilgen/MethodBuilder.hpp"
+#include "thread_api.h"
+
+extern int32_t compileMethodBuilder(TR::MethodBuilder *m, void **entry, int32_t compThreadID);
+
+// the default omrthread stack is too small for the optimizer
+static const uintptr_t COMPILATION_THREAD_STACK_SIZE = 4 * 1024 * 1024;
+
+namespace JitBuilder
+{
+
+class CompileRequest
+   {
+   public:
+
+   CompileRequest(TR::MethodBuilder *methodBuilder, int32_t priority, CompileCompletionCallback callback, void *userData)
+      : _methodBuilder(methodBuilder),
+        _priority(priority),
+        _sequence(0),
+        _submitTime(0),
+        _callback(callback),
+        _userData(userData),
+        _rc(COMPILATION_REQUESTED),
+        _entryPoint(NULL),
+        _references(2),
+        _previous(NULL),
+        _next(NULL)
+      {}
+
+   TR::MethodBuilder *_methodBuilder;
+   int32_t _priority;
+   uint64_t _sequence;
+   uint64_t _submitTime;
+   CompileCompletionCallback _callback;
+   void *_userData;
+   int32_t _rc;
+   void *_entryPoint;
+   uint32_t _references; ///< one for the caller, one for the queue until the request completes
+   CompileRequest *_previous;
+   CompileRequest *_next;
+   };
+
+} // namespace JitBuilder
+
+/**
+ * The compilation threads and any thread that waits for them use omrthread monitors,
+ * which only attached threads may enter.
+ */
+static bool
+attachCurrentThread()
+   {
+   omrthread_t self = omrthread_self();
+   return (NULL != self) || (J9THREAD_SUCCESS == omrthread_attach_ex(&self, J9THREAD_ATTR_DEFAULT));
+   }
+
+JitBuilder::CompileQueue::CompileQueue(uint32_t capacity, CompileRequest **heap)
+   : _monitor(NULL),
+     _heap(heap),
+     _capacity(capacity),
+     _count(0),
+     _nextSequence(0),
+     _liveRequests(NULL),
+     _threadCount(0),
+     _nextCompThreadID(1),
+     _shuttingDown(false)
+   {
+   memset(&_statistics, 0, sizeof(_statistics));
+   }
+
+JitBuilder::CompileQueue *
+JitBuilder::CompileQueue::create(uint32_t numThreads, uint32_t capacity)
+   {
+   TR::RawAllocator rawAllocator = TR::Compiler->rawAllocator;
+
+   if ((0 == numThreads) || (0 == capacity))
+      return NULL;
+   if ((0 != omrthread_init_library()) || !attachCurrentThread())
+      return NULL;
+
+   void *queueMemory = rawAllocator.allocate(sizeof(CompileQueue), std::nothrow);
+   CompileRequest **heap = static_cast<CompileRequest **>(rawAllocator.allocate(capacity * sizeof(CompileRequest *), std::nothrow));
+   if ((NULL == queueMemory) || (NULL == heap))
+      {
+      rawAllocator.deallocate(queueMemory);
+      rawAllocator.deallocate(heap);
+      return NULL;
+      }
+
+   CompileQueue *queue = new (queueMemory) CompileQueue(capacity, heap);
+   if (0 != omrthread_monitor_init_with_name(&queue->_monitor, 0, "JIT-CompileQueueMonitor"))
+      {
+      rawAllocator.deallocate(heap);
+      rawAllocator.deallocate(queueMemory);
+      return NULL;
+      }
+
+   for (uint32_t i = 0; i < numThreads; i++)
+      {
+      omrthread_t thread = NULL;
+
+      omrthread_monitor_enter(queue->_monitor);
+      queue->_threadCount += 1;
+      omrthread_monitor_exit(queue->_monitor);
+      if (J9THREAD_SUCCESS != omrthread_create(&thread, COMPILATION_THREAD_STACK_SIZE, J9THREAD_PRIORITY_NORMAL, 0, compilationThreadProc, queue))
+         {
+         omrthread_monitor_enter(queue->_monitor);
+         queue->_threadCount -= 1;
+         omrthread_monitor_exit(queue->_monitor);
+         destroy(queue);
+         return NULL;
+         }
+      }
+
+   return queue;
+   }
+
+void
+JitBuilder::CompileQueue::destroy(CompileQueue *queue)
+   {
+   TR::RawAllocator rawAllocator = TR::Compiler->rawAllocator;
+
+   attachCurrentThread();
+   omrthread_monitor_enter(queue->_monitor);
+   queue->_shuttingDown = true;
+   omrthread_monitor_notify_all(queue->_monitor);
+   while (0 != queue->_count)
+      {
+      CompileRequest *request = queue->pop();
+      omrthread_monitor_exit(queue->_monitor);
+      queue->complete(request, COMPILATION_FAILED, NULL);
+      omrthread_monitor_enter(queue->_monitor);
+      }
+   while (0 != queue->_threadCount)
+      omrthread_monitor_wait(queue->_monitor);
+
+   // requests the caller has not released
+   while (NULL != queue->_liveRequests)
+      {
+      CompileRequest *request = queue->_liveRequests;
+      queue->_liveRequests = request->_next;
+      request->~CompileRequest();
+      rawAllocator.deallocate(request);
+      }
+   omrthread_monitor_exit(queue->_monitor);
+
+   omrthread_monitor_destroy(queue->_monitor);
+   rawAllocator.deallocate(queue->_heap);
+   queue->~CompileQueue();
+   rawAllocator.deallocate(queue);
+   }
+
+JitBuilder::CompileRequest *
+JitBuilder::CompileQueue::submit(TR::MethodBuilder *methodBuilder, int32_t priority, bool waitIfFull, CompileCompletionCallback callback, void *userData)
+   {
+   TR::RawAllocator rawAllocator = TR::Compiler->rawAllocator;
+
+   if (!attachCurrentThread())
+      return NULL;
+
+   void *requestMemory = rawAllocator.allocate(sizeof(CompileRequest), std::nothrow);
+   if (NULL == requestMemory)
+      return NULL;
+   CompileRequest *request = new (requestMemory) CompileRequest(methodBuilder, priority, callback, userData);
+
+   omrthread_monitor_enter(_monitor);
+   while (waitIfFull && (_count == _capacity) && !_shuttingDown)
+      omrthread_monitor_wait(_monitor);
+   if ((_count == _capacity) || _shuttingDown)
+      {
+      _statistics._rejected += 1;
+      omrthread_monitor_exit(_monitor);
+      request->~CompileRequest();
+      rawAllocator.deallocate(request);
+      return NULL;
+      }
+
+   request->_sequence = _nextSequence++;
+   request->_submitTime = TR::Compiler->vm.getUSecClock();
+   request->_next = _liveRequests;
+   if (NULL != _liveRequests)
+      _liveRequests->_previous = request;
+   _liveRequests = request;
+   push(request);
+
+   _statistics._submitted += 1;
+   if (_count > _statistics._maxQueueDepth)
+      _statistics._maxQueueDepth = _count;
+   omrthread_monitor_notify_all(_monitor);
+   omrthread_monitor_exit(_monitor);
+
+   return request;
+   }
+
+int32_t
+JitBuilder::CompileQueue::poll(CompileRequest *request, void **entryPoint)
+   {
+   attachCurrentThread();
+   omrthread_monitor_enter(_monitor);
+   int32_t rc = request->_rc;
+   if (COMPILATION_REQUESTED != rc)
+      *entryPoint = request->_entryPoint;
+   omrthread_monitor_exit(_monitor);
+   return rc;
+   }
+
+int32_t
+JitBuilder::CompileQueue::wait(CompileRequest *request, void **entryPoint)
+   {
+   attachCurrentThread();
+   omrthread_monitor_enter(_monitor);
+   while (COMPILATION_REQUESTED == request->_rc)
+      omrthread_monitor_wait(_monitor);
+   int32_t rc = request->_rc;
+   *entryPoint = request->_entryPoint;
+   omrthread_monitor_exit(_monitor);
+   return rc;
+   }
+
+void
+JitBuilder::CompileQueue::release(CompileRequest *request)
+   {
+   attachCurrentThread();
+   omrthread_monitor_enter(_monitor);
+   releaseLocked(request);
+   omrthread_monitor_exit(_monitor);
+   }
+
+void
+JitBuilder::CompileQueue::getStatistics(CompileQueueStatistics &statistics)
+   {
+   attachCurrentThread();
+   omrthread_monitor_enter(_monitor);
+   statistics = _statistics;
+   omrthread_monitor_exit(_monitor);
+   }
+
+int J9THREAD_PROC
+JitBuilder::CompileQueue::compilationThreadProc(void *arg)
+   {
+   static_cast<CompileQueue *>(arg)->compilationThreadLoop();
+   return 0;
+   }
+
+void
+JitBuilder::CompileQueue::compilationThreadLoop()
+   {
+   omrthread_monitor_enter(_monitor);
+   int32_t compThreadID = _nextCompThreadID++;
+   while (true)
+      {
+      while ((0 == _count) && !_shuttingDown)
+         omrthread_monitor_wait(_monitor);
+      if (_shuttingDown)
+         break;
+
+      CompileRequest *request = pop();
+      // there is room for a waiting submitter
+      omrthread_monitor_notify_all(_monitor);
+      omrthread_monitor_exit(_monitor);
+
+      uint64_t startTime = TR::Compiler->vm.getUSecClock();
+      void *entryPoint = NULL;
+      int32_t rc = compileMethodBuilder(request->_methodBuilder, &entryPoint, compThreadID);
+      uint64_t endTime = TR::Compiler->vm.getUSecClock();
+      if (COMPILATION_SUCCEEDED != rc)
+         entryPoint = NULL;
+
+      omrthread_monitor_enter(_monitor);
+      uint64_t queueTime = startTime - request->_submitTime;
+      uint64_t compileTime = endTime - startTime;
+      _statistics._completed += 1;
+      if (COMPILATION_SUCCEEDED != rc)
+         _statistics._failed += 1;
+      _statistics._totalQueueTime += queueTime;
+      _statistics._totalCompileTime += compileTime;
+      if (queueTime > _statistics._maxQueueTime)
+         _statistics._maxQueueTime = queueTime;
+      if (compileTime > _statistics._maxCompileTime)
+         _statistics._maxCompileTime = compileTime;
+      omrthread_monitor_exit(_monitor);
+
+      complete(request, rc, entryPoint);
+      omrthread_monitor_enter(_monitor);
+      }
+
+   _threadCount -= 1;
+   omrthread_monitor_notify_all(_monitor);
+   omrthread_exit(_monitor);
+   }
+
+/**
+ * Publish the result of a request, call its callback and drop the queue's reference to it.
+ * Called without the monitor held, so that the callback may use the queue.
+ */
+void
+JitBuilder::CompileQueue::complete(CompileRequest *request, int32_t rc, void *entryPoint)
+   {
+   omrthread_monitor_enter(_monitor);
+   request->_entryPoint = entryPoint;
+   request->_rc = rc;
+   omrthread_monitor_notify_all(_monitor);
+   omrthread_monitor_exit(_monitor);
+
+   if (NULL != request->_callback)
+      request->_callback(request, rc, entryPoint, request->_userData);
+
+   omrthread_monitor_enter(_monitor);
+   releaseLocked(request);
+   omrthread_monitor_exit(_monitor);
+   }
+
+bool
+JitBuilder::CompileQueue::precedes(CompileRequest *a, CompileRequest *b)
+   {
+   if (a->_priority != b->_priority)
+      return a->_priority > b->_priority;
+   return a->_sequence < b->_sequence;
+   }
+
+void
+JitBuilder::CompileQueue::push(CompileRequest *request)
+   {
+   uint32_t i = _count++;
+   while (i > 0)
+      {
+      uint32_t parent = (i - 1) / 2;
+      if (!precedes(request, _heap[parent]))
+         break;
+      _heap[i] = _heap[parent];
+      i = parent;
+      }
+   _heap[i] = request;
+   }
+
+JitBuilder::CompileRequest *
+JitBuilder::CompileQueue::pop()
+   {
+   CompileRequest *top = _heap[0];
+   CompileRequest *last = _heap[--_count];
+   uint32_t i = 0;
+   while (true)
+      {
+      uint32_t child = (2 * i) + 1;
+      if (child >= _count)
+         break;
+      if (((child + 1) < _count) && precedes(_heap[child + 1], _heap[child]))
+         child += 1;
+      if (!precedes(_heap[child], last))
+         break;
+      _heap[i] = _heap[child];
+      i = child;
+      }
+   _heap[i] = last;
+   return top;
+   }
+
+void
+JitBuilder::CompileQueue::releaseLocked(CompileRequest *request)
+   {
+   request->_references -= 1;
+   if (0 == request->_references)
+      {
+      if (NULL != request->_previous)
+         request->_previous->_next = request->_next;
+      else
+         _liveRequests = request->_next;
+      if (NULL != request->_next)
+         request->_next->_previous = request->_previous;
+      request->~CompileRequest();
+      TR::Compiler->rawAllocator.deallocate(request);
+      }
+   }
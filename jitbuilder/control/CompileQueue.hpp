@@ -0,0 +1,156 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#ifndef JITBUILDER_COMPILEQUEUE_INCL
+#define JITBUILDER_COMPILEQUEUE_INCL
+
+#include <stdint.h>
+#include "omrthread.h"
+
+namespace TR { class MethodBuilder; }
+
+namespace JitBuilder
+{
+
+class CompileRequest;
+
+/**
+ * @brief Called on the compilation thread when an asynchronous compilation completes
+ *
+ * @param request The request that completed. It remains valid until released.
+ * @param rc The compilation return code, COMPILATION_SUCCEEDED on success
+ * @param entryPoint The entry point of the compiled method, or NULL if compilation failed
+ * @param userData The userData passed when the request was submitted
+ */
+typedef void (*CompileCompletionCallback)(CompileRequest *request, int32_t rc, void *entryPoint, void *userData);
+
+/**
+ * @brief Counters kept by a CompileQueue. Times are in microseconds.
+ */
+struct CompileQueueStatistics
+   {
+   uint64_t _submitted;
+   uint64_t _rejected;         ///< requests refused because the queue was full
+   uint64_t _completed;
+   uint64_t _failed;           ///< completed requests that did not produce an entry point
+   uint64_t _totalQueueTime;   ///< time from submission to the start of compilation
+   uint64_t _maxQueueTime;
+   uint64_t _totalCompileTime;
+   uint64_t _maxCompileTime;
+   uint32_t _maxQueueDepth;
+   };
+
+/**
+ * @brief A bounded priority queue of MethodBuilders drained by a pool of compilation threads
+ *
+ * Requests with a higher priority are compiled first, and requests of equal priority are
+ * compiled in submission order. The compilation threads compile concurrently with each other
+ * and with application threads. A MethodBuilder and its TypeDictionary must not be used by
+ * the caller until its request has completed.
+ *
+ * The queue uses the OMR thread library. Threads that submit or wait for requests are
+ * attached to it the first time they do so.
+ */
+class CompileQueue
+   {
+   public:
+
+   /**
+    * @brief Create a queue and start its compilation threads
+    * @param numThreads The number of compilation threads
+    * @param capacity The maximum number of requests waiting to be compiled
+    * @return the queue, or NULL if it could not be created
+    */
+   static CompileQueue *create(uint32_t numThreads, uint32_t capacity);
+
+   /**
+    * @brief Stop the compilation threads and free the queue and all of its requests
+    *
+    * Requests that have not started compiling complete with COMPILATION_FAILED. Compilations
+    * in progress are allowed to finish.
+    */
+   static void destroy(CompileQueue *queue);
+
+   /**
+    * @brief Queue a MethodBuilder to be compiled
+    * @param methodBuilder The MethodBuilder to compile
+    * @param priority The priority of the request, higher priorities are compiled first
+    * @param waitIfFull If the queue is full, wait for space when true, or fail when false
+    * @param callback Called when the compilation completes, may be NULL
+    * @param userData Passed to callback
+    * @return the request, or NULL if the queue is full and waitIfFull is false
+    */
+   CompileRequest *submit(TR::MethodBuilder *methodBuilder, int32_t priority, bool waitIfFull, CompileCompletionCallback callback, void *userData);
+
+   /**
+    * @brief Obtain the result of a request without waiting
+    * @param request The request
+    * @param entryPoint Set to the entry point once the compilation has completed
+    * @return COMPILATION_REQUESTED if the compilation has not completed, else its return code
+    */
+   int32_t poll(CompileRequest *request, void **entryPoint);
+
+   /**
+    * @brief Wait for a request to complete
+    * @param request The request
+    * @param entryPoint Set to the entry point of the compiled method, or NULL on failure
+    * @return the compilation return code
+    */
+   int32_t wait(CompileRequest *request, void **entryPoint);
+
+   /**
+    * @brief Release a request. It must not be used afterwards. A request released before it
+    * completes is still compiled, and its callback is still called.
+    */
+   void release(CompileRequest *request);
+
+   void getStatistics(CompileQueueStatistics &statistics);
+
+   private:
+
+   CompileQueue(uint32_t capacity, CompileRequest **heap);
+
+   static int J9THREAD_PROC compilationThreadProc(void *arg);
+   void compilationThreadLoop();
+   void complete(CompileRequest *request, int32_t rc, void *entryPoint);
+
+   bool precedes(CompileRequest *a, CompileRequest *b);
+   void push(CompileRequest *request);
+   CompileRequest *pop();
+   void releaseLocked(CompileRequest *request);
+
+   omrthread_monitor_t _monitor;
+   CompileRequest **_heap;          ///< binary heap of the requests waiting to be compiled
+   uint32_t _capacity;
+   uint32_t _count;
+   uint64_t _nextSequence;
+   CompileRequest *_liveRequests;  ///< every request not yet freed
+   uint32_t _threadCount;           ///< compilation threads that have not exited
+   int32_t _nextCompThreadID;       ///< compilation threads are numbered from 1, 0 is an application thread
+   bool _shuttingDown;
+   CompileQueueStatistics _statistics;
+   };
+
+} // namespace JitBuilder
+
+#endif // !defined(JITBUILDER_COMPILEQUEUE_INCL)
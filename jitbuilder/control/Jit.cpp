@@ -24,15 +24,21 @@
 #include "codegen/CodeGenerator.hpp"
 #include "compile/CompilationTypes.hpp"
 #include "compile/Method.hpp"
+#include "control/CompilationResultCache.hpp"
 #include "control/CompileMethod.hpp"
+#include "control/CompileQueue.hpp"
+#include "control/PersistentCodeCache.hpp"
+#include "control/TieredCompilation.hpp"
 #include "env/CompilerEnv.hpp"
 #include "env/FrontEnd.hpp"
 #include "env/IO.hpp"
 #include "env/JitConfig.hpp"
 #include "env/RawAllocator.hpp"
+#include "env/VerboseLog.hpp"
 #include "ilgen/IlGeneratorMethodDetails_inlines.hpp"
 #include "ilgen/MethodBuilder.hpp"
 #include "ilgen/TypeDictionary.hpp"
+#include "infra/Monitor.hpp"
 #include "runtime/CodeCache.hpp"
 #include "runtime/Runtime.hpp"
 #include "control/CompilationController.hpp"
@@ -44,6 +50,29 @@
 extern TR_RuntimeHelperTable runtimeHelpers;
 extern void setupCodeCacheParameters(int32_t *, OMR::CodeCacheCodeGenCallbacks *callBacks, int32_t *numHelpers, int32_t *CCPreLoadedCodeSize);
 
+static JitBuilder::CompileQueue *compileQueue = NULL;
+static JitBuilder::TieredMethod *tieredMethods = NULL;
+static TR::Monitor *tieredMethodsMonitor = NULL;
+static JitBuilder::PersistentCodeCache *persistentCodeCache = NULL;
+static JitBuilder::CompilationResultCache *compilationResultCache = NULL;
+static uint64_t jitOptionsHash = 0;
+
+// MethodBuilders look up their IL in the compilation result cache, which looks it up in
+// the persistent code cache on a miss, or in whichever of them is in use
+static void
+updateCodeStore()
+   {
+   if (NULL != compilationResultCache)
+      {
+      compilationResultCache->setNext(persistentCodeCache);
+      TR::MethodBuilder::setCodeStore(compilationResultCache);
+      }
+   else
+      {
+      TR::MethodBuilder::setCodeStore(persistentCodeCache);
+      }
+   }
+
 static void
 initHelper(void *helper, TR_RuntimeHelper id)
    {
@@ -144,6 +173,10 @@ initializeJitBuilder(TR_RuntimeHelper *helperIDs, void **helperAddresses, int32_
    if (commonJitInit(fe, options) < 0)
       return false;
 
+   jitOptionsHash = JitBuilder::PersistentCodeCache::hashOptions(options);
+
+   tieredMethodsMonitor = TR::Monitor::create("JIT-TieredMethodsMonitor");
+
    initializeCodeCache(fe.codeCacheManager());
 
    return true;
@@ -167,6 +200,15 @@ initializeJitBuilder(TR_RuntimeHelper *helperIDs, void **helperAddresses, int32_
 // An individual program should link statically against JitBuilder, then call:
 //     initializeJit() or initializeJitWithOptions() to initialize the Jit
 //     compileMethodBuilder() as many times as needed to create compiled code
+//     or startCompilationThreads() once, then compileMethodBuilderAsync() to
+//        compile on background threads
+//     or compileMethodBuilderTiered() to compile a profiling version first and
+//        recompile it once it is hot, and releaseTieredMethod() before freeing
+//        the MethodBuilder
+//     openPersistentCodeCache() to reuse code compiled by earlier runs for
+//        MethodBuilders that generate the same IL
+//     enableCompilationResultCache() to reuse code compiled earlier in the run
+//        for MethodBuilders that generate the same IL
 //     shuwdownJit() when the test is complete
 //
 
@@ -185,10 +227,13 @@ internal_initializeJit()
    return initializeJitBuilder(0, 0, 0, (char *)"-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator");
    }
 
+// Compilations may run concurrently on any number of threads. compThreadID is 0
+// on application threads and identifies the thread on the compilation threads, so
+// that each of them gets its own log file.
 int32_t
-internal_compileMethodBuilder(TR::MethodBuilder *m, void **entry)
+compileMethodBuilder(TR::MethodBuilder *m, void **entry, int32_t compThreadID)
    {
-   auto rc = m->Compile(entry);
+   int32_t rc = m->Compile(entry, compThreadID);
 
 #if defined(AIXPPC)
    struct FunctionDescriptor
@@ -211,11 +256,263 @@ internal_compileMethodBuilder(TR::MethodBuilder *m, void **entry)
    return rc;
    }
 
+int32_t
+internal_compileMethodBuilder(TR::MethodBuilder *m, void **entry)
+   {
+   return compileMethodBuilder(m, entry, 0);
+   }
+
+bool
+internal_startCompilationThreads(int32_t numThreads, int32_t queueCapacity)
+   {
+   if ((NULL != compileQueue) || (numThreads <= 0) || (queueCapacity <= 0))
+      return false;
+
+   compileQueue = JitBuilder::CompileQueue::create(numThreads, queueCapacity);
+   return NULL != compileQueue;
+   }
+
+void *
+internal_compileMethodBuilderAsync(TR::MethodBuilder *m, int32_t priority, bool waitIfFull, void *completionCallback, void *userData)
+   {
+   if (NULL == compileQueue)
+      return NULL;
+
+   return compileQueue->submit(m, priority, waitIfFull, reinterpret_cast<JitBuilder::CompileCompletionCallback>(completionCallback), userData);
+   }
+
+int32_t
+internal_pollCompilation(void *request, void **entry)
+   {
+   return compileQueue->poll(static_cast<JitBuilder::CompileRequest *>(request), entry);
+   }
+
+int32_t
+internal_waitForCompilation(void *request, void **entry)
+   {
+   return compileQueue->wait(static_cast<JitBuilder::CompileRequest *>(request), entry);
+   }
+
+void
+internal_releaseCompilation(void *request)
+   {
+   compileQueue->release(static_cast<JitBuilder::CompileRequest *>(request));
+   }
+
+// The profiling code is stored in *entry, and replaced by the recompiled code once
+// the method has been invoked invocationThreshold times or its loops have iterated
+// backEdgeThreshold times. The method is recompiled on the compilation threads if
+// they have been started, otherwise on the thread that reaches the threshold.
+//
+// The method is recompiled from m, so m, its TypeDictionary and entry must stay allocated
+// until releaseTieredMethod(m) or shutdownJit() is called, and the profiling code must not
+// be called after that.
+int32_t
+internal_compileMethodBuilderTiered(TR::MethodBuilder *m, int32_t invocationThreshold, int32_t backEdgeThreshold, void **entry)
+   {
+   if ((invocationThreshold <= 0) || (backEdgeThreshold <= 0))
+      return COMPILATION_FAILED;
+
+   JitBuilder::TieredMethod *method = JitBuilder::TieredMethod::create(m, compileQueue, invocationThreshold, backEdgeThreshold, entry);
+   if (NULL == method)
+      return COMPILATION_FAILED;
+
+   int32_t rc = method->compileProfiled();
+   if (COMPILATION_SUCCEEDED != rc)
+      {
+      JitBuilder::TieredMethod::destroy(method);
+      return rc;
+      }
+
+   tieredMethodsMonitor->enter();
+   method->_next = tieredMethods;
+   tieredMethods = method;
+   tieredMethodsMonitor->exit();
+
+   return rc;
+   }
+
+// Waits for a recompilation of the method compiled from m that has already started, or
+// stops one from starting, and then forgets the method. *entry keeps whichever code was
+// installed last; only the recompiled code may be called afterwards.
+void
+internal_releaseTieredMethod(TR::MethodBuilder *m)
+   {
+   JitBuilder::TieredMethod *method = NULL;
+
+   tieredMethodsMonitor->enter();
+   for (JitBuilder::TieredMethod **link = &tieredMethods; NULL != *link; link = &(*link)->_next)
+      {
+      if ((*link)->isCompiledFrom(m))
+         {
+         method = *link;
+         *link = method->_next;
+         break;
+         }
+      }
+   tieredMethodsMonitor->exit();
+
+   if (NULL == method)
+      return;
+
+   method->stopRecompilation();
+   JitBuilder::TieredMethod::destroy(method);
+   }
+
+// Must be called while no compilations are in progress. The cache applies to every
+// compilation after it until closePersistentCodeCache() is called.
+bool
+internal_openPersistentCodeCache(const char *path, int64_t size)
+   {
+   if ((NULL != persistentCodeCache) || (NULL == path) || (size <= 0))
+      return false;
+
+   persistentCodeCache = JitBuilder::PersistentCodeCache::open(path, (uint64_t)size, jitOptionsHash);
+   if (NULL == persistentCodeCache)
+      return false;
+
+   updateCodeStore();
+   return true;
+   }
+
+void
+internal_closePersistentCodeCache()
+   {
+   if (NULL == persistentCodeCache)
+      return;
+
+   if (TR::Options::getVerboseOption(TR_VerbosePerformance))
+      {
+      JitBuilder::PersistentCodeCacheStatistics stats;
+      persistentCodeCache->getStatistics(stats);
+      TR_VerboseLog::writeLineLocked(TR_Vlog_PERF,
+         "persistent code cache: hits=%llu misses=%llu stored=%llu notStored=%llu",
+         (unsigned long long)stats._hits, (unsigned long long)stats._misses,
+         (unsigned long long)stats._stored, (unsigned long long)stats._notStored);
+      }
+   JitBuilder::PersistentCodeCache *cache = persistentCodeCache;
+   persistentCodeCache = NULL;
+   updateCodeStore();
+   JitBuilder::PersistentCodeCache::close(cache);
+   }
+
+int64_t
+internal_getPersistentCodeCacheHits()
+   {
+   if (NULL == persistentCodeCache)
+      return 0;
+
+   JitBuilder::PersistentCodeCacheStatistics stats;
+   persistentCodeCache->getStatistics(stats);
+   return (int64_t)stats._hits;
+   }
+
+int64_t
+internal_getPersistentCodeCacheMisses()
+   {
+   if (NULL == persistentCodeCache)
+      return 0;
+
+   JitBuilder::PersistentCodeCacheStatistics stats;
+   persistentCodeCache->getStatistics(stats);
+   return (int64_t)stats._misses;
+   }
+
+// Must be called while no compilations are in progress. When verifyIL is set, the IL of
+// each compilation is compared with the IL of the code it reuses, and not just its hash.
+bool
+internal_enableCompilationResultCache(bool verifyIL)
+   {
+   if (NULL != compilationResultCache)
+      return false;
+
+   compilationResultCache = JitBuilder::CompilationResultCache::create(verifyIL);
+   if (NULL == compilationResultCache)
+      return false;
+
+   updateCodeStore();
+   return true;
+   }
+
+void
+internal_disableCompilationResultCache()
+   {
+   if (NULL == compilationResultCache)
+      return;
+
+   if (TR::Options::getVerboseOption(TR_VerbosePerformance))
+      {
+      JitBuilder::CompilationResultCacheStatistics stats;
+      compilationResultCache->getStatistics(stats);
+      TR_VerboseLog::writeLineLocked(TR_Vlog_PERF,
+         "compilation result cache: hits=%llu misses=%llu collisions=%llu results=%llu",
+         (unsigned long long)stats._hits, (unsigned long long)stats._misses,
+         (unsigned long long)stats._collisions, (unsigned long long)stats._results);
+      }
+   JitBuilder::CompilationResultCache *cache = compilationResultCache;
+   compilationResultCache = NULL;
+   updateCodeStore();
+   JitBuilder::CompilationResultCache::destroy(cache);
+   }
+
+int64_t
+internal_getCompilationResultCacheHits()
+   {
+   if (NULL == compilationResultCache)
+      return 0;
+
+   JitBuilder::CompilationResultCacheStatistics stats;
+   compilationResultCache->getStatistics(stats);
+   return (int64_t)stats._hits;
+   }
+
+int64_t
+internal_getCompilationResultCacheMisses()
+   {
+   if (NULL == compilationResultCache)
+      return 0;
+
+   JitBuilder::CompilationResultCacheStatistics stats;
+   compilationResultCache->getStatistics(stats);
+   return (int64_t)stats._misses;
+   }
+
 void
 internal_shutdownJit()
    {
    auto fe = TR::FrontEnd::instance();
 
+   if (NULL != compileQueue)
+      {
+      if (TR::Options::getVerboseOption(TR_VerbosePerformance))
+         {
+         JitBuilder::CompileQueueStatistics stats;
+         compileQueue->getStatistics(stats);
+         TR_VerboseLog::writeLineLocked(TR_Vlog_PERF,
+            "async compilations: submitted=%llu rejected=%llu completed=%llu failed=%llu queueTime total=%lluus max=%lluus compileTime total=%lluus max=%lluus maxQueueDepth=%u",
+            (unsigned long long)stats._submitted, (unsigned long long)stats._rejected,
+            (unsigned long long)stats._completed, (unsigned long long)stats._failed,
+            (unsigned long long)stats._totalQueueTime, (unsigned long long)stats._maxQueueTime,
+            (unsigned long long)stats._totalCompileTime, (unsigned long long)stats._maxCompileTime,
+            stats._maxQueueDepth);
+         }
+      JitBuilder::CompileQueue::destroy(compileQueue);
+      compileQueue = NULL;
+      }
+
+   // after the compile queue, which may still hold their recompilations
+   while (NULL != tieredMethods)
+      {
+      JitBuilder::TieredMethod *method = tieredMethods;
+      tieredMethods = method->_next;
+      JitBuilder::TieredMethod::destroy(method);
+      }
+   TR::Monitor::destroy(tieredMethodsMonitor);
+   tieredMethodsMonitor = NULL;
+
+   internal_disableCompilationResultCache();
+   internal_closePersistentCodeCache();
+
    TR::CodeCacheManager &codeCacheManager = fe->codeCacheManager();
    codeCacheManager.destroy();
 
@@ -0,0 +1,522 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <algorithm>
+#include <new>
+#include <string.h>
+#include "AtomicSupport.hpp"
+#include "codegen/CodeGenerator.hpp"
+#include "codegen/Relocation.hpp"
+#include "compile/Compilation.hpp"
+#include "compile/SymbolReferenceTable.hpp"
+#include "control/PersistentCodeCache.hpp"
+#include "env/CompilerEnv.hpp"
+#include "il/MethodSymbol.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "infra/Checklist.hpp"
+#include "infra/CriticalSection.hpp"
+#include "infra/Monitor.hpp"
+#include "runtime/CodeCache.hpp"
+#include "runtime/CodeCacheManager.hpp"
+
+#if !defined(OMR_OS_WINDOWS)
+#include <fcntl.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif /* !defined(OMR_OS_WINDOWS) */
+
+// Changes to the file layout, or to what the key of a method covers, must change the version
+#define PERSISTENT_CODE_CACHE_VERSION 1
+
+// Code is copied to the same offset from a boundary of this many bytes as it was generated
+// at, so that the padding that aligns its instructions still aligns them
+#define CODE_ALIGNMENT 64
+
+static const char eyecatcher[8] = { 'J', 'B', 'C', 'O', 'D', 'E', '\0', '\0' };
+
+namespace JitBuilder
+{
+
+struct PersistentCodeCacheFileHeader
+   {
+   char _eyecatcher[8];
+   uint32_t _version;
+   uint32_t _headerSize;
+   uint64_t _size;            ///< of the file
+   volatile uint64_t _used;   ///< bytes of the file taken by the header and by complete records
+   };
+
+struct PersistentCodeCacheRecord
+   {
+   uint64_t _environment;     ///< hash of the options and processor the code was compiled for
+   uint64_t _ilHash[2];
+   uint64_t _ilSize;
+   uint64_t _checksum;        ///< of the rest of the record
+   uint32_t _recordSize;      ///< a multiple of 8
+   uint32_t _codeSize;
+   uint32_t _entryOffset;     ///< of the entry point from the start of the code
+   uint32_t _alignment;       ///< offset of the start of the code from a CODE_ALIGNMENT boundary
+   uint32_t _numRelocations;  ///< label addresses in the code, which are stored as offsets from its start
+   uint32_t _reserved;
+   // followed by the offsets of the label addresses in the code, then the code
+
+   uint32_t *relocations() { return reinterpret_cast<uint32_t *>(this + 1); }
+   uint8_t *code() { return reinterpret_cast<uint8_t *>(relocations() + _numRelocations); }
+   };
+
+} // namespace JitBuilder
+
+// 64 bit FNV-1a
+static uint64_t
+hashBytes(const void *data, size_t size, uint64_t hash = 0xcbf29ce484222325ULL)
+   {
+   const uint8_t *bytes = static_cast<const uint8_t *>(data);
+   for (size_t i = 0; i < size; i++)
+      {
+      hash ^= bytes[i];
+      hash *= 0x100000001b3ULL;
+      }
+   return hash;
+   }
+
+bool
+JitBuilder::PersistentCodeCache::Key::operator<(const Key &other) const
+   {
+   if (_ilHash[0] != other._ilHash[0])
+      return _ilHash[0] < other._ilHash[0];
+   if (_ilHash[1] != other._ilHash[1])
+      return _ilHash[1] < other._ilHash[1];
+   return _ilSize < other._ilSize;
+   }
+
+JitBuilder::PersistentCodeCache::PersistentCodeCache(int fd, uint8_t *base, uint64_t size, uint64_t environment, TR::Monitor *monitor)
+   : _fd(fd),
+     _base(base),
+     _size(size),
+     _indexed(sizeof(PersistentCodeCacheFileHeader)),
+     _environment(environment),
+     _monitor(monitor),
+     _index(std::less<Key>(), IndexAllocator(TR::Compiler->rawAllocator))
+   {
+   memset(&_statistics, 0, sizeof(_statistics));
+   }
+
+uint64_t
+JitBuilder::PersistentCodeCache::hashOptions(const char *options)
+   {
+   return hashBytes(options, (options != NULL) ? strlen(options) : 0);
+   }
+
+JitBuilder::PersistentCodeCache *
+JitBuilder::PersistentCodeCache::open(const char *path, uint64_t size, uint64_t optionsHash)
+   {
+#if defined(OMR_OS_WINDOWS)
+   return NULL;
+#else /* defined(OMR_OS_WINDOWS) */
+   TR::RawAllocator rawAllocator = TR::Compiler->rawAllocator;
+   PersistentCodeCacheFileHeader header;
+
+   int fd = ::open(path, O_RDWR | O_CREAT, 0644);
+   if (fd < 0)
+      return NULL;
+
+   if (!lockFile(fd))
+      {
+      ::close(fd);
+      return NULL;
+      }
+
+   // the first process to lock a new file sizes it and writes its header
+   struct stat status;
+   bool initialize = false;
+   if (0 != fstat(fd, &status))
+      size = 0;
+   else if (0 == status.st_size)
+      {
+      size &= ~(uint64_t)7;
+      if ((size < sizeof(PersistentCodeCacheFileHeader) + sizeof(PersistentCodeCacheRecord)) || (0 != ftruncate(fd, (off_t)size)))
+         size = 0;
+      initialize = true;
+      }
+   else if ((sizeof(header) == pread(fd, &header, sizeof(header), 0))
+            && (0 == memcmp(header._eyecatcher, eyecatcher, sizeof(eyecatcher)))
+            && (PERSISTENT_CODE_CACHE_VERSION == header._version)
+            && (sizeof(PersistentCodeCacheFileHeader) == header._headerSize)
+            && ((uint64_t)status.st_size == header._size))
+      size = header._size;
+   else
+      size = 0;
+
+   void *base = MAP_FAILED;
+   if ((0 != size) && (size <= (uint64_t)SIZE_MAX))
+      base = mmap(NULL, (size_t)size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+   if (MAP_FAILED == base)
+      {
+      unlockFile(fd);
+      ::close(fd);
+      return NULL;
+      }
+
+   if (initialize)
+      {
+      PersistentCodeCacheFileHeader *newHeader = static_cast<PersistentCodeCacheFileHeader *>(base);
+      memcpy(newHeader->_eyecatcher, eyecatcher, sizeof(eyecatcher));
+      newHeader->_version = PERSISTENT_CODE_CACHE_VERSION;
+      newHeader->_headerSize = sizeof(PersistentCodeCacheFileHeader);
+      newHeader->_size = size;
+      newHeader->_used = sizeof(PersistentCodeCacheFileHeader);
+      }
+   unlockFile(fd);
+
+   OMRProcessorDesc processor = TR::Compiler->target.cpu.getProcessorDescription();
+   uint32_t pointerSize = sizeof(void *);
+   uint64_t environment = hashBytes(&optionsHash, sizeof(optionsHash));
+   environment = hashBytes(&processor, sizeof(processor), environment);
+   environment = hashBytes(&pointerSize, sizeof(pointerSize), environment);
+
+   TR::Monitor *monitor = TR::Monitor::create("JIT-PersistentCodeCacheMonitor");
+   void *cacheMemory = rawAllocator.allocate(sizeof(PersistentCodeCache), std::nothrow);
+   if ((NULL == monitor) || (NULL == cacheMemory))
+      {
+      if (NULL != monitor)
+         TR::Monitor::destroy(monitor);
+      rawAllocator.deallocate(cacheMemory);
+      munmap(base, (size_t)size);
+      ::close(fd);
+      return NULL;
+      }
+
+   return new (cacheMemory) PersistentCodeCache(fd, static_cast<uint8_t *>(base), size, environment, monitor);
+#endif /* defined(OMR_OS_WINDOWS) */
+   }
+
+void
+JitBuilder::PersistentCodeCache::close(PersistentCodeCache *cache)
+   {
+#if !defined(OMR_OS_WINDOWS)
+   munmap(cache->_base, (size_t)cache->_size);
+   ::close(cache->_fd);
+#endif /* !defined(OMR_OS_WINDOWS) */
+   TR::Monitor::destroy(cache->_monitor);
+   cache->~PersistentCodeCache();
+   TR::Compiler->rawAllocator.deallocate(cache);
+   }
+
+// Locks the file against other processes. Threads of this process are kept out by _monitor.
+bool
+JitBuilder::PersistentCodeCache::lockFile(int fd)
+   {
+#if defined(OMR_OS_WINDOWS)
+   return false;
+#else /* defined(OMR_OS_WINDOWS) */
+   struct flock lock;
+   memset(&lock, 0, sizeof(lock));
+   lock.l_type = F_WRLCK;
+   lock.l_whence = SEEK_SET;
+   int rc;
+   do
+      rc = fcntl(fd, F_SETLKW, &lock);
+   while ((-1 == rc) && (EINTR == errno));
+   return 0 == rc;
+#endif /* defined(OMR_OS_WINDOWS) */
+   }
+
+void
+JitBuilder::PersistentCodeCache::unlockFile(int fd)
+   {
+#if !defined(OMR_OS_WINDOWS)
+   struct flock lock;
+   memset(&lock, 0, sizeof(lock));
+   lock.l_type = F_UNLCK;
+   lock.l_whence = SEEK_SET;
+   fcntl(fd, F_SETLK, &lock);
+#endif /* !defined(OMR_OS_WINDOWS) */
+   }
+
+JitBuilder::PersistentCodeCache::Key
+JitBuilder::PersistentCodeCache::keyOf(const OMR::MethodBuilderIL &il)
+   {
+   Key key;
+   key._ilHash[0] = il.getHash()[0];
+   key._ilHash[1] = il.getHash()[1];
+   key._ilSize = il.getSize();
+   return key;
+   }
+
+// Adds the records that this or other processes have appended since the last call to the
+// index. The caller holds _monitor.
+void
+JitBuilder::PersistentCodeCache::indexNewRecords()
+   {
+   PersistentCodeCacheFileHeader *header = reinterpret_cast<PersistentCodeCacheFileHeader *>(_base);
+   uint64_t used = header->_used;
+   if (used > _size)
+      used = _size;
+   VM_AtomicSupport::readBarrier();
+
+   while (_indexed < used)
+      {
+      PersistentCodeCacheRecord *record = reinterpret_cast<PersistentCodeCacheRecord *>(_base + _indexed);
+      if ((record->_recordSize < sizeof(PersistentCodeCacheRecord)) || (record->_recordSize > used - _indexed))
+         break; // the file is damaged, and nothing after this can be found
+
+      if (record->_environment == _environment)
+         {
+         Key key;
+         key._ilHash[0] = record->_ilHash[0];
+         key._ilHash[1] = record->_ilHash[1];
+         key._ilSize = record->_ilSize;
+         _index.insert(std::make_pair(key, _indexed));
+         }
+      _indexed += record->_recordSize;
+      }
+   }
+
+// Copies the code in a record into the code cache and relocates it. The caller holds _monitor.
+void *
+JitBuilder::PersistentCodeCache::install(TR::Compilation *comp, PersistentCodeCacheRecord *record)
+   {
+   uint64_t contentSize = record->_recordSize - sizeof(PersistentCodeCacheRecord);
+   if (((uint64_t)record->_numRelocations * sizeof(uint32_t) + record->_codeSize > contentSize)
+       || (record->_entryOffset >= record->_codeSize)
+       || (hashBytes(record->relocations(), (size_t)contentSize) != record->_checksum))
+      return NULL;
+
+   uint32_t *relocations = record->relocations();
+   for (uint32_t i = 0; i < record->_numRelocations; i++)
+      {
+      if ((record->_codeSize < sizeof(uintptr_t)) || (relocations[i] > record->_codeSize - sizeof(uintptr_t)))
+         return NULL;
+      }
+
+   TR::CodeCacheManager *manager = TR::CodeCacheManager::instance();
+   size_t allocationSize = record->_codeSize + CODE_ALIGNMENT - 1;
+   int32_t numReserved = 0;
+   TR::CodeCache *codeCache = manager->reserveCodeCache(false, allocationSize, comp->getCompThreadID(), &numReserved);
+   if (NULL == codeCache)
+      return NULL;
+   uint8_t *coldCode = NULL;
+   uint8_t *memory = manager->allocateCodeMemory(allocationSize, 0, &codeCache, &coldCode, false);
+   manager->unreserveCodeCache(codeCache);
+   if (NULL == memory)
+      return NULL;
+
+   uint8_t *code = memory + ((record->_alignment - (uintptr_t)memory) & (CODE_ALIGNMENT - 1));
+   memcpy(code, record->code(), record->_codeSize);
+   for (uint32_t i = 0; i < record->_numRelocations; i++)
+      {
+      uintptr_t address;
+      memcpy(&address, code + relocations[i], sizeof(address));
+      address += (uintptr_t)code;
+      memcpy(code + relocations[i], &address, sizeof(address));
+      }
+   TR::CodeGenerator::syncCode(code, record->_codeSize);
+
+   return code + record->_entryOffset;
+   }
+
+void *
+JitBuilder::PersistentCodeCache::lookup(TR::Compilation *comp, const OMR::MethodBuilderIL &il)
+   {
+   Key key = keyOf(il);
+   void *entry = NULL;
+
+   OMR::CriticalSection lookingUp(_monitor);
+   indexNewRecords();
+   Index::iterator found = _index.find(key);
+   if (found != _index.end())
+      entry = install(comp, reinterpret_cast<PersistentCodeCacheRecord *>(_base + found->second));
+
+   if (NULL != entry)
+      _statistics._hits++;
+   else
+      _statistics._misses++;
+   return entry;
+   }
+
+static bool
+hasRelocatableReferences(TR::Node *node, int32_t numILSymRefs, TR::NodeChecklist &visited)
+   {
+   if (visited.contains(node))
+      return true;
+   visited.add(node);
+
+   if (node->getOpCode().hasSymbolReference())
+      {
+      TR::SymbolReference *symRef = node->getSymbolReference();
+      TR::Symbol *symbol = symRef->getSymbol();
+
+      // the addresses of statics created after the IL was hashed are not part of the key
+      if (symbol->isStatic() && (symRef->getReferenceNumber() >= numILSymRefs))
+         return false;
+
+      // calls to functions without an address are relative to the code
+      if (node->getOpCode().isCall())
+         {
+         TR::MethodSymbol *methodSymbol = symbol->castToMethodSymbol();
+         if (methodSymbol->isHelper() || (!node->getOpCode().isIndirect() && (NULL == methodSymbol->getMethodAddress())))
+            return false;
+         }
+      }
+
+   for (int32_t i = 0; i < node->getNumChildren(); i++)
+      {
+      if (!hasRelocatableReferences(node->getChild(i), numILSymRefs, visited))
+         return false;
+      }
+   return true;
+   }
+
+// Whether the code just generated depends on where it is only through the absolute
+// addresses of its labels. AMD64 system linkage calls functions with an address through
+// a register, so calls are only position independent there.
+bool
+JitBuilder::PersistentCodeCache::isRelocatable(TR::Compilation *comp, const OMR::MethodBuilderIL &il)
+   {
+   TR::CodeGenerator *cg = comp->cg();
+
+   if (!comp->target().cpu.isX86() || !comp->target().is64Bit())
+      return false;
+   if ((NULL != cg->getColdCodeStart()) || !cg->getExternalRelocationList().empty())
+      return false;
+
+   // runtime helpers, including those the code generator calls from snippets
+   TR::SymbolReferenceTable *symRefTab = comp->getSymRefTab();
+   int32_t numHelpers = std::min(symRefTab->getNumHelperSymbols(), symRefTab->getNumSymRefs());
+   for (int32_t i = 0; i < numHelpers; i++)
+      {
+      if (NULL != symRefTab->getSymRef(i))
+         return false;
+      }
+
+   TR::NodeChecklist visited(comp);
+   for (TR::TreeTop *tt = comp->getStartTree(); NULL != tt; tt = tt->getNextTreeTop())
+      {
+      if (!hasRelocatableReferences(tt->getNode(), il.getNumSymRefs(), visited))
+         return false;
+      }
+   return true;
+   }
+
+void
+JitBuilder::PersistentCodeCache::store(TR::Compilation *comp, const OMR::MethodBuilderIL &il)
+   {
+   TR::CodeGenerator *cg = comp->cg();
+   uint8_t *start = cg->getBinaryBufferStart();
+   uint64_t codeSize = cg->getCodeEnd() - start;
+
+   bool relocatable = isRelocatable(comp, il) && (codeSize <= UINT32_MAX);
+   uint32_t numRelocations = 0;
+   for (auto it = cg->getRelocationList().begin(); relocatable && (it != cg->getRelocationList().end()); ++it)
+      {
+      if ((*it)->isLabelAbsoluteRelocation())
+         {
+         uint8_t *location = (*it)->getUpdateLocation();
+         if ((location < start) || (location + sizeof(uintptr_t) > start + codeSize))
+            relocatable = false;
+         numRelocations++;
+         }
+      }
+
+   OMR::CriticalSection storing(_monitor);
+   if (!relocatable)
+      {
+      _statistics._notStored++;
+      return;
+      }
+
+   uint64_t recordSize = (sizeof(PersistentCodeCacheRecord) + (uint64_t)numRelocations * sizeof(uint32_t) + codeSize + 7) & ~(uint64_t)7;
+   if (!lockFile(_fd))
+      {
+      _statistics._notStored++;
+      return;
+      }
+
+   // another process may have stored the same method since it was looked up
+   indexNewRecords();
+   Key key = keyOf(il);
+   if (_index.find(key) != _index.end())
+      {
+      unlockFile(_fd);
+      return;
+      }
+
+   PersistentCodeCacheFileHeader *header = reinterpret_cast<PersistentCodeCacheFileHeader *>(_base);
+   uint64_t used = header->_used;
+   if ((used != _indexed) || (recordSize > _size - used) || (recordSize > UINT32_MAX))
+      {
+      unlockFile(_fd);
+      _statistics._notStored++;
+      return;
+      }
+
+   PersistentCodeCacheRecord *record = reinterpret_cast<PersistentCodeCacheRecord *>(_base + used);
+   memset(record, 0, (size_t)recordSize);
+   record->_environment = _environment;
+   record->_ilHash[0] = key._ilHash[0];
+   record->_ilHash[1] = key._ilHash[1];
+   record->_ilSize = key._ilSize;
+   record->_recordSize = (uint32_t)recordSize;
+   record->_codeSize = (uint32_t)codeSize;
+   record->_entryOffset = (uint32_t)(cg->getCodeStart() - start);
+   record->_alignment = (uint32_t)((uintptr_t)start & (CODE_ALIGNMENT - 1));
+   record->_numRelocations = numRelocations;
+
+   uint8_t *code = record->code();
+   memcpy(code, start, (size_t)codeSize);
+   uint32_t *relocations = record->relocations();
+   for (auto it = cg->getRelocationList().begin(); it != cg->getRelocationList().end(); ++it)
+      {
+      if ((*it)->isLabelAbsoluteRelocation())
+         {
+         uint32_t offset = (uint32_t)((*it)->getUpdateLocation() - start);
+         uintptr_t address;
+         memcpy(&address, code + offset, sizeof(address));
+         address -= (uintptr_t)start;
+         memcpy(code + offset, &address, sizeof(address));
+         *relocations++ = offset;
+         }
+      }
+   record->_checksum = hashBytes(record->relocations(), (size_t)(recordSize - sizeof(PersistentCodeCacheRecord)));
+
+   // other processes read records below _used without locking the file
+   VM_AtomicSupport::writeBarrier();
+   header->_used = used + recordSize;
+   unlockFile(_fd);
+
+   indexNewRecords();
+   _statistics._stored++;
+   }
+
+void
+JitBuilder::PersistentCodeCache::getStatistics(PersistentCodeCacheStatistics &statistics)
+   {
+   OMR::CriticalSection readingStatistics(_monitor);
+   statistics = _statistics;
+   }
@@ -0,0 +1,131 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#ifndef JITBUILDER_PERSISTENTCODECACHE_INCL
+#define JITBUILDER_PERSISTENTCODECACHE_INCL
+
+#include <stdint.h>
+#include <map>
+#include "env/RawAllocator.hpp"
+#include "ilgen/MethodBuilderCodeStore.hpp"
+
+namespace TR { class Monitor; }
+
+namespace JitBuilder
+{
+
+struct PersistentCodeCacheRecord;
+
+/**
+ * @brief Counters kept by a PersistentCodeCache
+ */
+struct PersistentCodeCacheStatistics
+   {
+   uint64_t _hits;        ///< methods whose code was found in the file and installed
+   uint64_t _misses;      ///< methods that had to be compiled
+   uint64_t _stored;      ///< compiled methods whose code was added to the file
+   uint64_t _notStored;   ///< compiled methods whose code cannot be relocated, or did not fit
+   };
+
+/**
+ * @brief A file of code compiled for MethodBuilders, kept from one run of a program to the next
+ *
+ * Code is found by the canonical form of the IL it was compiled from, together with the JIT
+ * options, the processor and the format of the file. When a MethodBuilder generates IL that
+ * has code in the file, the code is copied into the code cache, the addresses of its own
+ * labels in it are relocated, and the compilation returns it without optimizing or compiling
+ * the method.
+ *
+ * Only code that depends on where it is through the addresses of its labels alone is stored.
+ * That is x86-64 code that calls no runtime helpers and that calls functions through their
+ * absolute addresses. The addresses of statics and called functions are part of the
+ * canonical IL, so code that refers to them is only found by runs of the program that have
+ * them at the same addresses.
+ *
+ * The file is mapped into memory and is a fixed size. Records are only ever appended to it,
+ * under a lock on the file, so several processes can use the same file at once. It is only
+ * supported on POSIX systems.
+ */
+class PersistentCodeCache : public OMR::MethodBuilderCodeStore
+   {
+   public:
+
+   /**
+    * @brief Open a cache file, creating it if it does not exist
+    * @param path The path of the file
+    * @param size The size of the file if it is created. An existing file keeps its size.
+    * @param optionsHash The hash of the JIT options, from hashOptions
+    * @return the cache, or NULL if the file cannot be opened or mapped, or is not a cache file
+    */
+   static PersistentCodeCache *open(const char *path, uint64_t size, uint64_t optionsHash);
+
+   /**
+    * @brief Unmap and close a cache file. Code installed from it stays in the code cache.
+    */
+   static void close(PersistentCodeCache *cache);
+
+   /**
+    * @brief Hash the JIT option string, which is part of the key of each method in the file
+    */
+   static uint64_t hashOptions(const char *options);
+
+   virtual void *lookup(TR::Compilation *comp, const OMR::MethodBuilderIL &il);
+   virtual void store(TR::Compilation *comp, const OMR::MethodBuilderIL &il);
+
+   void getStatistics(PersistentCodeCacheStatistics &statistics);
+
+   private:
+
+   struct Key
+      {
+      uint64_t _ilHash[2];
+      uint64_t _ilSize;
+
+      bool operator<(const Key &other) const;
+      };
+
+   typedef TR::typed_allocator<std::pair<const Key, uint64_t>, TR::RawAllocator> IndexAllocator;
+   typedef std::map<Key, uint64_t, std::less<Key>, IndexAllocator> Index;
+
+   PersistentCodeCache(int fd, uint8_t *base, uint64_t size, uint64_t environment, TR::Monitor *monitor);
+
+   static Key keyOf(const OMR::MethodBuilderIL &il);
+   static bool isRelocatable(TR::Compilation *comp, const OMR::MethodBuilderIL &il);
+   void indexNewRecords();
+   void *install(TR::Compilation *comp, PersistentCodeCacheRecord *record);
+   static bool lockFile(int fd);
+   static void unlockFile(int fd);
+
+   int _fd;
+   uint8_t *_base;           ///< the mapping of the whole file
+   uint64_t _size;
+   uint64_t _indexed;        ///< offset of the first record not in _index
+   uint64_t _environment;    ///< hash of the options, processor and format, which records must match
+   TR::Monitor *_monitor;
+   Index _index;             ///< file offset of the record for each key
+   PersistentCodeCacheStatistics _statistics;
+   };
+
+} // namespace JitBuilder
+
+#endif // !defined(JITBUILDER_PERSISTENTCODECACHE_INCL)
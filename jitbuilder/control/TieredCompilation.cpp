@@ -0,0 +1,162 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <limits.h>
+#include <new>
+#include <string.h>
+#include "AtomicSupport.hpp"
+#include "compile/Compilation.hpp"
+#include "control/CompileQueue.hpp"
+#include "control/TieredCompilation.hpp"
+#include "env/CompilerEnv.hpp"
+#include "omrthread.h"
+
+extern int32_t compileMethodBuilder(TR::MethodBuilder *m, void **entry, int32_t compThreadID);
+
+// recompilations of methods that have shown themselves to be hot go ahead of other requests
+static const int32_t RECOMPILATION_PRIORITY = INT32_MAX;
+
+JitBuilder::TieredMethod::TieredMethod(TR::MethodBuilder *methodBuilder, CompileQueue *queue, int32_t invocationThreshold, int32_t backEdgeThreshold, void **entryPoint)
+   : _next(NULL),
+     _methodBuilder(methodBuilder),
+     _queue(queue),
+     _invocationThreshold(invocationThreshold),
+     _backEdgeThreshold(backEdgeThreshold),
+     _entryPoint(entryPoint),
+     _state(Profiling)
+   {
+   memset(&_profile, 0, sizeof(_profile));
+   _profile._invocationsLeft = invocationThreshold;
+   _profile._backEdgesLeft = backEdgeThreshold;
+   _profile._thresholdHelper = reinterpret_cast<void *>(thresholdReached);
+   _profile._thresholdHelperArg = this;
+   }
+
+JitBuilder::TieredMethod *
+JitBuilder::TieredMethod::create(TR::MethodBuilder *methodBuilder, CompileQueue *queue, int32_t invocationThreshold, int32_t backEdgeThreshold, void **entryPoint)
+   {
+   void *methodMemory = TR::Compiler->rawAllocator.allocate(sizeof(TieredMethod), std::nothrow);
+   if (NULL == methodMemory)
+      return NULL;
+   return new (methodMemory) TieredMethod(methodBuilder, queue, invocationThreshold, backEdgeThreshold, entryPoint);
+   }
+
+void
+JitBuilder::TieredMethod::destroy(TieredMethod *method)
+   {
+   TR::RawAllocator rawAllocator = TR::Compiler->rawAllocator;
+
+   if (NULL != method->_profile._blockCounts)
+      rawAllocator.deallocate(method->_profile._blockCounts);
+   method->~TieredMethod();
+   rawAllocator.deallocate(method);
+   }
+
+int32_t
+JitBuilder::TieredMethod::compileProfiled()
+   {
+   _methodBuilder->setProfile(&_profile, true);
+   return compileMethodBuilder(_methodBuilder, _entryPoint, 0);
+   }
+
+void
+JitBuilder::TieredMethod::stopRecompilation()
+   {
+   while (Profiling != VM_AtomicSupport::lockCompareExchangeU32(&_state, Profiling, RecompilationStopped))
+      {
+      uint32_t state = _state;
+      if ((Recompiled == state) || (RecompilationFailed == state) || (RecompilationStopped == state))
+         break;
+      // a recompilation is in progress, on the compile queue or on the thread that reached the threshold
+      omrthread_yield();
+      }
+   VM_AtomicSupport::readBarrier();
+   }
+
+/**
+ * Called by the profiling code, on the thread running it, when the method has been
+ * invoked or has iterated often enough. The profiling code keeps running after this
+ * returns, so it must not be made to call again: its counters are set out of reach
+ * whether or not this thread is the one that recompiles the method.
+ */
+void
+JitBuilder::TieredMethod::thresholdReached(void *arg)
+   {
+   TieredMethod *method = static_cast<TieredMethod *>(arg);
+
+   method->_profile._invocationsLeft = INT32_MAX;
+   method->_profile._backEdgesLeft = INT32_MAX;
+   if (Profiling == VM_AtomicSupport::lockCompareExchangeU32(&method->_state, Profiling, Recompiling))
+      method->recompile();
+   }
+
+void
+JitBuilder::TieredMethod::recompile()
+   {
+   _methodBuilder->setProfile(&_profile, false);
+
+   if (NULL != _queue)
+      {
+      CompileRequest *request = _queue->submit(_methodBuilder, RECOMPILATION_PRIORITY, false, recompilationComplete, this);
+      if (NULL != request)
+         {
+         _queue->release(request);
+         return;
+         }
+
+      // the queue is full: keep profiling and try again when the thresholds are next reached
+      _methodBuilder->setProfile(NULL, false);
+      _profile._invocationsLeft = _invocationThreshold;
+      _profile._backEdgesLeft = _backEdgeThreshold;
+      VM_AtomicSupport::writeBarrier();
+      _state = Profiling;
+      return;
+      }
+
+   void *entryPoint = NULL;
+   int32_t rc = compileMethodBuilder(_methodBuilder, &entryPoint, 0);
+   install(rc, entryPoint);
+   }
+
+void
+JitBuilder::TieredMethod::recompilationComplete(CompileRequest *request, int32_t rc, void *entryPoint, void *method)
+   {
+   static_cast<TieredMethod *>(method)->install(rc, entryPoint);
+   }
+
+/**
+ * The profiling code stays in place if the method could not be recompiled.
+ */
+void
+JitBuilder::TieredMethod::install(int32_t rc, void *entryPoint)
+   {
+   if ((COMPILATION_SUCCEEDED != rc) || (NULL == entryPoint))
+      {
+      _state = RecompilationFailed;
+      return;
+      }
+
+   // the compiled code must be visible before a caller can find it through the slot
+   VM_AtomicSupport::writeBarrier();
+   *_entryPoint = entryPoint;
+   _state = Recompiled;
+   }
@@ -0,0 +1,119 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#ifndef JITBUILDER_TIEREDCOMPILATION_INCL
+#define JITBUILDER_TIEREDCOMPILATION_INCL
+
+#include <stdint.h>
+#include "ilgen/MethodBuilder.hpp"
+
+namespace JitBuilder
+{
+
+class CompileQueue;
+class CompileRequest;
+
+/**
+ * @brief A MethodBuilder compiled in two tiers
+ *
+ * The method is first compiled at cold with profiling code that counts how often each
+ * block runs, how often the method is invoked and how often its loops iterate. When
+ * either of the last two counts reaches its threshold, the method is recompiled at hot
+ * using the block counts, on the compile queue if there is one or else on the thread that
+ * reached the threshold, and the recompiled code is stored in the entry point slot.
+ *
+ * Callers must call the method through the entry point slot each time, so that they use
+ * the recompiled code once it is installed. Activations of the profiling code that are
+ * already running keep running it. The MethodBuilder, its TypeDictionary and the entry
+ * point slot must stay allocated until the TieredMethod is destroyed, and the profiling
+ * code must not run after that.
+ */
+class TieredMethod
+   {
+   public:
+
+   enum State
+      {
+      Profiling,
+      Recompiling,
+      Recompiled,
+      RecompilationFailed,
+      RecompilationStopped
+      };
+
+   /**
+    * @brief Create a tiered method. Nothing is compiled until compileProfiled is called.
+    * @param methodBuilder The MethodBuilder to compile
+    * @param queue The compile queue to recompile the method on, or NULL to recompile it synchronously
+    * @param invocationThreshold The number of invocations after which the method is recompiled
+    * @param backEdgeThreshold The number of loop iterations after which the method is recompiled
+    * @param entryPoint The slot the entry point of the compiled method is stored in
+    * @return the tiered method, or NULL if it could not be allocated
+    */
+   static TieredMethod *create(TR::MethodBuilder *methodBuilder, CompileQueue *queue, int32_t invocationThreshold, int32_t backEdgeThreshold, void **entryPoint);
+
+   /**
+    * @brief Free a tiered method. Its compiled code must no longer be running, and it must
+    * not be waiting on the compile queue, so the queue must have been destroyed first.
+    */
+   static void destroy(TieredMethod *method);
+
+   /**
+    * @brief Compile the profiling version of the method and store its entry point
+    * @return the compilation return code
+    */
+   int32_t compileProfiled();
+
+   /**
+    * @brief Stop the method from being recompiled. If a recompilation has already started,
+    * wait for it to complete and install its code.
+    */
+   void stopRecompilation();
+
+   State getState() { return (State)_state; }
+
+   bool isCompiledFrom(TR::MethodBuilder *methodBuilder) { return methodBuilder == _methodBuilder; }
+
+   TieredMethod *_next;  ///< for the owner's list of tiered methods
+
+   private:
+
+   TieredMethod(TR::MethodBuilder *methodBuilder, CompileQueue *queue, int32_t invocationThreshold, int32_t backEdgeThreshold, void **entryPoint);
+
+   static void thresholdReached(void *method);
+   static void recompilationComplete(CompileRequest *request, int32_t rc, void *entryPoint, void *method);
+   void recompile();
+   void install(int32_t rc, void *entryPoint);
+
+   TR::MethodBuilder *_methodBuilder;
+   CompileQueue *_queue;
+   int32_t _invocationThreshold;
+   int32_t _backEdgeThreshold;
+   void **_entryPoint;
+   volatile uint32_t _state;
+   OMR::MethodBuilderProfile _profile;
+   };
+
+} // namespace JitBuilder
+
+#endif // !defined(JITBUILDER_TIEREDCOMPILATION_INCL)
@@ -101,6 +101,7 @@ static const OptimizationStrategy JBcoldStrategyOpts[] =
    { OMR::localCSE                                                                 },
    { OMR::basicBlockExtension                                                      },
    { OMR::cheapTacticalGlobalRegisterAllocatorGroup                                },
+   { OMR::endOpts                                                                  },
    };
 
 static const OptimizationStrategy JBwarmStrategyOpts[] =
@@ -144,6 +145,52 @@ static const OptimizationStrategy JBwarmStrategyOpts[] =
    { OMR::endOpts                                                                  },
    };
 
+// used to recompile methods that were profiled by a cold compile: the block frequencies
+// collected in the profile guide block ordering, cold block outlining and global register
+// allocation
+static const OptimizationStrategy JBhotStrategyOpts[] =
+   {
+   { OMR::coldBlockOutlining                                                       },
+   { OMR::deadTreesElimination                                                     },
+   { OMR::inlining                                                                 },
+   { OMR::treeSimplification                                                       },
+   { OMR::localCSE                                                                 },
+   { OMR::basicBlockOrdering                                                       }, // straighten goto's
+   { OMR::globalCopyPropagation                                                    },
+   { OMR::globalDeadStoreElimination,                OMR::IfMoreThanOneBlock       },
+   { OMR::deadTreesElimination                                                     },
+   { OMR::treeSimplification                                                       },
+   { OMR::basicBlockHoisting                                                       },
+   { OMR::treeSimplification                                                       },
+
+   { OMR::globalValuePropagation,                    OMR::IfMoreThanOneBlock       },
+   { OMR::localValuePropagation,                     OMR::IfOneBlock               },
+   { OMR::switchAnalyzer,                                                          },
+   { OMR::localCSE                                                                 },
+   { OMR::treeSimplification                                                       },
+   { OMR::trivialDeadTreeRemoval,                    OMR::IfEnabled                },
+
+   { OMR::basicBlockOrdering,                        OMR::IfLoops                  }, // clean up block order for loop canonicalization, if it will run
+   { OMR::loopCanonicalization,                      OMR::IfLoops                  }, // canonicalization must run before inductionVariableAnalysis else indvar data gets messed up
+   { OMR::inductionVariableAnalysis,                 OMR::IfLoops                  }, // needed for loop unroller
+   { OMR::generalLoopUnroller,                       OMR::IfLoops                  },
+   { OMR::basicBlockExtension,                       OMR::MarkLastRun              }, // clean up order and extend blocks now
+   { OMR::treeSimplification                                                       },
+   { OMR::localCSE                                                                 },
+   { OMR::treeSimplification,                        OMR::IfEnabled                },
+   { OMR::trivialDeadTreeRemoval,                    OMR::IfEnabled                },
+   { OMR::basicBlockOrdering                                                       }, // lay out the hot path using the block frequencies
+   { OMR::tacticalGlobalRegisterAllocatorGroup                                     },
+   { OMR::globalDeadStoreGroup,                                                    },
+   { OMR::redundantGotoElimination,                  OMR::IfEnabled                }, // if global register allocator created new block
+   { OMR::rematerialization                                                        },
+   { OMR::deadTreesElimination,                      OMR::IfEnabled                }, // remove dead anchors created by check/store removal
+   { OMR::deadTreesElimination,                      OMR::IfEnabled                }, // remove dead RegStores produced by previous deadTrees pass
+   { OMR::regDepCopyRemoval                                                        },
+
+   { OMR::endOpts                                                                  },
+   };
+
 
 namespace JitBuilder
 {
@@ -199,10 +246,14 @@ Optimizer::Optimizer(TR::Compilation *comp, TR::ResolvedMethodSymbol *methodSymb
       new (comp->allocator()) TR::OptimizationManager(self(), TR_TrivialInliner::create, OMR::inlining);
    _opts[OMR::switchAnalyzer] =
       new (comp->allocator()) TR::OptimizationManager(self(), TR::SwitchAnalyzer::create, OMR::switchAnalyzer);
+   _opts[OMR::coldBlockOutlining] =
+      new (comp->allocator()) TR::OptimizationManager(self(), TR_ColdBlockOutlining::create, OMR::coldBlockOutlining);
 
    // Initialize optimization groups
    _opts[OMR::cheapTacticalGlobalRegisterAllocatorGroup] =
       new (comp->allocator()) TR::OptimizationManager(self(), NULL, OMR::cheapTacticalGlobalRegisterAllocatorGroup, cheapTacticalGlobalRegisterAllocatorOpts);
+   _opts[OMR::tacticalGlobalRegisterAllocatorGroup] =
+      new (comp->allocator()) TR::OptimizationManager(self(), NULL, OMR::tacticalGlobalRegisterAllocatorGroup, tacticalGlobalRegisterAllocatorOpts);
    _opts[OMR::globalDeadStoreGroup] =
       new (comp->allocator()) TR::OptimizationManager(self(), NULL, OMR::globalDeadStoreGroup, globalDeadStoreOpts);
 
@@ -213,9 +264,9 @@ Optimizer::Optimizer(TR::Compilation *comp, TR::ResolvedMethodSymbol *methodSymb
 
 
    omrCompilationStrategies[noOpt] = JBwarmStrategyOpts;
-   omrCompilationStrategies[cold]  = JBwarmStrategyOpts;
+   omrCompilationStrategies[cold]  = JBcoldStrategyOpts;
    omrCompilationStrategies[warm]  = JBwarmStrategyOpts;
-   omrCompilationStrategies[hot]   = JBwarmStrategyOpts;
+   omrCompilationStrategies[hot]   = JBhotStrategyOpts;
 
    }
 
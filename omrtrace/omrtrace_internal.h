@@ -66,6 +66,14 @@ extern "C" {
 #define UT_TRC_BUFFER_NEW             0x20000000 /* indicates an empty new buffer in use by a thread. cleared when buffer is written to. */
 #define UT_TRC_BUFFER_ACTIVE          0x80000000 /* indicates a buffer in use by a thread */
 
+#define UT_WRITER_STOPPED             0
+#define UT_WRITER_RUNNING             1
+#define UT_WRITER_STOPPING            2
+
+#define UT_PREALLOCATED_BUFFERS       8 /* free buffers allocated when the first subscriber registers */
+#define UT_BUFFER_ALLOCATION_BATCH    4 /* buffers allocated together when the free queue is empty */
+#define UT_FREE_QUEUE_POP_ATTEMPTS    8 /* tries at popping the free queue before allocating instead */
+
 /*
  * =============================================================================
  * Constants for trace point actions.
@@ -226,8 +234,14 @@ struct OMR_TraceGlobal {
 	char                       *serviceInfo;            /* Service information             */
 	char                       *traceFormatSpec;        /* Printf template filespec        */
 	OMR_TraceThread            *lastPrint;              /* OMR_TraceThread for last print     */
-	OMR_TraceBuffer            *freeQueue;              /* Free buffer queue               */
-	omrthread_monitor_t         freeQueueLock;          /* lock for free queue */
+	OMR_TraceBuffer * volatile  freeQueue;              /* Free buffer queue               */
+	volatile uintptr_t          freeQueuePopper;        /* Set while a thread pops the free queue */
+	OMR_TraceBuffer * volatile  fullQueue;              /* Published buffers not yet delivered, newest first */
+	omrthread_t                 writerThread;           /* Delivers published buffers to subscribers */
+	omrthread_monitor_t         writerLock;             /* The writer thread waits on this for buffers */
+	volatile uint32_t           writerState;            /* UT_WRITER_xxx                   */
+	OMR_TraceThread             writerTraceThread;      /* Recursion counting for the writer thread */
+	omrthread_t volatile        deliveringThread;       /* The thread delivering buffers to subscribers */
 	UtTraceCfg                 *config;                 /* Trace selection cmds link/list  */
 	UtTraceFileHdr             *traceHeader;            /* Trace file header               */
 	UtComponentList            *componentList;          /* registered or configured component */
@@ -455,6 +469,25 @@ omr_error_t setFormat(const char *datDir);
  */
 void doTracePoint(OMR_TraceThread *thr, UtModuleInfo *modInfo, uint32_t traceId, const char *spec, va_list varArgs);
 
+/**
+ * @brief Creates a trace point from pre-formatted argument data
+ *
+ * As doTracePoint, but the arguments have already been laid out by a generated
+ * tracepoint writer in the order and sizes the trace record uses, so they are copied
+ * into the trace buffer as a single block. This is the counterpart of
+ * UtModuleInterface.TraceData.
+ *
+ * Tracepoints that are printed need their arguments as a va_list, so the generated
+ * writers never pass them here. If one arrives anyway it is recorded but not printed.
+ *
+ * @param[in] thr The OMR_TraceThread for the currently executing thread. Must not be NULL.
+ * @param[in] modInfo A pointer to the UtModuleInfo for the module this trace point belongs to.
+ * @param[in] traceId The trace point id for this trace point.
+ * @param[in] data    The argument data for this trace point. May be NULL if length is 0.
+ * @param[in] length  The number of bytes of argument data.
+ */
+void doTracePointData(OMR_TraceThread *thr, UtModuleInfo *modInfo, uint32_t traceId, const void *data, uint32_t length);
+
 void enlistRecordSubscriber(UtSubscription *subscription);
 void delistRecordSubscriber(UtSubscription *subscription);
 void deleteRecordSubscriber(OMR_TraceGlobal *global, UtSubscription *subscription);
@@ -506,6 +539,7 @@ omr_error_t trcDeregisterRecordSubscriber(OMR_TraceThread *thr, UtSubscription *
  *  All functions on the module interface (and only functions on the module interface) start
  *  with j9 **/
 void omrTrace(void *env, UtModuleInfo *modInfo, uint32_t traceId, const char *spec, ...);
+void omrTraceData(void *env, UtModuleInfo *modInfo, uint32_t traceId, const void *data, uint32_t length);
 
 /**
  * @brief Publish a trace buffer.
@@ -535,6 +569,41 @@ omr_error_t releaseTraceBuffer(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf
  */
 OMR_TraceBuffer *recycleTraceBuffer(OMR_TraceThread *currentThr);
 
+/**
+ * @brief Allocate trace buffers from the buffer pool.
+ *
+ * @param[in] currentThread The current thread, may be NULL.
+ * @param[in] count The number of buffers wanted.
+ * @return a list of up to count buffers linked through next, or NULL if none could be allocated
+ */
+OMR_TraceBuffer *allocateTraceBuffers(OMR_TraceThread *currentThread, uint32_t count);
+
+/**
+ * @brief Deliver every buffer published so far to the subscribers.
+ *
+ * Does nothing if called from a subscriber while buffers are being delivered.
+ *
+ * @param[in] currentThr The current thread.
+ */
+void flushTraceBuffers(OMR_TraceThread *currentThr);
+
+/**
+ * @brief Start the thread which delivers published buffers to the subscribers.
+ *
+ * Until it is started, or if it cannot be, buffers are delivered by the threads that publish them.
+ *
+ * @param[in] thr The current thread.
+ * @return an OMR error code
+ */
+omr_error_t startTraceWriterThread(OMR_TraceThread *thr);
+
+/**
+ * @brief Stop the trace writer thread, if it is running, and wait for it to exit.
+ *
+ * Buffers it has not delivered stay on the full queue.
+ */
+void stopTraceWriterThread(void);
+
 /*
  * =============================================================================
  * Externs
@@ -199,6 +199,10 @@ omr_trc_preForkHandler(void)
 		UT_DBGOUT(1, ("<UT> omr_trc_preForkHandler: requesting global buffer pool lock.\n"));
 		omrthread_monitor_enter(OMR_TRACEGLOBAL(bufferPoolLock));
 		UT_DBGOUT(1, ("<UT> omr_trc_preForkHandler: obtained global buffer pool lock.\n"));
+
+		UT_DBGOUT(1, ("<UT> omr_trc_preForkHandler: requesting global trace writer lock.\n"));
+		omrthread_monitor_enter(OMR_TRACEGLOBAL(writerLock));
+		UT_DBGOUT(1, ("<UT> omr_trc_preForkHandler: obtained global trace writer lock.\n"));
 	}
 }
 
@@ -206,6 +210,9 @@ void
 omr_trc_postForkParentHandler(void)
 {
 	if ((NULL != omrTraceGlobal) && (OMR_TRACE_ENGINE_MT_ENABLED == OMR_TRACEGLOBAL(initState))) {
+		omrthread_monitor_exit(OMR_TRACEGLOBAL(writerLock));
+		UT_DBGOUT(1, ("<UT> omr_trc_postForkParentHandler: released global trace writer lock.\n"));
+
 		omrthread_monitor_exit(OMR_TRACEGLOBAL(bufferPoolLock));
 		UT_DBGOUT(1, ("<UT> omr_trc_postForkParentHandler: released global buffer pool lock.\n"));
 
@@ -232,6 +239,9 @@ void
 omr_trc_postForkChildHandler(void)
 {
 	if ((NULL != omrTraceGlobal) && (OMR_TRACE_ENGINE_MT_ENABLED == OMR_TRACEGLOBAL(initState))) {
+		omrthread_monitor_exit(OMR_TRACEGLOBAL(writerLock));
+		UT_DBGOUT(1, ("<UT> omr_trc_postForkParentHandler: released global trace writer lock.\n"));
+
 		omrthread_monitor_exit(OMR_TRACEGLOBAL(bufferPoolLock));
 		UT_DBGOUT(1, ("<UT> omr_trc_postForkParentHandler: released global buffer pool lock.\n"));
 
@@ -269,13 +279,22 @@ postForkCleanupGlobals(OMR_TraceThread *thr)
 	}
 	OMR_TRACEGLOBAL(lastPrint) = NULL;
 	OMR_TRACEGLOBAL(lostRecords) = 0;
+
+	/* The writer thread does not exist in the child. Buffers are delivered
+	 * synchronously until a subscriber registration restarts it.
+	 */
+	OMR_TRACEGLOBAL(writerState) = UT_WRITER_STOPPED;
+	OMR_TRACEGLOBAL(writerThread) = NULL;
+	OMR_TRACEGLOBAL(deliveringThread) = NULL;
 }
 
 void
 postForkCleanupBuffers(OMR_TraceThread *thr)
 {
-	/* Clear all buffers in the pool and in freeQueue. */
+	/* Clear all buffers in the pool, freeQueue and fullQueue. */
 	OMR_TRACEGLOBAL(freeQueue) = NULL;
+	OMR_TRACEGLOBAL(freeQueuePopper) = 0;
+	OMR_TRACEGLOBAL(fullQueue) = NULL;
 	if (NULL != thr) {
 		thr->trcBuf = NULL;
 	}
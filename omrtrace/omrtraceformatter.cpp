@@ -23,9 +23,11 @@
 #include <string.h>
 #include <stdio.h>
 #include <stddef.h>
+#include <stdlib.h>
 
 #include "omrtraceformat.h"
 #include "omrtrace_internal.h"
+#include "omrutil.h"
 
 #define ONEMILLION (1000000)
 
@@ -53,6 +55,9 @@ struct UtTracePointIterator {
 	uint32_t numberOfBytesInPlatformShort;
 	OMRPortLibrary *portLib;
 	FormatStringCallback getFormatStringFn;
+	const UtTraceFormatFilter *filter;
+	int32_t tracePointFiltered;
+	uint64_t timeStamp;
 };
 
 struct UtTraceFileIterator {
@@ -171,6 +176,58 @@ omr_trc_freeTraceFileIterator(UtTraceFileIterator *iter)
 	return OMR_ERROR_NONE;
 }
 
+/**
+ * Prepare iterator to format the trace buffer it points to. endPlatform and endSystem
+ * are a pair of time stamps used to convert trace point time stamps to wall clock time.
+ */
+static void
+initTracePointIterator(UtTracePointIterator *iterator, uint32_t bufferSize, UtTraceSection *traceSection,
+		uint64_t endPlatform, uint64_t endSystem, OMRPortLibrary *portLib, FormatStringCallback getFormatStringFn)
+{
+	uint64_t spanPlatform, spanSystem;
+
+	iterator->recordLength = bufferSize;
+	iterator->end = iterator->buffer->record.nextEntry;
+	iterator->start = iterator->buffer->record.firstEntry;
+	iterator->dataLength = iterator->buffer->record.nextEntry - iterator->buffer->record.firstEntry;
+	iterator->currentUpperTimeWord = (uint64_t)(iterator->buffer->record.sequence) & J9CONST64(0xFFFFFFFF00000000);
+	iterator->currentPos = iterator->buffer->record.nextEntry;
+	iterator->startPlatform = traceSection->startPlatform;
+	iterator->startSystem = traceSection->startSystem;
+	iterator->endPlatform = endPlatform; /* TODO - Is there a better timestamp we can use here? */
+	iterator->endSystem = endSystem; /* TODO - Is there a better timestamp we can use here? */
+	iterator->portLib = portLib;
+	iterator->getFormatStringFn = getFormatStringFn;
+
+	spanPlatform = iterator->endPlatform - iterator->startPlatform;
+	spanSystem = iterator->endSystem - iterator->startSystem;
+
+	iterator->timeConversion = spanPlatform / spanSystem;
+	if (iterator->timeConversion == 0) {
+		/* this will be used as the divisor in formatting time stamps */
+		iterator->timeConversion = 1;
+	}
+
+#ifdef OMR_ENV_LITTLE_ENDIAN
+	iterator->isBigEndian = FALSE;
+#else
+	iterator->isBigEndian = TRUE;
+#endif
+	iterator->isCircularBuffer = TRUE;
+	iterator->iteratorHasWrapped = FALSE;
+	iterator->tempBuffForWrappedTP = NULL;
+	iterator->processingIncompleteDueToPartialTracePoint = FALSE;
+	iterator->longTracePointLength = 0;
+
+	iterator->numberOfBytesInPlatformUDATA = (uint32_t)sizeof(uintptr_t);
+	iterator->numberOfBytesInPlatformPtr = (uint32_t)sizeof(char *);
+	iterator->numberOfBytesInPlatformShort = (uint32_t)sizeof(short);
+
+	iterator->filter = NULL;
+	iterator->tracePointFiltered = FALSE;
+	iterator->timeStamp = iterator->buffer->record.sequence;
+}
+
 /**
  * This returns a structure for iterating over a trace buffer for
  * use with omr_trc_formatNextTracePoint.
@@ -184,7 +241,6 @@ omr_trc_getTracePointIteratorForNextBuffer(UtTraceFileIterator *fileIterator, Ut
 {
 	UtTracePointIterator *iterator = NULL;
 	intptr_t bytesRead = -1;
-	uint64_t spanPlatform, spanSystem;
 
 	OMRPORT_ACCESS_FROM_OMRPORT(fileIterator->portLib);
 
@@ -219,41 +275,8 @@ omr_trc_getTracePointIteratorForNextBuffer(UtTraceFileIterator *fileIterator, Ut
 		}
 	}
 
-	iterator->recordLength = fileIterator->header->bufferSize;
-	iterator->end = iterator->buffer->record.nextEntry;
-	iterator->start = iterator->buffer->record.firstEntry;
-	iterator->dataLength = iterator->buffer->record.nextEntry - iterator->buffer->record.firstEntry;
-	iterator->currentUpperTimeWord = (uint64_t)(iterator->buffer->record.sequence) & J9CONST64(0xFFFFFFFF00000000);
-	iterator->currentPos = iterator->buffer->record.nextEntry;
-	iterator->startPlatform = fileIterator->traceSection->startPlatform;
-	iterator->startSystem = fileIterator->traceSection->startSystem;
-	iterator->endPlatform = omrtime_hires_clock(); /* TODO - Is there a better timestamp we can use here? */
-	iterator->endSystem = ((uint64_t) omrtime_current_time_millis()); /* TODO - Is there a better timestamp we can use here? */
-	iterator->portLib = fileIterator->portLib;
-	iterator->getFormatStringFn = fileIterator->getFormatStringFn;
-
-	spanPlatform = iterator->endPlatform - iterator->startPlatform;
-	spanSystem = iterator->endSystem - iterator->startSystem;
-
-	iterator->timeConversion = spanPlatform / spanSystem;
-	if (iterator->timeConversion == 0) {
-		/* this will be used as the divisor in formatting time stamps */
-		iterator->timeConversion = 1;
-	}
-
-#ifdef OMR_ENV_LITTLE_ENDIAN
-	iterator->isBigEndian = FALSE;
-#else
-	iterator->isBigEndian = TRUE;
-#endif
-	iterator->isCircularBuffer = TRUE;
-	iterator->iteratorHasWrapped = FALSE;
-	iterator->processingIncompleteDueToPartialTracePoint = FALSE;
-	iterator->longTracePointLength = 0;
-
-	iterator->numberOfBytesInPlatformUDATA = (uint32_t)sizeof(uintptr_t);
-	iterator->numberOfBytesInPlatformPtr = (uint32_t)sizeof(char *);
-	iterator->numberOfBytesInPlatformShort = (uint32_t)sizeof(short);
+	initTracePointIterator(iterator, fileIterator->header->bufferSize, fileIterator->traceSection,
+			omrtime_hires_clock(), (uint64_t)omrtime_current_time_millis(), fileIterator->portLib, fileIterator->getFormatStringFn);
 
 	UT_DBGOUT_CHECKED(4,
 			("<UT> firstEntry: %d, offset of record: %ld buffer size: %d endianness %s\n", iterator->start, offsetof(OMR_TraceBuffer, record), fileIterator->header->bufferSize, (iterator->isBigEndian)?"bigEndian":"littleEndian"));
@@ -702,6 +725,28 @@ formatTracePointParameters(UtTracePointIterator *iter, char *destBuffer, uint32_
 #undef UT_TRACE_FORMATTER_8BIT_DATA
 #undef UT_TRACE_FORMATTER_STRING_DATA
 
+static BOOLEAN
+tracePointMatchesFilter(const UtTraceFormatFilter *filter, const char *modName, uint32_t modNameLength, uint32_t traceId,
+						uint64_t timeStamp)
+{
+	if (NULL != filter->componentName) {
+		/* the component of a composite name, e.g. pool(j9mm), is the part before the opening brace */
+		const char *brace = (const char *)memchr(modName, '(', modNameLength);
+		size_t componentLength = (NULL == brace) ? modNameLength : (size_t)(brace - modName);
+
+		if ((strlen(filter->componentName) != componentLength) || (0 != strncmp(filter->componentName, modName, componentLength))) {
+			return FALSE;
+		}
+	}
+	if ((filter->tracePointId >= 0) && ((uint32_t)filter->tracePointId != traceId)) {
+		return FALSE;
+	}
+	if ((timeStamp < filter->startTime) || ((0 != filter->endTime) && (timeStamp > filter->endTime))) {
+		return FALSE;
+	}
+	return TRUE;
+}
+
 static const char *
 parseTracePoint(OMRPortLibrary *portLib, UtTraceRecord *record, uint32_t offset, int tpLength,
 				uint64_t *timeStampMostSignificantBytes, UtTracePointIterator *iter, char *buffer, uint32_t bufferLength)
@@ -740,6 +785,12 @@ parseTracePoint(OMRPortLibrary *portLib, UtTraceRecord *record, uint32_t offset,
 	/* check for all the control/internal tracepoints */
 	/* 0x0010nnnn8 == lost record tracepoint */
 	if (traceId == 0x0010) {
+		if ((NULL != iter->filter) && ((NULL != iter->filter->componentName) || (iter->filter->tracePointId >= 0))) {
+			/* lost records don't belong to any component */
+			iter->tracePointFiltered = TRUE;
+			buffer[0] = '\0';
+			return buffer;
+		}
 		/* 	too much danger of looping to recurse here - return a warning string and let
 		 omr_trc_formatNextTracePoint(thr, iter) make the call on whether it can extract
 		 any further data */
@@ -823,6 +874,14 @@ parseTracePoint(OMRPortLibrary *portLib, UtTraceRecord *record, uint32_t offset,
 	tempLower = (uint64_t)timeStampLeastSignificantBytes;
 	tempUpper = (uint64_t)*timeStampMostSignificantBytes;
 	timeStamp = tempUpper | tempLower;
+	iter->timeStamp = timeStamp;
+
+	if ((NULL != iter->filter) && !tracePointMatchesFilter(iter->filter, modNameString, modNameLength, traceId, timeStamp)) {
+		/* let the caller move on to the next trace point without formatting this one */
+		iter->tracePointFiltered = TRUE;
+		buffer[0] = '\0';
+		return buffer;
+	}
 
 	/* this formula is taken directly from the trace formatter to maintain agreement between representations
 	 *	made by this function and those made by the TraceFormat tool. */
@@ -983,3 +1042,613 @@ omr_trc_formatNextTracePoint(UtTracePointIterator *iter, char *buffer, uint32_t
 						   buffer, bufferLength);
 }
 
+/*
+ * =============================================================================
+ *   Parallel formatting of whole trace files.
+ *
+ *   Each buffer in a trace file holds trace points from a single thread, in
+ *   time stamp order, and the buffers of a thread never overlap in time. The
+ *   file is indexed so that every buffer knows the range of time stamps it can
+ *   hold: from the last time stamp of its thread's previous buffer to its own
+ *   last time stamp (record.sequence). Buffers are formatted in order of their
+ *   last time stamp by a pool of threads, and each formatted buffer becomes a
+ *   sorted run. The calling thread merges the runs and passes every trace point
+ *   older than the earliest time stamp any unformatted buffer can hold to the
+ *   callback, so the output is in time stamp order and the formatted text that
+ *   is held in memory is bounded by the number of buffers in flight.
+ * =============================================================================
+ */
+
+/* Room for the time stamp and module name prefix, and parameters that expand as they are formatted */
+#define UT_FORMATTED_TRACEPOINT_LENGTH (4 * (UT_MAX_EXTENDED_LENGTH + 1))
+/* Buffers released to each formatting thread at a time */
+#define UT_FORMAT_BUFFERS_PER_THREAD 4
+
+typedef struct UtTraceBufferIndexEntry {
+	UtTraceRecord *record;
+	uint64_t threadId;
+	uint64_t firstTimeStamp;
+	uint64_t lastTimeStamp;
+	uint32_t fileIndex;
+} UtTraceBufferIndexEntry;
+
+typedef struct UtFormattedBuffer {
+	uint64_t *timeStamps;
+	uintptr_t *textOffsets;
+	char *text;
+	uintptr_t textLength;
+	uintptr_t textCapacity;
+	uint32_t count;
+	uint32_t capacity;
+	/* Trace points are formatted newest first, so they are merged from the end */
+	uint32_t remaining;
+	omr_error_t rc;
+	BOOLEAN formatted;
+} UtFormattedBuffer;
+
+typedef struct UtTraceFileFormatter {
+	OMRPortLibrary *portLib;
+	FormatStringCallback getFormatStringFn;
+	const UtTraceFormatFilter *filter;
+	UtTraceSection *traceSection;
+	uint32_t bufferSize;
+	uint64_t endPlatform;
+	uint64_t endSystem;
+	UtTraceBufferIndexEntry *buffers;
+	UtFormattedBuffer *results;
+	uint32_t bufferCount;
+	omrthread_monitor_t lock;
+	uint32_t nextBuffer;
+	uint32_t releasedBuffers;
+	uint32_t activeThreads;
+	BOOLEAN shutdown;
+} UtTraceFileFormatter;
+
+static int
+compareBuffersByThread(const void *left, const void *right)
+{
+	const UtTraceBufferIndexEntry *l = (const UtTraceBufferIndexEntry *)left;
+	const UtTraceBufferIndexEntry *r = (const UtTraceBufferIndexEntry *)right;
+
+	if (l->threadId != r->threadId) {
+		return (l->threadId < r->threadId) ? -1 : 1;
+	}
+	if (l->lastTimeStamp != r->lastTimeStamp) {
+		return (l->lastTimeStamp < r->lastTimeStamp) ? -1 : 1;
+	}
+	return (l->fileIndex < r->fileIndex) ? -1 : ((l->fileIndex > r->fileIndex) ? 1 : 0);
+}
+
+static int
+compareBuffersByTime(const void *left, const void *right)
+{
+	const UtTraceBufferIndexEntry *l = (const UtTraceBufferIndexEntry *)left;
+	const UtTraceBufferIndexEntry *r = (const UtTraceBufferIndexEntry *)right;
+
+	if (l->lastTimeStamp != r->lastTimeStamp) {
+		return (l->lastTimeStamp < r->lastTimeStamp) ? -1 : 1;
+	}
+	return (l->fileIndex < r->fileIndex) ? -1 : ((l->fileIndex > r->fileIndex) ? 1 : 0);
+}
+
+/**
+ * Build the index of the buffers in the file that may hold trace points inside the filter's
+ * time window, sorted in the order they will be formatted.
+ */
+static omr_error_t
+indexTraceBuffers(UtTraceFileFormatter *formatter, char *data, uint64_t fileLength, uint32_t headerLength)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(formatter->portLib);
+	const UtTraceFormatFilter *filter = formatter->filter;
+	uint64_t fileBuffers = (fileLength - headerLength) / formatter->bufferSize;
+	UtTraceBufferIndexEntry *buffers = NULL;
+	uint32_t count = 0;
+	uint32_t kept = 0;
+	uint32_t i = 0;
+
+	if (fileBuffers > (uint64_t)(UINT32_MAX / sizeof(UtTraceBufferIndexEntry))) {
+		return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+	}
+	if (0 != ((fileLength - headerLength) % formatter->bufferSize)) {
+		UT_DBGOUT_CHECKED(1, ("<UT> omr_trc_formatTraceFile ignoring partial buffer at the end of the file\n"));
+	}
+
+	buffers = (UtTraceBufferIndexEntry *)omrmem_allocate_memory(
+			(uintptr_t)(fileBuffers + 1) * sizeof(UtTraceBufferIndexEntry), OMRMEM_CATEGORY_TRACE);
+	if (NULL == buffers) {
+		return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+	}
+
+	for (i = 0; i < (uint32_t)fileBuffers; i++) {
+		UtTraceRecord *record = (UtTraceRecord *)(data + headerLength + ((uintptr_t)i * formatter->bufferSize));
+
+		/* skip empty buffers, and those the iterator could not walk safely */
+		if ((record->firstEntry < (int32_t)offsetof(UtTraceRecord, threadName))
+			|| (record->nextEntry <= record->firstEntry)
+			|| ((uint32_t)record->nextEntry > formatter->bufferSize)
+		) {
+			continue;
+		}
+		buffers[count].record = record;
+		buffers[count].threadId = record->threadId;
+		buffers[count].firstTimeStamp = 0;
+		buffers[count].lastTimeStamp = record->sequence;
+		buffers[count].fileIndex = i;
+		count += 1;
+	}
+
+	/* a buffer's trace points are no older than the last one in its thread's previous buffer */
+	qsort(buffers, count, sizeof(UtTraceBufferIndexEntry), compareBuffersByThread);
+	for (i = 1; i < count; i++) {
+		if (buffers[i].threadId == buffers[i - 1].threadId) {
+			buffers[i].firstTimeStamp = buffers[i - 1].lastTimeStamp;
+		}
+	}
+
+	for (i = 0; i < count; i++) {
+		if ((NULL != filter)
+			&& ((buffers[i].lastTimeStamp < filter->startTime)
+				|| ((0 != filter->endTime) && (buffers[i].firstTimeStamp > filter->endTime)))
+		) {
+			continue;
+		}
+		buffers[kept] = buffers[i];
+		kept += 1;
+	}
+	qsort(buffers, kept, sizeof(UtTraceBufferIndexEntry), compareBuffersByTime);
+
+	UT_DBGOUT_CHECKED(2, ("<UT> omr_trc_formatTraceFile formatting %u of %llu buffers\n", kept, fileBuffers));
+
+	formatter->buffers = buffers;
+	formatter->bufferCount = kept;
+	return OMR_ERROR_NONE;
+}
+
+static omr_error_t
+appendFormattedTracePoint(OMRPortLibrary *portLib, UtFormattedBuffer *result, uint64_t timeStamp, const char *tracePoint)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	uintptr_t length = strlen(tracePoint) + 1;
+
+	if (result->count == result->capacity) {
+		uint32_t capacity = (0 == result->capacity) ? 64 : (2 * result->capacity);
+		uint64_t *timeStamps = (uint64_t *)omrmem_reallocate_memory(result->timeStamps, capacity * sizeof(uint64_t), OMRMEM_CATEGORY_TRACE);
+		uintptr_t *textOffsets = NULL;
+
+		if (NULL == timeStamps) {
+			return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+		}
+		result->timeStamps = timeStamps;
+		textOffsets = (uintptr_t *)omrmem_reallocate_memory(result->textOffsets, capacity * sizeof(uintptr_t), OMRMEM_CATEGORY_TRACE);
+		if (NULL == textOffsets) {
+			return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+		}
+		result->textOffsets = textOffsets;
+		result->capacity = capacity;
+	}
+	if ((result->textCapacity - result->textLength) < length) {
+		uintptr_t capacity = OMR_MAX(2 * result->textCapacity, result->textLength + length);
+		char *text = (char *)omrmem_reallocate_memory(result->text, capacity, OMRMEM_CATEGORY_TRACE);
+
+		if (NULL == text) {
+			return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+		}
+		result->text = text;
+		result->textCapacity = capacity;
+	}
+
+	memcpy(result->text + result->textLength, tracePoint, length);
+	result->timeStamps[result->count] = timeStamp;
+	result->textOffsets[result->count] = result->textLength;
+	result->textLength += length;
+	result->count += 1;
+	return OMR_ERROR_NONE;
+}
+
+static void
+freeFormattedBuffer(OMRPortLibrary *portLib, UtFormattedBuffer *result)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+
+	omrmem_free_memory(result->timeStamps);
+	omrmem_free_memory(result->textOffsets);
+	omrmem_free_memory(result->text);
+	result->timeStamps = NULL;
+	result->textOffsets = NULL;
+	result->text = NULL;
+}
+
+/**
+ * Format the buffer at position index in the index into its result. The mapped buffer is
+ * copied into scratch first because the iterator modifies the data it formats.
+ */
+static omr_error_t
+formatIndexedBuffer(UtTraceFileFormatter *formatter, OMR_TraceBuffer *scratch, char *line, uint32_t index)
+{
+	UtFormattedBuffer *result = &formatter->results[index];
+	UtTracePointIterator iterator;
+	const char *tracePoint = NULL;
+	omr_error_t rc = OMR_ERROR_NONE;
+
+	if ((NULL == scratch) || (NULL == line)) {
+		return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+	}
+
+	memcpy(&scratch->record, formatter->buffers[index].record, formatter->bufferSize);
+	iterator.buffer = scratch;
+	initTracePointIterator(&iterator, formatter->bufferSize, formatter->traceSection, formatter->endPlatform,
+			formatter->endSystem, formatter->portLib, formatter->getFormatStringFn);
+	iterator.filter = formatter->filter;
+
+	while ((OMR_ERROR_NONE == rc)
+		&& (NULL != (tracePoint = omr_trc_formatNextTracePoint(&iterator, line, UT_FORMATTED_TRACEPOINT_LENGTH)))
+	) {
+		if (iterator.tracePointFiltered) {
+			iterator.tracePointFiltered = FALSE;
+		} else {
+			rc = appendFormattedTracePoint(formatter->portLib, result, iterator.timeStamp, tracePoint);
+		}
+	}
+	result->remaining = result->count;
+	return rc;
+}
+
+static int J9THREAD_PROC
+formatterThreadMain(void *entryArg)
+{
+	UtTraceFileFormatter *formatter = (UtTraceFileFormatter *)entryArg;
+	omrthread_monitor_t const lock = formatter->lock;
+	OMRPORT_ACCESS_FROM_OMRPORT(formatter->portLib);
+	OMR_TraceBuffer *scratch = (OMR_TraceBuffer *)omrmem_allocate_memory(
+			formatter->bufferSize + offsetof(OMR_TraceBuffer, record), OMRMEM_CATEGORY_TRACE);
+	char *line = (char *)omrmem_allocate_memory(UT_FORMATTED_TRACEPOINT_LENGTH, OMRMEM_CATEGORY_TRACE);
+
+	omrthread_monitor_enter(lock);
+	while (!formatter->shutdown) {
+		if (formatter->nextBuffer < formatter->releasedBuffers) {
+			uint32_t index = formatter->nextBuffer;
+			omr_error_t rc = OMR_ERROR_NONE;
+
+			formatter->nextBuffer += 1;
+			omrthread_monitor_exit(lock);
+			rc = formatIndexedBuffer(formatter, scratch, line, index);
+			omrthread_monitor_enter(lock);
+			formatter->results[index].rc = rc;
+			formatter->results[index].formatted = TRUE;
+			omrthread_monitor_notify_all(lock);
+		} else {
+			omrthread_monitor_wait(lock);
+		}
+	}
+	omrmem_free_memory(scratch);
+	omrmem_free_memory(line);
+	formatter->activeThreads -= 1;
+	omrthread_monitor_notify_all(lock);
+	omrthread_exit(lock);
+
+	/* unreachable */
+	return 0;
+}
+
+/**
+ * Make buffers up to, but not including, position limit in the index available for formatting.
+ * Without formatting threads they are formatted on the calling thread.
+ */
+static void
+releaseIndexedBuffers(UtTraceFileFormatter *formatter, OMR_TraceBuffer *scratch, char *line, uint32_t limit)
+{
+	if (0 == formatter->activeThreads) {
+		while (formatter->nextBuffer < limit) {
+			uint32_t index = formatter->nextBuffer;
+
+			formatter->nextBuffer += 1;
+			formatter->results[index].rc = formatIndexedBuffer(formatter, scratch, line, index);
+			formatter->results[index].formatted = TRUE;
+		}
+		formatter->releasedBuffers = limit;
+	} else {
+		omrthread_monitor_enter(formatter->lock);
+		formatter->releasedBuffers = limit;
+		omrthread_monitor_notify_all(formatter->lock);
+		omrthread_monitor_exit(formatter->lock);
+	}
+}
+
+static void
+waitForIndexedBuffer(UtTraceFileFormatter *formatter, uint32_t index)
+{
+	if (0 != formatter->activeThreads) {
+		omrthread_monitor_enter(formatter->lock);
+		while (!formatter->results[index].formatted) {
+			omrthread_monitor_wait(formatter->lock);
+		}
+		omrthread_monitor_exit(formatter->lock);
+	}
+}
+
+/* The runs being merged form a binary heap ordered by the time stamp of their next trace point */
+static BOOLEAN
+runPrecedes(UtTraceFileFormatter *formatter, uint32_t left, uint32_t right)
+{
+	UtFormattedBuffer *l = &formatter->results[left];
+	UtFormattedBuffer *r = &formatter->results[right];
+	uint64_t leftTime = l->timeStamps[l->remaining - 1];
+	uint64_t rightTime = r->timeStamps[r->remaining - 1];
+
+	if (leftTime != rightTime) {
+		return leftTime < rightTime;
+	}
+	return left < right;
+}
+
+static void
+siftRunDown(UtTraceFileFormatter *formatter, uint32_t *heap, uint32_t heapSize, uint32_t position)
+{
+	for (;;) {
+		uint32_t smallest = position;
+		uint32_t child = (2 * position) + 1;
+
+		if ((child < heapSize) && runPrecedes(formatter, heap[child], heap[smallest])) {
+			smallest = child;
+		}
+		if (((child + 1) < heapSize) && runPrecedes(formatter, heap[child + 1], heap[smallest])) {
+			smallest = child + 1;
+		}
+		if (smallest == position) {
+			break;
+		}
+		uint32_t swap = heap[position];
+		heap[position] = heap[smallest];
+		heap[smallest] = swap;
+		position = smallest;
+	}
+}
+
+static void
+pushRun(UtTraceFileFormatter *formatter, uint32_t *heap, uint32_t *heapSize, uint32_t run)
+{
+	uint32_t position = *heapSize;
+
+	heap[position] = run;
+	*heapSize += 1;
+	while (0 != position) {
+		uint32_t parent = (position - 1) / 2;
+
+		if (!runPrecedes(formatter, heap[position], heap[parent])) {
+			break;
+		}
+		heap[position] = heap[parent];
+		heap[parent] = run;
+		position = parent;
+	}
+}
+
+/**
+ * Pass the merged trace points with time stamps before limit to the callback.
+ */
+static omr_error_t
+emitMergedTracePoints(UtTraceFileFormatter *formatter, uint32_t *heap, uint32_t *heapSize, uint64_t limit,
+		FormattedTracePointCallback callback, void *userData)
+{
+	omr_error_t rc = OMR_ERROR_NONE;
+
+	while ((OMR_ERROR_NONE == rc) && (0 != *heapSize)) {
+		uint32_t run = heap[0];
+		UtFormattedBuffer *result = &formatter->results[run];
+		uint32_t next = result->remaining - 1;
+
+		if (result->timeStamps[next] >= limit) {
+			break;
+		}
+		rc = callback(userData, formatter->buffers[run].threadId, result->timeStamps[next], result->text + result->textOffsets[next]);
+		result->remaining = next;
+		if (0 == next) {
+			freeFormattedBuffer(formatter->portLib, result);
+			*heapSize -= 1;
+			heap[0] = heap[*heapSize];
+		}
+		siftRunDown(formatter, heap, *heapSize, 0);
+	}
+	return rc;
+}
+
+static omr_error_t
+formatIndexedTraceFile(UtTraceFileFormatter *formatter, uint32_t formatThreads, FormattedTracePointCallback callback, void *userData)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(formatter->portLib);
+	const uint32_t bufferCount = formatter->bufferCount;
+	uint32_t batchSize = OMR_MAX(formatThreads, 1) * UT_FORMAT_BUFFERS_PER_THREAD;
+	OMR_TraceBuffer *scratch = NULL;
+	char *line = NULL;
+	uint64_t *mergeLimits = NULL;
+	uint32_t *heap = NULL;
+	uint32_t heapSize = 0;
+	uint32_t merged = 0;
+	uint32_t i = 0;
+	omr_error_t rc = OMR_ERROR_NONE;
+
+	formatter->results = (UtFormattedBuffer *)omrmem_allocate_memory((bufferCount + 1) * sizeof(UtFormattedBuffer), OMRMEM_CATEGORY_TRACE);
+	mergeLimits = (uint64_t *)omrmem_allocate_memory((bufferCount + 1) * sizeof(uint64_t), OMRMEM_CATEGORY_TRACE);
+	heap = (uint32_t *)omrmem_allocate_memory((bufferCount + 1) * sizeof(uint32_t), OMRMEM_CATEGORY_TRACE);
+	if ((NULL == formatter->results) || (NULL == mergeLimits) || (NULL == heap)) {
+		rc = OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+		goto done;
+	}
+	memset(formatter->results, 0, (bufferCount + 1) * sizeof(UtFormattedBuffer));
+
+	/* trace points older than mergeLimits[n] can't be in buffers from position n onwards */
+	mergeLimits[bufferCount] = UINT64_MAX;
+	for (i = bufferCount; i > 0; i--) {
+		mergeLimits[i - 1] = OMR_MIN(mergeLimits[i], formatter->buffers[i - 1].firstTimeStamp);
+	}
+
+	if (formatThreads > 1) {
+		if (0 != omrthread_monitor_init_with_name(&formatter->lock, 0, "Trace Formatter")) {
+			rc = OMR_ERROR_FAILED_TO_ALLOCATE_MONITOR;
+			goto done;
+		}
+		for (i = 0; i < formatThreads; i++) {
+			omrthread_t thread = NULL;
+
+			omrthread_monitor_enter(formatter->lock);
+			formatter->activeThreads += 1;
+			omrthread_monitor_exit(formatter->lock);
+			if (0 != createThreadWithCategory(&thread, 0, J9THREAD_PRIORITY_NORMAL, 0, formatterThreadMain, formatter,
+				J9THREAD_CATEGORY_SYSTEM_THREAD)
+			) {
+				/* carry on with the threads that did start */
+				UT_DBGOUT_CHECKED(1, ("<UT> omr_trc_formatTraceFile unable to start formatting thread %u\n", i));
+				omrthread_monitor_enter(formatter->lock);
+				formatter->activeThreads -= 1;
+				omrthread_monitor_exit(formatter->lock);
+				break;
+			}
+		}
+	}
+	if (0 == formatter->activeThreads) {
+		scratch = (OMR_TraceBuffer *)omrmem_allocate_memory(formatter->bufferSize + offsetof(OMR_TraceBuffer, record), OMRMEM_CATEGORY_TRACE);
+		line = (char *)omrmem_allocate_memory(UT_FORMATTED_TRACEPOINT_LENGTH, OMRMEM_CATEGORY_TRACE);
+	}
+
+	/* keep the next batch of buffers formatting while the current one is merged */
+	releaseIndexedBuffers(formatter, scratch, line, OMR_MIN(batchSize, bufferCount));
+	while ((OMR_ERROR_NONE == rc) && (merged < bufferCount)) {
+		uint32_t batchEnd = OMR_MIN(merged + batchSize, bufferCount);
+
+		releaseIndexedBuffers(formatter, scratch, line, OMR_MIN(batchEnd + batchSize, bufferCount));
+		for (; merged < batchEnd; merged++) {
+			waitForIndexedBuffer(formatter, merged);
+			if (OMR_ERROR_NONE != formatter->results[merged].rc) {
+				rc = formatter->results[merged].rc;
+				break;
+			}
+			if (0 != formatter->results[merged].count) {
+				pushRun(formatter, heap, &heapSize, merged);
+			} else {
+				freeFormattedBuffer(OMRPORTLIB, &formatter->results[merged]);
+			}
+		}
+		if (OMR_ERROR_NONE == rc) {
+			rc = emitMergedTracePoints(formatter, heap, &heapSize, mergeLimits[merged], callback, userData);
+		}
+	}
+
+done:
+	if (0 != formatter->activeThreads) {
+		omrthread_monitor_enter(formatter->lock);
+		formatter->shutdown = TRUE;
+		omrthread_monitor_notify_all(formatter->lock);
+		while (0 != formatter->activeThreads) {
+			omrthread_monitor_wait(formatter->lock);
+		}
+		omrthread_monitor_exit(formatter->lock);
+	}
+	if (NULL != formatter->lock) {
+		omrthread_monitor_destroy(formatter->lock);
+	}
+	if (NULL != formatter->results) {
+		for (i = 0; i < bufferCount; i++) {
+			freeFormattedBuffer(OMRPORTLIB, &formatter->results[i]);
+		}
+		omrmem_free_memory(formatter->results);
+	}
+	omrmem_free_memory(mergeLimits);
+	omrmem_free_memory(heap);
+	omrmem_free_memory(scratch);
+	omrmem_free_memory(line);
+	return rc;
+}
+
+omr_error_t
+omr_trc_formatTraceFile(OMRPortLibrary *portLib, const char *fileName, FormatStringCallback getFormatStringFn,
+						const UtTraceFormatFilter *filter, uint32_t formatThreads, FormattedTracePointCallback callback, void *userData)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	UtTraceFileFormatter formatter;
+	J9MmapHandle *mapping = NULL;
+	char *data = NULL;
+	UtTraceFileHdr *header = NULL;
+	intptr_t traceFileHandle = -1;
+	int64_t fileLength = 0;
+	omr_error_t rc = OMR_ERROR_NONE;
+
+	if ((NULL == fileName) || (NULL == getFormatStringFn) || (NULL == callback)) {
+		return OMR_ERROR_ILLEGAL_ARGUMENT;
+	}
+
+	traceFileHandle = omrfile_open(fileName, EsOpenRead, 0);
+	if (traceFileHandle < 0) {
+		return OMR_ERROR_FILE_UNAVAILABLE;
+	}
+
+	fileLength = omrfile_flength(traceFileHandle);
+	if ((fileLength < (int64_t)sizeof(UtTraceFileHdr)) || ((uint64_t)fileLength > (uint64_t)UINTPTR_MAX)) {
+		omrfile_close(traceFileHandle);
+		return OMR_ERROR_ILLEGAL_ARGUMENT;
+	}
+
+	/* Map the file so that only the buffers that are formatted are read. */
+	if (OMR_ARE_ANY_BITS_SET(omrmmap_capabilities(), OMRPORT_MMAP_CAPABILITY_READ)) {
+		mapping = omrmmap_map_file(traceFileHandle, 0, (uintptr_t)fileLength, NULL, OMRPORT_MMAP_FLAG_READ, OMRMEM_CATEGORY_TRACE);
+	}
+	if (NULL != mapping) {
+		data = (char *)mapping->pointer;
+	} else {
+		intptr_t bytesRead = 0;
+
+		UT_DBGOUT_CHECKED(2, ("<UT> omr_trc_formatTraceFile cannot map %s, reading it instead\n", fileName));
+		data = (char *)omrmem_allocate_memory((uintptr_t)fileLength, OMRMEM_CATEGORY_TRACE);
+		if (NULL == data) {
+			omrfile_close(traceFileHandle);
+			return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+		}
+		while (bytesRead < (intptr_t)fileLength) {
+			intptr_t bytes = omrfile_read(traceFileHandle, data + bytesRead, (intptr_t)fileLength - bytesRead);
+
+			if (bytes <= 0) {
+				omrmem_free_memory(data);
+				omrfile_close(traceFileHandle);
+				return OMR_ERROR_INTERNAL;
+			}
+			bytesRead += bytes;
+		}
+	}
+
+	/* Check for a valid looking header. */
+	header = (UtTraceFileHdr *)data;
+	if ((header->endianSignature != UT_ENDIAN_SIGNATURE)
+		|| (header->header.length < (int32_t)sizeof(UtTraceFileHdr))
+		|| ((int64_t)header->header.length > fileLength)
+		|| (header->bufferSize <= (int32_t)offsetof(UtTraceRecord, threadName))
+		|| (header->traceStart <= 0)
+		|| ((header->traceStart + (int32_t)sizeof(UtTraceSection)) > header->header.length)
+	) {
+		rc = OMR_ERROR_ILLEGAL_ARGUMENT;
+	}
+
+	if (OMR_ERROR_NONE == rc) {
+		memset(&formatter, 0, sizeof(formatter));
+		formatter.portLib = OMRPORTLIB;
+		formatter.getFormatStringFn = getFormatStringFn;
+		formatter.filter = filter;
+		formatter.traceSection = (UtTraceSection *)(data + header->traceStart);
+		formatter.bufferSize = (uint32_t)header->bufferSize;
+		/* every buffer converts time stamps with the same pair so the output doesn't depend on the formatting order */
+		formatter.endPlatform = omrtime_hires_clock();
+		formatter.endSystem = (uint64_t)omrtime_current_time_millis();
+
+		rc = indexTraceBuffers(&formatter, data, (uint64_t)fileLength, (uint32_t)header->header.length);
+	}
+	if (OMR_ERROR_NONE == rc) {
+		rc = formatIndexedTraceFile(&formatter, formatThreads, callback, userData);
+		omrmem_free_memory(formatter.buffers);
+	}
+
+	if (NULL != mapping) {
+		omrmmap_unmap_file(mapping);
+	} else {
+		omrmem_free_memory(data);
+	}
+	omrfile_close(traceFileHandle);
+	return rc;
+}
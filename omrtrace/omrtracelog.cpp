@@ -33,7 +33,6 @@
 #define MAX_QUALIFIED_NAME_LENGTH 16
 
 
-static OMR_TraceBuffer *allocateTraceBuffer(OMR_TraceThread *currentThread);
 static UtProcessorInfo *getProcessorInfo(void);
 static void raiseAssertion(void);
 
@@ -260,7 +259,7 @@ getTrcBuf(OMR_TraceThread *thr, OMR_TraceBuffer *oldBuf, int bufferType)
 			return NULL;
 		}
 
-		trcBuf = allocateTraceBuffer(thr);
+		trcBuf = allocateTraceBuffers(thr, UT_BUFFER_ALLOCATION_BATCH);
 		if (trcBuf == NULL) {
 			if (OMR_TRACEGLOBAL(dynamicBuffers) == TRUE) {
 				OMR_TRACEGLOBAL(dynamicBuffers) = FALSE;
@@ -270,8 +269,12 @@ getTrcBuf(OMR_TraceThread *thr, OMR_TraceBuffer *oldBuf, int bufferType)
 			return trcBuf;
 		}
 
-		VM_AtomicSupport::addU32((volatile uint32_t *)&OMR_TRACEGLOBAL(allocatedTraceBuffers), 1);
-		UT_DBGOUT(1, ("<UT> Allocated buffer %i " UT_POINTER_SPEC "\n", OMR_TRACEGLOBAL(allocatedTraceBuffers), trcBuf));
+		/* Keep one and leave the rest for the next threads that need a buffer */
+		while (NULL != trcBuf->next) {
+			OMR_TraceBuffer *spare = trcBuf->next;
+			trcBuf->next = spare->next;
+			releaseTraceBuffer(thr, spare);
+		}
 	}
 
 
@@ -608,46 +611,52 @@ traceCount(UtModuleInfo *moduleInfo, uint32_t traceId)
 }
 
 /*******************************************************************************
- * name        - utTraceV
- * description - Make a tracepoint
- * parameters  - OMR_TraceThread, tracepoint identifier and trace data.
+ * name        - writeEntryLength
+ * description - Write the length byte that ends a trace entry, handling a wrap
+ *               into the next buffer
+ * parameters  - OMR_TraceThread, buffer type, current tracebuffer pointer,
+ *               traceentry length and current tracebuffer
  * returns     - void
- *
  ******************************************************************************/
 static void
-traceV(OMR_TraceThread *thr, UtModuleInfo *modInfo, uint32_t traceId, const char *spec,
-	   va_list var, int bufferType)
+writeEntryLength(OMR_TraceThread *thr, int bufferType, char **p, int *entryLength, OMR_TraceBuffer **trcBuf)
+{
+	if ((char *)&(*trcBuf)->record + OMR_TRACEGLOBAL(bufferSize) - *p >
+		(int32_t)sizeof(char)) {
+		**p = (unsigned char)*entryLength;
+	} else {
+		char charVar = (unsigned char)*entryLength;
+		copyToBuffer(thr, bufferType, &charVar, p, sizeof(char),
+					 entryLength, trcBuf);
+		(*entryLength)--;
+		(*p)--;
+	}
+}
+
+/*******************************************************************************
+ * name        - startTraceEntry
+ * description - Write the id, timestamp and module name that begin a trace
+ *               entry, followed by its length byte
+ * parameters  - OMR_TraceThread, tracepoint identifier, buffer type, returned
+ *               traceentry length and tracebuffer
+ * returns     - Pointer to the length byte, or NULL if there is no buffer
+ ******************************************************************************/
+static char *
+startTraceEntry(OMR_TraceThread *thr, UtModuleInfo *modInfo, uint32_t traceId, int bufferType,
+				int *entryLengthOut, OMR_TraceBuffer **trcBufOut)
 {
 	OMR_TraceBuffer   *trcBuf;
 	int                lastSequence;
 	int                entryLength;
 	int                length;
 	char              *p;
-	const signed char *str;
-	char              *format = NULL;
 	int32_t               intVar;
 	char               charVar;
-	unsigned short     shortVar;
-	int64_t               i64Var;
-	double             doubleVar;
-	char              *ptrVar;
 	const char        *stringVar;
 	size_t             stringVarLen;
 	char              *containerModuleVar = NULL;
 	size_t             containerModuleVarLen = 0;
 	char               temp[3];
-	static char        lengthConversion[] = {0,
-											 sizeof(char),
-											 sizeof(short),
-											 0,
-											 sizeof(int32_t),
-											 sizeof(float),
-											 sizeof(char *),
-											 sizeof(double),
-											 sizeof(int64_t),
-											 sizeof(long double),
-											 0
-											};
 	OMRPORT_ACCESS_FROM_OMRPORT(OMR_TRACEGLOBAL(portLibrary));
 
 	if (modInfo != NULL) {
@@ -672,10 +681,10 @@ traceV(OMR_TraceThread *thr, UtModuleInfo *modInfo, uint32_t traceId, const char
 		if (((trcBuf = thr->trcBuf) == NULL)
 		&&  ((trcBuf = getTrcBuf(thr, NULL, bufferType)) == NULL)
 		) {
-			return;
+			return NULL;
 		}
 	} else {
-		return;
+		return NULL;
 	}
 
 	if (trcBuf->flags & UT_TRC_BUFFER_NEW) {
@@ -695,7 +704,7 @@ traceV(OMR_TraceThread *thr, UtModuleInfo *modInfo, uint32_t traceId, const char
 		thr->trcBuf = NULL;
 		trcBuf = getTrcBuf(thr, NULL, bufferType);
 		if (trcBuf == NULL) {
-			return;
+			return NULL;
 		}
 
 		p = (char *)&trcBuf->record + trcBuf->record.nextEntry + 1;
@@ -794,6 +803,92 @@ traceV(OMR_TraceThread *thr, UtModuleInfo *modInfo, uint32_t traceId, const char
 		entryLength--;
 	}
 
+	*entryLengthOut = entryLength;
+	*trcBufOut = trcBuf;
+	return p;
+}
+
+/*******************************************************************************
+ * name        - finishTraceEntry
+ * description - Complete a trace entry, adding the extended length for long
+ *               entries, and record where the next one starts
+ * parameters  - OMR_TraceThread, buffer type, pointer to the length byte,
+ *               traceentry length and current tracebuffer
+ * returns     - void
+ ******************************************************************************/
+static void
+finishTraceEntry(OMR_TraceThread *thr, int bufferType, char *p, int entryLength, OMR_TraceBuffer *trcBuf)
+{
+	/*
+	 *  Most tracepoints should now be complete, so we might bail out now.
+	 *  We don't need a -1 in the nextEntry assignment as we do elsewhere when
+	 *  copyToBuffer's been involved because p is decremented above.
+	 */
+	if (entryLength <= UT_MAX_TRC_LENGTH) {
+		trcBuf->record.nextEntry =
+			(int32_t)(p - (char *)&trcBuf->record);
+		return;
+	} else {
+		/*
+		 *  Handle long trace records
+		 */
+		char temp[4];
+		p++;
+		temp[0] = 0;
+		temp[1] = 0;
+		temp[2] = (char)(entryLength >> 8);
+		temp[3] = UT_TRC_EXTENDED_LENGTH;
+		copyToBuffer(thr, bufferType, temp, &p, 4, &entryLength, &trcBuf);
+		/* copyToBuffer increments p past the last byte written, but nextEntry
+		 * needs to point to the length byte so we need -1 here.
+		 */
+		trcBuf->record.nextEntry =
+			(int32_t)(p - (char *)&trcBuf->record - 1);
+	}
+}
+
+/*******************************************************************************
+ * name        - utTraceV
+ * description - Make a tracepoint
+ * parameters  - OMR_TraceThread, tracepoint identifier and trace data.
+ * returns     - void
+ *
+ ******************************************************************************/
+static void
+traceV(OMR_TraceThread *thr, UtModuleInfo *modInfo, uint32_t traceId, const char *spec,
+	   va_list var, int bufferType)
+{
+	OMR_TraceBuffer   *trcBuf;
+	int                entryLength;
+	int                length;
+	char              *p;
+	const signed char *str;
+	char              *format = NULL;
+	int32_t               intVar;
+	char               charVar;
+	unsigned short     shortVar;
+	int64_t               i64Var;
+	double             doubleVar;
+	char              *ptrVar;
+	const char        *stringVar;
+	static char        lengthConversion[] = {0,
+											 sizeof(char),
+											 sizeof(short),
+											 0,
+											 sizeof(int32_t),
+											 sizeof(float),
+											 sizeof(char *),
+											 sizeof(double),
+											 sizeof(int64_t),
+											 sizeof(long double),
+											 0
+											};
+
+	p = startTraceEntry(thr, modInfo, traceId, bufferType, &entryLength, &trcBuf);
+	if (p == NULL) {
+		return;
+	}
+
 	/*
 	 * Process maximal trace
 	 */
@@ -1060,45 +1155,47 @@ traceV(OMR_TraceThread *thr, UtModuleInfo *modInfo, uint32_t traceId, const char
 			/*
 			 *  Set the entry length
 			 */
-			if ((char *)&trcBuf->record + OMR_TRACEGLOBAL(bufferSize) - p >
-				(int32_t)sizeof(char)) {
-				*p = (unsigned char)entryLength;
-			} else {
-				charVar = (unsigned char)entryLength;
-				copyToBuffer(thr, bufferType, &charVar, &p, sizeof(char),
-							 &entryLength, &trcBuf);
-				entryLength--;
-				p--;
-			}
+			writeEntryLength(thr, bufferType, &p, &entryLength, &trcBuf);
 		}
 	}
 
-	/*
-	 *  Most tracepoints should now be complete, so we might bail out now.
-	 *  We don't need a -1 in the nextEntry assignment as we do elsewhere when
-	 *  copyToBuffer's been involved because p is decremented above.
-	 */
-	if (entryLength <= UT_MAX_TRC_LENGTH) {
-		trcBuf->record.nextEntry =
-			(int32_t)(p - (char *)&trcBuf->record);
+	finishTraceEntry(thr, bufferType, p, entryLength, trcBuf);
+}
+
+/*******************************************************************************
+ * name        - traceData
+ * description - Make a tracepoint from data a generated writer has already laid
+ *               out in record order
+ * parameters  - OMR_TraceThread, tracepoint identifier, trace data and its
+ *               length.
+ * returns     - void
+ ******************************************************************************/
+static void
+traceData(OMR_TraceThread *thr, UtModuleInfo *modInfo, uint32_t traceId, const char *data,
+		  int dataLength, int bufferType)
+{
+	OMR_TraceBuffer   *trcBuf;
+	int                entryLength;
+	char              *p;
+
+	p = startTraceEntry(thr, modInfo, traceId, bufferType, &entryLength, &trcBuf);
+	if (p == NULL) {
 		return;
-	} else {
-		/*
-		 *  Handle long trace records
-		 */
-		char temp[4];
-		p++;
-		temp[0] = 0;
-		temp[1] = 0;
-		temp[2] = (char)(entryLength >> 8);
-		temp[3] = UT_TRC_EXTENDED_LENGTH;
-		copyToBuffer(thr, bufferType, temp, &p, 4, &entryLength, &trcBuf);
-		/* copyToBuffer increments p past the last byte written, but nextEntry
-		 * needs to point to the length byte so we need -1 here.
-		 */
-		trcBuf->record.nextEntry =
-			(int32_t)(p - (char *)&trcBuf->record - 1);
 	}
+
+	if (OMR_ARE_ANY_BITS_SET(thr->currentOutputMask, UT_MAXIMAL | UT_EXCEPTION) && (dataLength > 0)) {
+		if ((p + dataLength + 1) < (char *)&trcBuf->record + OMR_TRACEGLOBAL(bufferSize)) {
+			memcpy(p, data, dataLength);
+			p += dataLength;
+			entryLength += dataLength;
+			*p = (unsigned char)entryLength;
+		} else {
+			copyToBuffer(thr, bufferType, data, &p, dataLength, &entryLength, &trcBuf);
+			writeEntryLength(thr, bufferType, &p, &entryLength, &trcBuf);
+		}
+	}
+
+	finishTraceEntry(thr, bufferType, p, entryLength, trcBuf);
 }
 
 static void
@@ -1128,6 +1225,18 @@ logTracePoint(OMR_TraceThread *thr, UtModuleInfo *modInfo, uint32_t traceId, con
 	}
 }
 
+static void
+logTracePointData(OMR_TraceThread *thr, UtModuleInfo *modInfo, uint32_t traceId, const char *data, uint32_t length)
+{
+	if ((thr->currentOutputMask & (UT_MINIMAL | UT_MAXIMAL)) != 0) {
+		traceData(thr, modInfo, traceId, data, (int)length, UT_NORMAL_BUFFER);
+	}
+
+	if ((thr->currentOutputMask & UT_COUNT) != 0) {
+		traceCount(modInfo, traceId);
+	}
+}
+
 void
 omrTrace(void *env, UtModuleInfo *modInfo, uint32_t traceId, const char *spec, ...)
 {
@@ -1140,25 +1249,35 @@ omrTrace(void *env, UtModuleInfo *modInfo, uint32_t traceId, const char *spec, .
 	}
 }
 
+void
+omrTraceData(void *env, UtModuleInfo *modInfo, uint32_t traceId, const void *data, uint32_t length)
+{
+	OMR_TraceThread *thr = OMR_TRACE_THREAD_FROM_ENV(env);
+	if (NULL != thr) {
+		doTracePointData(thr, modInfo, traceId, data, length);
+	}
+}
+
 /*******************************************************************************
- * name        - doTracePoint
- * description - Make a tracepoint, not called directly outside of rastrace
- * parameters  - OMR_TraceThread, tracepoint identifier and trace data.
- * returns     - void
- *
+ * name        - enterTracePoint
+ * description - Set up the thread's output mask and recursion protection for a
+ *               tracepoint
+ * parameters  - OMR_TraceThread, tracepoint identifier, returned saved output
+ *               mask for auxiliary tracepoints.
+ * returns     - TRUE if the tracepoint should be taken, in which case
+ *               exitTracePoint must be called afterwards
  ******************************************************************************/
-void
-doTracePoint(OMR_TraceThread *thr, UtModuleInfo *modInfo, uint32_t traceId, const char *spec, va_list varArgs)
+static BOOLEAN
+enterTracePoint(OMR_TraceThread *thr, UtModuleInfo *modInfo, uint32_t traceId, unsigned char *savedOutputMask)
 {
-	unsigned char savedOutputMask = '\0';
 	BOOLEAN isRegular = FALSE; /* is this a regular tracepoint, and not an auxiliary tracepoint? */
 
 	if ((NULL == omrTraceGlobal) || (OMR_TRACE_ENGINE_SHUTDOWN_STARTED == OMR_TRACEGLOBAL(initState))) {
-		return;
+		return FALSE;
 	}
 
 	if (NULL == thr) {
-		return;
+		return FALSE;
 	}
 
 	/* modInfo == NULL is for internal ute tracepoints */
@@ -1166,7 +1285,7 @@ doTracePoint(OMR_TraceThread *thr, UtModuleInfo *modInfo, uint32_t traceId, cons
 	if (isRegular) {
 		/* Recursion protection only applies to regular (not auxiliary) tracepoints. */
 		if (thr->recursion) {
-			return;
+			return FALSE;
 		}
 		incrementRecursionCounter(thr);
 
@@ -1181,18 +1300,25 @@ doTracePoint(OMR_TraceThread *thr, UtModuleInfo *modInfo, uint32_t traceId, cons
 		 * minimal (i.e. throwing away all the stack data) makes no sense - so it is converted to
 		 * maximal. currentOutputMask is reset below.
 		 */
-		savedOutputMask = thr->currentOutputMask;
+		*savedOutputMask = thr->currentOutputMask;
 		if (thr->currentOutputMask & UT_MINIMAL) {
-			thr->currentOutputMask = (savedOutputMask & ~UT_MINIMAL) | UT_MAXIMAL;
+			thr->currentOutputMask = (*savedOutputMask & ~UT_MINIMAL) | UT_MAXIMAL;
 		}
 	}
 
-	if ((OMR_TRACEGLOBAL(traceSuspend) == 0) && (thr->suspendResume >= 0)) {
-		/* logTracePoint writes the trace point to the appropriate location */
-		logTracePoint(thr, modInfo, traceId, spec, varArgs);
-	}
+	return TRUE;
+}
 
-	if (isRegular) {
+/*******************************************************************************
+ * name        - exitTracePoint
+ * description - Undo enterTracePoint
+ * parameters  - OMR_TraceThread, saved output mask from enterTracePoint.
+ * returns     - void
+ ******************************************************************************/
+static void
+exitTracePoint(OMR_TraceThread *thr, UtModuleInfo *modInfo, unsigned char savedOutputMask)
+{
+	if ((NULL == modInfo) || !MODULE_IS_AUXILIARY(modInfo)) {
 		/* This block is only executed for regular tracepoints */
 		decrementRecursionCounter(thr);
 	} else {
@@ -1201,6 +1327,48 @@ doTracePoint(OMR_TraceThread *thr, UtModuleInfo *modInfo, uint32_t traceId, cons
 	}
 }
 
+/*******************************************************************************
+ * name        - doTracePoint
+ * description - Make a tracepoint, not called directly outside of rastrace
+ * parameters  - OMR_TraceThread, tracepoint identifier and trace data.
+ * returns     - void
+ *
+ ******************************************************************************/
+void
+doTracePoint(OMR_TraceThread *thr, UtModuleInfo *modInfo, uint32_t traceId, const char *spec, va_list varArgs)
+{
+	unsigned char savedOutputMask = '\0';
+
+	if (enterTracePoint(thr, modInfo, traceId, &savedOutputMask)) {
+		if ((OMR_TRACEGLOBAL(traceSuspend) == 0) && (thr->suspendResume >= 0)) {
+			/* logTracePoint writes the trace point to the appropriate location */
+			logTracePoint(thr, modInfo, traceId, spec, varArgs);
+		}
+		exitTracePoint(thr, modInfo, savedOutputMask);
+	}
+}
+
+/*******************************************************************************
+ * name        - doTracePointData
+ * description - Make a tracepoint from pre-formatted data, not called directly
+ *               outside of rastrace
+ * parameters  - OMR_TraceThread, tracepoint identifier, trace data and its
+ *               length.
+ * returns     - void
+ ******************************************************************************/
+void
+doTracePointData(OMR_TraceThread *thr, UtModuleInfo *modInfo, uint32_t traceId, const void *data, uint32_t length)
+{
+	unsigned char savedOutputMask = '\0';
+
+	if (enterTracePoint(thr, modInfo, traceId, &savedOutputMask)) {
+		if ((OMR_TRACEGLOBAL(traceSuspend) == 0) && (thr->suspendResume >= 0)) {
+			logTracePointData(thr, modInfo, traceId, (const char *)data, length);
+		}
+		exitTracePoint(thr, modInfo, savedOutputMask);
+	}
+}
+
 /*******************************************************************************
  * name        - internalTrace
  * description - Make an tracepoint, not called outside rastrace
@@ -1292,18 +1460,31 @@ raiseAssertion(void)
  * does these operations together while preventing trace points.
  */
 OMR_TraceBuffer *
-allocateTraceBuffer(OMR_TraceThread *currentThread)
+allocateTraceBuffers(OMR_TraceThread *currentThread, uint32_t count)
 {
-	OMR_TraceBuffer *newTrcBuffer = NULL;
+	OMR_TraceBuffer *buffers = NULL;
+	uint32_t allocated = 0;
 
 	if (NULL != currentThread) {
 		incrementRecursionCounter(currentThread);
 	}
 	omrthread_monitor_enter(OMR_TRACEGLOBAL(bufferPoolLock));
-	newTrcBuffer = (OMR_TraceBuffer *)pool_newElement(OMR_TRACEGLOBAL(bufferPool));
+	for (allocated = 0; allocated < count; allocated++) {
+		OMR_TraceBuffer *newTrcBuffer = (OMR_TraceBuffer *)pool_newElement(OMR_TRACEGLOBAL(bufferPool));
+		if (NULL == newTrcBuffer) {
+			break;
+		}
+		newTrcBuffer->next = buffers;
+		buffers = newTrcBuffer;
+	}
 	omrthread_monitor_exit(OMR_TRACEGLOBAL(bufferPoolLock));
 	if (NULL != currentThread) {
 		decrementRecursionCounter(currentThread);
 	}
-	return newTrcBuffer;
+
+	if (0 != allocated) {
+		VM_AtomicSupport::addU32((volatile uint32_t *)&OMR_TRACEGLOBAL(allocatedTraceBuffers), allocated);
+		UT_DBGOUT(1, ("<UT> Allocated %u buffers, %u in total\n", allocated, OMR_TRACEGLOBAL(allocatedTraceBuffers)));
+	}
+	return buffers;
 }
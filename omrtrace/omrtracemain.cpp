@@ -346,6 +346,9 @@ freeTrace(void)
 	 * We still have a problem where we fail to notice that a concurrent thread is in the process
 	 * of attaching, and start deleting omrTraceGlobal from under it.
 	 */
+	stopTraceWriterThread();
+	flushTraceBuffers(&global->writerTraceThread);
+
 	omrTraceGlobal = NULL;
 	const_cast<OMR_VM *>(global->vm)->_trcEngine = NULL;
 	const_cast<OMR_VM *>(global->vm)->utIntf = NULL;
@@ -403,8 +406,8 @@ freeTrace(void)
 	omrthread_monitor_destroy(global->subscribersLock);
 	global->subscribersLock = NULL;
 
-	omrthread_monitor_destroy(global->freeQueueLock);
-	global->freeQueueLock = NULL;
+	omrthread_monitor_destroy(global->writerLock);
+	global->writerLock = NULL;
 
 	omrthread_monitor_destroy(global->traceLock);
 	global->traceLock = NULL;
@@ -548,8 +551,8 @@ initializeTrace(OMR_VM *vm, const char *datDir, const OMR_TraceLanguageInterface
 		rc = OMR_ERROR_FAILED_TO_ALLOCATE_MONITOR;
 		goto fail;
 	}
-	if (0 != omrthread_monitor_init_with_name(&OMR_TRACEGLOBAL(freeQueueLock), 0, "Global Trace Free Queue")) {
-		UT_DBGOUT(1, ("<UT> Initialization of freeQueueLock failed\n"));
+	if (0 != omrthread_monitor_init_with_name(&OMR_TRACEGLOBAL(writerLock), 0, "Global Trace Writer")) {
+		UT_DBGOUT(1, ("<UT> Initialization of writerLock failed\n"));
 		rc = OMR_ERROR_FAILED_TO_ALLOCATE_MONITOR;
 		goto fail;
 	}
@@ -705,6 +708,11 @@ out:
 	freeTraceLock(thr);
 	omrthread_monitor_exit(OMR_TRACEGLOBAL(subscribersLock));
 	UT_DBGOUT(5, ("<UT thr=" UT_POINTER_SPEC "> Lock released for registration\n", thr));
+
+	if (OMR_ERROR_NONE == result) {
+		/* If the writer can't be started, publishing threads deliver their own buffers */
+		startTraceWriterThread(thr);
+	}
 	decrementRecursionCounter(thr);
 	return result;
 }
@@ -734,6 +742,9 @@ trcDeregisterRecordSubscriber(OMR_TraceThread *thr, UtSubscription *subscription
 	omrthread_monitor_enter(OMR_TRACEGLOBAL(subscribersLock));
 	UT_DBGOUT(5, ("<UT thr=" UT_POINTER_SPEC "> Lock acquired for deregistration\n", thr));
 
+	/* The subscriber gets every buffer published before it was deregistered */
+	flushTraceBuffers(thr);
+
 	if (findRecordSubscriber(subscriptionID)) {
 		getTraceLock(thr);
 		destroyRecordSubscriber(thr, subscriptionID, TRUE);
@@ -752,14 +763,17 @@ trcDeregisterRecordSubscriber(OMR_TraceThread *thr, UtSubscription *subscription
 
 /*******************************************************************************
  * name        - trcFlushTraceData
- * description - Places in use trace buffers on the write queue and prompts queue
- * 				 processing
- * parameters  - thr, first, last, pause
+ * description - Delivers the buffers on the write queue to the subscribers
+ * 				 before returning
+ * parameters  - thr
  * returns     - Success or error code
  ******************************************************************************/
 static omr_error_t
 trcFlushTraceData(OMR_TraceThread *thr)
 {
+	if (NULL != thr) {
+		flushTraceBuffers(thr);
+	}
 	return OMR_ERROR_NONE;
 }
 
@@ -851,6 +865,7 @@ fillInUTInterfaces(UtInterface **utIntf, OMR_TraceInterface *omrTraceIntf, UtMod
 		utModuleIntf->Trace           = omrTrace;
 		utModuleIntf->TraceInit       = omrTraceInit;
 		utModuleIntf->TraceTerm       = omrTraceTerm;
+		utModuleIntf->TraceData       = omrTraceData;
 
 		/*
 		 * Make the interfaces available.
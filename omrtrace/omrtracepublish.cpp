@@ -20,11 +20,29 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
  *******************************************************************************/
 
+/*
+ * Buffer management.
+ *
+ * Free buffers are kept on OMR_TRACEGLOBAL(freeQueue), a stack which any thread may push to
+ * with a CAS. Only one thread at a time may pop from it, which is what makes the pop safe
+ * from ABA; a thread which finds another popping gives up after a few attempts and allocates
+ * instead of waiting.
+ *
+ * Full buffers are pushed to OMR_TRACEGLOBAL(fullQueue) the same way, and the whole queue is
+ * taken at once by whichever thread delivers them to the subscribers: normally the trace writer
+ * thread, so that the thread which filled a buffer never waits for the subscribers.
+ */
+
 #include "AtomicSupport.hpp"
 
 #include "omrtrace_internal.h"
+#include "omrutil.h"
 #include "thread_api.h"
 
+static void notifySubscribers(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf);
+static void deliverFullBuffers(OMR_TraceThread *currentThr);
+static int J9THREAD_PROC traceWriterThreadMain(void *entryArg);
+
 omr_error_t
 publishTraceBuffer(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf)
 {
@@ -46,37 +64,30 @@ publishTraceBuffer(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf)
 	/* only publish a buffer if data has been written to it */
 	if ((bufFlags & UT_TRC_BUFFER_ACTIVE) && !(bufFlags & UT_TRC_BUFFER_NEW)) {
 		const uint32_t newFlags = (bufFlags & (~(UT_TRC_BUFFER_ACTIVE | UT_TRC_BUFFER_NEW))) | UT_TRC_BUFFER_FULL;
+		OMR_TraceBuffer *oldHead = NULL;
+
 		/* CAS is not needed because flags is modified only by the thread that owns the buffer */
 		buf->flags = newFlags;
 
-		omrthread_monitor_t const subscribersLock = OMR_TRACEGLOBAL(subscribersLock);
-		omrthread_monitor_enter(subscribersLock);
-		for (UtSubscription *subscription = (UtSubscription *)OMR_TRACEGLOBAL(subscribers); subscription; subscription = subscription->next) {
-			subscription->dataLength = OMR_TRACEGLOBAL(bufferSize);
-			subscription->data = &(buf->record);
-
-			omr_error_t subscriberRc = subscription->subscriber(subscription);
-			if (OMR_ERROR_NONE != subscriberRc) {
-				/* If the subscriber callback fails, call the alarm callback and
-				 * remove the subscription.
-				 */
-				UtSubscription *subscriptionToDestroy = subscription;
-
-				/* adjust the loop iterator */
-				subscription = subscriptionToDestroy->prev;
-
-				getTraceLock(currentThr);
-				destroyRecordSubscriber(currentThr, subscriptionToDestroy, 1);
-				freeTraceLock(currentThr);
-
-				if (NULL == subscription) {
-					break;
-				}
+		do {
+			oldHead = OMR_TRACEGLOBAL(fullQueue);
+			buf->next = oldHead;
+		} while ((uintptr_t)oldHead != VM_AtomicSupport::lockCompareExchange(
+			(volatile uintptr_t *)&OMR_TRACEGLOBAL(fullQueue), (uintptr_t)oldHead, (uintptr_t)buf));
+
+		if (UT_WRITER_RUNNING == OMR_TRACEGLOBAL(writerState)) {
+			/* The writer only waits when the queue is empty, so only the first buffer needs to wake it */
+			if (NULL == oldHead) {
+				omrthread_monitor_enter(OMR_TRACEGLOBAL(writerLock));
+				omrthread_monitor_notify(OMR_TRACEGLOBAL(writerLock));
+				omrthread_monitor_exit(OMR_TRACEGLOBAL(writerLock));
 			}
+		} else {
+			deliverFullBuffers(currentThr);
 		}
-		omrthread_monitor_exit(subscribersLock);
+	} else {
+		releaseTraceBuffer(currentThr, buf);
 	}
-	releaseTraceBuffer(currentThr, buf);
 
 	decrementRecursionCounter(currentThr);
 	return rc;
@@ -85,6 +96,8 @@ publishTraceBuffer(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf)
 omr_error_t
 releaseTraceBuffer(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf)
 {
+	OMR_TraceBuffer *oldHead = NULL;
+
 	incrementRecursionCounter(currentThr);
 
 	/* Ensure the buffer's owner can't use it anymore.
@@ -97,10 +110,11 @@ releaseTraceBuffer(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf)
 		buf->thr->trcBuf = NULL;
 	}
 
-	omrthread_monitor_enter(OMR_TRACEGLOBAL(freeQueueLock));
-	buf->next = OMR_TRACEGLOBAL(freeQueue);
-	OMR_TRACEGLOBAL(freeQueue) = buf;
-	omrthread_monitor_exit(OMR_TRACEGLOBAL(freeQueueLock));
+	do {
+		oldHead = OMR_TRACEGLOBAL(freeQueue);
+		buf->next = oldHead;
+	} while ((uintptr_t)oldHead != VM_AtomicSupport::lockCompareExchange(
+		(volatile uintptr_t *)&OMR_TRACEGLOBAL(freeQueue), (uintptr_t)oldHead, (uintptr_t)buf));
 
 	decrementRecursionCounter(currentThr);
 	return OMR_ERROR_NONE;
@@ -109,16 +123,189 @@ releaseTraceBuffer(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf)
 OMR_TraceBuffer *
 recycleTraceBuffer(OMR_TraceThread *currentThr)
 {
+	OMR_TraceBuffer *recycledBuf = NULL;
+	uint32_t attempt = 0;
+
 	incrementRecursionCounter(currentThr);
 
-	omrthread_monitor_enter(OMR_TRACEGLOBAL(freeQueueLock));
-	OMR_TraceBuffer *recycledBuf = OMR_TRACEGLOBAL(freeQueue);
-	if (recycledBuf) {
-		OMR_TRACEGLOBAL(freeQueue) = recycledBuf->next;
-		recycledBuf->next = NULL;
+	for (attempt = 0; (attempt < UT_FREE_QUEUE_POP_ATTEMPTS) && (NULL != OMR_TRACEGLOBAL(freeQueue)); attempt++) {
+		if (0 == VM_AtomicSupport::lockCompareExchange(&OMR_TRACEGLOBAL(freeQueuePopper), 0, 1)) {
+			/* No other thread can pop, so recycledBuf cannot be popped and pushed back before the CAS */
+			do {
+				recycledBuf = OMR_TRACEGLOBAL(freeQueue);
+			} while ((NULL != recycledBuf) && ((uintptr_t)recycledBuf != VM_AtomicSupport::lockCompareExchange(
+				(volatile uintptr_t *)&OMR_TRACEGLOBAL(freeQueue), (uintptr_t)recycledBuf, (uintptr_t)recycledBuf->next)));
+			VM_AtomicSupport::writeBarrier();
+			OMR_TRACEGLOBAL(freeQueuePopper) = 0;
+			if (NULL != recycledBuf) {
+				recycledBuf->next = NULL;
+			}
+			break;
+		}
+		VM_AtomicSupport::yieldCPU();
 	}
-	omrthread_monitor_exit(OMR_TRACEGLOBAL(freeQueueLock));
 
 	decrementRecursionCounter(currentThr);
 	return recycledBuf;
 }
+
+/**
+ * Pass a full buffer to each subscriber. A subscriber which fails is removed.
+ *
+ * @pre hold OMR_TRACEGLOBAL(subscribersLock)
+ */
+static void
+notifySubscribers(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf)
+{
+	for (UtSubscription *subscription = (UtSubscription *)OMR_TRACEGLOBAL(subscribers); subscription; subscription = subscription->next) {
+		subscription->dataLength = OMR_TRACEGLOBAL(bufferSize);
+		subscription->data = &(buf->record);
+
+		omr_error_t subscriberRc = subscription->subscriber(subscription);
+		if (OMR_ERROR_NONE != subscriberRc) {
+			/* If the subscriber callback fails, call the alarm callback and
+			 * remove the subscription.
+			 */
+			UtSubscription *subscriptionToDestroy = subscription;
+
+			/* adjust the loop iterator */
+			subscription = subscriptionToDestroy->prev;
+
+			getTraceLock(currentThr);
+			destroyRecordSubscriber(currentThr, subscriptionToDestroy, 1);
+			freeTraceLock(currentThr);
+
+			if (NULL == subscription) {
+				break;
+			}
+		}
+	}
+}
+
+/**
+ * Take everything on the full queue, pass it to the subscribers in the order it was published,
+ * and put the buffers on the free queue. Holding subscribersLock throughout means that once a
+ * thread has entered it, every buffer published earlier has been delivered.
+ */
+static void
+deliverFullBuffers(OMR_TraceThread *currentThr)
+{
+	omrthread_monitor_t const subscribersLock = OMR_TRACEGLOBAL(subscribersLock);
+	omrthread_t previousDeliverer = NULL;
+	OMR_TraceBuffer *batch = NULL;
+	OMR_TraceBuffer *ordered = NULL;
+
+	incrementRecursionCounter(currentThr);
+	omrthread_monitor_enter(subscribersLock);
+	previousDeliverer = OMR_TRACEGLOBAL(deliveringThread);
+	OMR_TRACEGLOBAL(deliveringThread) = omrthread_self();
+
+	batch = (OMR_TraceBuffer *)VM_AtomicSupport::lockExchange((volatile uintptr_t *)&OMR_TRACEGLOBAL(fullQueue), 0);
+	/* The queue is newest first */
+	while (NULL != batch) {
+		OMR_TraceBuffer *next = batch->next;
+		batch->next = ordered;
+		ordered = batch;
+		batch = next;
+	}
+	while (NULL != ordered) {
+		OMR_TraceBuffer *next = ordered->next;
+		notifySubscribers(currentThr, ordered);
+		releaseTraceBuffer(currentThr, ordered);
+		ordered = next;
+	}
+
+	OMR_TRACEGLOBAL(deliveringThread) = previousDeliverer;
+	omrthread_monitor_exit(subscribersLock);
+	decrementRecursionCounter(currentThr);
+}
+
+void
+flushTraceBuffers(OMR_TraceThread *currentThr)
+{
+	/* A subscriber may call back into trace while its buffers are being delivered */
+	if (OMR_TRACEGLOBAL(deliveringThread) != omrthread_self()) {
+		deliverFullBuffers(currentThr);
+	}
+}
+
+/**
+ * The trace writer thread delivers full buffers as they are published.
+ */
+static int J9THREAD_PROC
+traceWriterThreadMain(void *entryArg)
+{
+	OMR_TraceGlobal *global = (OMR_TraceGlobal *)entryArg;
+	omrthread_monitor_t const writerLock = global->writerLock;
+
+	omrthread_monitor_enter(writerLock);
+	while (UT_WRITER_RUNNING == global->writerState) {
+		if (NULL == global->fullQueue) {
+			omrthread_monitor_wait(writerLock);
+		} else {
+			omrthread_monitor_exit(writerLock);
+			deliverFullBuffers(&global->writerTraceThread);
+			omrthread_monitor_enter(writerLock);
+		}
+	}
+	global->writerState = UT_WRITER_STOPPED;
+	omrthread_monitor_notify_all(writerLock);
+	omrthread_exit(writerLock);
+
+	/* unreachable */
+	return 0;
+}
+
+omr_error_t
+startTraceWriterThread(OMR_TraceThread *thr)
+{
+	omr_error_t rc = OMR_ERROR_NONE;
+	BOOLEAN started = FALSE;
+	OMR_TraceBuffer *spares = NULL;
+
+	omrthread_monitor_enter(OMR_TRACEGLOBAL(writerLock));
+	if (UT_WRITER_STOPPED == OMR_TRACEGLOBAL(writerState)) {
+		OMR_TRACEGLOBAL(writerState) = UT_WRITER_RUNNING;
+		if (0 != createThreadWithCategory(&OMR_TRACEGLOBAL(writerThread), 0, J9THREAD_PRIORITY_NORMAL, 0,
+			traceWriterThreadMain, omrTraceGlobal, J9THREAD_CATEGORY_SYSTEM_THREAD)
+		) {
+			/* Buffers are delivered by the threads that publish them instead */
+			UT_DBGOUT(1, ("<UT> Unable to start the trace writer thread\n"));
+			OMR_TRACEGLOBAL(writerState) = UT_WRITER_STOPPED;
+			OMR_TRACEGLOBAL(writerThread) = NULL;
+			rc = OMR_ERROR_FAILED_TO_ATTACH_NATIVE_THREAD;
+		} else {
+			started = TRUE;
+		}
+	}
+	omrthread_monitor_exit(OMR_TRACEGLOBAL(writerLock));
+
+	/* Threads will start publishing buffers, so have replacements ready for them. This takes
+	 * bufferPoolLock, which the fork handlers take before writerLock, so it is not done under
+	 * writerLock.
+	 */
+	if (started) {
+		spares = allocateTraceBuffers(thr, UT_PREALLOCATED_BUFFERS);
+	}
+	while (NULL != spares) {
+		OMR_TraceBuffer *next = spares->next;
+		releaseTraceBuffer(thr, spares);
+		spares = next;
+	}
+	return rc;
+}
+
+void
+stopTraceWriterThread(void)
+{
+	omrthread_monitor_enter(OMR_TRACEGLOBAL(writerLock));
+	if (UT_WRITER_RUNNING == OMR_TRACEGLOBAL(writerState)) {
+		OMR_TRACEGLOBAL(writerState) = UT_WRITER_STOPPING;
+		omrthread_monitor_notify_all(OMR_TRACEGLOBAL(writerLock));
+		while (UT_WRITER_STOPPED != OMR_TRACEGLOBAL(writerState)) {
+			omrthread_monitor_wait(OMR_TRACEGLOBAL(writerLock));
+		}
+		OMR_TRACEGLOBAL(writerThread) = NULL;
+	}
+	omrthread_monitor_exit(OMR_TRACEGLOBAL(writerLock));
+}
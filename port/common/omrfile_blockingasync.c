@@ -24,6 +24,9 @@
  * @file
  * @ingroup Port
  * @brief file
+ *
+ * Where files are not opened for overlapped I/O, the blocking async operations are the
+ * plain file operations. For requests that complete in the background see omrfileaio.c.
  */
 
 #include "omrport.h"
@@ -43,7 +46,7 @@
 int32_t
 omrfile_blockingasync_close(struct OMRPortLibrary *portLibrary, intptr_t fd)
 {
-	return -1;
+	return portLibrary->file_close(portLibrary, fd);
 }
 
 /**
@@ -60,7 +63,7 @@ omrfile_blockingasync_close(struct OMRPortLibrary *portLibrary, intptr_t fd)
 intptr_t
 omrfile_blockingasync_open(struct OMRPortLibrary *portLibrary, const char *path, int32_t flags, int32_t mode)
 {
-	return -1;
+	return portLibrary->file_open(portLibrary, path, flags, mode);
 }
 
 /**
@@ -82,7 +85,7 @@ omrfile_blockingasync_open(struct OMRPortLibrary *portLibrary, const char *path,
 int32_t
 omrfile_blockingasync_lock_bytes(struct OMRPortLibrary *portLibrary, intptr_t fd, int32_t lockFlags, uint64_t offset, uint64_t length)
 {
-	return -1;
+	return portLibrary->file_lock_bytes(portLibrary, fd, lockFlags, offset, length);
 }
 
 
@@ -100,7 +103,7 @@ omrfile_blockingasync_lock_bytes(struct OMRPortLibrary *portLibrary, intptr_t fd
 int32_t
 omrfile_blockingasync_unlock_bytes(struct OMRPortLibrary *portLibrary, intptr_t fd, uint64_t offset, uint64_t length)
 {
-	return -1;
+	return portLibrary->file_unlock_bytes(portLibrary, fd, offset, length);
 }
 /**
  * Read bytes from a file descriptor into a user provided buffer.
@@ -115,7 +118,7 @@ omrfile_blockingasync_unlock_bytes(struct OMRPortLibrary *portLibrary, intptr_t
 intptr_t
 omrfile_blockingasync_read(struct OMRPortLibrary *portLibrary, intptr_t fd, void *buf, intptr_t nbytes)
 {
-	return -1;
+	return portLibrary->file_read(portLibrary, fd, buf, nbytes);
 }
 
 
@@ -134,7 +137,7 @@ omrfile_blockingasync_read(struct OMRPortLibrary *portLibrary, intptr_t fd, void
 intptr_t
 omrfile_blockingasync_write(struct OMRPortLibrary *portLibrary, intptr_t fd, const void *buf, intptr_t nbytes)
 {
-	return -1;
+	return portLibrary->file_write(portLibrary, fd, buf, nbytes);
 }
 
 /**
@@ -149,7 +152,7 @@ omrfile_blockingasync_write(struct OMRPortLibrary *portLibrary, intptr_t fd, con
 int32_t
 omrfile_blockingasync_set_length(struct OMRPortLibrary *portLibrary, intptr_t fd, int64_t newLength)
 {
-	return -1;
+	return portLibrary->file_set_length(portLibrary, fd, newLength);
 }
 
 /**
@@ -163,7 +166,7 @@ omrfile_blockingasync_set_length(struct OMRPortLibrary *portLibrary, intptr_t fd
 int64_t
 omrfile_blockingasync_flength(struct OMRPortLibrary *portLibrary, intptr_t fd)
 {
-	return -1;
+	return portLibrary->file_flength(portLibrary, fd);
 }
 
 /**
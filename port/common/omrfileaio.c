@@ -0,0 +1,140 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Port
+ * @brief Asynchronous file I/O
+ *
+ * This is the implementation for platforms without asynchronous file I/O support; see unix/omrfileaio.c.
+ */
+
+#include "omrport.h"
+#include "omrportpriv.h"
+
+/**
+ * Create a context for asynchronous file I/O.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] queueDepth The maximum number of requests in flight at once.
+ * @param[in] flags OMRPORT_FILE_AIO_FORCE_THREADS to use worker threads even where io_uring is available.
+ * @param[out] context The new context.
+ *
+ * @return 0 on success, negative portable error code on failure.
+ */
+int32_t
+omrfile_aio_create(struct OMRPortLibrary *portLibrary, uint32_t queueDepth, uint32_t flags, OMRFileAIOContext **context)
+{
+	*context = NULL;
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Destroy a context. Requests still in flight are waited for, but their callbacks are not run.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] context The context to destroy, may be NULL.
+ */
+void
+omrfile_aio_destroy(struct OMRPortLibrary *portLibrary, OMRFileAIOContext *context)
+{
+}
+
+/**
+ * Register buffers for use by requests with a fixedBufferIndex. The buffers stay pinned until the
+ * context is destroyed or other buffers are registered. No requests may be in flight.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] context The context.
+ * @param[in] buffers The buffers to register.
+ * @param[in] count The number of buffers.
+ *
+ * @return 0 on success, negative portable error code on failure.
+ */
+int32_t
+omrfile_aio_register_buffers(struct OMRPortLibrary *portLibrary, OMRFileAIOContext *context, OMRFileAIOVec *buffers, uint32_t count)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Submit a batch of requests. Requests are accepted in order until the context's queue depth is reached;
+ * each accepted request is PENDING until it is reaped and must not be modified until then.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] context The context.
+ * @param[in] requests The requests to submit.
+ * @param[in] count The number of requests.
+ *
+ * @return the number of requests accepted, or a negative portable error code if any request is invalid,
+ * in which case none are accepted.
+ */
+intptr_t
+omrfile_aio_submit(struct OMRPortLibrary *portLibrary, OMRFileAIOContext *context, OMRFileAIORequest **requests, uintptr_t count)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Reap completed requests, waiting for at least minCompletions of them (or all the requests in flight,
+ * if fewer). Each reaped request has its result set and becomes COMPLETE, then its callback is run.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] context The context.
+ * @param[in] minCompletions The number of completions to wait for, 0 to only reap those already complete.
+ *
+ * @return the number of requests reaped, or a negative portable error code.
+ */
+intptr_t
+omrfile_aio_reap(struct OMRPortLibrary *portLibrary, OMRFileAIOContext *context, uintptr_t minCompletions)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Answer a descriptor that becomes readable when requests complete, for use with poll or select.
+ * It is reset by omrfile_aio_reap and must not be read or closed by the caller.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] context The context.
+ *
+ * @return the descriptor, or a negative portable error code.
+ */
+intptr_t
+omrfile_aio_get_event_fd(struct OMRPortLibrary *portLibrary, OMRFileAIOContext *context)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Answer how a context performs its requests.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] context The context.
+ *
+ * @return OMRPORT_FILE_AIO_BACKEND_IO_URING or OMRPORT_FILE_AIO_BACKEND_THREADS, 0 if unsupported.
+ */
+uint32_t
+omrfile_aio_backend(struct OMRPortLibrary *portLibrary, OMRFileAIOContext *context)
+{
+	return 0;
+}
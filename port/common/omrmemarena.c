@@ -0,0 +1,396 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Port
+ * @brief Memory arenas
+ *
+ * An arena hands out memory by bumping a pointer through chunks obtained from omrmem_allocate_memory,
+ * so category accounting happens once per chunk rather than once per allocation. Individual allocations
+ * are never freed; the arena is rewound, reset or released as a whole. Arenas are not thread safe and
+ * are intended to be owned by one thread at a time. Chunks of the standard size may be recycled through
+ * an OMRMemArenaPool, which is thread safe and may be shared by arenas on different threads.
+ */
+#include <string.h>
+
+#include "omrport.h"
+#include "omrportpriv.h"
+#include "omrportpg.h"
+#include "omrportptb.h"
+
+typedef struct OMRMemArenaChunk {
+	struct OMRMemArenaChunk *next;
+	uintptr_t size; /* usable bytes following the header */
+} OMRMemArenaChunk;
+
+struct OMRMemArena {
+	OMRMemArenaChunk *chunks; /* standard size chunks, most recent (current) first */
+	OMRMemArenaChunk *largeChunks; /* dedicated chunks for large requests, most recent first */
+	uint8_t *alloc;
+	uint8_t *top;
+	uintptr_t chunkSize;
+	uint32_t category;
+	OMRMemArenaPool *pool;
+};
+
+struct OMRMemArenaPool {
+	MUTEX mutex;
+	OMRMemArenaChunk *freeChunks;
+	uintptr_t freeCount;
+	uintptr_t maxFreeChunks;
+	uintptr_t chunkSize;
+	uint32_t category;
+};
+
+#define ARENA_ALIGNMENT sizeof(uint64_t)
+#define ARENA_ROUND_UP(value) ((((uintptr_t)(value)) + (ARENA_ALIGNMENT - 1)) & ~(ARENA_ALIGNMENT - 1))
+#define CHUNK_DATA(chunk) ((uint8_t *)((chunk) + 1))
+
+/* Requests larger than this fraction of the chunk size get a dedicated chunk rather than abandoning the current one */
+#define LARGE_REQUEST_DIVISOR 4
+
+static OMRMemArenaChunk *
+allocateChunk(struct OMRPortLibrary *portLibrary, uintptr_t size, uint32_t category)
+{
+	OMRMemArenaChunk *chunk = NULL;
+
+	if (size <= (UDATA_MAX - sizeof(OMRMemArenaChunk))) {
+		chunk = portLibrary->mem_allocate_memory(portLibrary, sizeof(OMRMemArenaChunk) + size, OMR_GET_CALLSITE(), category);
+		if (NULL != chunk) {
+			chunk->next = NULL;
+			chunk->size = size;
+		}
+	}
+	return chunk;
+}
+
+static OMRMemArenaChunk *
+getChunk(struct OMRPortLibrary *portLibrary, OMRMemArena *arena)
+{
+	OMRMemArenaPool *pool = arena->pool;
+	OMRMemArenaChunk *chunk = NULL;
+
+	if (NULL != pool) {
+		MUTEX_ENTER(pool->mutex);
+		chunk = pool->freeChunks;
+		if (NULL != chunk) {
+			pool->freeChunks = chunk->next;
+			pool->freeCount -= 1;
+		}
+		MUTEX_EXIT(pool->mutex);
+	}
+	if (NULL == chunk) {
+		chunk = allocateChunk(portLibrary, arena->chunkSize, arena->category);
+	}
+	return chunk;
+}
+
+static void
+putChunk(struct OMRPortLibrary *portLibrary, OMRMemArena *arena, OMRMemArenaChunk *chunk)
+{
+	OMRMemArenaPool *pool = arena->pool;
+
+	if (NULL != pool) {
+		MUTEX_ENTER(pool->mutex);
+		if (pool->freeCount < pool->maxFreeChunks) {
+			chunk->next = pool->freeChunks;
+			pool->freeChunks = chunk;
+			pool->freeCount += 1;
+			chunk = NULL;
+		}
+		MUTEX_EXIT(pool->mutex);
+	}
+	if (NULL != chunk) {
+		portLibrary->mem_free_memory(portLibrary, chunk);
+	}
+}
+
+/**
+ * Create a pool of arena chunks. Arenas created with the pool allocate chunks of the pool's size and
+ * category, and return them to the pool when rewound, reset or released.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] chunkSize Usable bytes per chunk, or 0 for OMRPORT_MEM_ARENA_DEFAULT_CHUNK_SIZE
+ * @param[in] maxFreeChunks The most free chunks the pool retains; further chunks are freed
+ * @param[in] category Memory category the chunks are charged to
+ *
+ * @return the pool, or NULL on failure
+ */
+OMRMemArenaPool *
+omrmem_arena_pool_create(struct OMRPortLibrary *portLibrary, uintptr_t chunkSize, uintptr_t maxFreeChunks, uint32_t category)
+{
+	OMRMemArenaPool *pool = portLibrary->mem_allocate_memory(portLibrary, sizeof(OMRMemArenaPool), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+
+	if (NULL != pool) {
+		memset(pool, 0, sizeof(OMRMemArenaPool));
+		if (!MUTEX_INIT(pool->mutex)) {
+			portLibrary->mem_free_memory(portLibrary, pool);
+			return NULL;
+		}
+		pool->chunkSize = ARENA_ROUND_UP((0 == chunkSize) ? OMRPORT_MEM_ARENA_DEFAULT_CHUNK_SIZE : chunkSize);
+		pool->maxFreeChunks = maxFreeChunks;
+		pool->category = category;
+	}
+	return pool;
+}
+
+/**
+ * Destroy a pool, freeing the chunks it holds. Arenas using the pool must have been destroyed.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] pool The pool, may be NULL
+ */
+void
+omrmem_arena_pool_destroy(struct OMRPortLibrary *portLibrary, OMRMemArenaPool *pool)
+{
+	if (NULL != pool) {
+		OMRMemArenaChunk *chunk = pool->freeChunks;
+
+		while (NULL != chunk) {
+			OMRMemArenaChunk *next = chunk->next;
+			portLibrary->mem_free_memory(portLibrary, chunk);
+			chunk = next;
+		}
+		MUTEX_DESTROY(pool->mutex);
+		portLibrary->mem_free_memory(portLibrary, pool);
+	}
+}
+
+/**
+ * Create an arena. No chunk is allocated until the first allocation.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] chunkSize Usable bytes per chunk, or 0 for OMRPORT_MEM_ARENA_DEFAULT_CHUNK_SIZE; ignored when pool is not NULL
+ * @param[in] category Memory category the chunks are charged to; ignored when pool is not NULL
+ * @param[in] pool Pool to take chunks from and return them to, or NULL
+ *
+ * @return the arena, or NULL on failure
+ */
+OMRMemArena *
+omrmem_arena_create(struct OMRPortLibrary *portLibrary, uintptr_t chunkSize, uint32_t category, OMRMemArenaPool *pool)
+{
+	OMRMemArena *arena = portLibrary->mem_allocate_memory(portLibrary, sizeof(OMRMemArena), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+
+	if (NULL != arena) {
+		memset(arena, 0, sizeof(OMRMemArena));
+		if (NULL != pool) {
+			arena->chunkSize = pool->chunkSize;
+			arena->category = pool->category;
+			arena->pool = pool;
+		} else {
+			arena->chunkSize = ARENA_ROUND_UP((0 == chunkSize) ? OMRPORT_MEM_ARENA_DEFAULT_CHUNK_SIZE : chunkSize);
+			arena->category = category;
+		}
+	}
+	return arena;
+}
+
+/**
+ * Release an arena's memory and free the arena.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] arena The arena, may be NULL
+ */
+void
+omrmem_arena_destroy(struct OMRPortLibrary *portLibrary, OMRMemArena *arena)
+{
+	if (NULL != arena) {
+		omrmem_arena_release(portLibrary, arena);
+		portLibrary->mem_free_memory(portLibrary, arena);
+	}
+}
+
+static void *
+allocateSlow(struct OMRPortLibrary *portLibrary, OMRMemArena *arena, uintptr_t size)
+{
+	OMRMemArenaChunk *chunk = NULL;
+
+	if (size > (arena->chunkSize / LARGE_REQUEST_DIVISOR)) {
+		chunk = allocateChunk(portLibrary, size, arena->category);
+		if (NULL == chunk) {
+			return NULL;
+		}
+		chunk->next = arena->largeChunks;
+		arena->largeChunks = chunk;
+		return CHUNK_DATA(chunk);
+	}
+
+	chunk = getChunk(portLibrary, arena);
+	if (NULL == chunk) {
+		return NULL;
+	}
+	chunk->next = arena->chunks;
+	arena->chunks = chunk;
+	arena->alloc = CHUNK_DATA(chunk) + size;
+	arena->top = CHUNK_DATA(chunk) + chunk->size;
+	return CHUNK_DATA(chunk);
+}
+
+/**
+ * Allocate memory from an arena. The memory is 8-byte aligned, is not zeroed, and remains valid
+ * until the arena is rewound past it, reset, released or destroyed.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] arena The arena
+ * @param[in] byteAmount Number of bytes to allocate
+ *
+ * @return pointer to the memory, or NULL on failure
+ */
+void *
+omrmem_arena_allocate(struct OMRPortLibrary *portLibrary, OMRMemArena *arena, uintptr_t byteAmount)
+{
+	uintptr_t size = ARENA_ROUND_UP(byteAmount);
+
+	if (0 == size) {
+		if (0 != byteAmount) {
+			/* rounding overflowed */
+			return NULL;
+		}
+		size = ARENA_ALIGNMENT;
+	}
+	if (size <= (uintptr_t)(arena->top - arena->alloc)) {
+		void *result = arena->alloc;
+		arena->alloc += size;
+		return result;
+	}
+	return allocateSlow(portLibrary, arena, size);
+}
+
+/**
+ * Record the current position of an arena so that later allocations can be discarded with
+ * @ref omrmem_arena_rewind.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] arena The arena
+ * @param[out] mark The position
+ */
+void
+omrmem_arena_mark(struct OMRPortLibrary *portLibrary, OMRMemArena *arena, OMRMemArenaMark *mark)
+{
+	mark->chunk = arena->chunks;
+	mark->largeChunk = arena->largeChunks;
+	mark->alloc = arena->alloc;
+}
+
+/**
+ * Discard every allocation made since mark was taken. Marks taken after mark become invalid.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] arena The arena
+ * @param[in] mark A position previously recorded by @ref omrmem_arena_mark
+ */
+void
+omrmem_arena_rewind(struct OMRPortLibrary *portLibrary, OMRMemArena *arena, const OMRMemArenaMark *mark)
+{
+	OMRMemArenaChunk *markChunk = (OMRMemArenaChunk *)mark->chunk;
+	OMRMemArenaChunk *markLargeChunk = (OMRMemArenaChunk *)mark->largeChunk;
+
+	while (arena->largeChunks != markLargeChunk) {
+		OMRMemArenaChunk *chunk = arena->largeChunks;
+		arena->largeChunks = chunk->next;
+		portLibrary->mem_free_memory(portLibrary, chunk);
+	}
+	while (arena->chunks != markChunk) {
+		OMRMemArenaChunk *chunk = arena->chunks;
+		arena->chunks = chunk->next;
+		putChunk(portLibrary, arena, chunk);
+	}
+	if (NULL == markChunk) {
+		arena->alloc = NULL;
+		arena->top = NULL;
+	} else {
+		arena->alloc = mark->alloc;
+		arena->top = CHUNK_DATA(markChunk) + markChunk->size;
+	}
+}
+
+/**
+ * Discard every allocation, keeping one chunk so that the arena can be refilled without allocating.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] arena The arena
+ */
+void
+omrmem_arena_reset(struct OMRPortLibrary *portLibrary, OMRMemArena *arena)
+{
+	OMRMemArenaChunk *first = arena->chunks;
+
+	if (NULL != first) {
+		/* rewind to the start of the oldest chunk */
+		OMRMemArenaMark mark;
+
+		while (NULL != first->next) {
+			first = first->next;
+		}
+		mark.chunk = first;
+		mark.largeChunk = NULL;
+		mark.alloc = CHUNK_DATA(first);
+		omrmem_arena_rewind(portLibrary, arena, &mark);
+	} else {
+		omrmem_arena_release(portLibrary, arena);
+	}
+}
+
+/**
+ * Discard every allocation and give all of the arena's chunks back to its pool or to the system.
+ * The arena remains usable.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] arena The arena
+ */
+void
+omrmem_arena_release(struct OMRPortLibrary *portLibrary, OMRMemArena *arena)
+{
+	OMRMemArenaMark mark;
+
+	mark.chunk = NULL;
+	mark.largeChunk = NULL;
+	mark.alloc = NULL;
+	omrmem_arena_rewind(portLibrary, arena, &mark);
+}
+
+/**
+ * Get the calling thread's scratch arena, creating it on first use. It is charged to
+ * OMRMEM_CATEGORY_PORT_LIBRARY and destroyed with the thread's per thread buffer. Since any code on
+ * the thread may use it, callers should bracket their use with @ref omrmem_arena_mark and
+ * @ref omrmem_arena_rewind rather than resetting it.
+ *
+ * @param[in] portLibrary The port library
+ *
+ * @return the arena, or NULL on failure
+ */
+OMRMemArena *
+omrmem_arena_thread_scratch(struct OMRPortLibrary *portLibrary)
+{
+	PortlibPTBuffers_t ptBuffers = omrport_tls_get(portLibrary);
+	OMRMemArena *arena = NULL;
+
+	if (NULL != ptBuffers) {
+		arena = ptBuffers->scratchArena;
+		if (NULL == arena) {
+			arena = portLibrary->mem_arena_create(portLibrary, 0, OMRMEM_CATEGORY_PORT_LIBRARY, NULL);
+			ptBuffers->scratchArena = arena;
+		}
+	}
+	return arena;
+}
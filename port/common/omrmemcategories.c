@@ -39,9 +39,42 @@
 #include "omrport.h"
 #include "omrportpriv.h"
 #include "omrportpg.h"
+#include "omrthread.h"
 #include "omrutilbase.h"
 #include "ut_omrport.h"
 
+/*
+ * Allocations made through omrmem_allocate_memory update the category counters through a small per thread
+ * cache of deltas rather than with atomics on the shared OMRMemCategory, which becomes a contended cache line
+ * when many threads allocate under the same category. The owning thread still updates its deltas atomically,
+ * but on a line no other thread writes in the common case, so that omrmem_categories_flush_caches can fold
+ * them from any thread. Deltas are folded when a slot is reused for another category, every
+ * CATEGORY_CACHE_FLUSH_INTERVAL updates, when the thread exits, and before categories are walked or queried.
+ *
+ * The locks are omrthread monitors, which the thread library releases in the child of a fork when they were
+ * held by threads that do not exist there. A cache is kept for the next new thread when its thread exits
+ * rather than freed, since its monitor can not be destroyed from the finalizers that run after a fork.
+ * Monitors can only be entered by attached threads, so threads that are not attached read the shared
+ * counters without folding the caches first, and only see the deltas that have already been folded.
+ */
+#define CATEGORY_CACHE_SLOTS 16
+#define CATEGORY_CACHE_FLUSH_INTERVAL 1024
+
+typedef struct OMRMemCategoryCacheSlot {
+	OMRMemCategory *category;
+	volatile uintptr_t allocations; /* delta, may wrap negative */
+	volatile uintptr_t bytes; /* delta, may wrap negative */
+} OMRMemCategoryCacheSlot;
+
+typedef struct OMRMemCategoryCache {
+	struct OMRMemCategoryCache *next;
+	struct OMRPortLibrary *portLibrary;
+	omrthread_monitor_t monitor; /* held while a slot changes category or is folded */
+	BOOLEAN inUse; /* FALSE once the thread has exited; protected by categoryCacheMonitor */
+	uintptr_t updates;
+	OMRMemCategoryCacheSlot slots[CATEGORY_CACHE_SLOTS];
+} OMRMemCategoryCache;
+
 /* Templates for categories that are copied into malloc'd memory in omrmem_startup_categories */
 OMRMEM_CATEGORY_NO_CHILDREN("Unknown", OMRMEM_CATEGORY_UNKNOWN);
 
@@ -113,6 +146,304 @@ omrmem_categories_decrement_bytes(OMRMemCategory *category, uintptr_t size)
 	subtractAtomic(&category->liveBytes, size);
 }
 
+static uintptr_t
+exchangeWithZero(volatile uintptr_t *address)
+{
+	uintptr_t oldValue = *address;
+
+	while (0 != oldValue) {
+		uintptr_t observed = compareAndSwapUDATA((uintptr_t *)address, oldValue, 0);
+		if (observed == oldValue) {
+			break;
+		}
+		oldValue = observed;
+	}
+	return oldValue;
+}
+
+/* Caller must hold the cache lock */
+static void
+foldSlot(OMRMemCategoryCacheSlot *slot)
+{
+	OMRMemCategory *category = slot->category;
+
+	if (NULL != category) {
+		uintptr_t allocations = exchangeWithZero(&slot->allocations);
+		uintptr_t bytes = exchangeWithZero(&slot->bytes);
+
+		if (0 != allocations) {
+			addAtomic(&category->liveAllocations, allocations);
+		}
+		if (0 != bytes) {
+			addAtomic(&category->liveBytes, bytes);
+		}
+	}
+}
+
+static void
+foldCache(OMRMemCategoryCache *cache)
+{
+	uintptr_t i = 0;
+
+	omrthread_monitor_enter(cache->monitor);
+	for (i = 0; i < CATEGORY_CACHE_SLOTS; i++) {
+		foldSlot(&cache->slots[i]);
+	}
+	omrthread_monitor_exit(cache->monitor);
+}
+
+/* The caches can only be locked, and so folded, by threads attached to the thread library */
+static BOOLEAN
+canFoldCaches(struct OMRPortLibrary *portLibrary)
+{
+	return (0 != portLibrary->portGlobals->categoryCacheTlsKey) && (NULL != omrthread_self());
+}
+
+static void
+categoryCacheFinalizer(void *value)
+{
+	OMRMemCategoryCache *cache = (OMRMemCategoryCache *)value;
+	struct OMRPortLibrary *portLibrary = cache->portLibrary;
+
+	omrthread_monitor_enter(portLibrary->portGlobals->categoryCacheMonitor);
+	foldCache(cache);
+	cache->inUse = FALSE;
+	omrthread_monitor_exit(portLibrary->portGlobals->categoryCacheMonitor);
+}
+
+static OMRMemCategoryCache *
+getCategoryCache(struct OMRPortLibrary *portLibrary)
+{
+	omrthread_tls_key_t key = portLibrary->portGlobals->categoryCacheTlsKey;
+	OMRMemCategoryCache *cache = NULL;
+	omrthread_t self = NULL;
+
+	if (0 == key) {
+		return NULL;
+	}
+	self = omrthread_self();
+	if (NULL == self) {
+		return NULL;
+	}
+	cache = (OMRMemCategoryCache *)omrthread_tls_get(self, key);
+	if (NULL == cache) {
+		omrthread_monitor_enter(portLibrary->portGlobals->categoryCacheMonitor);
+		cache = (OMRMemCategoryCache *)portLibrary->portGlobals->categoryCacheList;
+		while ((NULL != cache) && cache->inUse) {
+			cache = cache->next;
+		}
+		if (NULL == cache) {
+			/* The cache itself is not accounted for, like portGlobals, so that creating it cannot recurse */
+			cache = (OMRMemCategoryCache *)omrmem_allocate_memory_basic(portLibrary, sizeof(OMRMemCategoryCache));
+			if (NULL != cache) {
+				memset(cache, 0, sizeof(OMRMemCategoryCache));
+				if (0 != omrthread_monitor_init_with_name(&cache->monitor, 0, "portLibrary_omrmem_category_cache_monitor")) {
+					omrmem_free_memory_basic(portLibrary, cache);
+					cache = NULL;
+				} else {
+					cache->portLibrary = portLibrary;
+					cache->next = (OMRMemCategoryCache *)portLibrary->portGlobals->categoryCacheList;
+					portLibrary->portGlobals->categoryCacheList = cache;
+				}
+			}
+		}
+		if (NULL != cache) {
+			cache->inUse = TRUE;
+			omrthread_tls_set(self, key, cache);
+		}
+		omrthread_monitor_exit(portLibrary->portGlobals->categoryCacheMonitor);
+	}
+	return cache;
+}
+
+static void
+updateCachedCounters(struct OMRPortLibrary *portLibrary, OMRMemCategory *category, uintptr_t allocations, uintptr_t bytes)
+{
+	OMRMemCategoryCache *cache = getCategoryCache(portLibrary);
+
+	if (NULL == cache) {
+		addAtomic(&category->liveAllocations, allocations);
+		addAtomic(&category->liveBytes, bytes);
+	} else {
+		OMRMemCategoryCacheSlot *slot = &cache->slots[category->categoryCode & (CATEGORY_CACHE_SLOTS - 1)];
+
+		/* Only this thread changes a slot's category, so the check needs no lock */
+		if (slot->category != category) {
+			omrthread_monitor_enter(cache->monitor);
+			foldSlot(slot);
+			slot->category = category;
+			omrthread_monitor_exit(cache->monitor);
+		}
+		addAtomic(&slot->allocations, allocations);
+		addAtomic(&slot->bytes, bytes);
+
+		cache->updates += 1;
+		if (0 == (cache->updates % CATEGORY_CACHE_FLUSH_INTERVAL)) {
+			foldCache(cache);
+		}
+	}
+}
+
+/**
+ * Increments the counters for a memory category through the calling thread's cache.
+ *
+ * Called by omrmem_allocate_memory. Falls back to @ref omrmem_categories_increment_counters
+ * semantics when the thread has no cache.
+ */
+void
+omrmem_categories_cached_increment_counters(struct OMRPortLibrary *portLibrary, OMRMemCategory *category, uintptr_t size)
+{
+	Trc_Assert_PTR_mem_categories_increment_counters_NULL_category(NULL != category);
+
+	updateCachedCounters(portLibrary, category, 1, size);
+}
+
+/**
+ * Decrements the counters for a memory category through the calling thread's cache.
+ *
+ * Called by omrmem_free_memory. The block may have been allocated by another thread, so a
+ * thread's deltas can be negative.
+ */
+void
+omrmem_categories_cached_decrement_counters(struct OMRPortLibrary *portLibrary, OMRMemCategory *category, uintptr_t size)
+{
+	Trc_Assert_PTR_mem_categories_decrement_counters_NULL_category(NULL != category);
+
+	updateCachedCounters(portLibrary, category, (uintptr_t)-1, (uintptr_t)0 - size);
+}
+
+/**
+ * Fold every thread's cached deltas into the shared category counters. Does nothing when the
+ * calling thread is not attached to the thread library.
+ *
+ * @param[in] portLibrary The port library
+ */
+void
+omrmem_categories_flush_caches(struct OMRPortLibrary *portLibrary)
+{
+	if (canFoldCaches(portLibrary)) {
+		OMRMemCategoryCache *cache = NULL;
+
+		omrthread_monitor_enter(portLibrary->portGlobals->categoryCacheMonitor);
+		cache = (OMRMemCategoryCache *)portLibrary->portGlobals->categoryCacheList;
+		while (NULL != cache) {
+			foldCache(cache);
+			cache = cache->next;
+		}
+		omrthread_monitor_exit(portLibrary->portGlobals->categoryCacheMonitor);
+	}
+}
+
+/**
+ * Query the live bytes and allocations of one memory category.
+ *
+ * Every thread's cached deltas are folded first, and both counters are read while no other
+ * fold or query can run, so the pair is consistent with respect to all updates that completed
+ * before the call. A thread that is not attached to the thread library gets the shared counters
+ * as they are, without the deltas still cached by other threads.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] categoryCode The category to query
+ * @param[out] liveBytes The category's live bytes, excluding its children
+ * @param[out] liveAllocations The category's live allocations, excluding its children
+ *
+ * @return 0 on success, OMRPORT_ERROR_INVALID_ARGUMENTS if an output pointer is NULL
+ */
+int32_t
+omrmem_get_category_counters(struct OMRPortLibrary *portLibrary, uint32_t categoryCode, uintptr_t *liveBytes, uintptr_t *liveAllocations)
+{
+	OMRMemCategory *category = NULL;
+	BOOLEAN foldCaches = FALSE;
+	OMRMemCategoryCache *cache = NULL;
+
+	if ((NULL == liveBytes) || (NULL == liveAllocations)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+
+	category = omrmem_get_category(portLibrary, categoryCode);
+	foldCaches = canFoldCaches(portLibrary);
+	if (foldCaches) {
+		omrthread_monitor_enter(portLibrary->portGlobals->categoryCacheMonitor);
+		cache = (OMRMemCategoryCache *)portLibrary->portGlobals->categoryCacheList;
+		while (NULL != cache) {
+			foldCache(cache);
+			cache = cache->next;
+		}
+	}
+	*liveBytes = category->liveBytes;
+	*liveAllocations = category->liveAllocations;
+	if (foldCaches) {
+		omrthread_monitor_exit(portLibrary->portGlobals->categoryCacheMonitor);
+	}
+	return 0;
+}
+
+/**
+ * Create the per thread category caches. Called from omrmem_startup once the categories exist.
+ *
+ * @param[in] portLibrary The port library
+ *
+ * @return 0 on success, negative error code if the counters will be updated directly instead
+ */
+int32_t
+omrmem_startup_category_caches(struct OMRPortLibrary *portLibrary)
+{
+	omrthread_tls_key_t key = 0;
+
+	portLibrary->portGlobals->categoryCacheList = NULL;
+	if (0 != omrthread_monitor_init_with_name(&portLibrary->portGlobals->categoryCacheMonitor, 0, "portLibrary_omrmem_category_caches_monitor")) {
+		return OMRPORT_ERROR_STARTUP_MEM;
+	}
+	if (0 != omrthread_tls_alloc_with_finalizer(&key, categoryCacheFinalizer)) {
+		omrthread_monitor_destroy(portLibrary->portGlobals->categoryCacheMonitor);
+		return OMRPORT_ERROR_STARTUP_MEM;
+	}
+	portLibrary->portGlobals->categoryCacheTlsKey = key;
+	return 0;
+}
+
+/**
+ * Fold and free every per thread category cache. Later updates go directly to the categories.
+ *
+ * The calling thread is attached to the thread library for the duration, as the monitors can
+ * not be entered or destroyed otherwise.
+ *
+ * @param[in] portLibrary The port library
+ */
+void
+omrmem_shutdown_category_caches(struct OMRPortLibrary *portLibrary)
+{
+	omrthread_tls_key_t key = portLibrary->portGlobals->categoryCacheTlsKey;
+
+	if (0 != key) {
+		OMRMemCategoryCache *cache = NULL;
+		omrthread_t attachedThread = NULL;
+
+		/* Stop new caches being created, and detach the existing ones from their threads */
+		portLibrary->portGlobals->categoryCacheTlsKey = 0;
+		omrthread_tls_free(key);
+
+		if (0 != omrthread_attach_ex(&attachedThread, J9THREAD_ATTR_DEFAULT)) {
+			/* the caches are leaked rather than freed without their locks */
+			return;
+		}
+
+		omrthread_monitor_enter(portLibrary->portGlobals->categoryCacheMonitor);
+		cache = (OMRMemCategoryCache *)portLibrary->portGlobals->categoryCacheList;
+		while (NULL != cache) {
+			OMRMemCategoryCache *next = cache->next;
+			foldCache(cache);
+			omrthread_monitor_destroy(cache->monitor);
+			omrmem_free_memory_basic(portLibrary, cache);
+			cache = next;
+		}
+		portLibrary->portGlobals->categoryCacheList = NULL;
+		omrthread_monitor_exit(portLibrary->portGlobals->categoryCacheMonitor);
+		omrthread_monitor_destroy(portLibrary->portGlobals->categoryCacheMonitor);
+		omrthread_detach(attachedThread);
+	}
+}
+
 /**
  * Returns a reference to the OMRMemCategory structure represented by categoryCode.
  *
@@ -208,6 +539,8 @@ _recursive_category_walk_root(struct OMRPortLibrary *portLibrary, OMRMemCategory
 void
 omrmem_walk_categories(struct OMRPortLibrary *portLibrary, OMRMemCategoryWalkState *state)
 {
+	omrmem_categories_flush_caches(portLibrary);
+
 	/* User supplied categories are expected to include PORT_LIBRARY and UNKNOWN as part of their tree */
 	if (portLibrary->portGlobals->control.language_memory_categories.categories != NULL) {
 		_recursive_category_walk_root(portLibrary, state, portLibrary->portGlobals->control.language_memory_categories.categories[0]);
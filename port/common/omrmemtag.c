@@ -95,7 +95,7 @@ wrapBlockAndSetTags(struct OMRPortLibrary *portLibrary, void *memoryPointer, uin
 	}
 
 	category = omrmem_get_category(portLibrary, categoryCode);
-	omrmem_categories_increment_counters(category, ROUNDED_BYTE_AMOUNT(byteAmount));
+	omrmem_categories_cached_increment_counters(portLibrary, category, ROUNDED_BYTE_AMOUNT(byteAmount));
 
 	/* Fill in the tags */
 	headerTag->allocSize = byteAmount;
@@ -131,7 +131,7 @@ unwrapBlockAndCheckTags(struct OMRPortLibrary *portLibrary, void *memoryPointer)
 		&& (checkTagSumCheck(footerTag, J9MEMTAG_EYECATCHER_ALLOC_FOOTER) == 0)
 		&& (checkPadding(headerTag) == 0)) {
 
-		omrmem_categories_decrement_counters(headerTag->category, ROUNDED_BYTE_AMOUNT(headerTag->allocSize));
+		omrmem_categories_cached_decrement_counters(portLibrary, headerTag->category, ROUNDED_BYTE_AMOUNT(headerTag->allocSize));
 
 		/* Optimized freed header sumCheck setting */
 		headerTag->eyeCatcher = J9MEMTAG_EYECATCHER_FREED_HEADER;
@@ -335,6 +335,7 @@ omrmem_reallocate_memory(struct OMRPortLibrary *portLibrary, void *memoryPointer
 void
 omrmem_shutdown(struct OMRPortLibrary *portLibrary)
 {
+	omrmem_shutdown_category_caches(portLibrary);
 	omrmem_shutdown_categories(portLibrary);
 
 #if defined(OMR_ENV_DATA64)
@@ -396,6 +397,9 @@ omrmem_startup(struct OMRPortLibrary *portLibrary, uintptr_t portGlobalSize)
 	}
 #endif /* OMR_ENV_DATA64 */
 
+	/* Without per thread caches the counters are updated directly, so a failure here is not fatal */
+	omrmem_startup_category_caches(portLibrary);
+
 	return 0;
 }
 
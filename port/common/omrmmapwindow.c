@@ -0,0 +1,186 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Port
+ * @brief Memory map windows
+ *
+ * A window maps a bounded part of a file at a time, so that files larger than the address
+ * space a caller can spare are read through omrmmap_map_file. The window moves when the
+ * caller asks for bytes outside of it. Windows opened with OMRPORT_MMAP_FLAG_ADVISE_SEQUENTIAL
+ * also map the window that follows and ask for it to be read in the background, so that a
+ * caller reading through the file finds the data cached when it gets there.
+ */
+
+#include "omrport.h"
+#include "omrportpriv.h"
+#include "ut_omrport.h"
+
+struct J9MmapWindow {
+	intptr_t file;
+	uint64_t fileLength;
+	uintptr_t windowSize;
+	uint32_t flags;
+	uint32_t category;
+	/* file offset of the start of the current mapping */
+	uint64_t mappedOffset;
+	J9MmapHandle *handle;
+};
+
+/**
+ * Open a window over a file. Nothing is mapped until @ref omrmmap_window_map is called.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] file The file to map, open for reading. It must stay open until the window is closed.
+ * @param[in] windowSize The number of bytes to map at a time, rounded up to a multiple of OMRPORT_MMAP_WINDOW_ALIGNMENT.
+ * @param[in] flags The flags to map the file with, see @ref omrmmap.c::omrmmap_map_file "omrmmap_map_file".
+ * @param[in] category Memory allocation category code
+ *
+ * @return the window, or NULL on failure with the error reported through the port library
+ */
+J9MmapWindow *
+omrmmap_window_open(struct OMRPortLibrary *portLibrary, intptr_t file, uintptr_t windowSize, uint32_t flags, uint32_t category)
+{
+	J9MmapWindow *window = NULL;
+	int64_t fileLength = 0;
+
+	if (OMR_ARE_NO_BITS_SET(portLibrary->mmap_capabilities(portLibrary), OMRPORT_MMAP_CAPABILITY_READ)) {
+		/* omrmmap_map_file would read the whole file into memory whatever part was asked for */
+		portLibrary->error_set_last_error(portLibrary, -1, OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM);
+		return NULL;
+	}
+	if (OMR_ARE_ANY_BITS_SET(flags, OMRPORT_MMAP_FLAG_CREATE_FILE)) {
+		portLibrary->error_set_last_error(portLibrary, -1, OMRPORT_ERROR_MMAP_MAP_FILE_INVALIDFLAGS);
+		return NULL;
+	}
+
+	fileLength = portLibrary->file_flength(portLibrary, file);
+	if (fileLength < 0) {
+		portLibrary->error_set_last_error(portLibrary, -1, OMRPORT_ERROR_MMAP_MAP_FILE_STATFAILED);
+		return NULL;
+	}
+
+	window = (J9MmapWindow *)portLibrary->mem_allocate_memory(portLibrary, sizeof(J9MmapWindow), OMR_GET_CALLSITE(), category);
+	if (NULL == window) {
+		portLibrary->error_set_last_error(portLibrary, -1, OMRPORT_ERROR_MMAP_MAP_FILE_MALLOCFAILED);
+		return NULL;
+	}
+	window->file = file;
+	window->fileLength = (uint64_t)fileLength;
+	window->windowSize = ROUND_UP_TO_POWEROF2(OMR_MAX(windowSize, OMRPORT_MMAP_WINDOW_ALIGNMENT), OMRPORT_MMAP_WINDOW_ALIGNMENT);
+	window->flags = flags;
+	window->category = category;
+	window->mappedOffset = 0;
+	window->handle = NULL;
+
+	Trc_PRT_mmap_window_open(window, file, window->fileLength, window->windowSize, flags);
+	return window;
+}
+
+/**
+ * Obtain a pointer to the mapped file data at offset, moving the window if it does not
+ * already cover the bytes asked for. Pointers previously returned for the window are not
+ * valid once it moves.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] window The window
+ * @param[in] offset The file offset of the data
+ * @param[in,out] length On entry, the number of bytes the caller needs mapped from offset, or 0 for any.
+ * The window is widened if necessary. On return, the number of bytes mapped from offset, which is less
+ * than asked for only at the end of the file.
+ *
+ * @return a pointer to the data at offset, or NULL if offset is beyond the end of the file or the file
+ * could not be mapped
+ */
+void *
+omrmmap_window_map(struct OMRPortLibrary *portLibrary, J9MmapWindow *window, uint64_t offset, uintptr_t *length)
+{
+	uint64_t required = OMR_MAX(*length, (uintptr_t)1);
+	J9MmapHandle *handle = window->handle;
+
+	if (offset >= window->fileLength) {
+		*length = 0;
+		return NULL;
+	}
+	required = OMR_MIN(required, window->fileLength - offset);
+
+	if ((NULL == handle) || (offset < window->mappedOffset) || ((offset + required) > (window->mappedOffset + handle->size))) {
+		/* ROUND_*_TO_POWEROF2 mask with a uintptr_t, which would truncate file offsets on 32 bit platforms */
+		const uint64_t alignmentMask = (uint64_t)OMRPORT_MMAP_WINDOW_ALIGNMENT - 1;
+		uint64_t mappedOffset = offset & ~alignmentMask;
+		uint64_t mappedSize = window->windowSize;
+
+		if (OMR_ARE_ANY_BITS_SET(window->flags, OMRPORT_MMAP_FLAG_ADVISE_SEQUENTIAL)) {
+			/* map the next window as well, to be read ahead */
+			mappedSize += window->windowSize;
+		}
+		mappedSize = OMR_MAX(mappedSize, (offset + required - mappedOffset + alignmentMask) & ~alignmentMask);
+		mappedSize = OMR_MIN(mappedSize, window->fileLength - mappedOffset);
+#if !defined(OMR_ENV_DATA64)
+		if (mappedSize > (uint64_t)UINTPTR_MAX) {
+			portLibrary->error_set_last_error(portLibrary, -1, OMRPORT_ERROR_MMAP_MAP_FILE_MAPPINGFAILED);
+			*length = 0;
+			return NULL;
+		}
+#endif /* !defined(OMR_ENV_DATA64) */
+
+		Trc_PRT_mmap_window_remap(window, offset, (uintptr_t)mappedSize, mappedOffset);
+		if (NULL != handle) {
+			portLibrary->mmap_unmap_file(portLibrary, handle);
+			window->handle = NULL;
+		}
+		handle = portLibrary->mmap_map_file(portLibrary, window->file, mappedOffset, (uintptr_t)mappedSize, NULL, window->flags, window->category);
+		if (NULL == handle) {
+			*length = 0;
+			return NULL;
+		}
+		window->handle = handle;
+		window->mappedOffset = mappedOffset;
+
+		if (OMR_ARE_ANY_BITS_SET(window->flags, OMRPORT_MMAP_FLAG_ADVISE_SEQUENTIAL) && (handle->size > window->windowSize)) {
+			portLibrary->mmap_advise(portLibrary, (uint8_t *)handle->pointer + window->windowSize,
+					handle->size - window->windowSize, OMRPORT_MMAP_FLAG_ADVISE_WILLNEED);
+		}
+	}
+
+	*length = (uintptr_t)(window->mappedOffset + handle->size - offset);
+	return (uint8_t *)handle->pointer + (offset - window->mappedOffset);
+}
+
+/**
+ * Unmap a window and free it. The file is not closed.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] window The window to close, may be NULL
+ */
+void
+omrmmap_window_close(struct OMRPortLibrary *portLibrary, J9MmapWindow *window)
+{
+	if (NULL != window) {
+		Trc_PRT_mmap_window_close(window);
+		if (NULL != window->handle) {
+			portLibrary->mmap_unmap_file(portLibrary, window->handle);
+		}
+		portLibrary->mem_free_memory(portLibrary, window);
+	}
+}
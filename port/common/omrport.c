@@ -401,6 +401,41 @@ static OMRPortLibrary MainPortLibraryTable = {
 	omrsock_getsockopt_int, /* sock_getsockopt_int */
 	omrsock_getsockopt_linger, /* sock_getsockopt_linger */
 	omrsock_getsockopt_timeval, /* sock_getsockopt_timeval */
+	omrmem_arena_pool_create, /* mem_arena_pool_create */
+	omrmem_arena_pool_destroy, /* mem_arena_pool_destroy */
+	omrmem_arena_create, /* mem_arena_create */
+	omrmem_arena_destroy, /* mem_arena_destroy */
+	omrmem_arena_allocate, /* mem_arena_allocate */
+	omrmem_arena_mark, /* mem_arena_mark */
+	omrmem_arena_rewind, /* mem_arena_rewind */
+	omrmem_arena_reset, /* mem_arena_reset */
+	omrmem_arena_release, /* mem_arena_release */
+	omrmem_arena_thread_scratch, /* mem_arena_thread_scratch */
+	omrmem_get_category_counters, /* mem_get_category_counters */
+	omrfile_aio_create, /* file_aio_create */
+	omrfile_aio_destroy, /* file_aio_destroy */
+	omrfile_aio_register_buffers, /* file_aio_register_buffers */
+	omrfile_aio_submit, /* file_aio_submit */
+	omrfile_aio_reap, /* file_aio_reap */
+	omrfile_aio_get_event_fd, /* file_aio_get_event_fd */
+	omrfile_aio_backend, /* file_aio_backend */
+	omrmmap_advise, /* mmap_advise */
+	omrmmap_window_open, /* mmap_window_open */
+	omrmmap_window_map, /* mmap_window_map */
+	omrmmap_window_close, /* mmap_window_close */
+	omrsock_eventloop_create, /* sock_eventloop_create */
+	omrsock_eventloop_add, /* sock_eventloop_add */
+	omrsock_eventloop_modify, /* sock_eventloop_modify */
+	omrsock_eventloop_remove, /* sock_eventloop_remove */
+	omrsock_eventloop_wait, /* sock_eventloop_wait */
+	omrsock_eventloop_wakeup, /* sock_eventloop_wakeup */
+	omrsock_eventloop_destroy, /* sock_eventloop_destroy */
+	omrsock_sendmmsg, /* sock_sendmmsg */
+	omrsock_recvmmsg, /* sock_recvmmsg */
+	omrsock_zerocopy_complete, /* sock_zerocopy_complete */
+	omrtime_fast_ticks, /* time_fast_ticks */
+	omrtime_fast_ticks_frequency, /* time_fast_ticks_frequency */
+	omrtime_fast_ticks_delta, /* time_fast_ticks_delta */
 #if defined(OMR_OPT_CUDA)
 	NULL, /* cuda_configData */
 	omrcuda_startup, /* cuda_startup */
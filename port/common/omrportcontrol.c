@@ -200,6 +200,8 @@ omrport_control(struct OMRPortLibrary *portLibrary, const char *key, uintptr_t v
 	if (!strcmp(OMRPORT_CTLDATA_MEM_CATEGORIES_SET, key)) {
 		J9PortControlData *portControl = &portLibrary->portGlobals->control;
 		OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+		/* Fold per thread deltas into the categories they were charged to before the tables change */
+		omrmem_categories_flush_caches(portLibrary);
 		/* Allow categories to be reset to NULL (for testing purposes) - but not reset to anything else */
 		if (0 == value) {
 			omrmem_shutdown_categories(portLibrary);
@@ -344,5 +346,10 @@ omrport_control(struct OMRPortLibrary *portLibrary, const char *key, uintptr_t v
 	}
 #endif /* defined(PPG_mem32BitFlags) */
 
+	if (0 == strcmp(OMRPORT_CTLDATA_TIME_FAST_TICKS, key)) {
+		Assert_PRT_true((0 == value) || (1 == value));
+		return omrtime_fast_ticks_use_counter(portLibrary, (BOOLEAN)value);
+	}
+
 	return 1;
 }
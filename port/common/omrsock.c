@@ -847,3 +847,196 @@ omrsock_getsockopt_timeval(struct OMRPortLibrary *portLibrary, omrsock_socket_t
 {
 	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
 }
+
+/**
+ * Create an event loop, which reports the readiness of the sockets added to it without
+ * needing a thread per socket. Event loops are backed by epoll.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[out] loop The new event loop.
+ *
+ * @return 0, if no errors occurred, otherwise return an error.
+ */
+int32_t
+omrsock_eventloop_create(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t *loop)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Watch a socket with an event loop.
+ *
+ * Edge triggered sockets are reported once each time they become ready, so the socket
+ * should be non-blocking and read or written until it returns OMRPORT_ERROR_SOCKET_WOULDBLOCK
+ * before waiting again. One shot sockets are not reported again until they are re-armed
+ * with @ref omrsock_eventloop_modify, which lets several threads wait on one loop without
+ * two of them handling the same socket.
+ *
+ * @ref omrsock_eventloop_add, @ref omrsock_eventloop_modify and @ref omrsock_eventloop_remove
+ * must not be called concurrently for the same loop, though they may be called while other
+ * threads wait on it.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] loop The event loop.
+ * @param[in] sock The socket to watch. It must be removed from the loop before it is closed.
+ * @param[in] events The OMRSOCK_POLLIN and OMRSOCK_POLLOUT conditions to watch for, with
+ * OMRSOCK_EVENT_EDGE_TRIGGERED and OMRSOCK_EVENT_ONESHOT. OMRSOCK_POLLERR and OMRSOCK_POLLHUP
+ * are always reported.
+ * @param[in] userData Data reported with the socket's events.
+ *
+ * @return 0, if no errors occurred, otherwise return an error.
+ */
+int32_t
+omrsock_eventloop_add(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock, uint32_t events, void *userData)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Change the conditions an event loop watches a socket for, and re-arm a one shot socket.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] loop The event loop.
+ * @param[in] sock A socket added to loop.
+ * @param[in] events The conditions to watch for, see @ref omrsock_eventloop_add.
+ * @param[in] userData Data reported with the socket's events.
+ *
+ * @return 0, if no errors occurred, otherwise return an error.
+ */
+int32_t
+omrsock_eventloop_modify(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock, uint32_t events, void *userData)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Stop watching a socket with an event loop.
+ *
+ * Events for the socket that another thread has already been given by
+ * @ref omrsock_eventloop_wait still refer to it. The loop keeps what it needs to report
+ * those events until every thread that was waiting on it when the socket was removed has
+ * returned, or until it is destroyed, and frees it in a later call to add or remove.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] loop The event loop.
+ * @param[in] sock A socket added to loop.
+ *
+ * @return 0, if no errors occurred, otherwise return an error.
+ */
+int32_t
+omrsock_eventloop_remove(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Wait for sockets watched by an event loop to become ready.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] loop The event loop.
+ * @param[out] events The array to fill in with the ready sockets.
+ * @param[in] maxEvents The number of elements in events.
+ * @param[in] timeoutMs The maximum number of milliseconds to wait, or -1 to wait until a
+ * socket is ready or @ref omrsock_eventloop_wakeup is called.
+ *
+ * @return the number of events filled in, which is 0 on timeout or wakeup, otherwise
+ * return an error.
+ */
+int32_t
+omrsock_eventloop_wait(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_event_t events, uint32_t maxEvents, int32_t timeoutMs)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Make the threads waiting in @ref omrsock_eventloop_wait return, or the next call return
+ * immediately if no thread is waiting. Used to stop a thread that runs an event loop.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] loop The event loop.
+ *
+ * @return 0, if no errors occurred, otherwise return an error.
+ */
+int32_t
+omrsock_eventloop_wakeup(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Destroy an event loop. Sockets still added to the loop are not closed.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in,out] loop The event loop, set to NULL.
+ *
+ * @return 0, if no errors occurred, otherwise return an error.
+ */
+int32_t
+omrsock_eventloop_destroy(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t *loop)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Send several messages on a socket with one system call where the OS supports it.
+ *
+ * With OMRSOCK_MSG_ZEROCOPY the data is sent from the buffers without copying it, if
+ * OMRSOCK_SO_ZEROCOPY was set on the socket. The buffers must then not be changed until
+ * @ref omrsock_zerocopy_complete reports their messages complete. The flag is ignored
+ * where the OS cannot send without copying.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] sock The socket to send on.
+ * @param[in,out] msgs The messages to send. The length of each message sent is filled in,
+ * and is less than its nbyte if a stream socket's send buffer filled up.
+ * @param[in] count The number of messages.
+ * @param[in] flags OMRSOCK_MSG_DONTWAIT and OMRSOCK_MSG_ZEROCOPY.
+ *
+ * @return the number of messages sent, otherwise return an error.
+ */
+int32_t
+omrsock_sendmmsg(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, omrsock_msg_t msgs, uint32_t count, int32_t flags)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Receive several messages from a socket with one system call where the OS supports it.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] sock The socket to receive from.
+ * @param[in,out] msgs The buffers to receive the messages in. The length of each message
+ * received is filled in, as is the sender's address if addr is not NULL.
+ * @param[in] count The number of messages.
+ * @param[in] flags OMRSOCK_MSG_DONTWAIT, and OMRSOCK_MSG_WAITFORONE to wait only for the
+ * first message.
+ *
+ * @return the number of messages received, otherwise return an error.
+ */
+int32_t
+omrsock_recvmmsg(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, omrsock_msg_t msgs, uint32_t count, int32_t flags)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Get the next completion of zero-copy sends on a socket. Each successful send of a message
+ * with OMRSOCK_MSG_ZEROCOPY is numbered, starting at 0, and the buffers of the messages
+ * numbered first to last may be reused once this returns. Sockets with pending completions
+ * are reported with OMRSOCK_POLLERR by @ref omrsock_eventloop_wait and @ref omrsock_poll.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] sock The socket the messages were sent on.
+ * @param[out] first The number of the first completed send.
+ * @param[out] last The number of the last completed send.
+ * @param[out] copied Set to TRUE if the OS copied the data after all, as it does for
+ * loopback connections, in which case zero-copy sends are slower than copying.
+ *
+ * @return 0, if a completion was reported, OMRPORT_ERROR_SOCKET_WOULDBLOCK if no sends have
+ * completed, otherwise return an error.
+ */
+int32_t
+omrsock_zerocopy_complete(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, uint32_t *first, uint32_t *last, BOOLEAN *copied)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
@@ -2517,35 +2517,16 @@ convertWideToMutf8(const uint8_t **inBuffer, uintptr_t *inBufferSize, uint8_t *o
 
 	Assert_PRT_true(0 == (wideRemaining % 2));
 	if (0 == outBufferSize) { /* we just want the length */
-		while (wideRemaining > 0) {
-			uint32_t encodeResult = 0;
-			uint16_t wideChar = *((uint16_t *) wideCursor);
-			encodeResult = encodeUTF8CharN(wideChar, NULL, 3); /* convert one wide character, get the length, ignore the converted result */
-			if (0 == encodeResult) {
-				return OMRPORT_ERROR_STRING_ILLEGAL_STRING;
-			}
-			resultSize += encodeResult;
-			wideCursor += 2;
-			wideRemaining -= 2;
-		}
+		resultSize = (int32_t)encodedUTF8Length((const uint16_t *) wideCursor, wideRemaining / 2);
+		wideCursor += wideRemaining;
+		wideRemaining = 0;
 	} else {
-		uintptr_t outputLimit = outBufferSize;
-		uint8_t *outputCursor = outBuffer;
-		while ((wideRemaining > 0) && (outputLimit > 0)) {
-			uint16_t wideChar = *((uint16_t *) wideCursor);
-			uint32_t encodeResult = encodeUTF8CharN(wideChar, outputCursor, 3);
-			if (0 == encodeResult) {
-				return OMRPORT_ERROR_STRING_ILLEGAL_STRING;
-			}
-			resultSize += encodeResult;
-			outputLimit -= encodeResult;
-			outputCursor += encodeResult;
-			wideCursor += 2;
-			wideRemaining -= 2;
-		}
-		if (outputLimit > 0) {
-			*outputCursor = '\0'; /* null terminate if possible */
-		}
+		/* stops before a character which does not fit in the output buffer */
+		const uint16_t *wideCharCursor = (const uint16_t *) wideCursor;
+		uintptr_t wideCharsRemaining = wideRemaining / 2;
+		resultSize = (int32_t)encodeUTF8String(&wideCharCursor, &wideCharsRemaining, outBuffer, outBufferSize);
+		wideCursor = (const uint8_t *) wideCharCursor;
+		wideRemaining = wideCharsRemaining * 2;
 	}
 	*inBufferSize = wideRemaining; /* update caller's arguments */
 	*inBuffer = (uint8_t *) wideCursor;
@@ -2735,6 +2716,19 @@ convertUtf8ToMutf8(struct OMRPortLibrary *portLibrary, const uint8_t **inBuffer,
 	while ((utf8BufferSize > 0) && (lengthOnly || (mutf8BufferSize > 0))) {
 		int32_t consumed = 0;
 		int32_t produced = 0;
+		if ((utf8Buffer[0] > 0) && (utf8Buffer[0] < 0x80)) { /* run of single byte UTF-8, which is the same in modified UTF-8 */
+			uintptr_t asciiLimit = (lengthOnly || (utf8BufferSize < mutf8BufferSize)) ? utf8BufferSize : mutf8BufferSize;
+			uintptr_t asciiLength = scanUTF8ASCII(utf8Buffer, asciiLimit);
+			if (!lengthOnly) {
+				memcpy(mutf8Buffer, utf8Buffer, asciiLength);
+				mutf8Buffer += asciiLength;
+				mutf8BufferSize -= asciiLength;
+			}
+			utf8Buffer += asciiLength;
+			utf8BufferSize -= asciiLength;
+			producedTotal += (int32_t)asciiLength;
+			continue;
+		}
 		if ((0 == utf8Buffer[0]) && (lengthOnly || (mutf8BufferSize > 1))) { /* null - convert to double-byte form */
 			if (!lengthOnly) {
 				mutf8Buffer[0] = 0xc0;
@@ -2824,33 +2818,19 @@ convertMutf8ToWide(const uint8_t **inBuffer, uintptr_t *inBufferSize, uint8_t *o
 	const uint8_t *mutf8Cursor = *inBuffer;
 	int32_t resultSize = 0;
 	if (0 == outBufferSize) { /* we just want the length */
-		uint16_t temp = 0;
-		while (mutf8Remaining > 0) {
-			uint32_t bytesConsumed = decodeUTF8CharN(mutf8Cursor, &temp, mutf8Remaining);
-			if (0 == bytesConsumed) {
-				return OMRPORT_ERROR_STRING_ILLEGAL_STRING;
-			}
-			mutf8Cursor += bytesConsumed;
-			mutf8Remaining -= bytesConsumed;
-			resultSize += 2;
-		} /* while */
+		intptr_t wideChars = validateUTF8String(mutf8Cursor, mutf8Remaining);
+		if (wideChars < 0) {
+			return OMRPORT_ERROR_STRING_ILLEGAL_STRING;
+		}
+		mutf8Cursor += mutf8Remaining;
+		mutf8Remaining = 0;
+		resultSize = (int32_t)(wideChars * 2);
 	} else {
-		uint16_t *wideBufferCursor = (uint16_t *)outBuffer;
-		uintptr_t wideBufferLimit = outBufferSize; /* size in bytes */
-		while ((wideBufferLimit > 0) && (mutf8Remaining > 0)) {
-			uint32_t bytesConsumed = decodeUTF8CharN(mutf8Cursor, wideBufferCursor, mutf8Remaining);
-			if (0 == bytesConsumed) {
-				return OMRPORT_ERROR_STRING_ILLEGAL_STRING;
-			}
-			mutf8Remaining -= bytesConsumed;
-			mutf8Cursor += bytesConsumed;
-			wideBufferCursor += 1;
-			wideBufferLimit -= 2;
-			resultSize += 2;
-		} /* while */
-		if (wideBufferLimit > 1) {
-			*wideBufferCursor = 0; /* null terminate if possible */
+		intptr_t wideChars = decodeUTF8String(&mutf8Cursor, &mutf8Remaining, (uint16_t *)outBuffer, outBufferSize / 2);
+		if (wideChars < 0) {
+			return OMRPORT_ERROR_STRING_ILLEGAL_STRING;
 		}
+		resultSize = (int32_t)(wideChars * 2);
 	} /* if */
 	*inBuffer = mutf8Cursor; /* update caller's arguments */
 	*inBufferSize = mutf8Remaining;
@@ -0,0 +1,107 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup Port
+ * @brief Fast timestamps
+ *
+ * Fast ticks are timestamps for instrumentation that takes them at a high rate, such as
+ * trace points and per-phase timings. Where the platform has a CPU counter that runs at a
+ * constant rate and is synchronized across CPUs, omrport_control(OMRPORT_CTLDATA_TIME_FAST_TICKS, 1)
+ * switches them to read the counter directly. Otherwise, and until then, they are
+ * omrtime_hires_clock values.
+ */
+
+#include "omrport.h"
+#include "omrportpriv.h"
+#include "ut_omrport.h"
+
+/**
+ * Retrieve a timestamp, in units of @ref omrtime_fast_ticks_frequency ticks per second.
+ *
+ * The value is only meaningful relative to other fast ticks taken in the same process.
+ * It is not ordered with respect to the surrounding memory accesses.
+ *
+ * @param[in] portLibrary The port library.
+ *
+ * @return the current tick count
+ */
+uint64_t
+omrtime_fast_ticks(struct OMRPortLibrary *portLibrary)
+{
+	return portLibrary->time_hires_clock(portLibrary);
+}
+
+/**
+ * Retrieve the rate at which @ref omrtime_fast_ticks advances.
+ *
+ * @param[in] portLibrary The port library.
+ *
+ * @return the number of ticks per second
+ */
+uint64_t
+omrtime_fast_ticks_frequency(struct OMRPortLibrary *portLibrary)
+{
+	return portLibrary->time_hires_frequency(portLibrary);
+}
+
+/**
+ * Calculate the time elapsed between two @ref omrtime_fast_ticks values.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] startTicks Ticks at the start of the interval
+ * @param[in] endTicks Ticks at the end of the interval
+ * @param[in] requiredResolution Resolution of the result as a fraction of a second, see
+ * @ref omrtime.c::omrtime_hires_delta "omrtime_hires_delta".
+ *
+ * @return the elapsed time
+ */
+uint64_t
+omrtime_fast_ticks_delta(struct OMRPortLibrary *portLibrary, uint64_t startTicks, uint64_t endTicks, uint64_t requiredResolution)
+{
+	return portLibrary->time_hires_delta(portLibrary, startTicks, endTicks, requiredResolution);
+}
+
+/**
+ * Select what @ref omrtime_fast_ticks reads. The counter is only used if it runs at a constant
+ * rate and is consistent across the CPUs the process may run on. The ticks of the two sources
+ * cannot be compared, so the source can only be changed until @ref omrtime_fast_ticks first
+ * returns; after that a request for the other source fails. The source should be selected
+ * during startup, before other threads can take fast ticks.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] useCounter TRUE to read the CPU counter, FALSE to use omrtime_hires_clock.
+ *
+ * @return 0 if the requested source is in use, 1 if the counter cannot be used or fast ticks
+ * have already been taken from the other source
+ */
+int32_t
+omrtime_fast_ticks_use_counter(struct OMRPortLibrary *portLibrary, BOOLEAN useCounter)
+{
+	if (useCounter) {
+		Trc_PRT_time_fast_ticks_counter_unusable("not supported on this platform");
+		return 1;
+	}
+	return 0;
+}
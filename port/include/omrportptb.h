@@ -62,6 +62,8 @@ typedef struct PortlibPTBuffers_struct {
 	int32_t reportedErrorCode; /**< last reported error code */
 	char *reportedMessageBuffer; /**< last reported error message, either customized or from OS */
 	uintptr_t reportedMessageBufferSize; /**< reported message buffer size */
+
+	struct OMRMemArena *scratchArena; /**< per thread scratch arena, created on first use */
 } PortlibPTBuffers_struct;
 
 /**
@@ -0,0 +1,333 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup Port
+ * @brief Fast timestamps
+ *
+ * On x86, fast ticks can read the time stamp counter if the processor reports it invariant and
+ * the kernel uses it as its clock source. Its frequency is calibrated against CLOCK_MONOTONIC_RAW.
+ * On AArch64 they can read the virtual count of the generic timer, whose frequency is architected.
+ * Either counter is checked to be consistent across the CPUs the process may run on before it is used.
+ *
+ * See port/common/omrtimeticks.c for the descriptions of the functions.
+ */
+
+#if defined(LINUX) && !defined(OMRZTPF)
+/* _GNU_SOURCE is required for sched_setaffinity */
+#define _GNU_SOURCE
+#endif /* defined(LINUX) && !defined(OMRZTPF) */
+
+#include <sched.h>
+#include <string.h>
+#include <time.h>
+
+#include "omrport.h"
+#include "omrportpriv.h"
+#include "ut_omrport.h"
+
+#if !defined(OMRZTPF) && (defined(J9X86) || defined(J9HAMMER) || defined(OMR_ARCH_AARCH64))
+#define OMRTIME_FAST_TICKS_COUNTER
+#endif /* !defined(OMRZTPF) && (defined(J9X86) || defined(J9HAMMER) || defined(OMR_ARCH_AARCH64)) */
+
+#if defined(OMRTIME_FAST_TICKS_COUNTER)
+#if defined(J9X86) || defined(J9HAMMER)
+#include "omrsysinfo_helpers.h"
+
+#define CPUID_MAXIMUM_EXTENDED_FUNCTION 0x80000000
+#define CPUID_ADVANCED_POWER_MANAGEMENT 0x80000007
+#define CPUID_INVARIANT_TSC 0x100
+#define OMRTIME_COUNTER_CLOCKSOURCE "tsc"
+#else /* defined(J9X86) || defined(J9HAMMER) */
+#define OMRTIME_COUNTER_CLOCKSOURCE "arch_sys_counter"
+#endif /* defined(J9X86) || defined(J9HAMMER) */
+
+#define OMRTIME_CLOCKSOURCE_FILE "/sys/devices/system/clocksource/clocksource0/current_clocksource"
+/* how long the time stamp counter is timed for to calibrate it */
+#define OMRTIME_CALIBRATION_NANOS 20000000
+/* a counter sample is retried if reading the clock around it took longer than this */
+#define OMRTIME_SAMPLE_WINDOW_NANOS J9CONST_U64(2000)
+#define OMRTIME_SAMPLE_ATTEMPTS 10
+
+static uint64_t
+readCounter(void)
+{
+#if defined(J9X86) || defined(J9HAMMER)
+	uint32_t low = 0;
+	uint32_t high = 0;
+
+	__asm__ __volatile__("rdtsc" : "=a" (low), "=d" (high));
+	return ((uint64_t)high << 32) | low;
+#else /* defined(J9X86) || defined(J9HAMMER) */
+	uint64_t count = 0;
+
+	__asm__ __volatile__("mrs %0, cntvct_el0" : "=r" (count));
+	return count;
+#endif /* defined(J9X86) || defined(J9HAMMER) */
+}
+
+static BOOLEAN
+counterIsInvariant(void)
+{
+#if defined(J9X86) || defined(J9HAMMER)
+	uint32_t cpuInfo[4] = {0};
+
+	omrsysinfo_get_x86_cpuid(CPUID_MAXIMUM_EXTENDED_FUNCTION, cpuInfo);
+	if (cpuInfo[0] < CPUID_ADVANCED_POWER_MANAGEMENT) {
+		return FALSE;
+	}
+	omrsysinfo_get_x86_cpuid(CPUID_ADVANCED_POWER_MANAGEMENT, cpuInfo);
+	return OMR_ARE_ALL_BITS_SET(cpuInfo[3], CPUID_INVARIANT_TSC);
+#else /* defined(J9X86) || defined(J9HAMMER) */
+	/* the generic timer runs at a fixed frequency */
+	return TRUE;
+#endif /* defined(J9X86) || defined(J9HAMMER) */
+}
+
+/**
+ * The kernel stops using the counter as its clock source when its own checks find the counter
+ * unstable or unsynchronized, as they do on many virtual machines. If the clock source cannot
+ * be read, the checks made here decide.
+ */
+static BOOLEAN
+kernelUsesCounter(struct OMRPortLibrary *portLibrary)
+{
+	BOOLEAN result = TRUE;
+	intptr_t fd = portLibrary->file_open(portLibrary, OMRTIME_CLOCKSOURCE_FILE, EsOpenRead, 0);
+
+	if (fd >= 0) {
+		char clockSource[32];
+		intptr_t bytesRead = portLibrary->file_read(portLibrary, fd, clockSource, sizeof(clockSource) - 1);
+
+		if (bytesRead > 0) {
+			size_t nameLength = sizeof(OMRTIME_COUNTER_CLOCKSOURCE) - 1;
+
+			clockSource[bytesRead] = '\0';
+			result = (0 == strncmp(clockSource, OMRTIME_COUNTER_CLOCKSOURCE, nameLength))
+					&& (('\n' == clockSource[nameLength]) || ('\0' == clockSource[nameLength]));
+		}
+		portLibrary->file_close(portLibrary, fd);
+	}
+	return result;
+}
+
+/**
+ * Move the calling thread across each CPU it may run on, twice, checking that the counter never
+ * goes backwards. This catches counters that differ between CPUs by more than a migration takes.
+ * The thread's affinity is restored before returning.
+ */
+static BOOLEAN
+counterIsSynchronized(void)
+{
+	cpu_set_t allowed;
+	BOOLEAN synchronized = TRUE;
+	uint64_t previous = 0;
+	uintptr_t pass = 0;
+
+	if (0 != sched_getaffinity(0, sizeof(allowed), &allowed)) {
+		return FALSE;
+	}
+	for (pass = 0; synchronized && (pass < 2); pass++) {
+		int cpu = 0;
+
+		for (cpu = 0; synchronized && (cpu < CPU_SETSIZE); cpu++) {
+			cpu_set_t single;
+
+			if (!CPU_ISSET(cpu, &allowed)) {
+				continue;
+			}
+			CPU_ZERO(&single);
+			CPU_SET(cpu, &single);
+			if (0 == sched_setaffinity(0, sizeof(single), &single)) {
+				uint64_t now = readCounter();
+
+				synchronized = (now >= previous);
+				previous = now;
+			}
+		}
+	}
+	sched_setaffinity(0, sizeof(allowed), &allowed);
+	return synchronized;
+}
+
+#if defined(J9X86) || defined(J9HAMMER)
+/**
+ * Read the counter between two reads of CLOCK_MONOTONIC_RAW, retrying if the thread was held
+ * up between them.
+ *
+ * @param[out] nanos the clock time at which the counter was read
+ *
+ * @return the counter, or 0 if the clock cannot be read
+ */
+static uint64_t
+sampleCounter(uint64_t *nanos)
+{
+	uint64_t counter = 0;
+	uintptr_t attempt = 0;
+
+	for (attempt = 0; attempt < OMRTIME_SAMPLE_ATTEMPTS; attempt++) {
+		struct timespec before;
+		struct timespec after;
+		uint64_t beforeNanos = 0;
+		uint64_t afterNanos = 0;
+
+		if (0 != clock_gettime(CLOCK_MONOTONIC_RAW, &before)) {
+			return 0;
+		}
+		counter = readCounter();
+		if (0 != clock_gettime(CLOCK_MONOTONIC_RAW, &after)) {
+			return 0;
+		}
+		beforeNanos = ((uint64_t)before.tv_sec * OMRPORT_TIME_DELTA_IN_NANOSECONDS) + (uint64_t)before.tv_nsec;
+		afterNanos = ((uint64_t)after.tv_sec * OMRPORT_TIME_DELTA_IN_NANOSECONDS) + (uint64_t)after.tv_nsec;
+		*nanos = beforeNanos + ((afterNanos - beforeNanos) / 2);
+		if ((afterNanos - beforeNanos) < OMRTIME_SAMPLE_WINDOW_NANOS) {
+			break;
+		}
+	}
+	return counter;
+}
+#endif /* defined(J9X86) || defined(J9HAMMER) */
+
+/**
+ * @return the counter ticks per second, or 0 if the frequency cannot be determined
+ */
+static uint64_t
+counterFrequency(void)
+{
+#if defined(J9X86) || defined(J9HAMMER)
+	struct timespec calibration = {0, OMRTIME_CALIBRATION_NANOS};
+	uint64_t startNanos = 0;
+	uint64_t endNanos = 0;
+	uint64_t startCounter = sampleCounter(&startNanos);
+	uint64_t endCounter = 0;
+
+	/* an interrupted sleep only shortens the calibration */
+	nanosleep(&calibration, NULL);
+	endCounter = sampleCounter(&endNanos);
+	if ((0 == startCounter) || (endCounter <= startCounter) || (endNanos <= startNanos)) {
+		return 0;
+	}
+	return ((endCounter - startCounter) * OMRPORT_TIME_DELTA_IN_NANOSECONDS) / (endNanos - startNanos);
+#else /* defined(J9X86) || defined(J9HAMMER) */
+	uint64_t frequency = 0;
+
+	__asm__ __volatile__("mrs %0, cntfrq_el0" : "=r" (frequency));
+	return frequency;
+#endif /* defined(J9X86) || defined(J9HAMMER) */
+}
+#endif /* defined(OMRTIME_FAST_TICKS_COUNTER) */
+
+uint64_t
+omrtime_fast_ticks(struct OMRPortLibrary *portLibrary)
+{
+#if defined(OMRTIME_FAST_TICKS_COUNTER)
+	OMRPortLibraryGlobalData *portGlobals = portLibrary->portGlobals;
+
+	/* the flag is only written once, so that taking ticks doesn't keep dirtying the line */
+	if (0 == portGlobals->fastTicksTaken) {
+		portGlobals->fastTicksTaken = 1;
+	}
+	if (0 != portGlobals->fastTicksFrequency) {
+		return readCounter();
+	}
+#endif /* defined(OMRTIME_FAST_TICKS_COUNTER) */
+	return portLibrary->time_hires_clock(portLibrary);
+}
+
+uint64_t
+omrtime_fast_ticks_frequency(struct OMRPortLibrary *portLibrary)
+{
+	uint64_t frequency = portLibrary->portGlobals->fastTicksFrequency;
+
+	if (0 == frequency) {
+		frequency = portLibrary->time_hires_frequency(portLibrary);
+	}
+	return frequency;
+}
+
+uint64_t
+omrtime_fast_ticks_delta(struct OMRPortLibrary *portLibrary, uint64_t startTicks, uint64_t endTicks, uint64_t requiredResolution)
+{
+	uint64_t frequency = portLibrary->portGlobals->fastTicksFrequency;
+	uint64_t ticks = endTicks - startTicks;
+
+	if (0 == frequency) {
+		return portLibrary->time_hires_delta(portLibrary, startTicks, endTicks, requiredResolution);
+	}
+	if (frequency != requiredResolution) {
+		ticks = (uint64_t)((double)ticks * ((double)requiredResolution / (double)frequency));
+	}
+	return ticks;
+}
+
+int32_t
+omrtime_fast_ticks_use_counter(struct OMRPortLibrary *portLibrary, BOOLEAN useCounter)
+{
+#if defined(OMRTIME_FAST_TICKS_COUNTER)
+	OMRPortLibraryGlobalData *portGlobals = portLibrary->portGlobals;
+	const char *unusable = NULL;
+	uint64_t frequency = 0;
+
+	if ((!useCounter) == (0 == portGlobals->fastTicksFrequency)) {
+		return 0;
+	}
+	/* ticks already handed out would be compared with ticks from the other source */
+	if (0 != portGlobals->fastTicksTaken) {
+		Trc_PRT_time_fast_ticks_source_fixed((uint32_t)useCounter);
+		return 1;
+	}
+	if (!useCounter) {
+		portGlobals->fastTicksFrequency = 0;
+		return 0;
+	}
+
+	if (!counterIsInvariant()) {
+		unusable = "not invariant";
+	} else if (!kernelUsesCounter(portLibrary)) {
+		unusable = "not the kernel clock source";
+	} else if (!counterIsSynchronized()) {
+		unusable = "not synchronized across CPUs";
+	} else {
+		frequency = counterFrequency();
+		if (0 == frequency) {
+			unusable = "frequency unknown";
+		}
+	}
+	if (NULL != unusable) {
+		Trc_PRT_time_fast_ticks_counter_unusable(unusable);
+		return 1;
+	}
+
+	portGlobals->fastTicksFrequency = frequency;
+	Trc_PRT_time_fast_ticks_use_counter(frequency);
+	return 0;
+#else /* defined(OMRTIME_FAST_TICKS_COUNTER) */
+	if (useCounter) {
+		Trc_PRT_time_fast_ticks_counter_unusable("not supported on this platform");
+		return 1;
+	}
+	return 0;
+#endif /* defined(OMRTIME_FAST_TICKS_COUNTER) */
+}
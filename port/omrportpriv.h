@@ -134,6 +134,11 @@ typedef struct OMRPortLibraryGlobalData {
 	uintptr_t vmemEnableMadvise;					/* madvise to use Transparent HugePage (THP) for Virtual memory allocated by mmap */
 	J9SysinfoCPUTime oldestCPUTime;
 	J9SysinfoCPUTime latestCPUTime;
+	omrthread_tls_key_t categoryCacheTlsKey; /* per thread memory category deltas; 0 when caching is unavailable */
+	omrthread_monitor_t categoryCacheMonitor;
+	void *categoryCacheList;
+	uint64_t fastTicksFrequency; /* counter ticks per second when omrtime_fast_ticks reads the CPU counter, 0 when it uses omrtime_hires_clock */
+	uintptr_t fastTicksTaken; /* set once omrtime_fast_ticks has returned, after which fastTicksFrequency cannot change */
 } OMRPortLibraryGlobalData;
 
 /* J9SourceJ9CPUControl*/
@@ -298,6 +303,22 @@ omrfile_read_text(struct OMRPortLibrary *portLibrary, intptr_t fd, char *buf, in
 extern J9_CFUNC int32_t
 omrfile_get_text_encoding(struct OMRPortLibrary *portLibrary, char *charsetName, uintptr_t nbytes);
 
+/* J9SourceJ9FileAIO*/
+extern J9_CFUNC int32_t
+omrfile_aio_create(struct OMRPortLibrary *portLibrary, uint32_t queueDepth, uint32_t flags, OMRFileAIOContext **context);
+extern J9_CFUNC void
+omrfile_aio_destroy(struct OMRPortLibrary *portLibrary, OMRFileAIOContext *context);
+extern J9_CFUNC int32_t
+omrfile_aio_register_buffers(struct OMRPortLibrary *portLibrary, OMRFileAIOContext *context, OMRFileAIOVec *buffers, uint32_t count);
+extern J9_CFUNC intptr_t
+omrfile_aio_submit(struct OMRPortLibrary *portLibrary, OMRFileAIOContext *context, OMRFileAIORequest **requests, uintptr_t count);
+extern J9_CFUNC intptr_t
+omrfile_aio_reap(struct OMRPortLibrary *portLibrary, OMRFileAIOContext *context, uintptr_t minCompletions);
+extern J9_CFUNC intptr_t
+omrfile_aio_get_event_fd(struct OMRPortLibrary *portLibrary, OMRFileAIOContext *context);
+extern J9_CFUNC uint32_t
+omrfile_aio_backend(struct OMRPortLibrary *portLibrary, OMRFileAIOContext *context);
+
 /* J9SourceJ9Heap*/
 extern J9_CFUNC struct J9Heap *
 omrheap_create(struct OMRPortLibrary *portLibrary, void *heapBase, uintptr_t heapSize, uint32_t heapFlags);
@@ -313,6 +334,28 @@ extern J9_CFUNC BOOLEAN
 omrheap_grow(struct OMRPortLibrary *portLibrary, struct J9Heap *heap, uintptr_t growAmount);
 
 
+/* J9SourceJ9MemArena*/
+extern J9_CFUNC OMRMemArenaPool *
+omrmem_arena_pool_create(struct OMRPortLibrary *portLibrary, uintptr_t chunkSize, uintptr_t maxFreeChunks, uint32_t category);
+extern J9_CFUNC void
+omrmem_arena_pool_destroy(struct OMRPortLibrary *portLibrary, OMRMemArenaPool *pool);
+extern J9_CFUNC OMRMemArena *
+omrmem_arena_create(struct OMRPortLibrary *portLibrary, uintptr_t chunkSize, uint32_t category, OMRMemArenaPool *pool);
+extern J9_CFUNC void
+omrmem_arena_destroy(struct OMRPortLibrary *portLibrary, OMRMemArena *arena);
+extern J9_CFUNC void *
+omrmem_arena_allocate(struct OMRPortLibrary *portLibrary, OMRMemArena *arena, uintptr_t byteAmount);
+extern J9_CFUNC void
+omrmem_arena_mark(struct OMRPortLibrary *portLibrary, OMRMemArena *arena, OMRMemArenaMark *mark);
+extern J9_CFUNC void
+omrmem_arena_rewind(struct OMRPortLibrary *portLibrary, OMRMemArena *arena, const OMRMemArenaMark *mark);
+extern J9_CFUNC void
+omrmem_arena_reset(struct OMRPortLibrary *portLibrary, OMRMemArena *arena);
+extern J9_CFUNC void
+omrmem_arena_release(struct OMRPortLibrary *portLibrary, OMRMemArena *arena);
+extern J9_CFUNC OMRMemArena *
+omrmem_arena_thread_scratch(struct OMRPortLibrary *portLibrary);
+
 /* J9SourceJ9Mem*/
 extern J9_CFUNC void
 omrmem_deallocate_portLibrary_basic(void *memoryPointer);
@@ -372,6 +415,18 @@ extern J9_CFUNC void
 omrmem_categories_increment_bytes(OMRMemCategory *category, uintptr_t size);
 extern J9_CFUNC void
 omrmem_categories_decrement_bytes(OMRMemCategory *category, uintptr_t size);
+extern J9_CFUNC int32_t
+omrmem_startup_category_caches(struct OMRPortLibrary *portLibrary);
+extern J9_CFUNC void
+omrmem_shutdown_category_caches(struct OMRPortLibrary *portLibrary);
+extern J9_CFUNC void
+omrmem_categories_cached_increment_counters(struct OMRPortLibrary *portLibrary, OMRMemCategory *category, uintptr_t size);
+extern J9_CFUNC void
+omrmem_categories_cached_decrement_counters(struct OMRPortLibrary *portLibrary, OMRMemCategory *category, uintptr_t size);
+extern J9_CFUNC void
+omrmem_categories_flush_caches(struct OMRPortLibrary *portLibrary);
+extern J9_CFUNC int32_t
+omrmem_get_category_counters(struct OMRPortLibrary *portLibrary, uint32_t categoryCode, uintptr_t *liveBytes, uintptr_t *liveAllocations);
 
 /* J9SourceJ9MemoryMap*/
 extern J9_CFUNC void
@@ -392,6 +447,16 @@ extern J9_CFUNC uintptr_t
 omrmmap_get_region_granularity(struct OMRPortLibrary *portLibrary, void *address);
 extern J9_CFUNC void
 omrmmap_dont_need(struct OMRPortLibrary *portLibrary, const void *startAddress, size_t length);
+extern J9_CFUNC int32_t
+omrmmap_advise(struct OMRPortLibrary *portLibrary, void *startAddress, uintptr_t length, uint32_t advice);
+
+/* J9SourceJ9MmapWindow*/
+extern J9_CFUNC J9MmapWindow *
+omrmmap_window_open(struct OMRPortLibrary *portLibrary, intptr_t file, uintptr_t windowSize, uint32_t flags, uint32_t category);
+extern J9_CFUNC void *
+omrmmap_window_map(struct OMRPortLibrary *portLibrary, J9MmapWindow *window, uint64_t offset, uintptr_t *length);
+extern J9_CFUNC void
+omrmmap_window_close(struct OMRPortLibrary *portLibrary, J9MmapWindow *window);
 
 #if !defined(OMR_OS_WINDOWS)
 /* J9SourceJ9SharedSemaphore*/
@@ -801,6 +866,26 @@ extern J9_CFUNC int32_t
 omrsock_getsockopt_linger(struct OMRPortLibrary *portLibrary, omrsock_socket_t handle, int32_t optlevel, int32_t optname, omrsock_linger_t optval);
 extern J9_CFUNC int32_t
 omrsock_getsockopt_timeval(struct OMRPortLibrary *portLibrary, omrsock_socket_t handle, int32_t optlevel, int32_t optname, omrsock_timeval_t optval);
+extern J9_CFUNC int32_t
+omrsock_eventloop_create(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t *loop);
+extern J9_CFUNC int32_t
+omrsock_eventloop_add(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock, uint32_t events, void *userData);
+extern J9_CFUNC int32_t
+omrsock_eventloop_modify(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock, uint32_t events, void *userData);
+extern J9_CFUNC int32_t
+omrsock_eventloop_remove(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock);
+extern J9_CFUNC int32_t
+omrsock_eventloop_wait(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_event_t events, uint32_t maxEvents, int32_t timeoutMs);
+extern J9_CFUNC int32_t
+omrsock_eventloop_wakeup(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop);
+extern J9_CFUNC int32_t
+omrsock_eventloop_destroy(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t *loop);
+extern J9_CFUNC int32_t
+omrsock_sendmmsg(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, omrsock_msg_t msgs, uint32_t count, int32_t flags);
+extern J9_CFUNC int32_t
+omrsock_recvmmsg(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, omrsock_msg_t msgs, uint32_t count, int32_t flags);
+extern J9_CFUNC int32_t
+omrsock_zerocopy_complete(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, uint32_t *first, uint32_t *last, BOOLEAN *copied);
 
 /* J9SourceJ9Str*/
 extern J9_CFUNC uintptr_t
@@ -854,6 +939,16 @@ omrtime_msec_clock(struct OMRPortLibrary *portLibrary);
 extern J9_CFUNC uint64_t
 omrtime_current_time_nanos(struct OMRPortLibrary *portLibrary, uintptr_t *success);
 
+/* omrtimeticks.c */
+extern J9_CFUNC uint64_t
+omrtime_fast_ticks(struct OMRPortLibrary *portLibrary);
+extern J9_CFUNC uint64_t
+omrtime_fast_ticks_frequency(struct OMRPortLibrary *portLibrary);
+extern J9_CFUNC uint64_t
+omrtime_fast_ticks_delta(struct OMRPortLibrary *portLibrary, uint64_t startTicks, uint64_t endTicks, uint64_t requiredResolution);
+extern J9_CFUNC int32_t
+omrtime_fast_ticks_use_counter(struct OMRPortLibrary *portLibrary, BOOLEAN useCounter);
+
 /* J9SourceJ9TTY*/
 extern J9_CFUNC void
 omrtty_shutdown(struct OMRPortLibrary *portLibrary);
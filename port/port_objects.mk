@@ -117,6 +117,8 @@ ifneq (win,$(OMR_HOST_OS))
 endif
 
 OBJECTS += omrfile_blockingasync
+OBJECTS += omrfileaio
+OBJECTS += omrmmapwindow
 
 ifeq (win,$(OMR_HOST_OS))
   OBJECTS += omrfilehelpers
@@ -130,6 +132,7 @@ OBJECTS += omrheap
 OBJECTS += omrmem
 OBJECTS += omrmemtag
 OBJECTS += omrmemcategories
+OBJECTS += omrmemarena
 OBJECTS += omrport
 OBJECTS += omrmmap
 OBJECTS += j9nls
@@ -157,6 +160,7 @@ ifeq (win,$(OMR_HOST_OS))
   OBJECTS += omrsyslogmessages.res
 endif
 OBJECTS += omrtime
+OBJECTS += omrtimeticks
 OBJECTS += omrtlshelpers
 OBJECTS += omrtty
 OBJECTS += omrvmem
@@ -0,0 +1,878 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Port
+ * @brief Asynchronous file I/O
+ *
+ * On Linux requests are queued on an io_uring, driven through the raw system calls so there is no
+ * dependency on liburing. Where io_uring is not available, is disabled, or is refused by a seccomp
+ * policy, requests are queued to a small pool of worker threads doing positioned reads and writes.
+ * Either way completions are reaped, and callbacks run, on the thread owning the context, and an
+ * eventfd (or a pipe) signals completions to callers who would rather poll.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "omrportpriv.h"
+#include "omrthread.h"
+#include "omrutil.h"
+#include "omrutilbase.h"
+#include "ut_omrport.h"
+
+#if defined(LINUX) && !defined(OMRZTPF)
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#if defined(__NR_io_uring_setup)
+#include <linux/io_uring.h>
+/* IORING_OP_READ and IORING_OP_WRITE, and offset -1 meaning the file position, arrived together */
+#if defined(IORING_FEAT_RW_CUR_POS)
+#define OMRFILEAIO_IO_URING
+#endif /* defined(IORING_FEAT_RW_CUR_POS) */
+#endif /* defined(__NR_io_uring_setup) */
+#define OMRFILEAIO_EVENTFD
+#endif /* defined(LINUX) && !defined(OMRZTPF) */
+
+#define OMRFILEAIO_MAX_WORKERS 4
+#define OMRFILEAIO_WORKER_STACK_SIZE (64 * 1024)
+
+struct OMRFileAIOContext {
+	struct OMRPortLibrary *portLibrary;
+	uint32_t backend;
+	uint32_t queueDepth;
+	/* submitted and not yet reaped; only touched by the owning thread */
+	uintptr_t inflight;
+	uint32_t fixedBufferCount;
+	/* readable when requests complete; for a pipe the write end is separate */
+	int eventFd;
+	int eventWriteFd;
+
+	/* worker threads */
+	omrthread_monitor_t monitor;
+	OMRFileAIORequest *queueHead;
+	OMRFileAIORequest *queueTail;
+	OMRFileAIORequest *completedHead;
+	OMRFileAIORequest *completedTail;
+	uintptr_t completedCount;
+	uintptr_t liveWorkers;
+	BOOLEAN shutdown;
+
+#if defined(OMRFILEAIO_IO_URING)
+	int ringFd;
+	void *sqRing;
+	size_t sqRingSize;
+	void *cqRing;
+	size_t cqRingSize;
+	struct io_uring_sqe *sqes;
+	size_t sqesSize;
+	volatile uint32_t *sqHead;
+	volatile uint32_t *sqTail;
+	uint32_t *sqArray;
+	uint32_t sqMask;
+	uint32_t sqEntries;
+	volatile uint32_t *cqHead;
+	volatile uint32_t *cqTail;
+	struct io_uring_cqe *cqes;
+	uint32_t cqMask;
+#endif /* defined(OMRFILEAIO_IO_URING) */
+};
+
+/**
+ * @internal
+ * Map an errno to a (negative) portable error code, as omrfile does.
+ */
+static intptr_t
+findError(int errorCode)
+{
+	switch (errorCode) {
+	case EACCES:
+		/* FALLTHROUGH */
+	case EPERM:
+		return OMRPORT_ERROR_FILE_NOPERMISSION;
+	case EBADF:
+		return OMRPORT_ERROR_FILE_BADF;
+	case ENOSPC:
+		/* FALLTHROUGH */
+	case EFBIG:
+		return OMRPORT_ERROR_FILE_DISKFULL;
+	case EINVAL:
+		return OMRPORT_ERROR_FILE_INVAL;
+	case EISDIR:
+		return OMRPORT_ERROR_FILE_ISDIR;
+	case EAGAIN:
+		return OMRPORT_ERROR_FILE_EAGAIN;
+	case EFAULT:
+		return OMRPORT_ERROR_FILE_EFAULT;
+	case EINTR:
+		return OMRPORT_ERROR_FILE_EINTR;
+	case EIO:
+		return OMRPORT_ERROR_FILE_IO;
+	case EOVERFLOW:
+		return OMRPORT_ERROR_FILE_OVERFLOW;
+	case ESPIPE:
+		return OMRPORT_ERROR_FILE_SPIPE;
+	default:
+		return OMRPORT_ERROR_FILE_OPFAILED;
+	}
+}
+
+static void
+signalEvent(OMRFileAIOContext *context)
+{
+#if defined(OMRFILEAIO_EVENTFD)
+	uint64_t one = 1;
+
+	while ((-1 == write(context->eventWriteFd, &one, sizeof(one))) && (EINTR == errno)) {
+	}
+#else /* defined(OMRFILEAIO_EVENTFD) */
+	char one = 1;
+
+	/* a full pipe is already readable */
+	while ((-1 == write(context->eventWriteFd, &one, sizeof(one))) && (EINTR == errno)) {
+	}
+#endif /* defined(OMRFILEAIO_EVENTFD) */
+}
+
+static void
+drainEvent(OMRFileAIOContext *context)
+{
+	char buffer[64];
+
+	/* the descriptor is non-blocking; an eventfd is reset by one read, a pipe may need several */
+	while (0 < read(context->eventFd, buffer, sizeof(buffer))) {
+#if defined(OMRFILEAIO_EVENTFD)
+		break;
+#endif /* defined(OMRFILEAIO_EVENTFD) */
+	}
+}
+
+static int32_t
+openEvent(OMRFileAIOContext *context)
+{
+#if defined(OMRFILEAIO_EVENTFD)
+	context->eventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if (-1 == context->eventFd) {
+		return (int32_t)findError(errno);
+	}
+	context->eventWriteFd = context->eventFd;
+#else /* defined(OMRFILEAIO_EVENTFD) */
+	int fds[2];
+	int i = 0;
+
+	if (-1 == pipe(fds)) {
+		return (int32_t)findError(errno);
+	}
+	for (i = 0; i < 2; i++) {
+		fcntl(fds[i], F_SETFL, fcntl(fds[i], F_GETFL) | O_NONBLOCK);
+		fcntl(fds[i], F_SETFD, FD_CLOEXEC);
+	}
+	context->eventFd = fds[0];
+	context->eventWriteFd = fds[1];
+#endif /* defined(OMRFILEAIO_EVENTFD) */
+	return 0;
+}
+
+static void
+closeEvent(OMRFileAIOContext *context)
+{
+	if (-1 != context->eventFd) {
+		close(context->eventFd);
+	}
+	if ((-1 != context->eventWriteFd) && (context->eventWriteFd != context->eventFd)) {
+		close(context->eventWriteFd);
+	}
+}
+
+/**
+ * @internal
+ * Mark a request complete and run its callback.
+ */
+static void
+completeRequest(OMRFileAIOContext *context, OMRFileAIORequest *request, intptr_t result, BOOLEAN runCallbacks)
+{
+	context->inflight -= 1;
+	request->result = result;
+	request->state = OMRPORT_FILE_AIO_STATE_COMPLETE;
+	if (runCallbacks && (NULL != request->callback)) {
+		request->callback(context->portLibrary, request);
+	}
+}
+
+/**
+ * @internal
+ * Perform a request synchronously on a worker thread.
+ *
+ * @return bytes transferred, or a negative portable error code
+ */
+static intptr_t
+performRequest(OMRFileAIORequest *request)
+{
+	int fd = (int)request->fd;
+	off_t offset = (off_t)request->offset;
+	BOOLEAN positioned = (-1 != request->offset);
+	ssize_t rc = -1;
+
+	do {
+		switch (request->opcode) {
+		case OMRPORT_FILE_AIO_READ:
+			rc = positioned ? pread(fd, request->buffer, request->length, offset) : read(fd, request->buffer, request->length);
+			break;
+		case OMRPORT_FILE_AIO_WRITE:
+			rc = positioned ? pwrite(fd, request->buffer, request->length, offset) : write(fd, request->buffer, request->length);
+			break;
+		case OMRPORT_FILE_AIO_READV:
+			if (!positioned) {
+				rc = readv(fd, (struct iovec *)request->vecs, (int)request->vecCount);
+			} else {
+#if defined(LINUX)
+				rc = preadv(fd, (struct iovec *)request->vecs, (int)request->vecCount, offset);
+#else /* defined(LINUX) */
+				uintptr_t i = 0;
+				ssize_t total = 0;
+
+				for (i = 0; i < request->vecCount; i++) {
+					rc = pread(fd, request->vecs[i].buffer, request->vecs[i].length, offset + total);
+					if (rc < 0) {
+						break;
+					}
+					total += rc;
+					if ((uintptr_t)rc < request->vecs[i].length) {
+						break;
+					}
+				}
+				if ((rc >= 0) || (total > 0)) {
+					rc = total;
+				}
+#endif /* defined(LINUX) */
+			}
+			break;
+		case OMRPORT_FILE_AIO_WRITEV:
+			if (!positioned) {
+				rc = writev(fd, (struct iovec *)request->vecs, (int)request->vecCount);
+			} else {
+#if defined(LINUX)
+				rc = pwritev(fd, (struct iovec *)request->vecs, (int)request->vecCount, offset);
+#else /* defined(LINUX) */
+				uintptr_t i = 0;
+				ssize_t total = 0;
+
+				for (i = 0; i < request->vecCount; i++) {
+					rc = pwrite(fd, request->vecs[i].buffer, request->vecs[i].length, offset + total);
+					if (rc < 0) {
+						break;
+					}
+					total += rc;
+					if ((uintptr_t)rc < request->vecs[i].length) {
+						break;
+					}
+				}
+				if ((rc >= 0) || (total > 0)) {
+					rc = total;
+				}
+#endif /* defined(LINUX) */
+			}
+			break;
+		case OMRPORT_FILE_AIO_FSYNC:
+			rc = fsync(fd);
+			break;
+		default:
+			errno = EINVAL;
+			break;
+		}
+	} while ((-1 == rc) && (EINTR == errno));
+
+	return (rc < 0) ? findError(errno) : (intptr_t)rc;
+}
+
+static int J9THREAD_PROC
+aioWorker(void *arg)
+{
+	OMRFileAIOContext *context = (OMRFileAIOContext *)arg;
+
+	omrthread_set_name(omrthread_self(), "File AIO Worker");
+	omrthread_monitor_enter(context->monitor);
+	for (;;) {
+		OMRFileAIORequest *request = context->queueHead;
+
+		if (NULL == request) {
+			if (context->shutdown) {
+				break;
+			}
+			omrthread_monitor_wait(context->monitor);
+			continue;
+		}
+		context->queueHead = request->next;
+		if (NULL == context->queueHead) {
+			context->queueTail = NULL;
+		}
+		omrthread_monitor_exit(context->monitor);
+
+		/* the owner only reads result once the request is on the completed list */
+		request->result = performRequest(request);
+		request->next = NULL;
+
+		omrthread_monitor_enter(context->monitor);
+		if (NULL == context->completedTail) {
+			context->completedHead = request;
+		} else {
+			context->completedTail->next = request;
+		}
+		context->completedTail = request;
+		context->completedCount += 1;
+		omrthread_monitor_notify_all(context->monitor);
+		signalEvent(context);
+	}
+	context->liveWorkers -= 1;
+	omrthread_monitor_notify_all(context->monitor);
+	omrthread_exit(context->monitor);
+
+	/* unreachable */
+	return 0;
+}
+
+static int32_t
+startWorkers(OMRFileAIOContext *context)
+{
+	uintptr_t workers = OMR_MIN(context->queueDepth, OMRFILEAIO_MAX_WORKERS);
+	uintptr_t i = 0;
+
+	if (0 != omrthread_monitor_init_with_name(&context->monitor, 0, "portLibrary_omrfile_aio_monitor")) {
+		return OMRPORT_ERROR_FILE_OPFAILED;
+	}
+	for (i = 0; i < workers; i++) {
+		omrthread_t thread = NULL;
+
+		omrthread_monitor_enter(context->monitor);
+		context->liveWorkers += 1;
+		omrthread_monitor_exit(context->monitor);
+		if (J9THREAD_SUCCESS != createThreadWithCategory(&thread, OMRFILEAIO_WORKER_STACK_SIZE, J9THREAD_PRIORITY_NORMAL, 0,
+				aioWorker, context, J9THREAD_CATEGORY_SYSTEM_THREAD)
+		) {
+			omrthread_monitor_enter(context->monitor);
+			context->liveWorkers -= 1;
+			omrthread_monitor_exit(context->monitor);
+			break;
+		}
+	}
+	return (0 == i) ? OMRPORT_ERROR_FILE_OPFAILED : 0;
+}
+
+static void
+stopWorkers(OMRFileAIOContext *context)
+{
+	if (NULL != context->monitor) {
+		omrthread_monitor_enter(context->monitor);
+		context->shutdown = TRUE;
+		omrthread_monitor_notify_all(context->monitor);
+		while (0 != context->liveWorkers) {
+			omrthread_monitor_wait(context->monitor);
+		}
+		omrthread_monitor_exit(context->monitor);
+		omrthread_monitor_destroy(context->monitor);
+		context->monitor = NULL;
+	}
+}
+
+static void
+submitToWorkers(OMRFileAIOContext *context, OMRFileAIORequest **requests, uintptr_t count)
+{
+	uintptr_t i = 0;
+
+	omrthread_monitor_enter(context->monitor);
+	for (i = 0; i < count; i++) {
+		OMRFileAIORequest *request = requests[i];
+
+		request->next = NULL;
+		if (NULL == context->queueTail) {
+			context->queueHead = request;
+		} else {
+			context->queueTail->next = request;
+		}
+		context->queueTail = request;
+	}
+	if (1 == count) {
+		omrthread_monitor_notify(context->monitor);
+	} else {
+		omrthread_monitor_notify_all(context->monitor);
+	}
+	omrthread_monitor_exit(context->monitor);
+}
+
+static intptr_t
+reapFromWorkers(OMRFileAIOContext *context, uintptr_t minCompletions, BOOLEAN runCallbacks)
+{
+	OMRFileAIORequest *request = NULL;
+	intptr_t reaped = 0;
+
+	omrthread_monitor_enter(context->monitor);
+	while (context->completedCount < minCompletions) {
+		omrthread_monitor_wait(context->monitor);
+	}
+	request = context->completedHead;
+	reaped = (intptr_t)context->completedCount;
+	context->completedHead = NULL;
+	context->completedTail = NULL;
+	context->completedCount = 0;
+	omrthread_monitor_exit(context->monitor);
+
+	while (NULL != request) {
+		OMRFileAIORequest *next = request->next;
+
+		completeRequest(context, request, request->result, runCallbacks);
+		request = next;
+	}
+	return reaped;
+}
+
+#if defined(OMRFILEAIO_IO_URING)
+
+static int
+uringSetup(uint32_t entries, struct io_uring_params *params)
+{
+	return (int)syscall(__NR_io_uring_setup, entries, params);
+}
+
+static int
+uringEnter(int ringFd, uint32_t toSubmit, uint32_t minComplete, uint32_t flags)
+{
+	return (int)syscall(__NR_io_uring_enter, ringFd, toSubmit, minComplete, flags, NULL, 0);
+}
+
+static int
+uringRegister(int ringFd, uint32_t opcode, void *arg, uint32_t nrArgs)
+{
+	return (int)syscall(__NR_io_uring_register, ringFd, opcode, arg, nrArgs);
+}
+
+static void
+uringClose(OMRFileAIOContext *context)
+{
+	if (NULL != context->sqes) {
+		munmap(context->sqes, context->sqesSize);
+	}
+	if ((NULL != context->cqRing) && (context->cqRing != context->sqRing)) {
+		munmap(context->cqRing, context->cqRingSize);
+	}
+	if (NULL != context->sqRing) {
+		munmap(context->sqRing, context->sqRingSize);
+	}
+	if (-1 != context->ringFd) {
+		close(context->ringFd);
+	}
+	context->sqes = NULL;
+	context->cqRing = NULL;
+	context->sqRing = NULL;
+	context->ringFd = -1;
+}
+
+/**
+ * @internal
+ * Set up an io_uring and map its rings.
+ *
+ * @return 0 on success, otherwise the errno explaining why io_uring can't be used
+ */
+static int
+uringOpen(OMRFileAIOContext *context)
+{
+	struct io_uring_params params;
+	uint8_t *sq = NULL;
+	uint8_t *cq = NULL;
+
+	memset(&params, 0, sizeof(params));
+#if defined(IORING_SETUP_CLAMP)
+	params.flags = IORING_SETUP_CLAMP;
+#endif /* defined(IORING_SETUP_CLAMP) */
+	context->ringFd = uringSetup(context->queueDepth, &params);
+	if (-1 == context->ringFd) {
+		return errno;
+	}
+	if (0 == (params.features & IORING_FEAT_RW_CUR_POS)) {
+		uringClose(context);
+		return ENOSYS;
+	}
+
+	context->sqRingSize = params.sq_off.array + (params.sq_entries * sizeof(uint32_t));
+	context->cqRingSize = params.cq_off.cqes + (params.cq_entries * sizeof(struct io_uring_cqe));
+	if (0 != (params.features & IORING_FEAT_SINGLE_MMAP)) {
+		context->sqRingSize = OMR_MAX(context->sqRingSize, context->cqRingSize);
+		context->cqRingSize = context->sqRingSize;
+	}
+	context->sqRing = mmap(NULL, context->sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, context->ringFd, IORING_OFF_SQ_RING);
+	if (MAP_FAILED == context->sqRing) {
+		int error = errno;
+
+		context->sqRing = NULL;
+		uringClose(context);
+		return error;
+	}
+	if (0 != (params.features & IORING_FEAT_SINGLE_MMAP)) {
+		context->cqRing = context->sqRing;
+	} else {
+		context->cqRing = mmap(NULL, context->cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, context->ringFd, IORING_OFF_CQ_RING);
+		if (MAP_FAILED == context->cqRing) {
+			int error = errno;
+
+			context->cqRing = NULL;
+			uringClose(context);
+			return error;
+		}
+	}
+	context->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+	context->sqes = (struct io_uring_sqe *)mmap(NULL, context->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, context->ringFd, IORING_OFF_SQES);
+	if (MAP_FAILED == (void *)context->sqes) {
+		int error = errno;
+
+		context->sqes = NULL;
+		uringClose(context);
+		return error;
+	}
+
+	sq = (uint8_t *)context->sqRing;
+	context->sqHead = (volatile uint32_t *)(sq + params.sq_off.head);
+	context->sqTail = (volatile uint32_t *)(sq + params.sq_off.tail);
+	context->sqMask = *(uint32_t *)(sq + params.sq_off.ring_mask);
+	context->sqArray = (uint32_t *)(sq + params.sq_off.array);
+	context->sqEntries = params.sq_entries;
+	/* the completion queue is larger than the submission queue, so it can't overflow */
+	context->queueDepth = OMR_MIN(context->queueDepth, params.sq_entries);
+	cq = (uint8_t *)context->cqRing;
+	context->cqHead = (volatile uint32_t *)(cq + params.cq_off.head);
+	context->cqTail = (volatile uint32_t *)(cq + params.cq_off.tail);
+	context->cqMask = *(uint32_t *)(cq + params.cq_off.ring_mask);
+	context->cqes = (struct io_uring_cqe *)(cq + params.cq_off.cqes);
+
+	if (-1 == uringRegister(context->ringFd, IORING_REGISTER_EVENTFD, &context->eventFd, 1)) {
+		int error = errno;
+
+		uringClose(context);
+		return error;
+	}
+	return 0;
+}
+
+static intptr_t
+submitToRing(OMRFileAIOContext *context, OMRFileAIORequest **requests, uintptr_t count)
+{
+	uint32_t tail = *context->sqTail;
+	uintptr_t i = 0;
+	int rc = 0;
+
+	for (i = 0; i < count; i++) {
+		OMRFileAIORequest *request = requests[i];
+		uint32_t index = tail & context->sqMask;
+		struct io_uring_sqe *sqe = &context->sqes[index];
+		BOOLEAN fixed = (OMRPORT_FILE_AIO_NO_FIXED_BUFFER != request->fixedBufferIndex);
+
+		memset(sqe, 0, sizeof(*sqe));
+		sqe->fd = (int32_t)request->fd;
+		sqe->off = (uint64_t)request->offset;
+		sqe->user_data = (uint64_t)(uintptr_t)request;
+		switch (request->opcode) {
+		case OMRPORT_FILE_AIO_READ:
+		case OMRPORT_FILE_AIO_WRITE:
+			if (OMRPORT_FILE_AIO_READ == request->opcode) {
+				sqe->opcode = fixed ? IORING_OP_READ_FIXED : IORING_OP_READ;
+			} else {
+				sqe->opcode = fixed ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE;
+			}
+			sqe->addr = (uint64_t)(uintptr_t)request->buffer;
+			sqe->len = (uint32_t)request->length;
+			if (fixed) {
+				sqe->buf_index = (uint16_t)request->fixedBufferIndex;
+			}
+			break;
+		case OMRPORT_FILE_AIO_READV:
+			sqe->opcode = IORING_OP_READV;
+			sqe->addr = (uint64_t)(uintptr_t)request->vecs;
+			sqe->len = (uint32_t)request->vecCount;
+			break;
+		case OMRPORT_FILE_AIO_WRITEV:
+			sqe->opcode = IORING_OP_WRITEV;
+			sqe->addr = (uint64_t)(uintptr_t)request->vecs;
+			sqe->len = (uint32_t)request->vecCount;
+			break;
+		default:
+			sqe->opcode = IORING_OP_FSYNC;
+			sqe->off = 0;
+			break;
+		}
+		context->sqArray[index] = index;
+		tail += 1;
+	}
+
+	/* publish the entries before the tail */
+	issueWriteBarrier();
+	*context->sqTail = tail;
+
+	do {
+		rc = uringEnter(context->ringFd, (uint32_t)count, 0, 0);
+	} while ((-1 == rc) && (EINTR == errno));
+	if (-1 == rc) {
+		/* nothing was consumed; take the entries back */
+		*context->sqTail = tail - (uint32_t)count;
+		return findError(errno);
+	}
+	/* entries the kernel didn't consume yet stay queued and are submitted by the next enter */
+	return (intptr_t)count;
+}
+
+static intptr_t
+reapFromRing(OMRFileAIOContext *context, uintptr_t minCompletions, BOOLEAN runCallbacks)
+{
+	intptr_t reaped = 0;
+
+	for (;;) {
+		uint32_t head = *context->cqHead;
+		uint32_t tail = *context->cqTail;
+
+		issueReadBarrier();
+		if (head == tail) {
+			int rc = 0;
+
+			if ((uintptr_t)reaped >= minCompletions) {
+				break;
+			}
+			rc = uringEnter(context->ringFd, *context->sqTail - *context->sqHead, (uint32_t)(minCompletions - (uintptr_t)reaped), IORING_ENTER_GETEVENTS);
+			if ((-1 == rc) && (EINTR != errno)) {
+				return (0 == reaped) ? findError(errno) : reaped;
+			}
+			continue;
+		}
+		while (head != tail) {
+			struct io_uring_cqe *cqe = &context->cqes[head & context->cqMask];
+			OMRFileAIORequest *request = (OMRFileAIORequest *)(uintptr_t)cqe->user_data;
+			int32_t res = cqe->res;
+
+			/* hand the entry back before running the callback, which may submit more requests */
+			head += 1;
+			issueReadWriteBarrier();
+			*context->cqHead = head;
+			completeRequest(context, request, (res < 0) ? findError(-res) : (intptr_t)res, runCallbacks);
+			reaped += 1;
+		}
+	}
+	return reaped;
+}
+
+#endif /* defined(OMRFILEAIO_IO_URING) */
+
+static intptr_t
+reap(OMRFileAIOContext *context, uintptr_t minCompletions, BOOLEAN runCallbacks)
+{
+	drainEvent(context);
+	minCompletions = OMR_MIN(minCompletions, context->inflight);
+#if defined(OMRFILEAIO_IO_URING)
+	if (OMRPORT_FILE_AIO_BACKEND_IO_URING == context->backend) {
+		return reapFromRing(context, minCompletions, runCallbacks);
+	}
+#endif /* defined(OMRFILEAIO_IO_URING) */
+	return reapFromWorkers(context, minCompletions, runCallbacks);
+}
+
+int32_t
+omrfile_aio_create(struct OMRPortLibrary *portLibrary, uint32_t queueDepth, uint32_t flags, OMRFileAIOContext **context)
+{
+	OMRFileAIOContext *newContext = NULL;
+	int32_t rc = 0;
+
+	*context = NULL;
+	if (0 == queueDepth) {
+		return OMRPORT_ERROR_FILE_INVAL;
+	}
+	newContext = portLibrary->mem_allocate_memory(portLibrary, sizeof(OMRFileAIOContext), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == newContext) {
+		return OMRPORT_ERROR_FILE_OPFAILED;
+	}
+	memset(newContext, 0, sizeof(OMRFileAIOContext));
+	newContext->portLibrary = portLibrary;
+	newContext->queueDepth = queueDepth;
+	newContext->eventWriteFd = -1;
+#if defined(OMRFILEAIO_IO_URING)
+	newContext->ringFd = -1;
+#endif /* defined(OMRFILEAIO_IO_URING) */
+	rc = openEvent(newContext);
+	if (0 != rc) {
+		portLibrary->mem_free_memory(portLibrary, newContext);
+		return rc;
+	}
+
+#if defined(OMRFILEAIO_IO_URING)
+	if (0 == (flags & OMRPORT_FILE_AIO_FORCE_THREADS)) {
+		int error = uringOpen(newContext);
+
+		if (0 == error) {
+			newContext->backend = OMRPORT_FILE_AIO_BACKEND_IO_URING;
+		} else {
+			Trc_PRT_file_aio_io_uring_unavailable(error);
+		}
+	}
+#endif /* defined(OMRFILEAIO_IO_URING) */
+
+	if (0 == newContext->backend) {
+		newContext->backend = OMRPORT_FILE_AIO_BACKEND_THREADS;
+		rc = startWorkers(newContext);
+		if (0 != rc) {
+			stopWorkers(newContext);
+			closeEvent(newContext);
+			portLibrary->mem_free_memory(portLibrary, newContext);
+			return rc;
+		}
+	}
+
+	Trc_PRT_file_aio_create(newContext, newContext->backend, queueDepth);
+	*context = newContext;
+	return 0;
+}
+
+void
+omrfile_aio_destroy(struct OMRPortLibrary *portLibrary, OMRFileAIOContext *context)
+{
+	if (NULL == context) {
+		return;
+	}
+	Trc_PRT_file_aio_destroy(context);
+	/* buffers may still be written to until the requests in flight complete */
+	while (0 != context->inflight) {
+		if (0 > reap(context, context->inflight, FALSE)) {
+			break;
+		}
+	}
+#if defined(OMRFILEAIO_IO_URING)
+	if (OMRPORT_FILE_AIO_BACKEND_IO_URING == context->backend) {
+		uringClose(context);
+	}
+#endif /* defined(OMRFILEAIO_IO_URING) */
+	stopWorkers(context);
+	closeEvent(context);
+	portLibrary->mem_free_memory(portLibrary, context);
+}
+
+int32_t
+omrfile_aio_register_buffers(struct OMRPortLibrary *portLibrary, OMRFileAIOContext *context, OMRFileAIOVec *buffers, uint32_t count)
+{
+	if (0 != context->inflight) {
+		return OMRPORT_ERROR_FILE_EAGAIN;
+	}
+#if defined(OMRFILEAIO_IO_URING)
+	if (OMRPORT_FILE_AIO_BACKEND_IO_URING == context->backend) {
+		if (0 != context->fixedBufferCount) {
+			uringRegister(context->ringFd, IORING_UNREGISTER_BUFFERS, NULL, 0);
+			context->fixedBufferCount = 0;
+		}
+		if ((0 != count) && (-1 == uringRegister(context->ringFd, IORING_REGISTER_BUFFERS, buffers, count))) {
+			return (int32_t)findError(errno);
+		}
+	}
+#endif /* defined(OMRFILEAIO_IO_URING) */
+	/* worker threads need nothing pinned; the buffers are used as they are */
+	context->fixedBufferCount = count;
+	return 0;
+}
+
+intptr_t
+omrfile_aio_submit(struct OMRPortLibrary *portLibrary, OMRFileAIOContext *context, OMRFileAIORequest **requests, uintptr_t count)
+{
+	uintptr_t i = 0;
+
+	for (i = 0; i < count; i++) {
+		OMRFileAIORequest *request = requests[i];
+
+		switch (request->opcode) {
+		case OMRPORT_FILE_AIO_READ:
+		case OMRPORT_FILE_AIO_WRITE:
+			if ((OMRPORT_FILE_AIO_NO_FIXED_BUFFER != request->fixedBufferIndex)
+				&& ((request->fixedBufferIndex < 0) || ((uint32_t)request->fixedBufferIndex >= context->fixedBufferCount))
+			) {
+				return OMRPORT_ERROR_FILE_INVAL;
+			}
+			if (request->length > (uintptr_t)INT32_MAX) {
+				return OMRPORT_ERROR_FILE_INVAL;
+			}
+			break;
+		case OMRPORT_FILE_AIO_READV:
+		case OMRPORT_FILE_AIO_WRITEV:
+			if ((0 == request->vecCount) || (request->vecCount > (uintptr_t)INT32_MAX) || (NULL == request->vecs)) {
+				return OMRPORT_ERROR_FILE_INVAL;
+			}
+			break;
+		case OMRPORT_FILE_AIO_FSYNC:
+			break;
+		default:
+			return OMRPORT_ERROR_FILE_INVAL;
+		}
+	}
+
+	count = OMR_MIN(count, context->queueDepth - context->inflight);
+	if (0 == count) {
+		return 0;
+	}
+	for (i = 0; i < count; i++) {
+		requests[i]->result = 0;
+		requests[i]->state = OMRPORT_FILE_AIO_STATE_PENDING;
+	}
+
+#if defined(OMRFILEAIO_IO_URING)
+	if (OMRPORT_FILE_AIO_BACKEND_IO_URING == context->backend) {
+		intptr_t submitted = submitToRing(context, requests, count);
+
+		if (submitted < 0) {
+			for (i = 0; i < count; i++) {
+				requests[i]->state = OMRPORT_FILE_AIO_STATE_IDLE;
+			}
+			return submitted;
+		}
+		context->inflight += (uintptr_t)submitted;
+		return submitted;
+	}
+#endif /* defined(OMRFILEAIO_IO_URING) */
+
+	submitToWorkers(context, requests, count);
+	context->inflight += count;
+	return (intptr_t)count;
+}
+
+intptr_t
+omrfile_aio_reap(struct OMRPortLibrary *portLibrary, OMRFileAIOContext *context, uintptr_t minCompletions)
+{
+	return reap(context, minCompletions, TRUE);
+}
+
+intptr_t
+omrfile_aio_get_event_fd(struct OMRPortLibrary *portLibrary, OMRFileAIOContext *context)
+{
+	return (intptr_t)context->eventFd;
+}
+
+uint32_t
+omrfile_aio_backend(struct OMRPortLibrary *portLibrary, OMRFileAIOContext *context)
+{
+	return context->backend;
+}
@@ -160,6 +160,11 @@ omrmmap_read_map_file(struct OMRPortLibrary *portLibrary, intptr_t file, uint64_
  * @args                                         OMRPORT_MMAP_FLAG_PRIVATE              private memory mapping, do not share with other processes (implied by OMRPORT_MMAP_FLAG_COPYONWRITE)
  * @args                                         OMRPORT_MMAP_FLAG_ZOS_READ_MAPFILE     read the mapping file into allocated memory (which is the old behaviour of omrmmap_map_file()
  * 																						implementation on z/OS)
+ * @args                                         OMRPORT_MMAP_FLAG_ADVISE_SEQUENTIAL    the mapping will be read in order, see @ref omrmmap_advise
+ * @args                                         OMRPORT_MMAP_FLAG_ADVISE_RANDOM        the mapping will be read in no particular order
+ * @args                                         OMRPORT_MMAP_FLAG_ADVISE_WILLNEED      start reading the mapped file in the background
+ * @args                                         OMRPORT_MMAP_FLAG_POPULATE             fault the whole mapping in before returning
+ * @args                                         OMRPORT_MMAP_FLAG_HUGE_PAGES           back the mapping with huge pages where the file system supports it
  * @param [in]  categoryCode     Memory allocation category code
  *
  * @return                       A J9MmapHandle struct or NULL is an error has occurred
@@ -248,6 +253,11 @@ omrmmap_map_file(struct OMRPortLibrary *portLibrary, intptr_t file, uint64_t off
 		portLibrary->error_set_last_error_with_message(portLibrary, OMRPORT_ERROR_MMAP_MAP_FILE_INVALIDFLAGS, errMsg);
 		return NULL;
 	}
+#if defined(MAP_POPULATE)
+	if (OMR_ARE_ANY_BITS_SET(flags, OMRPORT_MMAP_FLAG_POPULATE)) {
+		mmapFlags |= MAP_POPULATE;
+	}
+#endif /* defined(MAP_POPULATE) */
 	Trc_PRT_mmap_map_file_unix_flagsSet(mmapProt, mmapFlags);
 
 	if (0 == size) {
@@ -284,6 +294,19 @@ omrmmap_map_file(struct OMRPortLibrary *portLibrary, intptr_t file, uint64_t off
 	returnVal->pointer = pointer;
 	returnVal->size = size;
 
+	/* Access hints are best effort: the mapping is usable without them */
+	{
+		uint32_t advice = flags & OMRPORT_MMAP_ADVICE_MASK;
+#if !defined(MAP_POPULATE)
+		if (OMR_ARE_ANY_BITS_SET(flags, OMRPORT_MMAP_FLAG_POPULATE)) {
+			advice |= OMRPORT_MMAP_FLAG_ADVISE_WILLNEED;
+		}
+#endif /* !defined(MAP_POPULATE) */
+		if ((0 != advice) && (0 != size)) {
+			omrmmap_advise(portLibrary, pointer, size, advice);
+		}
+	}
+
 	/* Completed, return */
 	Trc_PRT_mmap_map_file_unix_exiting(pointer, returnVal);
 	return returnVal;
@@ -426,6 +449,9 @@ omrmmap_startup(struct OMRPortLibrary *portLibrary)
  * @return a bit map containing the capabilites supported by the omrmmap sub component of the port library.
  * Possible bit values:
  *   OMRPORT_MMAP_CAPABILITY_COPYONWRITE - if not present, platform is not capable of "copy on write" memory mapping.
+ *   OMRPORT_MMAP_CAPABILITY_ADVISE - access pattern hints are passed to the operating system.
+ *   OMRPORT_MMAP_CAPABILITY_POPULATE - OMRPORT_MMAP_FLAG_POPULATE faults mappings in as they are created.
+ *   OMRPORT_MMAP_CAPABILITY_HUGE_PAGES - OMRPORT_MMAP_FLAG_HUGE_PAGES is passed to the operating system.
  *
  */
 int32_t
@@ -436,6 +462,15 @@ omrmmap_capabilities(struct OMRPortLibrary *portLibrary)
 #if !defined(J9ZOS390)
 			| OMRPORT_MMAP_CAPABILITY_PROTECT
 #endif /* defined(J9ZOS390) */
+#if defined(LINUX) || defined(OSX)
+			| OMRPORT_MMAP_CAPABILITY_ADVISE
+#endif /* defined(LINUX) || defined(OSX) */
+#if defined(MAP_POPULATE)
+			| OMRPORT_MMAP_CAPABILITY_POPULATE
+#endif /* defined(MAP_POPULATE) */
+#if defined(LINUX) && defined(MADV_HUGEPAGE)
+			| OMRPORT_MMAP_CAPABILITY_HUGE_PAGES
+#endif /* defined(LINUX) && defined(MADV_HUGEPAGE) */
 			/* If JSE platforms include WRITE and MSYNC */
 #if ((defined(LINUX) && defined(J9X86)) \
   || (defined(LINUXPPC)) \
@@ -518,3 +553,79 @@ omrmmap_dont_need(struct OMRPortLibrary *portLibrary, const void *startAddress,
 		}
 	}
 }
+
+/**
+ * Advise the operating system how a range of mapped memory will be accessed, so that it can
+ * read file data ahead of the faults that would otherwise wait for it.
+ * @note The range is widened to whole pages; unlike omrmmap_dont_need, a hint can't discard data.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] startAddress start address of the range
+ * @param[in] length number of bytes in the range
+ * @param[in] advice a combination of OMRPORT_MMAP_FLAG_ADVISE_SEQUENTIAL or OMRPORT_MMAP_FLAG_ADVISE_RANDOM,
+ * OMRPORT_MMAP_FLAG_ADVISE_WILLNEED and OMRPORT_MMAP_FLAG_HUGE_PAGES
+ *
+ * @return 0 on success, OMRPORT_ERROR_MMAP_MAP_FILE_INVALIDFLAGS if advice is not valid,
+ * OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM if a hint is not supported or OMRPORT_ERROR_MMAP_ADVISE_FAILED
+ * if the operating system rejected a hint
+ */
+int32_t
+omrmmap_advise(struct OMRPortLibrary *portLibrary, void *startAddress, uintptr_t length, uint32_t advice)
+{
+	int32_t rc = 0;
+
+	Trc_PRT_mmap_advise_entered(startAddress, length, advice);
+
+	if (OMR_ARE_ANY_BITS_SET(advice, ~(uint32_t)OMRPORT_MMAP_ADVICE_MASK)
+		|| OMR_ARE_ALL_BITS_SET(advice, OMRPORT_MMAP_FLAG_ADVISE_SEQUENTIAL | OMRPORT_MMAP_FLAG_ADVISE_RANDOM)
+	) {
+		portLibrary->error_set_last_error(portLibrary, -1, OMRPORT_ERROR_MMAP_MAP_FILE_INVALIDFLAGS);
+		rc = OMRPORT_ERROR_MMAP_MAP_FILE_INVALIDFLAGS;
+	} else {
+#if defined(LINUX) || defined(OSX)
+		uintptr_t pageSize = portLibrary->mmap_get_region_granularity(portLibrary, startAddress);
+		uintptr_t roundedStart = (uintptr_t)startAddress;
+		uintptr_t roundedLength = length;
+		int hints[4];
+		uintptr_t hintCount = 0;
+		uintptr_t i = 0;
+
+		if (0 != pageSize) {
+			roundedStart = ROUND_DOWN_TO_POWEROF2((uintptr_t)startAddress, pageSize);
+			roundedLength = ROUND_UP_TO_POWEROF2((uintptr_t)startAddress + length, pageSize) - roundedStart;
+		}
+		if (OMR_ARE_ANY_BITS_SET(advice, OMRPORT_MMAP_FLAG_ADVISE_SEQUENTIAL)) {
+			hints[hintCount++] = MADV_SEQUENTIAL;
+		}
+		if (OMR_ARE_ANY_BITS_SET(advice, OMRPORT_MMAP_FLAG_ADVISE_RANDOM)) {
+			hints[hintCount++] = MADV_RANDOM;
+		}
+		if (OMR_ARE_ANY_BITS_SET(advice, OMRPORT_MMAP_FLAG_HUGE_PAGES)) {
+#if defined(LINUX) && defined(MADV_HUGEPAGE)
+			/* Takes effect for file systems that can cache files in huge pages, e.g. tmpfs */
+			hints[hintCount++] = MADV_HUGEPAGE;
+#else /* defined(LINUX) && defined(MADV_HUGEPAGE) */
+			rc = OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+#endif /* defined(LINUX) && defined(MADV_HUGEPAGE) */
+		}
+		/* Ask for read ahead last, so that it follows the access pattern */
+		if (OMR_ARE_ANY_BITS_SET(advice, OMRPORT_MMAP_FLAG_ADVISE_WILLNEED)) {
+			hints[hintCount++] = MADV_WILLNEED;
+		}
+
+		for (i = 0; i < hintCount; i++) {
+			Trc_PRT_mmap_advise_oscall((void *)roundedStart, roundedLength, hints[i]);
+			if (-1 == madvise((void *)roundedStart, roundedLength, hints[i])) {
+				Trc_PRT_mmap_advise_madvise_failed((void *)roundedStart, roundedLength, hints[i], errno);
+				portLibrary->error_set_last_error(portLibrary, errno, OMRPORT_ERROR_MMAP_ADVISE_FAILED);
+				rc = OMRPORT_ERROR_MMAP_ADVISE_FAILED;
+			}
+		}
+#else /* defined(LINUX) || defined(OSX) */
+		rc = OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+#endif /* defined(LINUX) || defined(OSX) */
+	}
+
+	Trc_PRT_mmap_advise_exit(rc);
+	return rc;
+}
@@ -26,6 +26,13 @@
  * @brief Sockets
  */
 
+#if defined(LINUX) && !defined(OMRZTPF)
+/* defining _GNU_SOURCE allows the use of sendmmsg() and recvmmsg() in sys/socket.h */
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#endif /* defined(LINUX) && !defined(OMRZTPF) */
+
 #include "omrcfg.h"
 #include "omrsock.h"
 
@@ -39,6 +46,7 @@
 #include "omrport.h"
 #include "omrporterror.h"
 #include "omrsockptb.h"
+#include "omrutilbase.h"
 
 #if defined(J9ZOS390) && !defined(OMR_EBCDIC)
 #include "atoe.h"
@@ -153,6 +161,7 @@ get_os_socket_level(int32_t socketLevel)
  * \arg SO_RCVTIMEO, the receive timeout.
  * \arg SO_SNDTIMEO, the send timeout.
  * \arg TCP_NODELAY, the buffering scheme disabling Nagle's algorithm.
+ * \arg SO_ZEROCOPY, sends with MSG_ZEROCOPY avoid copying the data, where the OS supports it.
  *
  * @param[in] socketOption The portable socket option to convert.
  *
@@ -174,6 +183,10 @@ get_os_socket_option(int32_t socketOption)
 		return OS_SO_SNDTIMEO;
 	case OMRSOCK_TCP_NODELAY:
 		return OS_TCP_NODELAY;
+#if defined(OS_SO_ZEROCOPY)
+	case OMRSOCK_SO_ZEROCOPY:
+		return OS_SO_ZEROCOPY;
+#endif /* defined(OS_SO_ZEROCOPY) */
 	default:
 		break;
 	}
@@ -239,6 +252,70 @@ get_os_poll_constant(int16_t omrPollConstant)
 	return osPollConstant;
 }
 
+/**
+ * @internal Map OMRSOCK API user interface message flags to OS message flags.
+ *
+ * OMRSOCK_MSG_WAITFORONE and OMRSOCK_MSG_ZEROCOPY are dropped where the OS does not
+ * support them, which leaves the call blocking for every message or copying the data.
+ *
+ * @param omrFlags The OMR message flags to be converted.
+ *
+ * @return OS message flags.
+ */
+static int32_t
+get_os_msg_flags(int32_t omrFlags)
+{
+	int32_t osFlags = 0;
+
+	if (OMR_ARE_ANY_BITS_SET(omrFlags, OMRSOCK_MSG_DONTWAIT)) {
+		osFlags |= OS_MSG_DONTWAIT;
+	}
+#if defined(OS_MSG_WAITFORONE)
+	if (OMR_ARE_ANY_BITS_SET(omrFlags, OMRSOCK_MSG_WAITFORONE)) {
+		osFlags |= OS_MSG_WAITFORONE;
+	}
+#endif /* defined(OS_MSG_WAITFORONE) */
+#if defined(OS_MSG_ZEROCOPY)
+	if (OMR_ARE_ANY_BITS_SET(omrFlags, OMRSOCK_MSG_ZEROCOPY)) {
+		osFlags |= OS_MSG_ZEROCOPY;
+	}
+#endif /* defined(OS_MSG_ZEROCOPY) */
+
+	return osFlags;
+}
+
+#if defined(OMRSOCK_LINUX_EPOLL)
+/**
+ * @internal Map OMRSOCK API user interface poll constants and event loop flags
+ * to epoll events.
+ *
+ * @param omrEvents The OMR poll constants and event loop flags to be converted.
+ *
+ * @return epoll events.
+ */
+static uint32_t
+get_os_epoll_events(uint32_t omrEvents)
+{
+	uint32_t osEvents = 0;
+
+	if (OMR_ARE_ANY_BITS_SET(omrEvents, OMRSOCK_POLLIN)) {
+		osEvents |= EPOLLIN;
+	}
+	if (OMR_ARE_ANY_BITS_SET(omrEvents, OMRSOCK_POLLOUT)) {
+		osEvents |= EPOLLOUT;
+	}
+	if (OMR_ARE_ANY_BITS_SET(omrEvents, OMRSOCK_EVENT_EDGE_TRIGGERED)) {
+		osEvents |= EPOLLET;
+	}
+	if (OMR_ARE_ANY_BITS_SET(omrEvents, OMRSOCK_EVENT_ONESHOT)) {
+		osEvents |= EPOLLONESHOT;
+	}
+	/* EPOLLERR and EPOLLHUP are always reported. */
+
+	return osEvents;
+}
+#endif /* defined(OMRSOCK_LINUX_EPOLL) */
+
 /* Internal: OS dependent constants TO OMRSOCK user interface constants mapping. */
 
 /**
@@ -341,6 +418,36 @@ get_omr_poll_constant(int16_t osPollConstant)
 	return omrPollConstant;
 }
 
+#if defined(OMRSOCK_LINUX_EPOLL)
+/**
+ * @internal Map epoll events to OMRSOCK API user interface poll constants.
+ *
+ * @param osEvents The epoll events to be converted.
+ *
+ * @return OMR poll constants.
+ */
+static uint32_t
+get_omr_epoll_events(uint32_t osEvents)
+{
+	uint32_t omrEvents = 0;
+
+	if (OMR_ARE_ANY_BITS_SET(osEvents, EPOLLIN)) {
+		omrEvents |= OMRSOCK_POLLIN;
+	}
+	if (OMR_ARE_ANY_BITS_SET(osEvents, EPOLLOUT)) {
+		omrEvents |= OMRSOCK_POLLOUT;
+	}
+	if (OMR_ARE_ANY_BITS_SET(osEvents, EPOLLERR)) {
+		omrEvents |= OMRSOCK_POLLERR;
+	}
+	if (OMR_ARE_ANY_BITS_SET(osEvents, EPOLLHUP)) {
+		omrEvents |= OMRSOCK_POLLHUP;
+	}
+
+	return omrEvents;
+}
+#endif /* defined(OMRSOCK_LINUX_EPOLL) */
+
 /**
  * @internal
  * Determine the proper omrsock error code to return given a errno error code.
@@ -1269,3 +1376,642 @@ omrsock_getsockopt_timeval(struct OMRPortLibrary *portLibrary, omrsock_socket_t
 {
 	return get_opt(portLibrary, handle->data, optlevel, optname, (void*)&optval->data, sizeof(struct timeval));
 }
+
+#if defined(OMRSOCK_LINUX_EPOLL)
+/**
+ * @internal A socket registered with an event loop. epoll reports the address of the
+ * registration. A thread waiting on the loop may still hold it after the socket is removed,
+ * so it is retired rather than freed until every thread that was waiting then has returned.
+ */
+typedef struct OMRSockEventRegistration {
+	omrsock_socket_t socket;
+	void *userData;
+	struct OMRSockEventRegistration *nextRetired;
+	/* epoch of the loop when the socket was removed from the epoll set */
+	uintptr_t retiredEpoch;
+} OMRSockEventRegistration;
+
+struct OMRSockEventLoop {
+	int epollFd;
+	/* eventfd registered with a NULL registration, written by omrsock_eventloop_wakeup */
+	int wakeupFd;
+	/* indexed by socket descriptor */
+	OMRSockEventRegistration **registrations;
+	uint32_t registrationsLength;
+	/* advanced by the functions that change the loop, once no thread waits from the epoch before it */
+	volatile uintptr_t epoch;
+	/* threads in omrsock_eventloop_wait, indexed by the parity of the epoch they started waiting in */
+	volatile uintptr_t waiters[2];
+	/* registrations of removed sockets, which waiting threads may still hold, most recently removed first */
+	OMRSockEventRegistration *retired;
+};
+
+/* Number of events omrsock_eventloop_wait collects without allocating memory. */
+#define OMRSOCK_EVENTLOOP_STACK_EVENTS 16
+
+/**
+ * @internal Count the calling thread as waiting in the current epoch of the loop.
+ *
+ * The epoch is read again after the thread is counted, so that it is never counted in an
+ * epoch that the loop has already moved past.
+ *
+ * @param loop The event loop.
+ *
+ * @return The epoch to pass to @ref end_eventloop_wait.
+ */
+static uintptr_t
+start_eventloop_wait(struct OMRSockEventLoop *loop)
+{
+	uintptr_t epoch = compareAndSwapUDATA((uintptr_t *)&loop->epoch, 0, 0);
+
+	for (;;) {
+		uintptr_t currentEpoch = 0;
+
+		addAtomic(&loop->waiters[epoch & 1], 1);
+		currentEpoch = compareAndSwapUDATA((uintptr_t *)&loop->epoch, 0, 0);
+		if (currentEpoch == epoch) {
+			break;
+		}
+		subtractAtomic(&loop->waiters[epoch & 1], 1);
+		epoch = currentEpoch;
+	}
+
+	return epoch;
+}
+
+/**
+ * @internal Stop counting the calling thread as waiting on the loop.
+ *
+ * @param loop The event loop.
+ * @param epoch The epoch returned by @ref start_eventloop_wait.
+ */
+static void
+end_eventloop_wait(struct OMRSockEventLoop *loop, uintptr_t epoch)
+{
+	subtractAtomic(&loop->waiters[epoch & 1], 1);
+}
+
+/**
+ * @internal Free the registrations of removed sockets that no waiting thread can hold.
+ *
+ * The loop moves to the next epoch once every thread that started waiting in the epoch
+ * before the current one has returned, so only threads from the current and previous epochs
+ * can still be waiting. A registration removed two or more epochs ago was removed from the
+ * epoll set before any of them started waiting, and none of them can be given it. Called
+ * by the functions that change the loop, which are not called concurrently with each other.
+ *
+ * @param portLibrary The port library.
+ * @param loop The event loop.
+ */
+static void
+free_retired_registrations(struct OMRPortLibrary *portLibrary, struct OMRSockEventLoop *loop)
+{
+	OMRSockEventRegistration **link = &loop->retired;
+	OMRSockEventRegistration *registration = NULL;
+	uintptr_t epoch = loop->epoch;
+	uintptr_t i = 0;
+
+	if (NULL == loop->retired) {
+		return;
+	}
+
+	/* A registration removed in the current epoch can be freed after two advances. */
+	for (i = 0; i < 2; i++) {
+		if (0 != compareAndSwapUDATA((uintptr_t *)&loop->waiters[(epoch - 1) & 1], 0, 0)) {
+			break;
+		}
+		epoch = addAtomic(&loop->epoch, 1);
+	}
+
+	while ((NULL != *link) && ((epoch - (*link)->retiredEpoch) < 2)) {
+		link = &(*link)->nextRetired;
+	}
+	registration = *link;
+	*link = NULL;
+	while (NULL != registration) {
+		OMRSockEventRegistration *next = registration->nextRetired;
+		portLibrary->mem_free_memory(portLibrary, registration);
+		registration = next;
+	}
+}
+#endif /* defined(OMRSOCK_LINUX_EPOLL) */
+
+/* Number of messages omrsock_sendmmsg and omrsock_recvmmsg describe without allocating memory. */
+#define OMRSOCK_MMSG_STACK_MSGS 8
+
+int32_t
+omrsock_eventloop_create(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t *loop)
+{
+#if defined(OMRSOCK_LINUX_EPOLL)
+	struct OMRSockEventLoop *newLoop = NULL;
+	struct epoll_event event;
+	int32_t rc = 0;
+
+	if (NULL == loop) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+	*loop = NULL;
+
+	newLoop = (struct OMRSockEventLoop *)portLibrary->mem_allocate_memory(portLibrary, sizeof(struct OMRSockEventLoop), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == newLoop) {
+		return OMRPORT_ERROR_SYSTEMFULL;
+	}
+	memset(newLoop, 0, sizeof(struct OMRSockEventLoop));
+	newLoop->wakeupFd = -1;
+
+	newLoop->epollFd = epoll_create1(EPOLL_CLOEXEC);
+	if (0 > newLoop->epollFd) {
+		rc = portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+		goto fail;
+	}
+
+	newLoop->wakeupFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+	if (0 > newLoop->wakeupFd) {
+		rc = portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+		goto fail;
+	}
+
+	/* Level triggered, so that every waiting thread sees the wakeup until one drains it. */
+	memset(&event, 0, sizeof(event));
+	event.events = EPOLLIN;
+	event.data.ptr = NULL;
+	if (0 != epoll_ctl(newLoop->epollFd, EPOLL_CTL_ADD, newLoop->wakeupFd, &event)) {
+		rc = portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+		goto fail;
+	}
+
+	*loop = newLoop;
+	return 0;
+
+fail:
+	if (0 <= newLoop->wakeupFd) {
+		close(newLoop->wakeupFd);
+	}
+	if (0 <= newLoop->epollFd) {
+		close(newLoop->epollFd);
+	}
+	portLibrary->mem_free_memory(portLibrary, newLoop);
+	return rc;
+#else /* defined(OMRSOCK_LINUX_EPOLL) */
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+#endif /* defined(OMRSOCK_LINUX_EPOLL) */
+}
+
+int32_t
+omrsock_eventloop_add(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock, uint32_t events, void *userData)
+{
+#if defined(OMRSOCK_LINUX_EPOLL)
+	OMRSockEventRegistration *registration = NULL;
+	struct epoll_event event;
+	uint32_t fd = 0;
+
+	if ((NULL == loop) || (NULL == sock) || (0 > sock->data)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+	fd = (uint32_t)sock->data;
+
+	if (fd >= loop->registrationsLength) {
+		uint32_t newLength = OMR_MAX(fd + 1, 2 * loop->registrationsLength);
+		OMRSockEventRegistration **newRegistrations = (OMRSockEventRegistration **)portLibrary->mem_reallocate_memory(portLibrary,
+				loop->registrations, newLength * sizeof(OMRSockEventRegistration *), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+		if (NULL == newRegistrations) {
+			return OMRPORT_ERROR_SYSTEMFULL;
+		}
+		memset(newRegistrations + loop->registrationsLength, 0, (newLength - loop->registrationsLength) * sizeof(OMRSockEventRegistration *));
+		loop->registrations = newRegistrations;
+		loop->registrationsLength = newLength;
+	}
+	if (NULL != loop->registrations[fd]) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+
+	registration = (OMRSockEventRegistration *)portLibrary->mem_allocate_memory(portLibrary, sizeof(OMRSockEventRegistration), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == registration) {
+		return OMRPORT_ERROR_SYSTEMFULL;
+	}
+	registration->socket = sock;
+	registration->userData = userData;
+	registration->nextRetired = NULL;
+	registration->retiredEpoch = 0;
+
+	memset(&event, 0, sizeof(event));
+	event.events = get_os_epoll_events(events);
+	event.data.ptr = registration;
+	if (0 != epoll_ctl(loop->epollFd, EPOLL_CTL_ADD, sock->data, &event)) {
+		portLibrary->mem_free_memory(portLibrary, registration);
+		return portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+	}
+	loop->registrations[fd] = registration;
+	free_retired_registrations(portLibrary, loop);
+
+	return 0;
+#else /* defined(OMRSOCK_LINUX_EPOLL) */
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+#endif /* defined(OMRSOCK_LINUX_EPOLL) */
+}
+
+int32_t
+omrsock_eventloop_modify(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock, uint32_t events, void *userData)
+{
+#if defined(OMRSOCK_LINUX_EPOLL)
+	OMRSockEventRegistration *registration = NULL;
+	struct epoll_event event;
+
+	if ((NULL == loop) || (NULL == sock) || (0 > sock->data) || ((uint32_t)sock->data >= loop->registrationsLength)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+	registration = loop->registrations[sock->data];
+	if (NULL == registration) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+	registration->userData = userData;
+
+	memset(&event, 0, sizeof(event));
+	event.events = get_os_epoll_events(events);
+	event.data.ptr = registration;
+	if (0 != epoll_ctl(loop->epollFd, EPOLL_CTL_MOD, sock->data, &event)) {
+		return portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+	}
+
+	return 0;
+#else /* defined(OMRSOCK_LINUX_EPOLL) */
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+#endif /* defined(OMRSOCK_LINUX_EPOLL) */
+}
+
+int32_t
+omrsock_eventloop_remove(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_socket_t sock)
+{
+#if defined(OMRSOCK_LINUX_EPOLL)
+	OMRSockEventRegistration *registration = NULL;
+	struct epoll_event event;
+	int32_t rc = 0;
+
+	if ((NULL == loop) || (NULL == sock) || (0 > sock->data) || ((uint32_t)sock->data >= loop->registrationsLength)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+	registration = loop->registrations[sock->data];
+	if (NULL == registration) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+
+	/* Kernels before 2.6.9 require a non-NULL event for EPOLL_CTL_DEL. */
+	memset(&event, 0, sizeof(event));
+	if (0 != epoll_ctl(loop->epollFd, EPOLL_CTL_DEL, sock->data, &event)) {
+		rc = portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+	}
+	loop->registrations[sock->data] = NULL;
+	registration->retiredEpoch = loop->epoch;
+	registration->nextRetired = loop->retired;
+	loop->retired = registration;
+	free_retired_registrations(portLibrary, loop);
+
+	return rc;
+#else /* defined(OMRSOCK_LINUX_EPOLL) */
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+#endif /* defined(OMRSOCK_LINUX_EPOLL) */
+}
+
+int32_t
+omrsock_eventloop_wait(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop, omrsock_event_t events, uint32_t maxEvents, int32_t timeoutMs)
+{
+#if defined(OMRSOCK_LINUX_EPOLL)
+	struct epoll_event osEventsArray[OMRSOCK_EVENTLOOP_STACK_EVENTS];
+	struct epoll_event *osEvents = osEventsArray;
+	int32_t numOsEvents = 0;
+	int32_t numEvents = 0;
+	int32_t i = 0;
+	uintptr_t epoch = 0;
+
+	if ((NULL == loop) || (NULL == events) || (0 == maxEvents)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+	maxEvents = OMR_MIN(maxEvents, (uint32_t)INT32_MAX / sizeof(struct epoll_event));
+
+	if (OMRSOCK_EVENTLOOP_STACK_EVENTS < maxEvents) {
+		osEvents = (struct epoll_event *)portLibrary->mem_allocate_memory(portLibrary, maxEvents * sizeof(struct epoll_event), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+		if (NULL == osEvents) {
+			return OMRPORT_ERROR_SYSTEMFULL;
+		}
+	}
+
+	/* Removed registrations are not freed until the events that refer to them have been read. */
+	epoch = start_eventloop_wait(loop);
+	numOsEvents = epoll_wait(loop->epollFd, osEvents, (int)maxEvents, timeoutMs);
+	if (0 > numOsEvents) {
+		numEvents = portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+	}
+
+	for (i = 0; i < numOsEvents; i++) {
+		OMRSockEventRegistration *registration = (OMRSockEventRegistration *)osEvents[i].data.ptr;
+
+		if (NULL == registration) {
+			uint64_t wakeups = 0;
+			/* Drain the wakeups, unless another waiting thread has done so already. */
+			ssize_t bytesRead = read(loop->wakeupFd, &wakeups, sizeof(wakeups));
+			(void)bytesRead;
+			continue;
+		}
+		events[numEvents].socket = registration->socket;
+		events[numEvents].userData = registration->userData;
+		events[numEvents].events = get_omr_epoll_events(osEvents[i].events);
+		numEvents += 1;
+	}
+	end_eventloop_wait(loop, epoch);
+
+	if (osEventsArray != osEvents) {
+		portLibrary->mem_free_memory(portLibrary, osEvents);
+	}
+
+	return numEvents;
+#else /* defined(OMRSOCK_LINUX_EPOLL) */
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+#endif /* defined(OMRSOCK_LINUX_EPOLL) */
+}
+
+int32_t
+omrsock_eventloop_wakeup(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t loop)
+{
+#if defined(OMRSOCK_LINUX_EPOLL)
+	uint64_t wakeup = 1;
+
+	if (NULL == loop) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+	/* EAGAIN means the counter is saturated, so a wakeup is already pending. */
+	if ((sizeof(wakeup) != write(loop->wakeupFd, &wakeup, sizeof(wakeup))) && (EAGAIN != errno)) {
+		return portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+	}
+
+	return 0;
+#else /* defined(OMRSOCK_LINUX_EPOLL) */
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+#endif /* defined(OMRSOCK_LINUX_EPOLL) */
+}
+
+int32_t
+omrsock_eventloop_destroy(struct OMRPortLibrary *portLibrary, omrsock_eventloop_t *loop)
+{
+#if defined(OMRSOCK_LINUX_EPOLL)
+	uint32_t i = 0;
+
+	if ((NULL == loop) || (NULL == *loop)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+
+	for (i = 0; i < (*loop)->registrationsLength; i++) {
+		if (NULL != (*loop)->registrations[i]) {
+			portLibrary->mem_free_memory(portLibrary, (*loop)->registrations[i]);
+		}
+	}
+	if (NULL != (*loop)->registrations) {
+		portLibrary->mem_free_memory(portLibrary, (*loop)->registrations);
+	}
+	while (NULL != (*loop)->retired) {
+		OMRSockEventRegistration *next = (*loop)->retired->nextRetired;
+		portLibrary->mem_free_memory(portLibrary, (*loop)->retired);
+		(*loop)->retired = next;
+	}
+	close((*loop)->wakeupFd);
+	close((*loop)->epollFd);
+	portLibrary->mem_free_memory(portLibrary, *loop);
+	*loop = NULL;
+
+	return 0;
+#else /* defined(OMRSOCK_LINUX_EPOLL) */
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+#endif /* defined(OMRSOCK_LINUX_EPOLL) */
+}
+
+/**
+ * @internal Get the length of the socket address in addr, as passed to the OS.
+ *
+ * @param addr The socket address.
+ *
+ * @return The length of the address.
+ */
+static socklen_t
+get_sockaddr_length(omrsock_sockaddr_t addr)
+{
+	if (OS_SOCK_AF_INET == addr->data.ss_family) {
+		return sizeof(omr_os_sockaddr_in);
+	}
+	return sizeof(omr_os_sockaddr_in6);
+}
+
+int32_t
+omrsock_sendmmsg(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, omrsock_msg_t msgs, uint32_t count, int32_t flags)
+{
+	int32_t osFlags = get_os_msg_flags(flags);
+#if defined(OMRSOCK_LINUX_EPOLL)
+	struct mmsghdr hdrsArray[OMRSOCK_MMSG_STACK_MSGS];
+	struct iovec iovsArray[OMRSOCK_MMSG_STACK_MSGS];
+	struct mmsghdr *hdrs = hdrsArray;
+	struct iovec *iovs = iovsArray;
+	int32_t numSent = 0;
+	uint32_t i = 0;
+
+	if ((NULL == sock) || (NULL == msgs) || (0 == count)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+	/* The kernel sends at most UIO_MAXIOV messages per call. */
+	count = OMR_MIN(count, 1024);
+
+	if (OMRSOCK_MMSG_STACK_MSGS < count) {
+		hdrs = (struct mmsghdr *)portLibrary->mem_allocate_memory(portLibrary, count * (sizeof(struct mmsghdr) + sizeof(struct iovec)), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+		if (NULL == hdrs) {
+			return OMRPORT_ERROR_SYSTEMFULL;
+		}
+		iovs = (struct iovec *)(hdrs + count);
+	}
+
+	memset(hdrs, 0, count * sizeof(struct mmsghdr));
+	for (i = 0; i < count; i++) {
+		iovs[i].iov_base = msgs[i].buf;
+		iovs[i].iov_len = msgs[i].nbyte;
+		hdrs[i].msg_hdr.msg_iov = &iovs[i];
+		hdrs[i].msg_hdr.msg_iovlen = 1;
+		if (NULL != msgs[i].addr) {
+			hdrs[i].msg_hdr.msg_name = &msgs[i].addr->data;
+			hdrs[i].msg_hdr.msg_namelen = get_sockaddr_length(msgs[i].addr);
+		}
+	}
+
+	numSent = sendmmsg(sock->data, hdrs, count, osFlags);
+	if (0 > numSent) {
+		numSent = portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+	} else {
+		for (i = 0; i < (uint32_t)numSent; i++) {
+			msgs[i].length = hdrs[i].msg_len;
+		}
+	}
+
+	if (hdrsArray != hdrs) {
+		portLibrary->mem_free_memory(portLibrary, hdrs);
+	}
+
+	return numSent;
+#else /* defined(OMRSOCK_LINUX_EPOLL) */
+	uint32_t i = 0;
+
+	if ((NULL == sock) || (NULL == msgs) || (0 == count)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+	count = OMR_MIN(count, INT32_MAX);
+
+	for (i = 0; i < count; i++) {
+		ssize_t bytesSent = 0;
+
+		if (NULL != msgs[i].addr) {
+			bytesSent = sendto(sock->data, msgs[i].buf, msgs[i].nbyte, osFlags, (omr_os_sockaddr *)&msgs[i].addr->data, get_sockaddr_length(msgs[i].addr));
+		} else {
+			bytesSent = send(sock->data, msgs[i].buf, msgs[i].nbyte, osFlags);
+		}
+		if (0 > bytesSent) {
+			if (0 == i) {
+				return portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+			}
+			break;
+		}
+		msgs[i].length = (uint32_t)bytesSent;
+		if (msgs[i].length < msgs[i].nbyte) {
+			/* A stream socket's send buffer is full, the following messages would block. */
+			i += 1;
+			break;
+		}
+	}
+
+	return (int32_t)i;
+#endif /* defined(OMRSOCK_LINUX_EPOLL) */
+}
+
+int32_t
+omrsock_recvmmsg(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, omrsock_msg_t msgs, uint32_t count, int32_t flags)
+{
+	int32_t osFlags = get_os_msg_flags(flags);
+#if defined(OMRSOCK_LINUX_EPOLL)
+	struct mmsghdr hdrsArray[OMRSOCK_MMSG_STACK_MSGS];
+	struct iovec iovsArray[OMRSOCK_MMSG_STACK_MSGS];
+	struct mmsghdr *hdrs = hdrsArray;
+	struct iovec *iovs = iovsArray;
+	int32_t numRecv = 0;
+	uint32_t i = 0;
+
+	if ((NULL == sock) || (NULL == msgs) || (0 == count)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+	/* The kernel receives at most UIO_MAXIOV messages per call. */
+	count = OMR_MIN(count, 1024);
+
+	if (OMRSOCK_MMSG_STACK_MSGS < count) {
+		hdrs = (struct mmsghdr *)portLibrary->mem_allocate_memory(portLibrary, count * (sizeof(struct mmsghdr) + sizeof(struct iovec)), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+		if (NULL == hdrs) {
+			return OMRPORT_ERROR_SYSTEMFULL;
+		}
+		iovs = (struct iovec *)(hdrs + count);
+	}
+
+	memset(hdrs, 0, count * sizeof(struct mmsghdr));
+	for (i = 0; i < count; i++) {
+		iovs[i].iov_base = msgs[i].buf;
+		iovs[i].iov_len = msgs[i].nbyte;
+		hdrs[i].msg_hdr.msg_iov = &iovs[i];
+		hdrs[i].msg_hdr.msg_iovlen = 1;
+		if (NULL != msgs[i].addr) {
+			hdrs[i].msg_hdr.msg_name = &msgs[i].addr->data;
+			hdrs[i].msg_hdr.msg_namelen = sizeof(omr_os_sockaddr_storage);
+		}
+	}
+
+	numRecv = recvmmsg(sock->data, hdrs, count, osFlags, NULL);
+	if (0 > numRecv) {
+		numRecv = portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+	} else {
+		for (i = 0; i < (uint32_t)numRecv; i++) {
+			msgs[i].length = hdrs[i].msg_len;
+		}
+	}
+
+	if (hdrsArray != hdrs) {
+		portLibrary->mem_free_memory(portLibrary, hdrs);
+	}
+
+	return numRecv;
+#else /* defined(OMRSOCK_LINUX_EPOLL) */
+	uint32_t i = 0;
+
+	if ((NULL == sock) || (NULL == msgs) || (0 == count)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+	count = OMR_MIN(count, INT32_MAX);
+
+	for (i = 0; i < count; i++) {
+		ssize_t bytesRecv = 0;
+
+		if (NULL != msgs[i].addr) {
+			socklen_t addrLength = sizeof(omr_os_sockaddr_storage);
+			bytesRecv = recvfrom(sock->data, msgs[i].buf, msgs[i].nbyte, osFlags, (omr_os_sockaddr *)&msgs[i].addr->data, &addrLength);
+		} else {
+			bytesRecv = recv(sock->data, msgs[i].buf, msgs[i].nbyte, osFlags);
+		}
+		if (0 > bytesRecv) {
+			if (0 == i) {
+				return portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+			}
+			break;
+		}
+		msgs[i].length = (uint32_t)bytesRecv;
+		if (0 == bytesRecv) {
+			/* The peer has shut down the connection. */
+			i += 1;
+			break;
+		}
+		if (OMR_ARE_ANY_BITS_SET(flags, OMRSOCK_MSG_WAITFORONE)) {
+			osFlags |= OS_MSG_DONTWAIT;
+		}
+	}
+
+	return (int32_t)i;
+#endif /* defined(OMRSOCK_LINUX_EPOLL) */
+}
+
+int32_t
+omrsock_zerocopy_complete(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, uint32_t *first, uint32_t *last, BOOLEAN *copied)
+{
+#if defined(OS_MSG_ZEROCOPY)
+	char control[CMSG_SPACE(sizeof(struct sock_extended_err) + sizeof(omr_os_sockaddr_storage))];
+	struct msghdr msg;
+	struct cmsghdr *cmsg = NULL;
+
+	if ((NULL == sock) || (NULL == first) || (NULL == last) || (NULL == copied)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_control = control;
+	msg.msg_controllen = sizeof(control);
+	if (0 > recvmsg(sock->data, &msg, MSG_ERRQUEUE)) {
+		return portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+	}
+
+	for (cmsg = CMSG_FIRSTHDR(&msg); NULL != cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+		if (((IPPROTO_IP == cmsg->cmsg_level) && (IP_RECVERR == cmsg->cmsg_type))
+			|| ((IPPROTO_IPV6 == cmsg->cmsg_level) && (IPV6_RECVERR == cmsg->cmsg_type))
+		) {
+			struct sock_extended_err *error = (struct sock_extended_err *)CMSG_DATA(cmsg);
+
+			if ((SO_EE_ORIGIN_ZEROCOPY == error->ee_origin) && (0 == error->ee_errno)) {
+				*first = error->ee_info;
+				*last = error->ee_data;
+				*copied = OMR_ARE_ANY_BITS_SET(error->ee_code, SO_EE_CODE_ZEROCOPY_COPIED) ? TRUE : FALSE;
+				return 0;
+			}
+		}
+	}
+
+	/* The error queue held a notification other than a send completion. */
+	return OMRPORT_ERROR_OPFAILED;
+#else /* defined(OS_MSG_ZEROCOPY) */
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+#endif /* defined(OS_MSG_ZEROCOPY) */
+}
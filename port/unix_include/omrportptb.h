@@ -65,6 +65,8 @@ typedef struct PortlibPTBuffers_struct {
 	char *reportedMessageBuffer; /**< last reported error message, either customized or from OS */
 	uintptr_t reportedMessageBufferSize; /**< reported message buffer size */
 
+	struct OMRMemArena *scratchArena; /**< per thread scratch arena, created on first use */
+
 #if defined(J9VM_PROVIDE_ICONV)
 	iconv_t converterCache[UNCACHED_ICONV_DESCRIPTOR]; /**< Everything in J9IconvName before UNCACHED_ICONV_DESCRIPTOR is cached */
 #endif /* J9VM_PROVIDE_ICONV */
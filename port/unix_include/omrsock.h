@@ -40,6 +40,14 @@
 #include <netinet/in.h> /* Must come before <netinet/tcp.h> */
 #include <netinet/tcp.h>
 
+#if defined(LINUX) && !defined(OMRZTPF)
+/* Event loops use epoll, and batched sends and receives use sendmmsg() and recvmmsg(). */
+#define OMRSOCK_LINUX_EPOLL
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <linux/errqueue.h>
+#endif /* defined(LINUX) && !defined(OMRZTPF) */
+
 typedef struct sockaddr omr_os_sockaddr;
 typedef struct sockaddr_in omr_os_sockaddr_in; /* IPv4 */
 typedef struct sockaddr_in6 omr_os_sockaddr_in6; /* IPv6 */
@@ -67,6 +75,9 @@ typedef struct sockaddr_in6 omr_os_sockaddr_in6; /* IPv6 */
 #define OS_SO_RCVTIMEO SO_RCVTIMEO
 #define OS_SO_SNDTIMEO SO_SNDTIMEO
 #define OS_TCP_NODELAY TCP_NODELAY
+#if defined(SO_ZEROCOPY)
+#define OS_SO_ZEROCOPY SO_ZEROCOPY
+#endif /* defined(SO_ZEROCOPY) */
 
 /* Socket Flags */
 #if defined(J9ZOS390)
@@ -88,4 +99,13 @@ typedef struct sockaddr_in6 omr_os_sockaddr_in6; /* IPv6 */
 #define OS_POLLHUP POLLHUP
 #endif
 
+/* Message Flags */
+#define OS_MSG_DONTWAIT MSG_DONTWAIT
+#if defined(MSG_WAITFORONE)
+#define OS_MSG_WAITFORONE MSG_WAITFORONE
+#endif /* defined(MSG_WAITFORONE) */
+#if defined(MSG_ZEROCOPY) && defined(SO_EE_ORIGIN_ZEROCOPY)
+#define OS_MSG_ZEROCOPY MSG_ZEROCOPY
+#endif /* defined(MSG_ZEROCOPY) && defined(SO_EE_ORIGIN_ZEROCOPY) */
+
 #endif /* !defined(OMRSOCK_H_) */
@@ -50,6 +50,10 @@ omrport_free_ptBuffer(struct OMRPortLibrary *portLibrary, PortlibPTBuffers_t ptB
 			portLibrary->mem_free_memory(portLibrary, ptBuffer->reportedMessageBuffer);
 			ptBuffer->reportedMessageBufferSize = 0;
 		}
+		if (NULL != ptBuffer->scratchArena) {
+			portLibrary->mem_arena_destroy(portLibrary, ptBuffer->scratchArena);
+			ptBuffer->scratchArena = NULL;
+		}
 
 		portLibrary->mem_free_memory(portLibrary, ptBuffer);
 	}
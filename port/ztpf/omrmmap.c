@@ -186,3 +186,16 @@ omrmmap_dont_need(struct OMRPortLibrary *portLibrary, const void *startAddress,
         return;
 }
 
+
+/**
+ * Advise the operating system how a range of mapped memory will be accessed.
+ * @param startAddress start address of the range
+ * @param length number of bytes in the range
+ * @param advice a combination of the OMRPORT_MMAP_FLAG_ADVISE_* flags and OMRPORT_MMAP_FLAG_HUGE_PAGES
+ * @return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM
+ */
+I_32
+omrmmap_advise(struct OMRPortLibrary *portLibrary, void *startAddress, UDATA length, U_32 advice)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
@@ -74,9 +74,12 @@ static intptr_t monitor_notify_original(omrthread_t self, omrthread_monitor_t mo
 
 #if defined(OMR_THR_THREE_TIER_LOCKING)
 static intptr_t init_spinCounts(omrthread_library_t lib);
-#if !defined(OMR_THR_MCS_LOCKS)
+#if !defined(OMR_THR_MCS_LOCKS) && !defined(OMR_THR_FUTEX_MONITORS)
 static void unblock_spinlock_threads(omrthread_t self, omrthread_monitor_t monitor);
-#endif /* !defined(OMR_THR_MCS_LOCKS) */
+#endif /* !defined(OMR_THR_MCS_LOCKS) && !defined(OMR_THR_FUTEX_MONITORS) */
+#if defined(OMR_THR_FUTEX_MONITORS)
+static void monitor_wake_next_notified(omrthread_t self, omrthread_monitor_t monitor, omrthread_t *queue);
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 #endif /* OMR_THR_THREE_TIER_LOCKING */
 
 static intptr_t init_threadParam(char *name, uintptr_t *pDefault);
@@ -189,6 +192,17 @@ omrthread_t global_lock_owner = UNOWNED;
 	} while (0)
 #endif /* defined(OMR_OS_WINDOWS) || !defined(OMR_NOTIFY_POLICY_CONTROL) */
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+/*
+ * Threads blocked on entry park on the monitor's futex rather than on their own
+ * condition. A futex wake can't target a single thread, so wake every parked
+ * thread; the ones that weren't meant to be woken will simply park again.
+ */
+#define NOTIFY_BLOCKED_WRAPPER(thread, monitor) omrthread_futex_unpark((monitor), 0)
+#else /* defined(OMR_THR_FUTEX_MONITORS) */
+#define NOTIFY_BLOCKED_WRAPPER(thread, monitor) NOTIFY_WRAPPER(thread)
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 /*
  * Thread Library
  */
@@ -299,6 +313,7 @@ omrthread_init(omrthread_library_t lib)
 	}
 
 	lib->threadWalkMutexesHeld = 0;
+	lib->contentionSampleInterval = J9THREAD_CONTENTION_DEFAULT_SAMPLE_INTERVAL;
 
 	lib->thread_pool = pool_new(sizeof(J9Thread), 0, 0, 0, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_THREADS, omrthread_mallocWrapper, omrthread_freeWrapper, lib);
 	if (lib->thread_pool == NULL) {
@@ -1002,6 +1017,9 @@ postForkResetMonitors(omrthread_t self)
 #if defined(OMR_THR_THREE_TIER_LOCKING)
 				entry->blocking = NULL;
 #endif /* defined(OMR_THR_THREE_TIER_LOCKING) */
+#if defined(OMR_THR_FUTEX_MONITORS)
+				entry->notifiedWaiters = 0;
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 				entry->waiting = NULL;
 				entry->notifyAllWaiting = NULL;
 			}
@@ -2213,6 +2231,7 @@ threadFree(omrthread_t thread, int globalAlreadyLocked)
 	jlm_thread_free(lib, thread);
 #endif
 
+	omrthread_contention_thread_free(lib, thread);
 	pool_removeElement(lib->thread_pool, thread);
 	lib->threadCount--;
 
@@ -2928,7 +2947,7 @@ interrupt_blocked_thread(omrthread_t self, omrthread_t threadToInterrupt)
 	monitor = threadToInterrupt->monitor;
 
 	if (MONITOR_TRY_LOCK(monitor) == 0) {
-		NOTIFY_WRAPPER(threadToInterrupt);
+		NOTIFY_BLOCKED_WRAPPER(threadToInterrupt, monitor);
 	} else {
 		omrthread_monitor_pin(monitor, self);
 		THREAD_UNLOCK(threadToInterrupt);
@@ -2940,7 +2959,7 @@ interrupt_blocked_thread(omrthread_t self, omrthread_t threadToInterrupt)
 			if ((threadToInterrupt->flags &
 				 (J9THREAD_FLAG_BLOCKED | J9THREAD_FLAG_ABORTABLE | J9THREAD_FLAG_ABORTED)) ==
 				(J9THREAD_FLAG_BLOCKED | J9THREAD_FLAG_ABORTABLE | J9THREAD_FLAG_ABORTED)) {
-				NOTIFY_WRAPPER(threadToInterrupt);
+				NOTIFY_BLOCKED_WRAPPER(threadToInterrupt, monitor);
 			}
 		}
 
@@ -3747,6 +3766,11 @@ monitor_init(omrthread_monitor_t monitor, uintptr_t flags, omrthread_library_t l
 #if defined(OMR_THR_SPIN_WAKE_CONTROL)
 	monitor->spinThreads = 0;
 #endif /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
+#if defined(OMR_THR_FUTEX_MONITORS)
+	monitor->futexSequence = 0;
+	monitor->notifiedWaiters = 0;
+	monitor->adaptiveSpinCount3 = monitor->spinCount3;
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 
 	ASSERT(monitor->spinCount1 != 0);
 	ASSERT(monitor->spinCount2 != 0);
@@ -3930,6 +3954,9 @@ omrthread_monitor_enter_abortable_using_threadId(omrthread_monitor_t monitor, om
 static intptr_t
 monitor_enter(omrthread_t self, omrthread_monitor_t monitor)
 {
+	BOOLEAN samplingEnabled = FALSE;
+	BOOLEAN sampleContention = FALSE;
+
 	ASSERT(self);
 	ASSERT(0 == self->monitor);
 	ASSERT(monitor);
@@ -3943,7 +3970,15 @@ monitor_enter(omrthread_t self, omrthread_monitor_t monitor)
 	self->monitor = monitor;
 	THREAD_UNLOCK(self);
 
-	MONITOR_LOCK(monitor, CALLER_MONITOR_ENTER);
+	/* sampling may be turned on or off concurrently, so the setting is read only once */
+	samplingEnabled = IS_CONTENTION_SAMPLING_ENABLED(self);
+	if (!samplingEnabled) {
+		MONITOR_LOCK(monitor, CALLER_MONITOR_ENTER);
+	} else if (0 != MONITOR_TRY_LOCK(monitor)) {
+		/* contended: sample before blocking, while the owner is known */
+		sampleContention = omrthread_contention_sample_due(self) && omrthread_contention_capture(self, monitor);
+		MONITOR_LOCK(monitor, CALLER_MONITOR_ENTER);
+	}
 
 	UPDATE_JLM_MON_ENTER(self, monitor, !IS_RECURSIVE_ENTER, IS_SLOW_ENTER);
 
@@ -3957,6 +3992,10 @@ monitor_enter(omrthread_t self, omrthread_monitor_t monitor)
 	monitor->owner = self;
 	monitor->count = 1;
 
+	if (sampleContention) {
+		omrthread_contention_record(self);
+	}
+
 	ASSERT(0 == self->monitor);
 
 	return 0;
@@ -3980,9 +4019,13 @@ static intptr_t
 monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN isAbortable)
 {
 	int blockedCount = 0;
+	BOOLEAN sampleContention = FALSE;
 #if defined(OMR_THR_MCS_LOCKS)
 	omrthread_mcs_node_t mcsNode = omrthread_mcs_node_allocate(self);
 #endif /* defined(OMR_THR_MCS_LOCKS) */
+#if defined(OMR_THR_FUTEX_MONITORS)
+	uint32_t futexSequence = 0;
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 	ASSERT(self);
 	ASSERT(monitor);
 	ASSERT(monitor->spinCount1 != 0);
@@ -3998,14 +4041,33 @@ monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN
 		if (0 == omrthread_spinlock_acquire(self, monitor))
 #endif /* defined(OMR_THR_MCS_LOCKS) */
 		{
+#if defined(OMR_THR_FUTEX_MONITORS)
+			/*
+			 * Having been woken from the futex, we can't tell whether other threads
+			 * are still parked, so make sure our exit wakes the next one.
+			 */
+			if (0 != blockedCount) {
+				omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_EXCEEDED);
+			}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 			monitor->owner = self;
 			monitor->count = 1;
 			ASSERT(monitor->spinlockState != J9THREAD_MONITOR_SPINLOCK_UNOWNED);
 			break;
 		}
 
+		/* sample before taking the monitor's mutex, so the backtrace does not hold up the owner's exit */
+		if ((0 == blockedCount) && IS_CONTENTION_SAMPLING_ENABLED(self)) {
+			sampleContention = omrthread_contention_sample_due(self) && omrthread_contention_capture(self, monitor);
+		}
+
 		MONITOR_LOCK(monitor, CALLER_MONITOR_ENTER_THREE_TIER1);
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+		/* Must be sampled before advertising ourselves through SPINLOCK_EXCEEDED. */
+		futexSequence = omrthread_futex_sequence(monitor);
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 #if !defined(OMR_THR_MCS_LOCKS)
 		/* For MCS locks, J9THREAD_MONITOR_SPINLOCK_EXCEEDED is unused. */
 		if (J9THREAD_MONITOR_SPINLOCK_UNOWNED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_EXCEEDED)) {
@@ -4053,6 +4115,15 @@ monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN
 			OMROSCOND_WAIT_LOOP();
 			threadDequeue(&monitor->blocking, self);
 		}
+#elif defined(OMR_THR_FUTEX_MONITORS) /* defined(OMR_THR_MCS_LOCKS) */
+		/* Stay on the blocking queue while parked so the thread can still be inspected. */
+		threadEnqueue(&monitor->blocking, self);
+		UPDATE_JLM_FUTEX_COUNT(self, monitor, park_count);
+		MONITOR_UNLOCK(monitor);
+		omrthread_futex_park(monitor, futexSequence);
+		MONITOR_LOCK(monitor, CALLER_MONITOR_ENTER_THREE_TIER5);
+		UPDATE_JLM_FUTEX_COUNT(self, monitor, wakeup_count);
+		threadDequeue(&monitor->blocking, self);
 #else /* defined(OMR_THR_MCS_LOCKS) */
 		threadEnqueue(&monitor->blocking, self);
 		OMROSCOND_WAIT(self->condition, monitor->mutex);
@@ -4108,6 +4179,10 @@ monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN
 
 	UPDATE_JLM_MON_ENTER(self, monitor, !IS_RECURSIVE_ENTER, (blockedCount > 0));
 
+	if (sampleContention) {
+		omrthread_contention_record(self);
+	}
+
 	ASSERT(!(self->flags & J9THREAD_FLAG_BLOCKED));
 	ASSERT(0 == self->monitor);
 
@@ -4116,7 +4191,7 @@ monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN
 #endif /* defined(OMR_THR_THREE_TIER_LOCKING) */
 
 
-#if defined(OMR_THR_THREE_TIER_LOCKING) && !defined(OMR_THR_MCS_LOCKS)
+#if defined(OMR_THR_THREE_TIER_LOCKING) && !defined(OMR_THR_MCS_LOCKS) && !defined(OMR_THR_FUTEX_MONITORS)
 /**
  * Notify all threads blocked on the monitor's mutex, waiting
  * to be told that it's ok to try again to get the spinlock.
@@ -4152,7 +4227,7 @@ unblock_spinlock_threads(omrthread_t self, omrthread_monitor_t monitor)
 	}
 }
 
-#endif /* defined(OMR_THR_THREE_TIER_LOCKING) && !defined(OMR_THR_MCS_LOCKS) */
+#endif /* defined(OMR_THR_THREE_TIER_LOCKING) && !defined(OMR_THR_MCS_LOCKS) && !defined(OMR_THR_FUTEX_MONITORS) */
 
 
 
@@ -4364,6 +4439,10 @@ monitor_exit(omrthread_t self, omrthread_monitor_t monitor)
  			unblock_spinlock_threads(self, monitor);
  		}
  		MONITOR_UNLOCK(monitor);
+#elif defined(OMR_THR_FUTEX_MONITORS) /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
+		if (J9THREAD_MONITOR_SPINLOCK_EXCEEDED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED)) {
+			omrthread_futex_unpark(monitor, 1);
+		}
 #else /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
 		if (J9THREAD_MONITOR_SPINLOCK_EXCEEDED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED)) {
 			MONITOR_LOCK(monitor, CALLER_MONITOR_EXIT1);
@@ -4630,6 +4709,10 @@ monitor_wait_original(omrthread_t self, omrthread_monitor_t monitor,
 	if (0 == monitor->spinThreads) {
 		unblock_spinlock_threads(self, monitor);
 	}
+#elif defined(OMR_THR_FUTEX_MONITORS) /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
+	if (J9THREAD_MONITOR_SPINLOCK_EXCEEDED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED)) {
+		omrthread_futex_unpark(monitor, 1);
+	}
 #else /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
 	if (J9THREAD_MONITOR_SPINLOCK_EXCEEDED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED)) {
 		unblock_spinlock_threads(self, monitor);
@@ -4706,6 +4789,9 @@ monitor_wait_original(omrthread_t self, omrthread_monitor_t monitor,
 	/* we have to remove self from the wait queue */
 	if (monitor_on_notify_all_wait_list(self, monitor)) {
 		queue = &monitor->notifyAllWaiting;
+#if defined(OMR_THR_FUTEX_MONITORS)
+		monitor->notifiedWaiters -= 1;
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 	} else {
 		queue = &monitor->waiting;
 	}
@@ -4765,9 +4851,19 @@ monitor_wait_original(omrthread_t self, omrthread_monitor_t monitor,
 			(BOOLEAN)((interruptible & J9THREAD_FLAG_ABORTABLE)? SET_ABORTABLE: DONT_SET_ABORTABLE))
 		== J9THREAD_INTERRUPTED_MONITOR_ENTER
 	) {
+#if defined(OMR_THR_FUTEX_MONITORS)
+		if (notified) {
+			monitor_wake_next_notified(self, monitor, &monitor->notifyAllWaiting);
+		}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 		/* we don't own the monitor */
 		return J9THREAD_INTERRUPTED_MONITOR_ENTER;
 	}
+#if defined(OMR_THR_FUTEX_MONITORS)
+	if (notified && (0 != monitor->notifiedWaiters)) {
+		monitor_wake_next_notified(self, monitor, &monitor->notifyAllWaiting);
+	}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 #else
 	monitor->owner = self;
 	UPDATE_JLM_MON_ENTER(self, monitor, !IS_RECURSIVE_ENTER, IS_SLOW_ENTER);
@@ -4898,6 +4994,10 @@ monitor_wait_three_tier(omrthread_t self, omrthread_monitor_t monitor,
 	if (0 == monitor->spinThreads) {
 		unblock_spinlock_threads(self, monitor);
 	}
+#elif defined(OMR_THR_FUTEX_MONITORS) /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
+	if (J9THREAD_MONITOR_SPINLOCK_EXCEEDED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED)) {
+		omrthread_futex_unpark(monitor, 1);
+	}
 #else /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
 	if (J9THREAD_MONITOR_SPINLOCK_EXCEEDED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED)) {
 		unblock_spinlock_threads(self, monitor);
@@ -4962,6 +5062,9 @@ monitor_wait_three_tier(omrthread_t self, omrthread_monitor_t monitor,
 	/* we have to remove self from the wait queue */
 	if (notified) {
 		queue = &monitor->blocking;
+#if defined(OMR_THR_FUTEX_MONITORS)
+		monitor->notifiedWaiters -= 1;
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 	} else {
 		queue = &monitor->waiting;
 	}
@@ -5013,9 +5116,19 @@ monitor_wait_three_tier(omrthread_t self, omrthread_monitor_t monitor,
 			(BOOLEAN)((interruptible & J9THREAD_FLAG_ABORTABLE)? SET_ABORTABLE: DONT_SET_ABORTABLE))
 		== J9THREAD_INTERRUPTED_MONITOR_ENTER
 	) {
+#if defined(OMR_THR_FUTEX_MONITORS)
+		if (notified) {
+			monitor_wake_next_notified(self, monitor, &monitor->blocking);
+		}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 		/* we don't own the monitor */
 		return J9THREAD_INTERRUPTED_MONITOR_ENTER;
 	}
+#if defined(OMR_THR_FUTEX_MONITORS)
+	if (notified && (0 != monitor->notifiedWaiters)) {
+		monitor_wake_next_notified(self, monitor, &monitor->blocking);
+	}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 	monitor->count = count;
 
 	ASSERT(monitor->owner == self);
@@ -5046,6 +5159,42 @@ monitor_wait_three_tier(omrthread_t self, omrthread_monitor_t monitor,
 }
 #endif /* OMR_THR_THREE_TIER_LOCKING */
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+/**
+ * Signal the next notified thread that is still asleep on the monitor.
+ *
+ * Notified threads are woken one at a time: each one signals its successor once it
+ * has re-entered the monitor (or given up doing so), so a notifyAll doesn't turn
+ * every waiter loose on the monitor at once.
+ *
+ * @param[in] self the current thread
+ * @param[in] monitor the monitor the current thread was notified on
+ * @param[in] queue the queue holding notified threads: the blocking queue for
+ * monitor_wait_three_tier, the notifyAll queue for monitor_wait_original
+ */
+static void
+monitor_wake_next_notified(omrthread_t self, omrthread_monitor_t monitor, omrthread_t *queue)
+{
+	omrthread_t next = NULL;
+
+	MONITOR_LOCK(monitor, CALLER_MONITOR_NOTIFY_HANDOFF);
+	if (0 != monitor->notifiedWaiters) {
+		/*
+		 * A thread clears J9THREAD_FLAG_NOTIFIED only after it has removed itself from
+		 * the queue under MONITOR_LOCK, so the flag is stable while we hold the lock.
+		 */
+		for (next = *queue; NULL != next; next = next->next) {
+			if (OMR_ARE_ALL_BITS_SET(next->flags, J9THREAD_FLAG_NOTIFIED)) {
+				NOTIFY_WRAPPER(next);
+				UPDATE_JLM_FUTEX_COUNT(self, monitor, notify_handoff_count);
+				break;
+			}
+		}
+	}
+	MONITOR_UNLOCK(monitor);
+}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 /**
  * Returns how many threads are currently waiting on a monitor.
  *
@@ -5172,6 +5321,9 @@ monitor_notify_original(omrthread_t self, omrthread_monitor_t monitor, int notif
 {
 	omrthread_t queue, next;
 	int someoneNotified = 0;
+#if defined(OMR_THR_FUTEX_MONITORS)
+	BOOLEAN startHandoff = FALSE;
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 
 	ASSERT(self);
 	ASSERT(monitor);
@@ -5188,6 +5340,17 @@ monitor_notify_original(omrthread_t self, omrthread_monitor_t monitor, int notif
 	next = monitor->waiting;
 	if (next) {
 		if (notifyall) {
+#if defined(OMR_THR_FUTEX_MONITORS)
+			/*
+			 * Rather than waking every waiter at once, only the first is signalled;
+			 * each one signals its successor once it has re-entered the monitor.
+			 * Skip the signal if an earlier notifyAll already started such a chain.
+			 */
+			startHandoff = (0 == monitor->notifiedWaiters);
+			for (queue = next; NULL != queue; queue = queue->next) {
+				monitor->notifiedWaiters += 1;
+			}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 			monitor_notify_all_migration(monitor);
 		}
 	}
@@ -5197,7 +5360,17 @@ monitor_notify_original(omrthread_t self, omrthread_monitor_t monitor, int notif
 		next = queue->next;
 		THREAD_LOCK(queue, CALLER_NOTIFY_ONE_OR_ALL);
 		if (queue->flags & J9THREAD_FLAG_WAITING) {
+#if defined(OMR_THR_FUTEX_MONITORS)
+			if (notifyall && !startHandoff) {
+				queue->flags &= ~J9THREAD_FLAG_WAITING;
+				queue->flags |= J9THREAD_FLAG_BLOCKED | J9THREAD_FLAG_NOTIFIED;
+			} else {
+				threadNotify(queue);
+				startHandoff = FALSE;
+			}
+#else /* defined(OMR_THR_FUTEX_MONITORS) */
 			threadNotify(queue);
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 			Trc_THR_ThreadMonitorNotifyThreadNotified(self, queue, monitor);
 			someoneNotified = 1;
 		}
@@ -5220,6 +5393,9 @@ static intptr_t
 monitor_notify_three_tier(omrthread_t self, omrthread_monitor_t monitor, int notifyall)
 {
 	omrthread_t queue;
+#if defined(OMR_THR_FUTEX_MONITORS)
+	BOOLEAN startHandoff = FALSE;
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 
 	ASSERT(self);
 	ASSERT(monitor);
@@ -5236,6 +5412,12 @@ monitor_notify_three_tier(omrthread_t self, omrthread_monitor_t monitor, int not
 #if defined(THREAD_ASSERTS)
 		ASSERT(monitor->spinlockState == J9THREAD_MONITOR_SPINLOCK_OWNED);
 #endif /* defined(THREAD_ASSERTS) */
+#elif defined(OMR_THR_FUTEX_MONITORS) /* defined(OMR_THR_MCS_LOCKS) */
+		/*
+		 * Notified threads are not woken by monitor_exit. The first one is signalled here,
+		 * unless an earlier notify already started a handoff chain that will reach it.
+		 */
+		startHandoff = (0 == monitor->notifiedWaiters);
 #else /* defined(OMR_THR_MCS_LOCKS) */
 #if defined(THREAD_ASSERTS)
 		intptr_t state = omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_EXCEEDED);
@@ -5253,10 +5435,19 @@ monitor_notify_three_tier(omrthread_t self, omrthread_monitor_t monitor, int not
 				queue->flags |= J9THREAD_FLAG_BLOCKED | J9THREAD_FLAG_NOTIFIED;
 				Trc_THR_ThreadMonitorNotifyThreadNotified(self, queue, monitor);
 				THREAD_UNLOCK(queue);
+#if defined(OMR_THR_FUTEX_MONITORS)
+				monitor->notifiedWaiters += 1;
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 
 				queue = queue->next;
 			} while (queue);
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+			if (startHandoff) {
+				NOTIFY_WRAPPER(monitor->waiting);
+			}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 			/* append waiting queue to the blocking queue */
 			if (monitor->blocking) {
 				omrthread_t tail;
@@ -5281,6 +5472,12 @@ monitor_notify_three_tier(omrthread_t self, omrthread_monitor_t monitor, int not
 
 			threadDequeue(&monitor->waiting, queue);
 			threadEnqueue(&monitor->blocking, queue);
+#if defined(OMR_THR_FUTEX_MONITORS)
+			monitor->notifiedWaiters += 1;
+			if (startHandoff) {
+				NOTIFY_WRAPPER(queue);
+			}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 		}
 	}
 
@@ -0,0 +1,498 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Thread
+ * @brief Monitor contention flight recorder
+ *
+ * Every Nth contended monitor enter on a thread is recorded into a small ring owned by that
+ * thread, with N starting at J9THREAD_CONTENTION_DEFAULT_SAMPLE_INTERVAL. Only the owning thread writes its ring, so recording
+ * takes no locks; readers detect samples overwritten under them using per-sample sequence
+ * numbers. Rings are freed with their thread, so a dump covers live threads only.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(LINUX) && defined(__GLIBC__)
+#include <execinfo.h>
+#endif /* defined(LINUX) && defined(__GLIBC__) */
+
+#include "omrcfg.h"
+#include "omrutilbase.h"
+#include "threaddef.h"
+#include "thread_internal.h"
+
+#define CONTENTION_RING_SIZE 64
+#define CONTENTION_BACKTRACE_DEPTH 8
+#define CONTENTION_NAME_LENGTH 48
+
+typedef struct J9ThreadContentionSample {
+	/* index + 1 of the sample occupying this slot, or 0 while it is being written */
+	volatile uintptr_t sequence;
+	uintptr_t ownerTid;
+	uintptr_t monitor;
+	uint64_t waitTime;
+	uint64_t timestamp;
+	uintptr_t depth;
+	void *backtrace[CONTENTION_BACKTRACE_DEPTH];
+	char name[CONTENTION_NAME_LENGTH];
+} J9ThreadContentionSample;
+
+typedef struct J9ThreadContentionRing {
+	volatile uintptr_t head;
+	J9ThreadContentionSample samples[CONTENTION_RING_SIZE];
+} J9ThreadContentionRing;
+
+/* a serialized record: J9ThreadContentionDumpRecord, return addresses, padded name */
+#define CONTENTION_RECORD_MAX_WORDS ((sizeof(J9ThreadContentionDumpRecord) / sizeof(uint64_t)) + CONTENTION_BACKTRACE_DEPTH + (CONTENTION_NAME_LENGTH / sizeof(uint64_t)))
+
+typedef struct J9ThreadContentionSummary {
+	uint64_t monitor;
+	const char *name;
+	uint32_t nameLength;
+	uintptr_t samples;
+	uint64_t totalWait;
+	uint64_t maxWait;
+	uint64_t lastOwnerTid;
+} J9ThreadContentionSummary;
+
+static intptr_t dumpThread(omrthread_t thread, omrthread_contention_writer_t writer, void *userData);
+static intptr_t dumpThreads(omrthread_library_t lib, omrthread_contention_writer_t writer, void *userData);
+static int compareSummaries(const void *left, const void *right);
+
+/**
+ * Decide whether the current contended enter should be sampled, counting down the
+ * thread's sampling interval.
+ *
+ * @param[in] self the current thread
+ * @return TRUE if the enter should be recorded
+ */
+BOOLEAN
+omrthread_contention_sample_due(omrthread_t self)
+{
+	uintptr_t interval = self->library->contentionSampleInterval;
+
+	if (0 == interval) {
+		return FALSE;
+	}
+	if (self->contentionSampleCountdown <= 1) {
+		self->contentionSampleCountdown = interval;
+		return TRUE;
+	}
+	self->contentionSampleCountdown -= 1;
+	return FALSE;
+}
+
+/**
+ * Start a sample of a contended enter in the current thread's ring. Called before the thread
+ * blocks, so that the backtrace is taken while the monitor is still owned by another thread
+ * rather than after this thread gets it. The sample is not visible to dumps until
+ * omrthread_contention_record() completes it; if the enter is abandoned, the next sample
+ * reuses its slot.
+ *
+ * @param[in] self the current thread
+ * @param[in] monitor the monitor that is contended
+ * @return TRUE if the sample was started, FALSE if the ring could not be allocated
+ */
+BOOLEAN
+omrthread_contention_capture(omrthread_t self, omrthread_monitor_t monitor)
+{
+	J9ThreadContentionRing *ring = self->contentionRing;
+	J9ThreadContentionSample *sample = NULL;
+	omrthread_t owner = monitor->owner;
+
+	if (NULL == ring) {
+		ring = (J9ThreadContentionRing *)omrthread_allocate_memory(self->library, sizeof(J9ThreadContentionRing), OMRMEM_CATEGORY_THREADS);
+		if (NULL == ring) {
+			return FALSE;
+		}
+		memset(ring, 0, sizeof(J9ThreadContentionRing));
+		self->contentionRing = ring;
+	}
+
+	sample = &ring->samples[ring->head % CONTENTION_RING_SIZE];
+	sample->sequence = 0;
+	issueWriteBarrier();
+
+	sample->ownerTid = (NULL != owner) ? owner->tid : 0;
+	sample->monitor = (uintptr_t)monitor;
+	if (NULL != monitor->name) {
+		strncpy(sample->name, monitor->name, CONTENTION_NAME_LENGTH - 1);
+		sample->name[CONTENTION_NAME_LENGTH - 1] = '\0';
+	} else {
+		sample->name[0] = '\0';
+	}
+#if defined(LINUX) && defined(__GLIBC__)
+	{
+		/* skip this function's frame */
+		void *frames[CONTENTION_BACKTRACE_DEPTH + 1];
+		int count = backtrace(frames, CONTENTION_BACKTRACE_DEPTH + 1);
+
+		sample->depth = (count > 1) ? (uintptr_t)(count - 1) : 0;
+		memcpy(sample->backtrace, frames + 1, sample->depth * sizeof(void *));
+	}
+#else /* defined(LINUX) && defined(__GLIBC__) */
+	sample->depth = 0;
+#endif /* defined(LINUX) && defined(__GLIBC__) */
+	/* the wait starts once the backtrace has been taken */
+	sample->timestamp = omrthread_get_hires_clock();
+	return TRUE;
+}
+
+/**
+ * Complete the sample started by omrthread_contention_capture() with the time waited, and
+ * publish it. Called once the monitor is owned.
+ *
+ * @param[in] self the current thread
+ */
+void
+omrthread_contention_record(omrthread_t self)
+{
+	J9ThreadContentionRing *ring = self->contentionRing;
+	uintptr_t index = ring->head;
+	J9ThreadContentionSample *sample = &ring->samples[index % CONTENTION_RING_SIZE];
+	uint64_t now = omrthread_get_hires_clock();
+
+	sample->waitTime = now - sample->timestamp;
+	sample->timestamp = now;
+
+	issueWriteBarrier();
+	sample->sequence = index + 1;
+	ring->head = index + 1;
+}
+
+/**
+ * Free a thread's contention ring. Called with the library's global lock held.
+ *
+ * @param[in] lib the thread library
+ * @param[in] thread the thread being freed
+ */
+void
+omrthread_contention_thread_free(omrthread_library_t lib, omrthread_t thread)
+{
+	if (NULL != thread->contentionRing) {
+		omrthread_free_memory(lib, thread->contentionRing);
+		thread->contentionRing = NULL;
+	}
+}
+
+/**
+ * Set how often contended monitor enters are sampled.
+ *
+ * @param[in] interval record one in every interval contended enters on each thread; 0 disables sampling.
+ * The thread library starts with J9THREAD_CONTENTION_DEFAULT_SAMPLE_INTERVAL.
+ */
+void
+omrthread_contention_set_sample_interval(uintptr_t interval)
+{
+	omrthread_library_t lib = GLOBAL_DATA(default_library);
+
+	lib->contentionSampleInterval = interval;
+}
+
+/**
+ * @return the current contention sampling interval, 0 if sampling is disabled
+ */
+uintptr_t
+omrthread_contention_get_sample_interval(void)
+{
+	omrthread_library_t lib = GLOBAL_DATA(default_library);
+
+	return lib->contentionSampleInterval;
+}
+
+/**
+ * Serialize the samples in one thread's ring.
+ *
+ * @param[in] thread the thread
+ * @param[in] writer the output callback
+ * @param[in] userData passed to writer
+ * @return 0 on success, otherwise the writer's non-zero return value
+ */
+static intptr_t
+dumpThread(omrthread_t thread, omrthread_contention_writer_t writer, void *userData)
+{
+	J9ThreadContentionRing *ring = thread->contentionRing;
+	uint64_t buffer[CONTENTION_RECORD_MAX_WORDS];
+	J9ThreadContentionDumpRecord *record = (J9ThreadContentionDumpRecord *)buffer;
+	uint64_t *returnAddresses = buffer + (sizeof(J9ThreadContentionDumpRecord) / sizeof(uint64_t));
+	uintptr_t head = 0;
+	uintptr_t index = 0;
+
+	if (NULL == ring) {
+		return 0;
+	}
+	head = ring->head;
+	issueReadBarrier();
+	index = (head > CONTENTION_RING_SIZE) ? (head - CONTENTION_RING_SIZE) : 0;
+	for (; index < head; index++) {
+		J9ThreadContentionSample *sample = &ring->samples[index % CONTENTION_RING_SIZE];
+		char *name = NULL;
+		uintptr_t depth = 0;
+		uintptr_t i = 0;
+		uintptr_t length = 0;
+		intptr_t rc = 0;
+
+		if ((index + 1) != sample->sequence) {
+			continue;
+		}
+		issueReadBarrier();
+		depth = OMR_MIN(sample->depth, CONTENTION_BACKTRACE_DEPTH);
+		memset(buffer, 0, sizeof(buffer));
+		record->tid = (uint64_t)thread->tid;
+		record->ownerTid = (uint64_t)sample->ownerTid;
+		record->monitor = (uint64_t)sample->monitor;
+		record->waitTime = sample->waitTime;
+		record->timestamp = sample->timestamp;
+		record->depth = (uint32_t)depth;
+		for (i = 0; i < depth; i++) {
+			returnAddresses[i] = (uint64_t)(uintptr_t)sample->backtrace[i];
+		}
+		name = (char *)(returnAddresses + depth);
+		memcpy(name, sample->name, CONTENTION_NAME_LENGTH);
+		name[CONTENTION_NAME_LENGTH - 1] = '\0';
+		record->nameLength = (uint32_t)strlen(name);
+		issueReadBarrier();
+		if ((index + 1) != sample->sequence) {
+			/* overwritten while we copied it */
+			continue;
+		}
+
+		length = sizeof(J9ThreadContentionDumpRecord) + (depth * sizeof(uint64_t)) + ((record->nameLength + 7) & ~(uintptr_t)7);
+		rc = writer(userData, buffer, length);
+		if (0 != rc) {
+			return rc;
+		}
+	}
+	return 0;
+}
+
+/**
+ * Write the dump header and every thread's samples.
+ *
+ * @param[in] lib the thread library
+ * @param[in] writer the output callback
+ * @param[in] userData passed to writer
+ * @return 0 on success, otherwise the writer's non-zero return value
+ */
+static intptr_t
+dumpThreads(omrthread_library_t lib, omrthread_contention_writer_t writer, void *userData)
+{
+	J9ThreadContentionDumpHeader header;
+	J9PoolState state;
+	omrthread_t each = NULL;
+	intptr_t rc = 0;
+
+	header.magic = J9THREAD_CONTENTION_DUMP_MAGIC;
+	header.version = J9THREAD_CONTENTION_DUMP_VERSION;
+	header.sampleInterval = lib->contentionSampleInterval;
+	rc = writer(userData, &header, sizeof(header));
+
+	each = (omrthread_t)pool_startDo(lib->thread_pool, &state);
+	while ((0 == rc) && (NULL != each)) {
+		rc = dumpThread(each, writer, userData);
+		each = (omrthread_t)pool_nextDo(&state);
+	}
+	return rc;
+}
+
+/**
+ * Write all threads' contention samples in the binary dump format.
+ *
+ * The writer is called with the thread library's global lock held, so it must not
+ * create, attach or detach threads.
+ *
+ * @param[in] writer the output callback
+ * @param[in] userData passed to writer
+ * @return 0 on success, otherwise the writer's non-zero return value
+ *
+ * @see omrthread_contention_dump_no_locking, omrthread_contention_report
+ */
+intptr_t
+omrthread_contention_dump(omrthread_contention_writer_t writer, void *userData)
+{
+	omrthread_library_t lib = GLOBAL_DATA(default_library);
+	intptr_t rc = 0;
+
+	GLOBAL_LOCK_SIMPLE(lib);
+	rc = dumpThreads(lib, writer, userData);
+	GLOBAL_UNLOCK_SIMPLE(lib);
+
+	return rc;
+}
+
+/**
+ * Write all threads' contention samples without taking any locks or allocating memory.
+ *
+ * This is intended for signal handlers and crash paths, with a writer that is itself
+ * async-signal-safe (for example one that calls write(2)). Threads created or destroyed
+ * concurrently may be missed or, rarely, produce a garbled record.
+ *
+ * @param[in] writer the output callback
+ * @param[in] userData passed to writer
+ * @return 0 on success, otherwise the writer's non-zero return value
+ *
+ * @see omrthread_contention_dump
+ */
+intptr_t
+omrthread_contention_dump_no_locking(omrthread_contention_writer_t writer, void *userData)
+{
+	return dumpThreads(GLOBAL_DATA(default_library), writer, userData);
+}
+
+/**
+ * Order summaries by descending total wait time.
+ */
+static int
+compareSummaries(const void *left, const void *right)
+{
+	const J9ThreadContentionSummary *l = (const J9ThreadContentionSummary *)left;
+	const J9ThreadContentionSummary *r = (const J9ThreadContentionSummary *)right;
+
+	if (l->totalWait != r->totalWait) {
+		return (l->totalWait < r->totalWait) ? 1 : -1;
+	}
+	return (l->samples < r->samples) ? 1 : ((l->samples > r->samples) ? -1 : 0);
+}
+
+/**
+ * Decode a contention dump and write a text report of the most contended monitors,
+ * ranked by total sampled wait time.
+ *
+ * @param[in] dump the dump produced by omrthread_contention_dump
+ * @param[in] length the size of the dump in bytes
+ * @param[in] maxMonitors the number of monitors to report, 0 for all
+ * @param[in] writer receives the report text
+ * @param[in] userData passed to writer
+ * @return 0 on success, J9THREAD_INVALID_ARGUMENT if the dump is malformed, J9THREAD_ERR_NOMEMORY,
+ * or the writer's non-zero return value
+ */
+intptr_t
+omrthread_contention_report(const void *dump, uintptr_t length, uintptr_t maxMonitors, omrthread_contention_writer_t writer, void *userData)
+{
+	omrthread_library_t lib = GLOBAL_DATA(default_library);
+	const J9ThreadContentionDumpHeader *header = (const J9ThreadContentionDumpHeader *)dump;
+	const uint8_t *cursor = (const uint8_t *)dump + sizeof(J9ThreadContentionDumpHeader);
+	const uint8_t *end = (const uint8_t *)dump + length;
+	J9ThreadContentionSummary *summaries = NULL;
+	uintptr_t summaryCount = 0;
+	uintptr_t summaryCapacity = 0;
+	uintptr_t i = 0;
+	char line[256];
+	int lineLength = 0;
+	intptr_t rc = 0;
+
+	if ((length < sizeof(J9ThreadContentionDumpHeader))
+		|| (J9THREAD_CONTENTION_DUMP_MAGIC != header->magic)
+		|| (J9THREAD_CONTENTION_DUMP_VERSION != header->version)
+	) {
+		return J9THREAD_INVALID_ARGUMENT;
+	}
+
+	while (cursor < end) {
+		const J9ThreadContentionDumpRecord *record = (const J9ThreadContentionDumpRecord *)cursor;
+		const char *name = NULL;
+		uintptr_t recordLength = 0;
+
+		if ((uintptr_t)(end - cursor) < sizeof(J9ThreadContentionDumpRecord)) {
+			rc = J9THREAD_INVALID_ARGUMENT;
+			break;
+		}
+		recordLength = sizeof(J9ThreadContentionDumpRecord) + ((uintptr_t)record->depth * sizeof(uint64_t)) + (((uintptr_t)record->nameLength + 7) & ~(uintptr_t)7);
+		if ((uintptr_t)(end - cursor) < recordLength) {
+			rc = J9THREAD_INVALID_ARGUMENT;
+			break;
+		}
+		name = (const char *)(cursor + sizeof(J9ThreadContentionDumpRecord) + ((uintptr_t)record->depth * sizeof(uint64_t)));
+
+		for (i = 0; i < summaryCount; i++) {
+			if ((summaries[i].monitor == record->monitor)
+				&& (summaries[i].nameLength == record->nameLength)
+				&& (0 == memcmp(summaries[i].name, name, record->nameLength))
+			) {
+				break;
+			}
+		}
+		if (i == summaryCount) {
+			if (summaryCount == summaryCapacity) {
+				uintptr_t newCapacity = (0 == summaryCapacity) ? 16 : (summaryCapacity * 2);
+				J9ThreadContentionSummary *newSummaries = (J9ThreadContentionSummary *)omrthread_allocate_memory(lib, newCapacity * sizeof(J9ThreadContentionSummary), OMRMEM_CATEGORY_THREADS);
+				if (NULL == newSummaries) {
+					rc = J9THREAD_ERR_NOMEMORY;
+					break;
+				}
+				if (NULL != summaries) {
+					memcpy(newSummaries, summaries, summaryCount * sizeof(J9ThreadContentionSummary));
+					omrthread_free_memory(lib, summaries);
+				}
+				summaries = newSummaries;
+				summaryCapacity = newCapacity;
+			}
+			memset(&summaries[i], 0, sizeof(J9ThreadContentionSummary));
+			summaries[i].monitor = record->monitor;
+			summaries[i].name = name;
+			summaries[i].nameLength = record->nameLength;
+			summaryCount += 1;
+		}
+		summaries[i].samples += 1;
+		summaries[i].totalWait += record->waitTime;
+		if (record->waitTime > summaries[i].maxWait) {
+			summaries[i].maxWait = record->waitTime;
+		}
+		if (0 != record->ownerTid) {
+			summaries[i].lastOwnerTid = record->ownerTid;
+		}
+		cursor += recordLength;
+	}
+
+	if (0 == rc) {
+		qsort(summaries, summaryCount, sizeof(J9ThreadContentionSummary), compareSummaries);
+		if ((0 == maxMonitors) || (maxMonitors > summaryCount)) {
+			maxMonitors = summaryCount;
+		}
+		lineLength = snprintf(line, sizeof(line),
+				"Top contended monitors (sampling 1 in %llu contended enters)\n"
+				"%4s %8s %16s %16s %18s %12s  %s\n",
+				(unsigned long long)header->sampleInterval,
+				"rank", "samples", "total wait", "max wait", "monitor", "last owner", "name");
+		rc = writer(userData, line, (uintptr_t)OMR_MIN(lineLength, (int)sizeof(line) - 1));
+		for (i = 0; (0 == rc) && (i < maxMonitors); i++) {
+			J9ThreadContentionSummary *summary = &summaries[i];
+			lineLength = snprintf(line, sizeof(line), "%4u %8llu %16llu %16llu 0x%016llx %12llu  %.*s\n",
+					(unsigned int)(i + 1),
+					(unsigned long long)summary->samples,
+					(unsigned long long)summary->totalWait,
+					(unsigned long long)summary->maxWait,
+					(unsigned long long)summary->monitor,
+					(unsigned long long)summary->lastOwnerTid,
+					(int)summary->nameLength, summary->name);
+			rc = writer(userData, line, (uintptr_t)OMR_MIN(lineLength, (int)sizeof(line) - 1));
+		}
+	}
+
+	if (NULL != summaries) {
+		omrthread_free_memory(lib, summaries);
+	}
+	return rc;
+}
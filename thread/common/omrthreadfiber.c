@@ -0,0 +1,85 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Thread
+ * @brief Fibers: lightweight user-space tasks multiplexed onto carrier threads.
+ *
+ * This is the common implementation for platforms without fiber support; see linux/omrthreadfiber.c.
+ */
+#include "omrcfg.h"
+#include "threaddef.h"
+
+intptr_t
+omrthread_fiber_scheduler_create(omrthread_fiber_scheduler_t *handle, uintptr_t carrierCount, uintptr_t stackSize)
+{
+	*handle = NULL;
+	return J9THREAD_ERR_UNSUPPORTED_PLAT;
+}
+
+intptr_t
+omrthread_fiber_scheduler_shutdown(omrthread_fiber_scheduler_t scheduler)
+{
+	return J9THREAD_ERR_UNSUPPORTED_PLAT;
+}
+
+intptr_t
+omrthread_fiber_create(omrthread_fiber_t *handle, omrthread_fiber_scheduler_t scheduler, omrthread_entrypoint_t entrypoint, void *entryarg)
+{
+	return J9THREAD_ERR_UNSUPPORTED_PLAT;
+}
+
+omrthread_fiber_t
+omrthread_fiber_self(void)
+{
+	return NULL;
+}
+
+void
+omrthread_fiber_yield(void)
+{
+	omrthread_yield();
+}
+
+intptr_t
+omrthread_fiber_park(void)
+{
+	return J9THREAD_INVALID_ARGUMENT;
+}
+
+void
+omrthread_fiber_unpark(omrthread_fiber_t fiber)
+{
+}
+
+intptr_t
+omrthread_fiber_tls_set(omrthread_fiber_t fiber, omrthread_tls_key_t key, void *value)
+{
+	return -1;
+}
+
+void *
+omrthread_fiber_tls_get(omrthread_fiber_t fiber, omrthread_tls_key_t key)
+{
+	return NULL;
+}
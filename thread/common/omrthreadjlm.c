@@ -26,6 +26,8 @@
  * @brief J9 Lock Monitoring
  */
 
+#include <stdio.h>
+
 #include "omrcfg.h"
 #include "omrcomp.h"
 #include "omrthread.h"
@@ -43,6 +45,7 @@ static intptr_t jlm_init(omrthread_library_t lib);
 static intptr_t jlm_init_pools(omrthread_library_t lib);
 static intptr_t jlm_gc_lock_init(omrthread_library_t lib);
 static void jlm_thread_clear(omrthread_t thread);
+static intptr_t jlm_dump_tracing(J9ThreadMonitorTracing *tracing, omrthread_monitor_t monitor, const char *name, omrthread_contention_writer_t writer, void *userData);
 
 /**
  * Initialize storage and clear structures for JLM thread and monitor tracing structures
@@ -434,3 +437,94 @@ jlm_monitor_free(omrthread_library_t lib, omrthread_monitor_t monitor)
 	}
 
 }
+
+
+/**
+ * Write one line of a monitor's JLM counters.
+ *
+ * @param[in] tracing the tracing structure
+ * @param[in] monitor the monitor it belongs to, or NULL for the GC lock
+ * @param[in] name the monitor name, or NULL
+ * @param[in] writer the output callback
+ * @param[in] userData passed to writer
+ * @return 0 on success, otherwise the writer's non-zero return value
+ */
+static intptr_t
+jlm_dump_tracing(J9ThreadMonitorTracing *tracing, omrthread_monitor_t monitor, const char *name, omrthread_contention_writer_t writer, void *userData)
+{
+	char line[256];
+	int lineLength = 0;
+
+	lineLength = snprintf(line, sizeof(line), "0x%016llx %10llu %10llu %10llu %10llu %10llu",
+			(unsigned long long)(uintptr_t)monitor,
+			(unsigned long long)tracing->enter_count,
+			(unsigned long long)tracing->slow_count,
+			(unsigned long long)tracing->recursive_count,
+			(unsigned long long)tracing->spin2_count,
+			(unsigned long long)tracing->yield_count);
+#if defined(OMR_THR_JLM_HOLD_TIMES)
+	lineLength += snprintf(line + lineLength, sizeof(line) - lineLength, " %16llu %10llu",
+			(unsigned long long)tracing->holdtime_sum,
+			(unsigned long long)tracing->holdtime_count);
+#endif /* defined(OMR_THR_JLM_HOLD_TIMES) */
+#if defined(OMR_THR_FUTEX_MONITORS)
+	lineLength += snprintf(line + lineLength, sizeof(line) - lineLength, " %10llu %10llu %10llu",
+			(unsigned long long)tracing->park_count,
+			(unsigned long long)tracing->wakeup_count,
+			(unsigned long long)tracing->notify_handoff_count);
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+	lineLength += snprintf(line + lineLength, sizeof(line) - lineLength, "  %.64s\n", (NULL == name) ? "" : name);
+
+	return writer(userData, line, (uintptr_t)OMR_MIN(lineLength, (int)sizeof(line) - 1));
+}
+
+
+/**
+ * Write a text table of the JLM counters of every monitor that has been entered since
+ * JLM was enabled, followed by the GC lock counters.
+ *
+ * The writer is called with the thread library's global lock held, so it must not
+ * create, attach or detach threads, or create or destroy monitors.
+ *
+ * @param[in] writer the output callback
+ * @param[in] userData passed to writer
+ * @return 0 on success, otherwise the writer's non-zero return value
+ */
+intptr_t
+omrthread_jlm_dump(omrthread_contention_writer_t writer, void *userData)
+{
+	omrthread_t self = MACRO_SELF();
+	omrthread_library_t lib = GLOBAL_DATA(default_library);
+	omrthread_monitor_t monitor = NULL;
+	omrthread_monitor_walk_state_t walkState;
+	char line[256];
+	int lineLength = 0;
+	intptr_t rc = 0;
+
+	ASSERT(self);
+	ASSERT(lib);
+
+	lineLength = snprintf(line, sizeof(line), "%18s %10s %10s %10s %10s %10s", "monitor", "enters", "slow", "recursive", "spin2", "yield");
+#if defined(OMR_THR_JLM_HOLD_TIMES)
+	lineLength += snprintf(line + lineLength, sizeof(line) - lineLength, " %16s %10s", "hold time", "holds");
+#endif /* defined(OMR_THR_JLM_HOLD_TIMES) */
+#if defined(OMR_THR_FUTEX_MONITORS)
+	lineLength += snprintf(line + lineLength, sizeof(line) - lineLength, " %10s %10s %10s", "parks", "wakeups", "handoffs");
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+	lineLength += snprintf(line + lineLength, sizeof(line) - lineLength, "  %s\n", "name");
+
+	GLOBAL_LOCK(self, CALLER_JLM_DUMP);
+	rc = writer(userData, line, (uintptr_t)OMR_MIN(lineLength, (int)sizeof(line) - 1));
+	omrthread_monitor_init_walk(&walkState);
+	while ((0 == rc) && (NULL != (monitor = omrthread_monitor_walk_no_locking(&walkState)))) {
+		if ((NULL != monitor->tracing) && (0 != monitor->tracing->enter_count)) {
+			rc = jlm_dump_tracing(monitor->tracing, monitor, monitor->name, writer, userData);
+		}
+	}
+	if ((0 == rc) && (NULL != lib->gc_lock_tracing) && (0 != lib->gc_lock_tracing->enter_count)) {
+		rc = jlm_dump_tracing(lib->gc_lock_tracing, NULL, "GC lock", writer, userData);
+	}
+	GLOBAL_UNLOCK(self);
+
+	return rc;
+}
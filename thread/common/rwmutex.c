@@ -22,16 +22,36 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include "omrutilbase.h"
 #include "threaddef.h"
 #include "thread_internal.h"
 
 #undef  ASSERT
 #define ASSERT(x) /**/
 
+/*
+ * Number of reader slots in a distributed rwmutex (a power of two). Threads hash to
+ * a slot, so readers on different threads rarely share a cache line.
+ */
+#define RWMUTEX_READER_SLOTS 32
+#define RWMUTEX_CACHE_LINE_SIZE 128
+
+typedef struct RWMutexReaderSlot {
+	volatile uintptr_t readers;
+	uint8_t padding[RWMUTEX_CACHE_LINE_SIZE - sizeof(uintptr_t)];
+} RWMutexReaderSlot;
+
 typedef struct RWMutex {
 	omrthread_monitor_t syncMon;
 	intptr_t status;
 	omrthread_t writer;
+	uintptr_t flags;
+	/* J9THREAD_RWMUTEX_DISTRIBUTED only: cache line aligned reader slots, and the allocation holding them */
+	RWMutexReaderSlot *readerSlots;
+	void *readerSlotsMemory;
+	/* J9THREAD_RWMUTEX_DISTRIBUTED only: set while a writer is draining or holding the mutex */
+	volatile uintptr_t writerPending;
 } RWMutex;
 
 #define ASSERT_RWMUTEX(m)\
@@ -41,10 +61,152 @@ typedef struct RWMutex {
 #define RWMUTEX_STATUS_IDLE(m)     ((m)->status == 0)
 #define RWMUTEX_STATUS_READING(m)  ((m)->status > 0)
 #define RWMUTEX_STATUS_WRITING(m)  ((m)->status < 0)
+#define RWMUTEX_IS_DISTRIBUTED(m)  OMR_ARE_ANY_BITS_SET((m)->flags, J9THREAD_RWMUTEX_DISTRIBUTED)
+
+static RWMutexReaderSlot *readerSlot(RWMutex *mutex, omrthread_t self);
+static uintptr_t countReaders(RWMutex *mutex);
+static void enterReadDistributed(RWMutex *mutex, omrthread_t self);
+static void exitReadDistributed(RWMutex *mutex, omrthread_t self);
+static intptr_t enterWriteDistributed(RWMutex *mutex, omrthread_t self, BOOLEAN blocking);
+
+/**
+ * Find the reader slot used by a thread. A thread always maps to the same slot.
+ *
+ * @param[in] mutex a distributed mutex
+ * @param[in] self the current thread
+ * @return the thread's reader slot
+ */
+static RWMutexReaderSlot *
+readerSlot(RWMutex *mutex, omrthread_t self)
+{
+	uintptr_t hash = (uintptr_t)self;
+
+	hash ^= hash >> 17;
+	hash ^= hash >> 9;
+	return &mutex->readerSlots[hash & (RWMUTEX_READER_SLOTS - 1)];
+}
+
+/**
+ * Sum the reader slots of a distributed mutex.
+ *
+ * @param[in] mutex a distributed mutex
+ * @return the number of read entries currently held
+ */
+static uintptr_t
+countReaders(RWMutex *mutex)
+{
+	uintptr_t readers = 0;
+	uintptr_t i = 0;
+
+	for (i = 0; i < RWMUTEX_READER_SLOTS; i++) {
+		readers += mutex->readerSlots[i].readers;
+	}
+	return readers;
+}
+
+/**
+ * Enter a distributed mutex for read.
+ *
+ * The fast path only touches the thread's own slot: increment it, then check that no
+ * writer is pending. Writers publish writerPending before summing the slots, so either
+ * the writer sees this reader's count or the reader sees writerPending and backs out.
+ *
+ * Like the shared count implementation, a reader only waits for a writer that owns the
+ * mutex, not for one that is still draining readers; this keeps recursive reads safe.
+ *
+ * @param[in] mutex a distributed mutex
+ * @param[in] self the current thread
+ */
+static void
+enterReadDistributed(RWMutex *mutex, omrthread_t self)
+{
+	RWMutexReaderSlot *slot = readerSlot(mutex, self);
+
+	addAtomic(&slot->readers, 1);
+	issueReadWriteBarrier();
+	if (0 != mutex->writerPending) {
+		/* back out, then enter under the monitor */
+		exitReadDistributed(mutex, self);
+
+		omrthread_monitor_enter(mutex->syncMon);
+		while (mutex->status < 0) {
+			omrthread_monitor_wait(mutex->syncMon);
+		}
+		addAtomic(&slot->readers, 1);
+		omrthread_monitor_exit(mutex->syncMon);
+	}
+}
+
+/**
+ * Exit a distributed mutex for read, waking a draining writer if there is one.
+ *
+ * @param[in] mutex a distributed mutex
+ * @param[in] self the current thread
+ */
+static void
+exitReadDistributed(RWMutex *mutex, omrthread_t self)
+{
+	subtractAtomic(&readerSlot(mutex, self)->readers, 1);
+	issueReadWriteBarrier();
+	if (0 != mutex->writerPending) {
+		omrthread_monitor_enter(mutex->syncMon);
+		omrthread_monitor_notify_all(mutex->syncMon);
+		omrthread_monitor_exit(mutex->syncMon);
+	}
+}
+
+/**
+ * Enter a distributed mutex for write: claim writerPending, then wait for every
+ * reader slot to drain.
+ *
+ * @param[in] mutex a distributed mutex
+ * @param[in] self the current thread
+ * @param[in] blocking if FALSE, return J9THREAD_RWMUTEX_WOULDBLOCK rather than wait
+ * @return J9THREAD_RWMUTEX_OK or J9THREAD_RWMUTEX_WOULDBLOCK
+ */
+static intptr_t
+enterWriteDistributed(RWMutex *mutex, omrthread_t self, BOOLEAN blocking)
+{
+	omrthread_monitor_enter(mutex->syncMon);
+
+	while (0 != mutex->writerPending) {
+		if (!blocking) {
+			omrthread_monitor_exit(mutex->syncMon);
+			return J9THREAD_RWMUTEX_WOULDBLOCK;
+		}
+		omrthread_monitor_wait(mutex->syncMon);
+	}
+	mutex->writerPending = 1;
+	issueReadWriteBarrier();
+
+	/* a reader exiting while writerPending is set notifies under syncMon, so no wakeup is lost */
+	while (0 != countReaders(mutex)) {
+		if (!blocking) {
+			mutex->writerPending = 0;
+			omrthread_monitor_notify_all(mutex->syncMon);
+			omrthread_monitor_exit(mutex->syncMon);
+			return J9THREAD_RWMUTEX_WOULDBLOCK;
+		}
+		omrthread_monitor_wait(mutex->syncMon);
+	}
+	mutex->status--;
+	mutex->writer = self;
+
+	ASSERT(RWMUTEX_STATUS_WRITING(mutex));
+
+	omrthread_monitor_exit(mutex->syncMon);
+
+	return J9THREAD_RWMUTEX_OK;
+}
 
 /**
  * Acquire and initialize a new read/write mutex from the threading library.
  *
+ * If flags includes J9THREAD_RWMUTEX_DISTRIBUTED, readers count themselves into
+ * per-thread slots on separate cache lines instead of a single shared count. Read
+ * entry and exit then avoid the mutex's monitor unless a writer is pending, at the
+ * cost of writers having to scan every slot. Use it for read-mostly data.
+ *
  * @param[out] handle pointer to a omrthread_rwmutex_t to be set to point to the new mutex
  * @param[in] flags initial flag values for the mutex
  * @return J9THREAD_RWMUTEX_OK on success
@@ -69,6 +231,28 @@ omrthread_rwmutex_init(omrthread_rwmutex_t *handle, uintptr_t flags, const char
 	if (NULL == mutex) {
 		ret = J9THREAD_RWMUTEX_FAIL;
 	} else {
+		mutex->flags = flags;
+		mutex->readerSlots = NULL;
+		mutex->readerSlotsMemory = NULL;
+		mutex->writerPending = 0;
+		if (RWMUTEX_IS_DISTRIBUTED(mutex)) {
+			uintptr_t slotsSize = RWMUTEX_READER_SLOTS * sizeof(RWMutexReaderSlot);
+
+			mutex->readerSlotsMemory = omrthread_allocate_memory(lib, slotsSize + RWMUTEX_CACHE_LINE_SIZE - 1, OMRMEM_CATEGORY_THREADS);
+			if (NULL == mutex->readerSlotsMemory) {
+#if defined(OMR_THR_FORK_SUPPORT)
+				GLOBAL_LOCK_SIMPLE(lib);
+				pool_removeElement(lib->rwmutexPool, mutex);
+				GLOBAL_UNLOCK_SIMPLE(lib);
+#else /* defined(OMR_THR_FORK_SUPPORT) */
+				omrthread_free_memory(lib, mutex);
+#endif /* defined(OMR_THR_FORK_SUPPORT) */
+				return J9THREAD_RWMUTEX_FAIL;
+			}
+			mutex->readerSlots = (RWMutexReaderSlot *)(((uintptr_t)mutex->readerSlotsMemory + RWMUTEX_CACHE_LINE_SIZE - 1) & ~(uintptr_t)(RWMUTEX_CACHE_LINE_SIZE - 1));
+			memset(mutex->readerSlots, 0, slotsSize);
+		}
+
 		omrthread_monitor_init_with_name(&mutex->syncMon, 0, (char *)name);
 		mutex->status = 0;
 		mutex->writer = 0;
@@ -103,6 +287,10 @@ omrthread_rwmutex_destroy(omrthread_rwmutex_t mutex)
 	ASSERT(0 == mutex->status);
 	ASSERT(0 == mutex->writer);
 	omrthread_monitor_destroy(mutex->syncMon);
+	if (NULL != mutex->readerSlotsMemory) {
+		ASSERT(0 == countReaders(mutex));
+		omrthread_free_memory(lib, mutex->readerSlotsMemory);
+	}
 #if defined(OMR_THR_FORK_SUPPORT)
 	ASSERT(0 != lib->rwmutexPool);
 	GLOBAL_LOCK_SIMPLE(lib);
@@ -142,8 +330,14 @@ omrthread_rwmutex_destroy(omrthread_rwmutex_t mutex)
 intptr_t
 omrthread_rwmutex_enter_read(omrthread_rwmutex_t mutex)
 {
+	omrthread_t self = omrthread_self();
 	ASSERT_RWMUTEX(mutex);
-	if (mutex->writer == omrthread_self()) {
+	if (mutex->writer == self) {
+		return J9THREAD_RWMUTEX_OK;
+	}
+
+	if (RWMUTEX_IS_DISTRIBUTED(mutex)) {
+		enterReadDistributed(mutex, self);
 		return J9THREAD_RWMUTEX_OK;
 	}
 
@@ -170,8 +364,14 @@ omrthread_rwmutex_enter_read(omrthread_rwmutex_t mutex)
 intptr_t
 omrthread_rwmutex_exit_read(omrthread_rwmutex_t mutex)
 {
+	omrthread_t self = omrthread_self();
 	ASSERT_RWMUTEX(mutex);
-	if (mutex->writer == omrthread_self()) {
+	if (mutex->writer == self) {
+		return J9THREAD_RWMUTEX_OK;
+	}
+
+	if (RWMUTEX_IS_DISTRIBUTED(mutex)) {
+		exitReadDistributed(mutex, self);
 		return J9THREAD_RWMUTEX_OK;
 	}
 
@@ -224,6 +424,10 @@ omrthread_rwmutex_enter_write(omrthread_rwmutex_t mutex)
 		return J9THREAD_RWMUTEX_OK;
 	}
 
+	if (RWMUTEX_IS_DISTRIBUTED(mutex)) {
+		return enterWriteDistributed(mutex, self, TRUE);
+	}
+
 	omrthread_monitor_enter(mutex->syncMon);
 
 	while (mutex->status != 0) {
@@ -262,6 +466,10 @@ omrthread_rwmutex_try_enter_write(omrthread_rwmutex_t mutex)
 		return J9THREAD_RWMUTEX_OK;
 	}
 
+	if (RWMUTEX_IS_DISTRIBUTED(mutex)) {
+		return enterWriteDistributed(mutex, self, FALSE);
+	}
+
 	omrthread_monitor_enter(mutex->syncMon);
 	if (mutex->status != 0) {
 		/* must get out */
@@ -299,6 +507,7 @@ omrthread_rwmutex_exit_write(omrthread_rwmutex_t mutex)
 	mutex->status++;
 	if (0 == mutex->status) {
 		mutex->writer = NULL;
+		mutex->writerPending = 0;
 		omrthread_monitor_notify_all(mutex->syncMon);
 	}
 
@@ -330,7 +539,7 @@ omrthread_rwmutex_is_writelocked(omrthread_rwmutex_t mutex)
 void
 omrthread_rwmutex_reset(omrthread_rwmutex_t rwmutex, omrthread_t self)
 {
-	if (RWMUTEX_STATUS_READING(rwmutex)) {
+	if (RWMUTEX_STATUS_READING(rwmutex) || (RWMUTEX_IS_DISTRIBUTED(rwmutex) && (0 != countReaders(rwmutex)))) {
 		fprintf(stderr, "ERROR: found read-locked rwmutex during post-fork reset!\n");
 		abort();
 	}
@@ -341,6 +550,7 @@ omrthread_rwmutex_reset(omrthread_rwmutex_t rwmutex, omrthread_t self)
 		 */
 		rwmutex->writer = NULL;
 		rwmutex->status = 0;
+		rwmutex->writerPending = 0;
 	}
 }
 
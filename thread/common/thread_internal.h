@@ -55,6 +55,42 @@ void
 omrthread_init(omrthread_library_t lib);
 
 
+/* ---------------- omrthreadcontention.c ---------------- */
+
+/**
+ * @brief
+ * @param self
+ * @return BOOLEAN
+ */
+BOOLEAN
+omrthread_contention_sample_due(omrthread_t self);
+
+/**
+ * @brief
+ * @param self
+ * @param monitor
+ * @return BOOLEAN
+ */
+BOOLEAN
+omrthread_contention_capture(omrthread_t self, omrthread_monitor_t monitor);
+
+/**
+ * @brief
+ * @param self
+ * @return void
+ */
+void
+omrthread_contention_record(omrthread_t self);
+
+/**
+ * @brief
+ * @param lib
+ * @param thread
+ * @return void
+ */
+void
+omrthread_contention_thread_free(omrthread_library_t lib, omrthread_t thread);
+
 /* ---------------- omrthreadjlm.c ---------------- */
 
 #if defined(OMR_THR_JLM)
@@ -98,6 +98,12 @@ intptr_t omrthread_spinlock_acquire(omrthread_t self, omrthread_monitor_t monito
 intptr_t omrthread_spinlock_acquire_no_spin(omrthread_t self, omrthread_monitor_t monitor);
 uintptr_t omrthread_spinlock_swapState(omrthread_monitor_t monitor, uintptr_t newState);
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+uint32_t omrthread_futex_sequence(omrthread_monitor_t monitor);
+void omrthread_futex_park(omrthread_monitor_t monitor, uint32_t sequence);
+void omrthread_futex_unpark(omrthread_monitor_t monitor, uintptr_t count);
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 #if defined(OMR_THR_MCS_LOCKS)
 intptr_t
 omrthread_mcs_lock(omrthread_t self, omrthread_monitor_t monitor, omrthread_mcs_node_t mcsNode, BOOLEAN retry);
@@ -162,6 +168,9 @@ enum {
 	CALLER_STORE_EXIT_CPU_USAGE,
 	CALLER_GET_JVM_CPU_USAGE_INFO,
 	CALLER_SET_FLAG_ENABLE_CPU_MONITOR,
+	CALLER_MONITOR_ENTER_THREE_TIER5,
+	CALLER_MONITOR_NOTIFY_HANDOFF,
+	CALLER_JLM_DUMP,
 	CALLER_LAST_INDEX
 };
 #define MAX_CALLER_INDEX CALLER_LAST_INDEX
@@ -264,6 +273,9 @@ enum {
 
 #define IS_OBJECT_MONITOR(monitor) (J9THREAD_MONITOR_OBJECT == ((monitor)->flags & J9THREAD_MONITOR_OBJECT))
 
+/* Checked on contended monitor enters only; sampling itself is decided by omrthread_contention_sample_due() */
+#define IS_CONTENTION_SAMPLING_ENABLED(thread) (0 != (thread)->library->contentionSampleInterval)
+
 #define IS_JLM_ENABLED(thread) ((thread)->library->flags & J9THREAD_LIB_FLAG_JLM_INIT_DATA_STRUCTURES)
 
 #if defined(OMR_THR_ADAPTIVE_SPIN)
@@ -305,6 +317,21 @@ enum {
 #define JLM_AVERAGE_HOLDTIME(monitor) ((monitor)->tracing->holdtime_avg)
 #define JLM_SLOW_PERCENT(monitor) (((monitor)->tracing->slow_count*100)/JLM_NON_RECURSIVE_ENTER_COUNT(monitor))
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+#define ADAPT_MONITOR_TRACE(thread, monitor, adaptTracepoint) \
+	do { \
+		adaptTracepoint( \
+			(IS_OBJECT_MONITOR(monitor) ? "object" : "system"), (monitor), \
+			(uint64_t)(monitor)->tracing->holdtime_sum, (monitor)->tracing->holdtime_count, \
+			(uint64_t)((monitor)->tracing->holdtime_count > 0 ? JLM_AVERAGE_HOLDTIME(monitor) : 0), \
+			(monitor)->tracing->slow_count, JLM_NON_RECURSIVE_ENTER_COUNT(monitor), \
+			((monitor)->tracing->enter_count > 0 ? JLM_SLOW_PERCENT(monitor) : 0)); \
+		Trc_THR_Adapt_FutexCounts( \
+			(IS_OBJECT_MONITOR(monitor) ? "object" : "system"), (monitor), \
+			(monitor)->tracing->park_count, (monitor)->tracing->wakeup_count, \
+			(monitor)->tracing->notify_handoff_count); \
+	} while (0)
+#else /* defined(OMR_THR_FUTEX_MONITORS) */
 #define ADAPT_MONITOR_TRACE(thread, monitor, adaptTracepoint) \
 	adaptTracepoint( \
 		(IS_OBJECT_MONITOR(monitor) ? "object" : "system"), (monitor), \
@@ -312,6 +339,7 @@ enum {
 		(uint64_t)((monitor)->tracing->holdtime_count > 0 ? JLM_AVERAGE_HOLDTIME(monitor) : 0), \
 		(monitor)->tracing->slow_count, JLM_NON_RECURSIVE_ENTER_COUNT(monitor), \
 		((monitor)->tracing->enter_count > 0 ? JLM_SLOW_PERCENT(monitor) : 0))
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 
 #ifdef OMR_THR_THREE_TIER_LOCKING
 #define DISABLE_RAW_MONITOR_SPIN(thread, monitor) \
@@ -488,6 +516,18 @@ enum {
 #define IS_SLOW_ENTER  (1)
 #define IS_RECURSIVE_ENTER  (1)
 
+#if defined(OMR_THR_JLM) && defined(OMR_THR_FUTEX_MONITORS)
+/* NOTE: Only called while holding the monitor's mutex. */
+#define UPDATE_JLM_FUTEX_COUNT(self, monitor, counter) \
+	do { \
+		if (IS_JLM_ENABLED(self) && (NULL != (monitor)->tracing)) { \
+			(monitor)->tracing->counter++; \
+		} \
+	} while (0)
+#else /* defined(OMR_THR_JLM) && defined(OMR_THR_FUTEX_MONITORS) */
+#define UPDATE_JLM_FUTEX_COUNT(self, monitor, counter)
+#endif /* defined(OMR_THR_JLM) && defined(OMR_THR_FUTEX_MONITORS) */
+
 #if defined(OMR_THR_JLM_HOLD_TIMES)
 #define UPDATE_JLM_MON_ENTER_HOLD_TIMES(self, monitor) \
 	do { \
@@ -22,6 +22,13 @@
 
 #include "AtomicSupport.hpp"
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 extern "C" {
 
 #include "thrtypes.h"
@@ -67,7 +74,12 @@ omrthread_spinlock_acquire(omrthread_t self, omrthread_monitor_t monitor)
 	}
 #endif /* OMR_THR_JLM */
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+	/* Only spin for as long as recent acquisitions of this monitor suggest is worthwhile. */
+	uintptr_t spinCount3Init = OMR_MIN(monitor->spinCount3, monitor->adaptiveSpinCount3);
+#else /* defined(OMR_THR_FUTEX_MONITORS) */
 	uintptr_t spinCount3Init = monitor->spinCount3;
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 	uintptr_t spinCount2Init = monitor->spinCount2;
 	uintptr_t spinCount1Init = monitor->spinCount1;
 
@@ -142,6 +154,20 @@ update_jlm:
 	}
 #endif /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+	/* Additive increase when spinning pays off, multiplicative decrease when the
+	 * monitor was held for longer than the spin budget. Updates are racy by design:
+	 * the budget is a heuristic and any value in [1, spinCount3] is valid.
+	 */
+	if (0 == result) {
+		if (monitor->adaptiveSpinCount3 < monitor->spinCount3) {
+			monitor->adaptiveSpinCount3 += 1;
+		}
+	} else if (monitor->adaptiveSpinCount3 > 1) {
+		monitor->adaptiveSpinCount3 >>= 1;
+	}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 	return result;
 }
 
@@ -196,6 +222,56 @@ omrthread_spinlock_swapState(omrthread_monitor_t monitor, uintptr_t newState)
 	return oldState;
 }
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+/**
+ * Read a monitor's futex sequence number.
+ *
+ * A thread that is about to park must sample the sequence before it marks the
+ * spinlock as SPINLOCK_EXCEEDED. A release that happens between the two steps
+ * advances the sequence, so the subsequent park returns immediately instead of
+ * missing the wakeup.
+ *
+ * @param[in] monitor the monitor
+ *
+ * @return the current sequence number
+ */
+uint32_t
+omrthread_futex_sequence(omrthread_monitor_t monitor)
+{
+	uint32_t sequence = monitor->futexSequence;
+	VM_AtomicSupport::readBarrier();
+	return sequence;
+}
+
+/**
+ * Block on a monitor's futex until the sequence number moves past the given value.
+ *
+ * Spurious returns are possible; callers must re-check the spinlock state.
+ *
+ * @param[in] monitor the monitor
+ * @param[in] sequence value returned by omrthread_futex_sequence
+ */
+void
+omrthread_futex_park(omrthread_monitor_t monitor, uint32_t sequence)
+{
+	syscall(SYS_futex, &monitor->futexSequence, FUTEX_WAIT_PRIVATE, sequence, NULL, NULL, 0);
+}
+
+/**
+ * Advance a monitor's futex sequence number and wake up to count parked threads.
+ *
+ * @param[in] monitor the monitor
+ * @param[in] count maximum number of threads to wake, or 0 to wake all of them
+ */
+void
+omrthread_futex_unpark(omrthread_monitor_t monitor, uintptr_t count)
+{
+	int wakeCount = (0 == count) ? INT_MAX : (int)count;
+	VM_AtomicSupport::addU32(&monitor->futexSequence, 1);
+	syscall(SYS_futex, &monitor->futexSequence, FUTEX_WAKE_PRIVATE, wakeCount, NULL, NULL, 0);
+}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 #if defined(OMR_THR_MCS_LOCKS)
 /**
  * Acquire the MCS lock.
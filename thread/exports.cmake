@@ -107,6 +107,20 @@ omr_add_exports(j9thr_obj
 	omrthread_numa_set_enabled
 	omrthread_numa_set_node_affinity
 	omrthread_numa_get_node_affinity
+	omrthread_contention_set_sample_interval
+	omrthread_contention_get_sample_interval
+	omrthread_contention_dump
+	omrthread_contention_dump_no_locking
+	omrthread_contention_report
+	omrthread_fiber_scheduler_create
+	omrthread_fiber_scheduler_shutdown
+	omrthread_fiber_create
+	omrthread_fiber_self
+	omrthread_fiber_yield
+	omrthread_fiber_park
+	omrthread_fiber_unpark
+	omrthread_fiber_tls_set
+	omrthread_fiber_tls_get
 	omrthread_map_native_priority
 	omrthread_set_priority_spread
 	omrthread_set_name
@@ -178,6 +192,7 @@ if(OMR_THR_JLM)
 	omr_add_exports(j9thr_obj
 		omrthread_jlm_init
 		omrthread_jlm_get_gc_lock_tracing
+		omrthread_jlm_dump
 	)
 endif()
 
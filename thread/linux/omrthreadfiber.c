@@ -0,0 +1,956 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Thread
+ * @brief Fibers: lightweight user-space tasks multiplexed onto carrier threads (Linux)
+ *
+ * A scheduler owns a fixed set of carrier omrthreads. Each carrier has its own run queue;
+ * a carrier with nothing to run steals from the other carriers before going idle. Fibers
+ * run on mmap'd stacks with a guard page, and finished fibers are pooled with their stacks
+ * so that creating a fiber usually costs no system calls.
+ *
+ * A fiber must not hold an omrthread monitor across omrthread_fiber_yield or
+ * omrthread_fiber_park, since it may resume on a different carrier. Blocking in an
+ * omrthread primitive blocks the carrier, not just the fiber.
+ *
+ * On x86-64 and AArch64, switching between a fiber and its carrier saves only the
+ * callee-saved registers and the floating point control state, then swaps stack pointers.
+ * swapcontext also saves and restores the signal mask, which costs an rt_sigprocmask
+ * system call on every switch; fibers therefore run with the signal mask of whichever
+ * carrier is running them. Other architectures fall back to ucontext.
+ */
+
+#include <string.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+#include "omrcfg.h"
+#include "omrutilbase.h"
+#include "threaddef.h"
+#include "thread_internal.h"
+
+#define FIBER_DEFAULT_STACK_SIZE (64 * 1024)
+/* number of finished fibers (with their stacks) kept for reuse by each scheduler */
+#define FIBER_POOL_MAX 256
+
+#define FIBER_STATE_READY 0
+#define FIBER_STATE_RUNNING 1
+#define FIBER_STATE_PARKED 2
+
+#define FIBER_ACTION_YIELD 0
+#define FIBER_ACTION_PARK 1
+#define FIBER_ACTION_EXIT 2
+
+#if defined(__x86_64__) || defined(__aarch64__)
+#define FIBER_REGISTER_SWITCH
+/* the saved stack pointer; the registers are saved on the stack itself */
+typedef void *J9ThreadFiberContext;
+#else /* defined(__x86_64__) || defined(__aarch64__) */
+typedef ucontext_t J9ThreadFiberContext;
+#endif /* defined(__x86_64__) || defined(__aarch64__) */
+
+struct J9ThreadFiberCarrier;
+
+typedef struct J9ThreadFiber {
+	J9ThreadFiberContext context;
+	struct J9ThreadFiberScheduler *scheduler;
+	/* the carrier currently (or most recently) running the fiber */
+	struct J9ThreadFiberCarrier *carrier;
+	struct J9ThreadFiber *next;
+	omrthread_entrypoint_t entrypoint;
+	void *entryarg;
+	volatile uintptr_t state;
+	volatile uintptr_t permit;
+	/* stack allocation, including the guard page at its low end */
+	void *stackBase;
+	uintptr_t stackAllocationSize;
+	void *tls[J9THREAD_MAX_TLS_KEYS];
+} J9ThreadFiber;
+
+typedef struct J9ThreadFiberCarrier {
+	struct J9ThreadFiberScheduler *scheduler;
+	omrthread_t thread;
+	/* protects queueHead and queueTail */
+	omrthread_monitor_t queueMonitor;
+	J9ThreadFiber *queueHead;
+	J9ThreadFiber *queueTail;
+	J9ThreadFiberContext schedulerContext;
+	J9ThreadFiber *current;
+	uintptr_t pendingAction;
+	uintptr_t index;
+} J9ThreadFiberCarrier;
+
+typedef struct J9ThreadFiberScheduler {
+	J9ThreadFiberCarrier *carriers;
+	uintptr_t carrierCount;
+	uintptr_t stackSize;
+	/* idle carriers wait here for work or shutdown */
+	omrthread_monitor_t idleMonitor;
+	volatile uintptr_t idleCarriers;
+	volatile uintptr_t readyCount;
+	volatile uintptr_t nextCarrier;
+	BOOLEAN shutdown;
+	/* protects liveFibers and the fiber pool */
+	omrthread_monitor_t monitor;
+	uintptr_t liveFibers;
+	J9ThreadFiber *fiberPool;
+	uintptr_t fiberPoolSize;
+} J9ThreadFiberScheduler;
+
+/* TLS key mapping each carrier thread to its J9ThreadFiberCarrier, shared by all schedulers */
+static omrthread_tls_key_t fiberCarrierKey = 0;
+static uintptr_t fiberCarrierKeyUsers = 0;
+
+static J9ThreadFiberCarrier *currentCarrier(void);
+static J9ThreadFiber *allocateFiber(J9ThreadFiberScheduler *scheduler);
+static void freeFiber(J9ThreadFiber *fiber);
+static void finishFiber(J9ThreadFiberScheduler *scheduler, J9ThreadFiber *fiber);
+static void enqueueFiber(J9ThreadFiberCarrier *carrier, J9ThreadFiber *fiber);
+static J9ThreadFiber *dequeueFiber(J9ThreadFiberCarrier *carrier);
+static J9ThreadFiber *takeReadyFiber(J9ThreadFiberCarrier *carrier);
+static BOOLEAN waitForWork(J9ThreadFiberScheduler *scheduler);
+static void runFiber(J9ThreadFiberCarrier *carrier, J9ThreadFiber *fiber);
+static void switchToCarrier(J9ThreadFiber *fiber, uintptr_t action);
+static void fiberStart(void);
+static void initContext(J9ThreadFiberContext *context, void *stackLow, uintptr_t stackSize);
+static void switchContext(J9ThreadFiberContext *save, J9ThreadFiberContext *load);
+static int J9THREAD_PROC carrierMain(void *arg);
+static void releaseCarrierKey(omrthread_library_t lib);
+static void destroyScheduler(J9ThreadFiberScheduler *scheduler, uintptr_t startedCarriers);
+
+/**
+ * @return the carrier the current thread is, or NULL if it is not a carrier thread
+ */
+static J9ThreadFiberCarrier *
+currentCarrier(void)
+{
+	omrthread_t self = omrthread_self();
+
+	if ((NULL == self) || (0 == fiberCarrierKey)) {
+		return NULL;
+	}
+	return (J9ThreadFiberCarrier *)omrthread_tls_get(self, fiberCarrierKey);
+}
+
+/**
+ * Take a fiber from the scheduler's pool, or allocate a new one with its stack.
+ *
+ * @param[in] scheduler the scheduler the fiber will run on
+ * @return the fiber, or NULL if memory could not be allocated
+ */
+static J9ThreadFiber *
+allocateFiber(J9ThreadFiberScheduler *scheduler)
+{
+	omrthread_library_t lib = GLOBAL_DATA(default_library);
+	J9ThreadFiber *fiber = NULL;
+	uintptr_t pageSize = 0;
+	void *stackBase = NULL;
+
+	omrthread_monitor_enter(scheduler->monitor);
+	fiber = scheduler->fiberPool;
+	if (NULL != fiber) {
+		scheduler->fiberPool = fiber->next;
+		scheduler->fiberPoolSize -= 1;
+	}
+	omrthread_monitor_exit(scheduler->monitor);
+	if (NULL != fiber) {
+		return fiber;
+	}
+
+	fiber = (J9ThreadFiber *)omrthread_allocate_memory(lib, sizeof(J9ThreadFiber), OMRMEM_CATEGORY_THREADS);
+	if (NULL == fiber) {
+		return NULL;
+	}
+	pageSize = (uintptr_t)sysconf(_SC_PAGESIZE);
+	fiber->stackAllocationSize = scheduler->stackSize + pageSize;
+	stackBase = mmap(NULL, fiber->stackAllocationSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (MAP_FAILED == stackBase) {
+		omrthread_free_memory(lib, fiber);
+		return NULL;
+	}
+	/* stacks grow down, so an overflow runs into the guard page */
+	if (0 != mprotect(stackBase, pageSize, PROT_NONE)) {
+		munmap(stackBase, fiber->stackAllocationSize);
+		omrthread_free_memory(lib, fiber);
+		return NULL;
+	}
+	fiber->stackBase = stackBase;
+	fiber->scheduler = scheduler;
+	return fiber;
+}
+
+/**
+ * Release a fiber and its stack.
+ *
+ * @param[in] fiber the fiber to free
+ */
+static void
+freeFiber(J9ThreadFiber *fiber)
+{
+	omrthread_library_t lib = GLOBAL_DATA(default_library);
+
+	munmap(fiber->stackBase, fiber->stackAllocationSize);
+	omrthread_free_memory(lib, fiber);
+}
+
+/**
+ * Run TLS finalizers for a fiber whose entrypoint has returned, and return it to the pool.
+ * Called on the carrier's own stack.
+ *
+ * @param[in] scheduler the fiber's scheduler
+ * @param[in] fiber the finished fiber
+ */
+static void
+finishFiber(J9ThreadFiberScheduler *scheduler, J9ThreadFiber *fiber)
+{
+	omrthread_library_t lib = GLOBAL_DATA(default_library);
+	intptr_t index = 0;
+	BOOLEAN pooled = FALSE;
+
+	for (index = 0; index < J9THREAD_MAX_TLS_KEYS; index++) {
+		if (NULL != fiber->tls[index]) {
+			void *value = NULL;
+			omrthread_tls_finalizer_t finalizer = NULL;
+
+			OMROSMUTEX_ENTER(lib->tls_mutex);
+			value = fiber->tls[index];
+			finalizer = lib->tls_finalizers[index];
+			OMROSMUTEX_EXIT(lib->tls_mutex);
+
+			if ((NULL != value) && (NULL != finalizer)) {
+				finalizer(value);
+			}
+		}
+	}
+
+	omrthread_monitor_enter(scheduler->monitor);
+	if (scheduler->fiberPoolSize < FIBER_POOL_MAX) {
+		fiber->next = scheduler->fiberPool;
+		scheduler->fiberPool = fiber;
+		scheduler->fiberPoolSize += 1;
+		pooled = TRUE;
+	}
+	scheduler->liveFibers -= 1;
+	if (0 == scheduler->liveFibers) {
+		omrthread_monitor_notify_all(scheduler->monitor);
+	}
+	omrthread_monitor_exit(scheduler->monitor);
+
+	if (!pooled) {
+		freeFiber(fiber);
+	}
+}
+
+/**
+ * Make a fiber runnable by appending it to a carrier's run queue, and wake an idle
+ * carrier if there is one.
+ *
+ * @param[in] carrier the carrier whose queue receives the fiber
+ * @param[in] fiber a fiber in the FIBER_STATE_READY state
+ */
+static void
+enqueueFiber(J9ThreadFiberCarrier *carrier, J9ThreadFiber *fiber)
+{
+	J9ThreadFiberScheduler *scheduler = carrier->scheduler;
+
+	fiber->next = NULL;
+	omrthread_monitor_enter(carrier->queueMonitor);
+	if (NULL == carrier->queueTail) {
+		carrier->queueHead = fiber;
+	} else {
+		carrier->queueTail->next = fiber;
+	}
+	carrier->queueTail = fiber;
+	omrthread_monitor_exit(carrier->queueMonitor);
+
+	/* pairs with the barrier in waitForWork: either we see the idle carrier or it sees readyCount */
+	addAtomic(&scheduler->readyCount, 1);
+	issueReadWriteBarrier();
+	if (0 != scheduler->idleCarriers) {
+		omrthread_monitor_enter(scheduler->idleMonitor);
+		omrthread_monitor_notify(scheduler->idleMonitor);
+		omrthread_monitor_exit(scheduler->idleMonitor);
+	}
+}
+
+/**
+ * Remove the fiber at the head of a carrier's run queue.
+ *
+ * @param[in] carrier the carrier whose queue is popped
+ * @return the fiber, or NULL if the queue is empty
+ */
+static J9ThreadFiber *
+dequeueFiber(J9ThreadFiberCarrier *carrier)
+{
+	J9ThreadFiber *fiber = NULL;
+
+	if (NULL == carrier->queueHead) {
+		/* racy peek: don't contend for an empty queue */
+		return NULL;
+	}
+	omrthread_monitor_enter(carrier->queueMonitor);
+	fiber = carrier->queueHead;
+	if (NULL != fiber) {
+		carrier->queueHead = fiber->next;
+		if (NULL == carrier->queueHead) {
+			carrier->queueTail = NULL;
+		}
+	}
+	omrthread_monitor_exit(carrier->queueMonitor);
+	return fiber;
+}
+
+/**
+ * Find the next fiber for a carrier to run: its own queue first, then steal from the others.
+ *
+ * @param[in] carrier the current carrier
+ * @return the fiber, or NULL if no fiber is ready
+ */
+static J9ThreadFiber *
+takeReadyFiber(J9ThreadFiberCarrier *carrier)
+{
+	J9ThreadFiberScheduler *scheduler = carrier->scheduler;
+	J9ThreadFiber *fiber = dequeueFiber(carrier);
+	uintptr_t i = 0;
+
+	for (i = 1; (NULL == fiber) && (i < scheduler->carrierCount); i++) {
+		fiber = dequeueFiber(&scheduler->carriers[(carrier->index + i) % scheduler->carrierCount]);
+	}
+	if (NULL != fiber) {
+		subtractAtomic(&scheduler->readyCount, 1);
+	}
+	return fiber;
+}
+
+/**
+ * Block an idle carrier until a fiber becomes ready or the scheduler shuts down.
+ *
+ * @param[in] scheduler the carrier's scheduler
+ * @return FALSE if the carrier should exit, TRUE otherwise
+ */
+static BOOLEAN
+waitForWork(J9ThreadFiberScheduler *scheduler)
+{
+	BOOLEAN result = TRUE;
+
+	omrthread_monitor_enter(scheduler->idleMonitor);
+	scheduler->idleCarriers += 1;
+	issueReadWriteBarrier();
+	while ((0 == scheduler->readyCount) && !scheduler->shutdown) {
+		omrthread_monitor_wait(scheduler->idleMonitor);
+	}
+	scheduler->idleCarriers -= 1;
+	result = !scheduler->shutdown;
+	omrthread_monitor_exit(scheduler->idleMonitor);
+
+	return result;
+}
+
+/**
+ * Switch from the carrier to a fiber, and act on the reason the fiber switched back.
+ *
+ * State changes for a fiber that stopped running are made here, after its context has been
+ * saved, so that another carrier never resumes a fiber that is still switching out.
+ *
+ * @param[in] carrier the current carrier
+ * @param[in] fiber a ready fiber
+ */
+static void
+runFiber(J9ThreadFiberCarrier *carrier, J9ThreadFiber *fiber)
+{
+	fiber->carrier = carrier;
+	fiber->state = FIBER_STATE_RUNNING;
+	carrier->current = fiber;
+
+	switchContext(&carrier->schedulerContext, &fiber->context);
+
+	carrier->current = NULL;
+	switch (carrier->pendingAction) {
+	case FIBER_ACTION_YIELD:
+		fiber->state = FIBER_STATE_READY;
+		enqueueFiber(carrier, fiber);
+		break;
+	case FIBER_ACTION_PARK:
+		/* pairs with the barrier in omrthread_fiber_unpark */
+		fiber->state = FIBER_STATE_PARKED;
+		issueReadWriteBarrier();
+		if ((0 != fiber->permit)
+			&& (FIBER_STATE_PARKED == compareAndSwapUDATA((uintptr_t *)&fiber->state, FIBER_STATE_PARKED, FIBER_STATE_READY))
+		) {
+			enqueueFiber(carrier, fiber);
+		}
+		break;
+	case FIBER_ACTION_EXIT:
+		finishFiber(carrier->scheduler, fiber);
+		break;
+	default:
+		break;
+	}
+}
+
+/**
+ * Save the current fiber's context and return to the carrier's scheduling loop.
+ *
+ * @param[in] fiber the current fiber
+ * @param[in] action what the carrier should do with the fiber
+ */
+static void
+switchToCarrier(J9ThreadFiber *fiber, uintptr_t action)
+{
+	J9ThreadFiberCarrier *carrier = fiber->carrier;
+
+	carrier->pendingAction = action;
+	switchContext(&fiber->context, &carrier->schedulerContext);
+}
+
+/**
+ * First function run on a fiber's stack.
+ */
+static void
+fiberStart(void)
+{
+	J9ThreadFiber *fiber = currentCarrier()->current;
+
+	fiber->entrypoint(fiber->entryarg);
+	switchToCarrier(fiber, FIBER_ACTION_EXIT);
+}
+
+#if defined(FIBER_REGISTER_SWITCH)
+/*
+ * void omrthread_fiber_switch_context(void **save, void *load)
+ *
+ * Push the callee-saved registers and the floating point control state, store the stack
+ * pointer in *save, then load the stack pointer from load and pop the state saved there.
+ * The final return resumes whatever code last switched away from load, or, for a new fiber,
+ * the entry address that initContext placed in the frame.
+ */
+#if defined(__x86_64__)
+/*
+ * frame, from the saved stack pointer up: mxcsr and x87 control word, r15, r14, r13, r12, rbx, rbp,
+ * return address; a new fiber's frame has one more slot, the null return address fiberStart sees
+ */
+#define FIBER_SWITCH_FRAME_SLOTS 9
+__asm__(
+	".text\n"
+	".p2align 4\n"
+	".globl omrthread_fiber_switch_context\n"
+	".hidden omrthread_fiber_switch_context\n"
+	".type omrthread_fiber_switch_context, @function\n"
+	"omrthread_fiber_switch_context:\n"
+	"	pushq %rbp\n"
+	"	pushq %rbx\n"
+	"	pushq %r12\n"
+	"	pushq %r13\n"
+	"	pushq %r14\n"
+	"	pushq %r15\n"
+	"	subq $8, %rsp\n"
+	"	stmxcsr (%rsp)\n"
+	"	fnstcw 4(%rsp)\n"
+	"	movq %rsp, (%rdi)\n"
+	"	movq %rsi, %rsp\n"
+	"	ldmxcsr (%rsp)\n"
+	"	fldcw 4(%rsp)\n"
+	"	addq $8, %rsp\n"
+	"	popq %r15\n"
+	"	popq %r14\n"
+	"	popq %r13\n"
+	"	popq %r12\n"
+	"	popq %rbx\n"
+	"	popq %rbp\n"
+	"	ret\n"
+	".size omrthread_fiber_switch_context, .-omrthread_fiber_switch_context\n"
+);
+#elif defined(__aarch64__) /* defined(__x86_64__) */
+/* frame, from the saved stack pointer up: x19-x28, x29, x30 (return address), d8-d15, fpcr, padding */
+#define FIBER_SWITCH_FRAME_SLOTS 22
+__asm__(
+	".text\n"
+	".p2align 4\n"
+	".globl omrthread_fiber_switch_context\n"
+	".hidden omrthread_fiber_switch_context\n"
+	".type omrthread_fiber_switch_context, %function\n"
+	"omrthread_fiber_switch_context:\n"
+	"	sub sp, sp, #176\n"
+	"	stp x19, x20, [sp, #0]\n"
+	"	stp x21, x22, [sp, #16]\n"
+	"	stp x23, x24, [sp, #32]\n"
+	"	stp x25, x26, [sp, #48]\n"
+	"	stp x27, x28, [sp, #64]\n"
+	"	stp x29, x30, [sp, #80]\n"
+	"	stp d8, d9, [sp, #96]\n"
+	"	stp d10, d11, [sp, #112]\n"
+	"	stp d12, d13, [sp, #128]\n"
+	"	stp d14, d15, [sp, #144]\n"
+	"	mrs x9, fpcr\n"
+	"	str x9, [sp, #160]\n"
+	"	mov x9, sp\n"
+	"	str x9, [x0]\n"
+	"	mov sp, x1\n"
+	"	ldr x9, [sp, #160]\n"
+	"	msr fpcr, x9\n"
+	"	ldp x19, x20, [sp, #0]\n"
+	"	ldp x21, x22, [sp, #16]\n"
+	"	ldp x23, x24, [sp, #32]\n"
+	"	ldp x25, x26, [sp, #48]\n"
+	"	ldp x27, x28, [sp, #64]\n"
+	"	ldp x29, x30, [sp, #80]\n"
+	"	ldp d8, d9, [sp, #96]\n"
+	"	ldp d10, d11, [sp, #112]\n"
+	"	ldp d12, d13, [sp, #128]\n"
+	"	ldp d14, d15, [sp, #144]\n"
+	"	add sp, sp, #176\n"
+	"	ret\n"
+	".size omrthread_fiber_switch_context, .-omrthread_fiber_switch_context\n"
+);
+#endif /* defined(__x86_64__) */
+
+void omrthread_fiber_switch_context(void **save, void *load);
+#endif /* defined(FIBER_REGISTER_SWITCH) */
+
+/**
+ * Prepare a new fiber's context so that switching to it runs fiberStart on the given stack.
+ *
+ * @param[out] context the fiber's context
+ * @param[in] stackLow the lowest usable address of the stack
+ * @param[in] stackSize the usable size of the stack
+ */
+static void
+initContext(J9ThreadFiberContext *context, void *stackLow, uintptr_t stackSize)
+{
+#if defined(FIBER_REGISTER_SWITCH)
+	uintptr_t *stackTop = (uintptr_t *)(((uintptr_t)stackLow + stackSize) & ~(uintptr_t)15);
+	uintptr_t *frame = stackTop - FIBER_SWITCH_FRAME_SLOTS;
+
+	memset(frame, 0, FIBER_SWITCH_FRAME_SLOTS * sizeof(uintptr_t));
+	/* new fibers start with the floating point control state of the thread creating them, as with getcontext */
+#if defined(__x86_64__)
+	__asm__ volatile("stmxcsr (%0)\n\tfnstcw 4(%0)" : : "r"(frame) : "memory");
+	frame[7] = (uintptr_t)fiberStart;
+#elif defined(__aarch64__) /* defined(__x86_64__) */
+	__asm__ volatile("mrs %0, fpcr" : "=r"(frame[20]));
+	frame[11] = (uintptr_t)fiberStart;
+#endif /* defined(__x86_64__) */
+	*context = frame;
+#else /* defined(FIBER_REGISTER_SWITCH) */
+	getcontext(context);
+	context->uc_stack.ss_sp = stackLow;
+	context->uc_stack.ss_size = stackSize;
+	context->uc_link = NULL;
+	makecontext(context, fiberStart, 0);
+#endif /* defined(FIBER_REGISTER_SWITCH) */
+}
+
+/**
+ * Save the current context and resume another.
+ *
+ * @param[out] save where to save the current context
+ * @param[in] load the context to resume
+ */
+static void
+switchContext(J9ThreadFiberContext *save, J9ThreadFiberContext *load)
+{
+#if defined(FIBER_REGISTER_SWITCH)
+	omrthread_fiber_switch_context(save, *load);
+#else /* defined(FIBER_REGISTER_SWITCH) */
+	swapcontext(save, load);
+#endif /* defined(FIBER_REGISTER_SWITCH) */
+}
+
+/**
+ * Entry point of a carrier thread: run ready fibers until the scheduler shuts down.
+ *
+ * @param[in] arg the J9ThreadFiberCarrier
+ * @return 0
+ */
+static int J9THREAD_PROC
+carrierMain(void *arg)
+{
+	J9ThreadFiberCarrier *carrier = (J9ThreadFiberCarrier *)arg;
+	J9ThreadFiberScheduler *scheduler = carrier->scheduler;
+	omrthread_t self = omrthread_self();
+
+	omrthread_tls_set(self, fiberCarrierKey, carrier);
+	for (;;) {
+		J9ThreadFiber *fiber = takeReadyFiber(carrier);
+		if (NULL != fiber) {
+			runFiber(carrier, fiber);
+		} else if (!waitForWork(scheduler)) {
+			break;
+		}
+	}
+	omrthread_tls_set(self, fiberCarrierKey, NULL);
+
+	return 0;
+}
+
+/**
+ * Drop a reference to fiberCarrierKey, freeing it with the last scheduler.
+ *
+ * @param[in] lib the thread library
+ */
+static void
+releaseCarrierKey(omrthread_library_t lib)
+{
+	omrthread_tls_key_t key = 0;
+
+	GLOBAL_LOCK_SIMPLE(lib);
+	fiberCarrierKeyUsers -= 1;
+	if (0 == fiberCarrierKeyUsers) {
+		key = fiberCarrierKey;
+		fiberCarrierKey = 0;
+	}
+	GLOBAL_UNLOCK_SIMPLE(lib);
+
+	if (0 != key) {
+		omrthread_tls_free(key);
+	}
+}
+
+/**
+ * Stop and join a scheduler's carriers, then free the scheduler and its pooled fibers.
+ *
+ * @param[in] scheduler the scheduler
+ * @param[in] startedCarriers the number of carrier threads that were created
+ */
+static void
+destroyScheduler(J9ThreadFiberScheduler *scheduler, uintptr_t startedCarriers)
+{
+	omrthread_library_t lib = GLOBAL_DATA(default_library);
+	uintptr_t i = 0;
+
+	omrthread_monitor_enter(scheduler->idleMonitor);
+	scheduler->shutdown = TRUE;
+	omrthread_monitor_notify_all(scheduler->idleMonitor);
+	omrthread_monitor_exit(scheduler->idleMonitor);
+
+	for (i = 0; i < startedCarriers; i++) {
+		omrthread_join(scheduler->carriers[i].thread);
+	}
+	for (i = 0; i < scheduler->carrierCount; i++) {
+		if (NULL != scheduler->carriers[i].queueMonitor) {
+			omrthread_monitor_destroy(scheduler->carriers[i].queueMonitor);
+		}
+	}
+	while (NULL != scheduler->fiberPool) {
+		J9ThreadFiber *fiber = scheduler->fiberPool;
+		scheduler->fiberPool = fiber->next;
+		freeFiber(fiber);
+	}
+	if (NULL != scheduler->monitor) {
+		omrthread_monitor_destroy(scheduler->monitor);
+	}
+	if (NULL != scheduler->idleMonitor) {
+		omrthread_monitor_destroy(scheduler->idleMonitor);
+	}
+	omrthread_free_memory(lib, scheduler->carriers);
+	omrthread_free_memory(lib, scheduler);
+	releaseCarrierKey(lib);
+}
+
+/**
+ * Create a fiber scheduler and start its carrier threads.
+ *
+ * @param[out] handle pointer to the new scheduler
+ * @param[in] carrierCount number of carrier threads; must be at least 1
+ * @param[in] stackSize size of each fiber's stack in bytes, or 0 for the default (64KB)
+ * @return J9THREAD_SUCCESS on success, J9THREAD_INVALID_ARGUMENT if carrierCount is 0,
+ * J9THREAD_ERR_NOMEMORY or J9THREAD_ERR_THREAD_CREATE_FAILED otherwise
+ *
+ * @see omrthread_fiber_scheduler_shutdown
+ */
+intptr_t
+omrthread_fiber_scheduler_create(omrthread_fiber_scheduler_t *handle, uintptr_t carrierCount, uintptr_t stackSize)
+{
+	omrthread_library_t lib = GLOBAL_DATA(default_library);
+	J9ThreadFiberScheduler *scheduler = NULL;
+	uintptr_t pageSize = (uintptr_t)sysconf(_SC_PAGESIZE);
+	omrthread_attr_t attr = NULL;
+	intptr_t rc = J9THREAD_SUCCESS;
+	uintptr_t i = 0;
+
+	ASSERT(NULL != handle);
+	*handle = NULL;
+	if (0 == carrierCount) {
+		return J9THREAD_INVALID_ARGUMENT;
+	}
+	if (0 == stackSize) {
+		stackSize = FIBER_DEFAULT_STACK_SIZE;
+	}
+	stackSize = (stackSize + pageSize - 1) & ~(pageSize - 1);
+
+	GLOBAL_LOCK_SIMPLE(lib);
+	if (0 == fiberCarrierKeyUsers) {
+		if (0 != omrthread_tls_alloc(&fiberCarrierKey)) {
+			GLOBAL_UNLOCK_SIMPLE(lib);
+			return J9THREAD_ERR_NOMEMORY;
+		}
+	}
+	fiberCarrierKeyUsers += 1;
+	GLOBAL_UNLOCK_SIMPLE(lib);
+
+	scheduler = (J9ThreadFiberScheduler *)omrthread_allocate_memory(lib, sizeof(J9ThreadFiberScheduler), OMRMEM_CATEGORY_THREADS);
+	if (NULL == scheduler) {
+		releaseCarrierKey(lib);
+		return J9THREAD_ERR_NOMEMORY;
+	}
+	memset(scheduler, 0, sizeof(J9ThreadFiberScheduler));
+	scheduler->carrierCount = carrierCount;
+	scheduler->stackSize = stackSize;
+	scheduler->carriers = (J9ThreadFiberCarrier *)omrthread_allocate_memory(lib, carrierCount * sizeof(J9ThreadFiberCarrier), OMRMEM_CATEGORY_THREADS);
+	if (NULL == scheduler->carriers) {
+		omrthread_free_memory(lib, scheduler);
+		releaseCarrierKey(lib);
+		return J9THREAD_ERR_NOMEMORY;
+	}
+	memset(scheduler->carriers, 0, carrierCount * sizeof(J9ThreadFiberCarrier));
+
+	if ((0 != omrthread_monitor_init_with_name(&scheduler->monitor, 0, "&scheduler->monitor"))
+		|| (0 != omrthread_monitor_init_with_name(&scheduler->idleMonitor, 0, "&scheduler->idleMonitor"))
+	) {
+		destroyScheduler(scheduler, 0);
+		return J9THREAD_ERR_NOMEMORY;
+	}
+	for (i = 0; i < carrierCount; i++) {
+		J9ThreadFiberCarrier *carrier = &scheduler->carriers[i];
+		carrier->scheduler = scheduler;
+		carrier->index = i;
+		if (0 != omrthread_monitor_init_with_name(&carrier->queueMonitor, 0, "&carrier->queueMonitor")) {
+			destroyScheduler(scheduler, 0);
+			return J9THREAD_ERR_NOMEMORY;
+		}
+	}
+
+	if (J9THREAD_SUCCESS != omrthread_attr_init(&attr)) {
+		destroyScheduler(scheduler, 0);
+		return J9THREAD_ERR_NOMEMORY;
+	}
+	omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE);
+	omrthread_attr_set_name(&attr, "Fiber carrier");
+	for (i = 0; i < carrierCount; i++) {
+		J9ThreadFiberCarrier *carrier = &scheduler->carriers[i];
+		if (J9THREAD_SUCCESS != omrthread_create_ex(&carrier->thread, &attr, FALSE, carrierMain, carrier)) {
+			rc = J9THREAD_ERR_THREAD_CREATE_FAILED;
+			break;
+		}
+	}
+	omrthread_attr_destroy(&attr);
+	if (J9THREAD_SUCCESS != rc) {
+		destroyScheduler(scheduler, i);
+		return rc;
+	}
+
+	*handle = scheduler;
+	return J9THREAD_SUCCESS;
+}
+
+/**
+ * Wait for every fiber on a scheduler to finish, then stop its carriers and free it.
+ *
+ * Must not be called from a fiber running on the scheduler being shut down.
+ *
+ * @param[in] scheduler the scheduler
+ * @return J9THREAD_SUCCESS, or J9THREAD_INVALID_ARGUMENT if called from one of the scheduler's carriers
+ *
+ * @see omrthread_fiber_scheduler_create
+ */
+intptr_t
+omrthread_fiber_scheduler_shutdown(omrthread_fiber_scheduler_t scheduler)
+{
+	J9ThreadFiberCarrier *carrier = currentCarrier();
+
+	if ((NULL != carrier) && (carrier->scheduler == scheduler)) {
+		return J9THREAD_INVALID_ARGUMENT;
+	}
+
+	omrthread_monitor_enter(scheduler->monitor);
+	while (0 != scheduler->liveFibers) {
+		omrthread_monitor_wait(scheduler->monitor);
+	}
+	omrthread_monitor_exit(scheduler->monitor);
+
+	destroyScheduler(scheduler, scheduler->carrierCount);
+	return J9THREAD_SUCCESS;
+}
+
+/**
+ * Create a fiber and make it runnable.
+ *
+ * A fiber created by another fiber starts on its creator's carrier (other carriers may
+ * steal it); otherwise carriers are picked round-robin.
+ *
+ * @param[out] handle if not NULL, set to the new fiber. The handle is only valid until the
+ * fiber's entrypoint returns.
+ * @param[in] scheduler the scheduler to run the fiber on
+ * @param[in] entrypoint the function the fiber runs; the fiber ends when it returns
+ * @param[in] entryarg the argument passed to entrypoint
+ * @return J9THREAD_SUCCESS on success, J9THREAD_ERR_CANT_ALLOC_STACK if the fiber or its
+ * stack could not be allocated
+ */
+intptr_t
+omrthread_fiber_create(omrthread_fiber_t *handle, omrthread_fiber_scheduler_t scheduler, omrthread_entrypoint_t entrypoint, void *entryarg)
+{
+	J9ThreadFiber *fiber = allocateFiber(scheduler);
+	J9ThreadFiberCarrier *carrier = currentCarrier();
+	uintptr_t pageSize = (uintptr_t)sysconf(_SC_PAGESIZE);
+
+	if (NULL == fiber) {
+		return J9THREAD_ERR_CANT_ALLOC_STACK;
+	}
+	fiber->carrier = NULL;
+	fiber->next = NULL;
+	fiber->entrypoint = entrypoint;
+	fiber->entryarg = entryarg;
+	fiber->state = FIBER_STATE_READY;
+	fiber->permit = 0;
+	memset(fiber->tls, 0, sizeof(fiber->tls));
+
+	initContext(&fiber->context, (char *)fiber->stackBase + pageSize, scheduler->stackSize);
+
+	omrthread_monitor_enter(scheduler->monitor);
+	scheduler->liveFibers += 1;
+	omrthread_monitor_exit(scheduler->monitor);
+
+	if (NULL != handle) {
+		*handle = fiber;
+	}
+	if ((NULL == carrier) || (carrier->scheduler != scheduler)) {
+		carrier = &scheduler->carriers[addAtomic(&scheduler->nextCarrier, 1) % scheduler->carrierCount];
+	}
+	enqueueFiber(carrier, fiber);
+
+	return J9THREAD_SUCCESS;
+}
+
+/**
+ * @return the fiber running on the current thread, or NULL if the current thread is not
+ * running a fiber
+ */
+omrthread_fiber_t
+omrthread_fiber_self(void)
+{
+	J9ThreadFiberCarrier *carrier = currentCarrier();
+
+	return (NULL == carrier) ? NULL : carrier->current;
+}
+
+/**
+ * Let other ready fibers run on the current carrier. Called outside a fiber, this
+ * yields the thread.
+ */
+void
+omrthread_fiber_yield(void)
+{
+	J9ThreadFiber *fiber = omrthread_fiber_self();
+
+	if (NULL == fiber) {
+		omrthread_yield();
+	} else {
+		switchToCarrier(fiber, FIBER_ACTION_YIELD);
+	}
+}
+
+/**
+ * Park the current fiber until another thread or fiber unparks it. The carrier runs other
+ * fibers meanwhile.
+ *
+ * As with omrthread_park, each fiber has a single permit: if omrthread_fiber_unpark was called
+ * since the fiber last parked, this returns immediately. Callers should re-check their wake-up
+ * condition, since the fiber may also return without a matching unpark.
+ *
+ * @return J9THREAD_SUCCESS, or J9THREAD_INVALID_ARGUMENT if the current thread is not running a fiber
+ *
+ * @see omrthread_fiber_unpark
+ */
+intptr_t
+omrthread_fiber_park(void)
+{
+	J9ThreadFiber *fiber = omrthread_fiber_self();
+
+	if (NULL == fiber) {
+		return J9THREAD_INVALID_ARGUMENT;
+	}
+	if (1 != compareAndSwapUDATA((uintptr_t *)&fiber->permit, 1, 0)) {
+		switchToCarrier(fiber, FIBER_ACTION_PARK);
+		fiber->permit = 0;
+		issueReadWriteBarrier();
+	}
+	return J9THREAD_SUCCESS;
+}
+
+/**
+ * Unpark a fiber, or give it a permit so that its next park returns immediately.
+ * May be called from any thread or fiber.
+ *
+ * @param[in] fiber a fiber whose entrypoint has not returned
+ *
+ * @see omrthread_fiber_park
+ */
+void
+omrthread_fiber_unpark(omrthread_fiber_t fiber)
+{
+	fiber->permit = 1;
+	/* pairs with the barrier in runFiber: either we see the fiber parked or the carrier sees the permit */
+	issueReadWriteBarrier();
+	if (FIBER_STATE_PARKED == compareAndSwapUDATA((uintptr_t *)&fiber->state, FIBER_STATE_PARKED, FIBER_STATE_READY)) {
+		enqueueFiber(fiber->carrier, fiber);
+	}
+}
+
+/**
+ * Set a fiber's TLS value.
+ *
+ * Fibers use the keys allocated by omrthread_tls_alloc and omrthread_tls_alloc_with_finalizer.
+ * Finalizers run when the fiber's entrypoint returns. Unlike thread TLS, omrthread_tls_free
+ * does not clear the values held by live fibers.
+ *
+ * @param[in] fiber a fiber
+ * @param[in] key key to have TLS value set
+ * @param[in] value value to be stored in TLS
+ * @return 0 on success
+ *
+ * @see omrthread_fiber_tls_get, omrthread_tls_set
+ */
+intptr_t
+omrthread_fiber_tls_set(omrthread_fiber_t fiber, omrthread_tls_key_t key, void *value)
+{
+	fiber->tls[key - 1] = value;
+
+	return 0;
+}
+
+/**
+ * Get a fiber's TLS value.
+ *
+ * @param[in] fiber a fiber
+ * @param[in] key key to read the TLS value of
+ * @return the value, or NULL if it was never set
+ *
+ * @see omrthread_fiber_tls_set, omrthread_tls_get
+ */
+void *
+omrthread_fiber_tls_get(omrthread_fiber_t fiber, omrthread_tls_key_t key)
+{
+	return fiber->tls[key - 1];
+}
@@ -33,8 +33,10 @@ OBJECTS :=\
   j9sem \
   omrthread \
   omrthreadattr \
+  omrthreadcontention \
   omrthreaddebug \
   omrthreaderror \
+  omrthreadfiber \
   omrthreadinspect \
   omrthreadmem \
   omrthreadnuma \
@@ -110,6 +112,7 @@ ifeq (1,$(OMR_THR_JLM))
 define WRITE_JLM_THREAD_EXPORTS
 @echo omrthread_jlm_init >>$@
 @echo omrthread_jlm_get_gc_lock_tracing >>$@
+@echo omrthread_jlm_dump >>$@
 endef
 endif
 
@@ -206,6 +209,20 @@ define WRITE_COMMON_THREAD_EXPORTS
 @echo omrthread_numa_set_enabled >>$@
 @echo omrthread_numa_set_node_affinity >>$@
 @echo omrthread_numa_get_node_affinity >>$@
+@echo omrthread_contention_set_sample_interval >>$@
+@echo omrthread_contention_get_sample_interval >>$@
+@echo omrthread_contention_dump >>$@
+@echo omrthread_contention_dump_no_locking >>$@
+@echo omrthread_contention_report >>$@
+@echo omrthread_fiber_scheduler_create >>$@
+@echo omrthread_fiber_scheduler_shutdown >>$@
+@echo omrthread_fiber_create >>$@
+@echo omrthread_fiber_self >>$@
+@echo omrthread_fiber_yield >>$@
+@echo omrthread_fiber_park >>$@
+@echo omrthread_fiber_unpark >>$@
+@echo omrthread_fiber_tls_set >>$@
+@echo omrthread_fiber_tls_get >>$@
 @echo omrthread_map_native_priority >>$@
 @echo omrthread_set_priority_spread >>$@
 @echo omrthread_set_name >>$@
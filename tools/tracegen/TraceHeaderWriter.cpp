@@ -30,9 +30,6 @@
 #include "TraceHeaderWriter.hpp"
 
 const char *UT_H_FILE_FOOTER_TEMPLATE =
-"extern UtModuleInfo %s_UtModuleInfo;\n"
-"extern unsigned char %s_UtActive[];\n"
-"\n"
 "#ifndef UT_MODULE_INFO\n"
 "#define UT_MODULE_INFO %s_UtModuleInfo\n"
 "#endif /* UT_MODULE_INFO */\n"
@@ -57,6 +54,7 @@ const char *UT_H_FILE_HEADER_TEMPLATE =
 "#ifndef UTE_%s_MODULE_HEADER\n"
 "#define UTE_%s_MODULE_HEADER\n"
 "\n"
+"#include <string.h>\n"
 "#include \"ute_module.h\"\n"
 "\n"
 "#ifndef UT_TRACE_OVERHEAD\n"
@@ -86,6 +84,9 @@ const char *UT_H_FILE_HEADER_TEMPLATE =
 "#define UT_MODULE_UNLOADED(utIntf) deregister%sWithTrace(utIntf)\n"
 "#define UT_%s_MODULE_LOADED(utIntf) register%sWithTrace(utIntf, NULL)\n"
 "#define UT_%s_MODULE_UNLOADED(utIntf) deregister%sWithTrace(utIntf)\n"
+"\n"
+"extern UtModuleInfo %s_UtModuleInfo;\n"
+"extern unsigned char %s_UtActive[];\n"
 "\n";
 
 const char *TP_ASSERT_TEMPLATE =
@@ -138,6 +139,94 @@ const char *TP_TEMPLATE =
 "#endif\n"
 "\n";
 
+/* Type-specialized trace point template, used when every argument has a fixed size.
+ * The writer lays the arguments out as the trace record stores them and hands them to
+ * TraceData, so the trace engine does not have to walk the spec and a va_list. Printed
+ * trace points need the va_list, so the writer passes those to Trace.
+ */
+const char *TP_WRITER_TAIL_TEMPLATE =
+"		%s_UtModuleInfo.intf->TraceData(env, &%s_UtModuleInfo, traceId, %s, %s);\n"
+"	} else {\n"
+"		%s_UtModuleInfo.intf->Trace(env, &%s_UtModuleInfo, traceId, %s%s);\n"
+"	}\n"
+"}\n"
+"%s" /* Place holder for option test macro (specified by "Test" option in tp spec) */
+"#define %s(%s%s) \\\n"
+"	do { /* tracepoint name: %s.%u */ \\\n"
+"		if (0 != %s_UtActive[%u]) { \\\n"
+"			%s_UtWrite%u(%s, ((%uu << 8) | %s_UtActive[%u])"
+;
+
+const char *TP_WRITER_FOOTER_TEMPLATE =
+"); \\\n"
+"		} \\\n"
+"	} while (0)\n"
+"#else\n"
+"%s" /* Place holder for option test macro (specified by "Test" option in tp spec) */
+"#define %s(%s%s) /* tracepoint name: %s.%u */\n"
+"#endif\n"
+"\n";
+
+/**
+ * Map the data types in a trace point's parameter string to the C types its writer
+ * stores them as.
+ * @param parameters The parameter string generated from the template, e.g. "\"\\6\\4\"" or "NULL"
+ * @param parmCount The number of parameters
+ * @param types Receives parmCount type names
+ * @return true if every parameter has a fixed size, false if the trace point must use the
+ * generic path (strings, long doubles)
+ */
+static bool
+getWriterTypes(const char *parameters, unsigned int parmCount, const char **types)
+{
+	const char *pos = parameters;
+	unsigned int count = 0;
+
+	if (0 == strcmp(parameters, "NULL")) {
+		return 0 == parmCount;
+	}
+	if ('\"' != *pos) {
+		return false;
+	}
+	pos += 1;
+	while ('\"' != *pos) {
+		unsigned int type = 0;
+
+		if (('\\' != *pos) || (count >= parmCount)) {
+			return false;
+		}
+		pos += 1;
+		while (('0' <= *pos) && ('7' >= *pos)) {
+			type = (type * 8) + (*pos - '0');
+			pos += 1;
+		}
+		switch (type) {
+		case 1: /* TRACE_DATA_TYPE_CHAR */
+			types[count] = "char";
+			break;
+		case 2: /* TRACE_DATA_TYPE_SHORT */
+			types[count] = "int16_t";
+			break;
+		case 4: /* TRACE_DATA_TYPE_INT32 */
+			types[count] = "int32_t";
+			break;
+		case 6: /* TRACE_DATA_TYPE_POINTER */
+			types[count] = "uintptr_t";
+			break;
+		case 7: /* TRACE_DATA_TYPE_DOUBLE */
+			types[count] = "double";
+			break;
+		case 8: /* TRACE_DATA_TYPE_INT64 */
+			types[count] = "int64_t";
+			break;
+		default:
+			return false;
+		}
+		count += 1;
+	}
+	return count == parmCount;
+}
+
 RCType
 TraceHeaderWriter::writeOutputFiles(J9TDFOptions *options, J9TDFFile *tdf)
 {
@@ -226,9 +315,11 @@ TraceHeaderWriter::tpTemplate(FILE *fd, unsigned int overhead, unsigned int test
 	const char *testMacroTemplate = "#define TrcEnabled_%s (0 != %s_UtActive[%u])\n";
 	const char *testNopTemplate = "#define TrcEnabled_%s 0\n";
 	size_t parmBufLen = (parmCount * 5) + 1;
+	const char **types = NULL;
 
 	parmString = (char *)Port::omrmem_calloc(1, parmBufLen);
-	if (NULL == parmString) {
+	types = (const char **)Port::omrmem_calloc(parmCount + 1, sizeof(const char *));
+	if ((NULL == parmString) || (NULL == types)) {
 		eprintf("Failed to allocate memory");
 		goto failed;
 	}
@@ -295,6 +386,11 @@ TraceHeaderWriter::tpTemplate(FILE *fd, unsigned int overhead, unsigned int test
 			rc = RC_FAILED;
 			goto failed;
 		}
+	} else if (getWriterTypes(parameters, parmCount, types)) {
+		rc = tpWriterTemplate(fd, overhead, testMacro, testNop, name, module, id, envParam, parameters, parmString, parmCount, types);
+		if (RC_OK != rc) {
+			goto failed;
+		}
 	} else {
 		if (0 <= fprintf(fd, TP_TEMPLATE
 				, overhead
@@ -329,6 +425,7 @@ TraceHeaderWriter::tpTemplate(FILE *fd, unsigned int overhead, unsigned int test
 	}
 
 	Port::omrmem_free((void **)&parmString);
+	Port::omrmem_free((void **)&types);
 
 	if (test) {
 		Port::omrmem_free((void **)&testMacro);
@@ -339,6 +436,7 @@ TraceHeaderWriter::tpTemplate(FILE *fd, unsigned int overhead, unsigned int test
 
 failed:
 	Port::omrmem_free((void **)&parmString);
+	Port::omrmem_free((void **)&types);
 
 	if (test) {
 		Port::omrmem_free((void **)&testMacro);
@@ -348,6 +446,114 @@ failed:
 	return rc;
 }
 
+/* Type-specialized trace point template.
+ * Writes the inline writer function, then the trace point macro that casts each argument
+ * to the type the writer stores it as. See TP_WRITER_TAIL_TEMPLATE.
+ */
+RCType
+TraceHeaderWriter::tpWriterTemplate(FILE *fd, unsigned int overhead, const char *testMacro, const char *testNop, const char *name, const char *module, unsigned int id, unsigned int envParam, const char *parameters, const char *parmString, unsigned int parmCount, const char **types)
+{
+	const char *parmStringNoLeadingComma = (parmCount > 0) ? parmString + 2 : parmString;
+	unsigned int i = 0;
+
+	/* Writer signature */
+	if (0 > fprintf(fd, "#if UT_TRACE_OVERHEAD >= %u\nstatic VMINLINE_ALWAYS void\n%s_UtWrite%u(void *env, uint32_t traceId", overhead, module, id)) {
+		return RC_FAILED;
+	}
+	for (i = 0; i < parmCount; i++) {
+		if (0 > fprintf(fd, ", %s P%u", types[i], i + 1)) {
+			return RC_FAILED;
+		}
+	}
+	if (0 > fprintf(fd, ")\n{\n\tif ((0 == (traceId & UT_TRACE_PRINT_ACTIVE)) && (NULL != %s_UtModuleInfo.intf->TraceData)) {\n", module)) {
+		return RC_FAILED;
+	}
+
+	/* Lay the arguments out in record order */
+	if (parmCount > 0) {
+		if (0 > fprintf(fd, "\t\tuint8_t data[sizeof(P1)")) {
+			return RC_FAILED;
+		}
+		for (i = 1; i < parmCount; i++) {
+			if (0 > fprintf(fd, " + sizeof(P%u)", i + 1)) {
+				return RC_FAILED;
+			}
+		}
+		if (0 > fprintf(fd, "];\n")) {
+			return RC_FAILED;
+		}
+		for (i = 0; i < parmCount; i++) {
+			unsigned int j = 0;
+
+			if (0 > fprintf(fd, "\t\tmemcpy(data")) {
+				return RC_FAILED;
+			}
+			for (j = 0; j < i; j++) {
+				if (0 > fprintf(fd, " + sizeof(P%u)", j + 1)) {
+					return RC_FAILED;
+				}
+			}
+			if (0 > fprintf(fd, ", &P%u, sizeof(P%u));\n", i + 1, i + 1)) {
+				return RC_FAILED;
+			}
+		}
+	}
+
+	if (0 > fprintf(fd, TP_WRITER_TAIL_TEMPLATE
+			, module
+			, module
+			, (parmCount > 0) ? "data" : "NULL"
+			, (parmCount > 0) ? "sizeof(data)" : "0"
+			, module
+			, module
+			, parameters
+			, parmString
+			, testMacro
+			, name
+			, envParam ? "thr" : ""
+			, envParam ? parmString : parmStringNoLeadingComma
+			, module
+			, id
+			, module
+			, id
+			, module
+			, id
+			, envParam ? UT_ENV_PARAM : UT_NOENV_PARAM
+			, id
+			, module
+			, id
+	)) {
+		return RC_FAILED;
+	}
+
+	/* Cast each argument to the writer's parameter type. Narrow integers go through intptr_t
+	 * so that a pointer traced with %d keeps its low bits, as va_arg would have read them.
+	 */
+	for (i = 0; i < parmCount; i++) {
+		const char *castFormat = ", (%s)(P%u)";
+
+		if ((0 == strcmp(types[i], "char")) || (0 == strcmp(types[i], "int16_t")) || (0 == strcmp(types[i], "int32_t"))) {
+			castFormat = ", (%s)(intptr_t)(P%u)";
+		}
+		if (0 > fprintf(fd, castFormat, types[i], i + 1)) {
+			return RC_FAILED;
+		}
+	}
+
+	if (0 > fprintf(fd, TP_WRITER_FOOTER_TEMPLATE
+			, testNop
+			, name
+			, envParam ? "thr" : ""
+			, envParam ? parmString : parmStringNoLeadingComma
+			, module
+			, id
+	)) {
+		return RC_FAILED;
+	}
+
+	return RC_OK;
+}
+
 RCType
 TraceHeaderWriter::tpAssert(FILE *fd, unsigned int overhead, unsigned int test, const char *name, const char *module, unsigned int id, unsigned int envParam, const char *conditionStr, unsigned int parmCount)
 {
@@ -495,7 +701,9 @@ TraceHeaderWriter::headerTemplate(J9TDFOptions *options, FILE *fd, const char *m
 			moduleName,
 			moduleName,
 			ucModule, moduleName,
-			ucModule, moduleName
+			ucModule, moduleName,
+			moduleName,
+			moduleName
 	)) {
 		rc = RC_OK;
 	} else {
@@ -535,7 +743,7 @@ TraceHeaderWriter::footerTemplate(FILE *fd, const char *moduleName)
 #endif /* !defined(OMRZTPF) */
 		pos++;
 	}
-	if (0 <= fprintf(fd, UT_H_FILE_FOOTER_TEMPLATE, moduleName, moduleName, moduleName, moduleName, ucModule)) {
+	if (0 <= fprintf(fd, UT_H_FILE_FOOTER_TEMPLATE, moduleName, moduleName, ucModule)) {
 		rc = RC_OK;
 	} else {
 		rc = RC_FAILED;
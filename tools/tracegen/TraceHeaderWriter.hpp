@@ -46,6 +46,14 @@ private:
 	 */
 	RCType tpTemplate(FILE *fd, unsigned int overhead, unsigned int test, const char *name, const char *module, unsigned int id, unsigned int envparam, const char *format, unsigned int formatParamCount, unsigned int auxiliary);
 
+	/**
+	 * Output trace point with a type-specialized writer function
+	 * @param fd Output stream
+	 * @param types The C type each parameter is stored as
+	 * @return RC_OK on success, RC_FAILED on failure
+	 */
+	RCType tpWriterTemplate(FILE *fd, unsigned int overhead, const char *testMacro, const char *testNop, const char *name, const char *module, unsigned int id, unsigned int envparam, const char *format, const char *parmString, unsigned int formatParamCount, const char **types);
+
 	/**
 	 *  Output assertion
 	 *  @param fd Output stream
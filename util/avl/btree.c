@@ -0,0 +1,793 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+/*
+ * file    : btree.c
+ *
+ *  Ordered index for address-range lookups
+ *
+ *  A B+-tree whose nodes are immutable once they are reachable from the root. An update copies the
+ *  nodes on the path from the root to the leaf it changes, and publishes the new path by storing the
+ *  new root, so readers take no locks and always see a consistent tree. Writers must be serialized
+ *  by the caller, as the users of J9AVLTree already do.
+ *
+ *  The nodes replaced by an update may still be in use by concurrent readers, so they are retired
+ *  rather than freed, and are only freed by btree_reclaim or btree_free, which the caller must
+ *  invoke when no reader is using the tree.
+ *
+ *  Nodes are not merged when they become sparse; empty nodes are removed and a root left with a
+ *  single child is replaced by that child.
+ */
+
+#include <string.h>
+#include "omrcfg.h"
+#include "avl_api.h"
+#include "omrutil.h"
+#include "omrutilbase.h"
+#include "pool_api.h"
+
+/* Up to two nodes are allocated per level, plus a new root */
+#define NEW_NODES_MAX ((2 * J9BTREE_MAX_HEIGHT) + 1)
+
+typedef struct J9BTreeUpdate {
+	J9BTreeNode *newNodes[NEW_NODES_MAX];
+	uintptr_t newNodeCount;
+} J9BTreeUpdate;
+
+static uintptr_t keysAtOrBelow(J9BTreeNode *node, uintptr_t key);
+static uintptr_t keysBelow(J9BTreeNode *node, uintptr_t key);
+static void *leftmostElement(J9BTreeNode *node);
+static J9BTreeNode *allocateNode(J9BTree *tree, J9BTreeUpdate *update, uint32_t level);
+static BOOLEAN replaceEntries(J9BTree *tree, J9BTreeUpdate *update, J9BTreeNode *node, uintptr_t position, uintptr_t removeCount, uintptr_t *insertKeys, void **insertValues, uintptr_t insertCount, J9BTreeNode **result, uintptr_t *resultCount);
+static BOOLEAN isNewNode(J9BTreeUpdate *update, J9BTreeNode *node);
+static void abandonUpdate(J9BTree *tree, J9BTreeUpdate *update);
+static void retireNode(J9BTree *tree, J9BTreeNode *node);
+static uintptr_t findPath(J9BTreeNode *root, uintptr_t key, J9BTreeNode **path, uintptr_t *index);
+static BOOLEAN rebuildPath(J9BTree *tree, J9BTreeNode **path, uintptr_t *index, uintptr_t depth, uintptr_t position, uintptr_t removeCount, uintptr_t key, void *element);
+static void *walkToElement(J9BTreeWalkState *state, uintptr_t level);
+
+/**
+ * @return the number of keys in node that are less than or equal to key
+ */
+static uintptr_t
+keysAtOrBelow(J9BTreeNode *node, uintptr_t key)
+{
+	uintptr_t low = 0;
+	uintptr_t high = node->count;
+
+	while (low < high) {
+		uintptr_t middle = (low + high) / 2;
+
+		if (node->keys[middle] <= key) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+	return low;
+}
+
+/**
+ * @return the number of keys in node that are less than key
+ */
+static uintptr_t
+keysBelow(J9BTreeNode *node, uintptr_t key)
+{
+	uintptr_t low = 0;
+	uintptr_t high = node->count;
+
+	while (low < high) {
+		uintptr_t middle = (low + high) / 2;
+
+		if (node->keys[middle] < key) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+	return low;
+}
+
+static void *
+leftmostElement(J9BTreeNode *node)
+{
+	while (0 != node->level) {
+		node = (J9BTreeNode *)node->values[0];
+	}
+	return node->values[0];
+}
+
+static J9BTreeNode *
+allocateNode(J9BTree *tree, J9BTreeUpdate *update, uint32_t level)
+{
+	J9BTreeNode *node = (J9BTreeNode *)pool_newElement(tree->nodePool);
+
+	if (NULL != node) {
+		node->count = 0;
+		node->level = level;
+		node->retiredNext = NULL;
+		update->newNodes[update->newNodeCount] = node;
+		update->newNodeCount += 1;
+	}
+	return node;
+}
+
+/**
+ * Build the replacement for node, with removeCount entries at position replaced by insertCount new
+ * entries. The result is split over two nodes if it does not fit in one, and is no node at all if
+ * it is empty.
+ *
+ * @param[out] result  The nodes holding the result
+ * @param[out] resultCount  The number of nodes holding the result, 0 to 2
+ *
+ * @return FALSE if a node could not be allocated
+ */
+static BOOLEAN
+replaceEntries(J9BTree *tree, J9BTreeUpdate *update, J9BTreeNode *node, uintptr_t position, uintptr_t removeCount,
+	uintptr_t *insertKeys, void **insertValues, uintptr_t insertCount, J9BTreeNode **result, uintptr_t *resultCount)
+{
+	uintptr_t keys[J9BTREE_NODE_SLOTS + 2];
+	void *values[J9BTREE_NODE_SLOTS + 2];
+	uintptr_t tail = position + removeCount;
+	uintptr_t count = 0;
+	uintptr_t leftCount = 0;
+	J9BTreeNode *left = NULL;
+	J9BTreeNode *right = NULL;
+
+	memcpy(keys, node->keys, position * sizeof(uintptr_t));
+	memcpy(values, node->values, position * sizeof(void *));
+	memcpy(&keys[position], insertKeys, insertCount * sizeof(uintptr_t));
+	memcpy(&values[position], insertValues, insertCount * sizeof(void *));
+	count = position + insertCount;
+	memcpy(&keys[count], &node->keys[tail], (node->count - tail) * sizeof(uintptr_t));
+	memcpy(&values[count], &node->values[tail], (node->count - tail) * sizeof(void *));
+	count += node->count - tail;
+
+	*resultCount = 0;
+	if (0 == count) {
+		return TRUE;
+	}
+	leftCount = (count > J9BTREE_NODE_SLOTS) ? (count / 2) : count;
+	left = allocateNode(tree, update, node->level);
+	if (NULL == left) {
+		return FALSE;
+	}
+	memcpy(left->keys, keys, leftCount * sizeof(uintptr_t));
+	memcpy(left->values, values, leftCount * sizeof(void *));
+	left->count = (uint32_t)leftCount;
+	result[0] = left;
+	*resultCount = 1;
+
+	if (leftCount < count) {
+		right = allocateNode(tree, update, node->level);
+		if (NULL == right) {
+			return FALSE;
+		}
+		memcpy(right->keys, &keys[leftCount], (count - leftCount) * sizeof(uintptr_t));
+		memcpy(right->values, &values[leftCount], (count - leftCount) * sizeof(void *));
+		right->count = (uint32_t)(count - leftCount);
+		result[1] = right;
+		*resultCount = 2;
+	}
+	return TRUE;
+}
+
+static BOOLEAN
+isNewNode(J9BTreeUpdate *update, J9BTreeNode *node)
+{
+	uintptr_t i = 0;
+
+	for (i = 0; i < update->newNodeCount; i++) {
+		if (node == update->newNodes[i]) {
+			return TRUE;
+		}
+	}
+	return FALSE;
+}
+
+static void
+abandonUpdate(J9BTree *tree, J9BTreeUpdate *update)
+{
+	uintptr_t i = 0;
+
+	for (i = 0; i < update->newNodeCount; i++) {
+		pool_removeElement(tree->nodePool, update->newNodes[i]);
+	}
+	update->newNodeCount = 0;
+}
+
+static void
+retireNode(J9BTree *tree, J9BTreeNode *node)
+{
+	node->retiredNext = tree->retiredNodes;
+	tree->retiredNodes = node;
+	tree->retiredCount += 1;
+}
+
+/**
+ * Record the nodes from root to the leaf that key belongs in, and the index of the child taken
+ * at each of them.
+ *
+ * @return the number of nodes on the path
+ */
+static uintptr_t
+findPath(J9BTreeNode *root, uintptr_t key, J9BTreeNode **path, uintptr_t *index)
+{
+	J9BTreeNode *node = root;
+	uintptr_t depth = 0;
+
+	while (0 != node->level) {
+		uintptr_t below = keysAtOrBelow(node, key);
+		uintptr_t child = (0 == below) ? 0 : (below - 1);
+
+		path[depth] = node;
+		index[depth] = child;
+		depth += 1;
+		node = (J9BTreeNode *)node->values[child];
+	}
+	path[depth] = node;
+	index[depth] = 0;
+	return depth + 1;
+}
+
+/**
+ * Copy the path with removeCount entries at position in its leaf replaced by element, if it is
+ * not NULL, and publish the new root.
+ *
+ * @return FALSE if the nodes for the update could not be allocated, in which case the tree is unchanged
+ */
+static BOOLEAN
+rebuildPath(J9BTree *tree, J9BTreeNode **path, uintptr_t *index, uintptr_t depth, uintptr_t position, uintptr_t removeCount, uintptr_t key, void *element)
+{
+	J9BTreeUpdate update;
+	uintptr_t insertKeys[2];
+	void *insertValues[2];
+	J9BTreeNode *result[2];
+	uintptr_t resultCount = 0;
+	J9BTreeNode *newRoot = NULL;
+	uintptr_t level = depth - 1;
+
+	update.newNodeCount = 0;
+	insertKeys[0] = key;
+	insertValues[0] = element;
+	if (!replaceEntries(tree, &update, path[level], position, removeCount, insertKeys, insertValues, (NULL == element) ? 0 : 1, result, &resultCount)) {
+		abandonUpdate(tree, &update);
+		return FALSE;
+	}
+	while (0 != level) {
+		uintptr_t i = 0;
+
+		level -= 1;
+		for (i = 0; i < resultCount; i++) {
+			insertKeys[i] = result[i]->keys[0];
+			insertValues[i] = result[i];
+		}
+		if (!replaceEntries(tree, &update, path[level], index[level], 1, insertKeys, insertValues, resultCount, result, &resultCount)) {
+			abandonUpdate(tree, &update);
+			return FALSE;
+		}
+	}
+
+	if (2 == resultCount) {
+		if (J9BTREE_MAX_HEIGHT == depth) {
+			abandonUpdate(tree, &update);
+			return FALSE;
+		}
+		newRoot = allocateNode(tree, &update, result[0]->level + 1);
+		if (NULL == newRoot) {
+			abandonUpdate(tree, &update);
+			return FALSE;
+		}
+		newRoot->keys[0] = result[0]->keys[0];
+		newRoot->values[0] = result[0];
+		newRoot->keys[1] = result[1]->keys[0];
+		newRoot->values[1] = result[1];
+		newRoot->count = 2;
+	} else if (1 == resultCount) {
+		newRoot = result[0];
+		while ((0 != newRoot->level) && (1 == newRoot->count)) {
+			/* replace a root left with a single child by the child */
+			J9BTreeNode *child = (J9BTreeNode *)newRoot->values[0];
+
+			if (isNewNode(&update, newRoot)) {
+				pool_removeElement(tree->nodePool, newRoot);
+			} else {
+				retireNode(tree, newRoot);
+			}
+			newRoot = child;
+		}
+	}
+
+	/* the new nodes must be complete before readers can reach them */
+	issueWriteBarrier();
+	tree->rootNode = newRoot;
+	for (level = 0; level < depth; level++) {
+		retireNode(tree, path[level]);
+	}
+	return TRUE;
+}
+
+/**
+ * Descend from path[level] to the leftmost element below the child selected by index[level].
+ */
+static void *
+walkToElement(J9BTreeWalkState *state, uintptr_t level)
+{
+	while (level < (state->depth - 1)) {
+		J9BTreeNode *child = (J9BTreeNode *)state->path[level]->values[state->index[level]];
+
+		level += 1;
+		state->path[level] = child;
+		state->index[level] = 0;
+	}
+	return state->path[level]->values[state->index[level]];
+}
+
+/**
+ * Create a new, empty ordered index.
+ *
+ * @param[in] portLibrary  The port library
+ * @param[in] memoryCategory  Memory category for the memory allocated by the tree
+ * @param[in] keyFunction  Returns the key of an element, for example the start of the address range
+ * it covers. It is called once per insert or delete, never by searches.
+ * @param[in] searchComparator  Optional. Returns 0 if an element matches a search value, in the style of
+ * J9AVLTree's searchComparator, for example if an address lies within the element's range. If NULL, only
+ * an element whose key equals the search value matches.
+ * @param[in] userData  Stored in the tree for the callbacks
+ *
+ * @return  The tree or NULL in the case of error
+ */
+J9BTree *
+btree_new(OMRPortLibrary *portLibrary, uint32_t memoryCategory,
+	uintptr_t (*keyFunction)(J9BTree *tree, void *element),
+	intptr_t (*searchComparator)(J9BTree *tree, uintptr_t searchValue, void *element),
+	void *userData)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	J9BTree *tree = (J9BTree *)omrmem_allocate_memory(sizeof(J9BTree), memoryCategory);
+
+	if (NULL != tree) {
+		memset(tree, 0, sizeof(J9BTree));
+		tree->keyFunction = keyFunction;
+		tree->searchComparator = searchComparator;
+		tree->portLibrary = portLibrary;
+		tree->memoryCategory = memoryCategory;
+		tree->userData = userData;
+		tree->nodePool = pool_new(J9BTREE_NODE_SIZE, 0, J9BTREE_NODE_ALIGNMENT, POOL_NO_ZERO, OMR_GET_CALLSITE(), memoryCategory, POOL_FOR_PORT(portLibrary));
+		if (NULL == tree->nodePool) {
+			omrmem_free_memory(tree);
+			tree = NULL;
+		}
+	}
+	return tree;
+}
+
+/**
+ * Free a tree and all of its nodes. The elements are not freed.
+ *
+ * @param[in] tree  The tree, may be NULL
+ */
+void
+btree_free(J9BTree *tree)
+{
+	if (NULL != tree) {
+		OMRPORT_ACCESS_FROM_OMRPORT(tree->portLibrary);
+
+		pool_kill(tree->nodePool);
+		omrmem_free_memory(tree);
+	}
+}
+
+/**
+ * Insert an element into a tree. The caller must serialize this with other updates of the tree.
+ *
+ * @param[in] tree  The tree
+ * @param[in] element  The element to insert
+ *
+ * @return  The element inserted, the element already in the tree with the same key, or NULL in the case of error
+ */
+void *
+btree_insert(J9BTree *tree, void *element)
+{
+	uintptr_t key = tree->keyFunction(tree, element);
+	J9BTreeNode *root = tree->rootNode;
+	J9BTreeNode *path[J9BTREE_MAX_HEIGHT];
+	uintptr_t index[J9BTREE_MAX_HEIGHT];
+	uintptr_t depth = 0;
+	uintptr_t position = 0;
+	J9BTreeNode *leaf = NULL;
+
+	if (NULL == root) {
+		J9BTreeUpdate update;
+
+		update.newNodeCount = 0;
+		leaf = allocateNode(tree, &update, 0);
+		if (NULL == leaf) {
+			return NULL;
+		}
+		leaf->keys[0] = key;
+		leaf->values[0] = element;
+		leaf->count = 1;
+		issueWriteBarrier();
+		tree->rootNode = leaf;
+		tree->elementCount = 1;
+		return element;
+	}
+
+	depth = findPath(root, key, path, index);
+	leaf = path[depth - 1];
+	position = keysBelow(leaf, key);
+	if ((position < leaf->count) && (key == leaf->keys[position])) {
+		return leaf->values[position];
+	}
+	if (!rebuildPath(tree, path, index, depth, position, 0, key, element)) {
+		return NULL;
+	}
+	tree->elementCount += 1;
+	return element;
+}
+
+/**
+ * Delete an element from a tree. The caller must serialize this with other updates of the tree.
+ *
+ * @param[in] tree  The tree
+ * @param[in] element  The element to delete
+ *
+ * @return  The element deleted, or NULL if it is not in the tree or in the case of error
+ */
+void *
+btree_delete(J9BTree *tree, void *element)
+{
+	uintptr_t key = tree->keyFunction(tree, element);
+	J9BTreeNode *root = tree->rootNode;
+	J9BTreeNode *path[J9BTREE_MAX_HEIGHT];
+	uintptr_t index[J9BTREE_MAX_HEIGHT];
+	uintptr_t depth = 0;
+	uintptr_t position = 0;
+	J9BTreeNode *leaf = NULL;
+
+	if (NULL == root) {
+		return NULL;
+	}
+	depth = findPath(root, key, path, index);
+	leaf = path[depth - 1];
+	position = keysBelow(leaf, key);
+	if ((position == leaf->count) || (element != leaf->values[position])) {
+		return NULL;
+	}
+	if (!rebuildPath(tree, path, index, depth, position, 1, 0, NULL)) {
+		return NULL;
+	}
+	tree->elementCount -= 1;
+	return element;
+}
+
+/**
+ * Load an empty tree with elements, which must be sorted by strictly ascending key. The tree is
+ * built bottom up with full nodes, which is much faster than inserting the elements one by one.
+ * The caller must serialize this with other updates of the tree.
+ *
+ * @param[in] tree  The tree
+ * @param[in] elements  The elements
+ * @param[in] count  The number of elements
+ *
+ * @return  0 on success, -1 if the tree is not empty, the elements are not sorted, or memory could not be allocated
+ */
+intptr_t
+btree_bulk_load(J9BTree *tree, void **elements, uintptr_t count)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(tree->portLibrary);
+	J9BTreeNode **nodes = NULL;
+	uintptr_t *keys = NULL;
+	uintptr_t nodeCount = 0;
+	uintptr_t levelCount = count;
+	uintptr_t allocated = 0;
+	uintptr_t level = 0;
+	uintptr_t i = 0;
+	J9BTreeNode **levelNodes = NULL;
+	J9BTreeNode **children = NULL;
+
+	if (NULL != tree->rootNode) {
+		return -1;
+	}
+	if (0 == count) {
+		return 0;
+	}
+	keys = (uintptr_t *)omrmem_allocate_memory(count * sizeof(uintptr_t), tree->memoryCategory);
+	if (NULL == keys) {
+		return -1;
+	}
+	for (i = 0; i < count; i++) {
+		keys[i] = tree->keyFunction(tree, elements[i]);
+		if ((0 != i) && (keys[i] <= keys[i - 1])) {
+			omrmem_free_memory(keys);
+			return -1;
+		}
+	}
+
+	/* allocate every node first, so that failure leaves the tree unchanged */
+	do {
+		levelCount = (levelCount + J9BTREE_NODE_SLOTS - 1) / J9BTREE_NODE_SLOTS;
+		nodeCount += levelCount;
+		level += 1;
+	} while (levelCount > 1);
+	if (level > J9BTREE_MAX_HEIGHT) {
+		omrmem_free_memory(keys);
+		return -1;
+	}
+	nodes = (J9BTreeNode **)omrmem_allocate_memory(nodeCount * sizeof(J9BTreeNode *), tree->memoryCategory);
+	if (NULL != nodes) {
+		for (allocated = 0; allocated < nodeCount; allocated++) {
+			nodes[allocated] = (J9BTreeNode *)pool_newElement(tree->nodePool);
+			if (NULL == nodes[allocated]) {
+				break;
+			}
+		}
+	}
+	if ((NULL == nodes) || (allocated < nodeCount)) {
+		for (i = 0; i < allocated; i++) {
+			pool_removeElement(tree->nodePool, nodes[i]);
+		}
+		omrmem_free_memory(nodes);
+		omrmem_free_memory(keys);
+		return -1;
+	}
+
+	/* spread the entries of each level evenly over its nodes, filling them */
+	levelCount = count;
+	levelNodes = nodes;
+	for (level = 0;; level++) {
+		uintptr_t nodesInLevel = (levelCount + J9BTREE_NODE_SLOTS - 1) / J9BTREE_NODE_SLOTS;
+		uintptr_t entry = 0;
+
+		for (i = 0; i < nodesInLevel; i++) {
+			J9BTreeNode *node = levelNodes[i];
+			uintptr_t entries = (levelCount / nodesInLevel) + ((i < (levelCount % nodesInLevel)) ? 1 : 0);
+			uintptr_t j = 0;
+
+			node->level = (uint32_t)level;
+			node->retiredNext = NULL;
+			node->count = (uint32_t)entries;
+			for (j = 0; j < entries; j++, entry++) {
+				if (0 == level) {
+					node->keys[j] = keys[entry];
+					node->values[j] = elements[entry];
+				} else {
+					node->keys[j] = children[entry]->keys[0];
+					node->values[j] = children[entry];
+				}
+			}
+		}
+		if (1 == nodesInLevel) {
+			break;
+		}
+		children = levelNodes;
+		levelNodes += nodesInLevel;
+		levelCount = nodesInLevel;
+	}
+
+	issueWriteBarrier();
+	tree->rootNode = levelNodes[0];
+	tree->elementCount = count;
+	omrmem_free_memory(nodes);
+	omrmem_free_memory(keys);
+	return 0;
+}
+
+/**
+ * Search a tree for the element that matches searchValue: the element with the greatest key less
+ * than or equal to searchValue, if the tree's searchComparator returns 0 for it. This takes no locks.
+ *
+ * @param[in] tree  The tree
+ * @param[in] searchValue  The value to search for, for example an address
+ *
+ * @return  The found element or NULL
+ */
+void *
+btree_search(J9BTree *tree, uintptr_t searchValue)
+{
+	J9BTreeNode *node = tree->rootNode;
+	uintptr_t below = 0;
+
+	if (NULL == node) {
+		return NULL;
+	}
+	for (;;) {
+		below = keysAtOrBelow(node, searchValue);
+		if (0 == below) {
+			return NULL;
+		}
+		if (0 == node->level) {
+			break;
+		}
+		node = (J9BTreeNode *)node->values[below - 1];
+	}
+	if (NULL == tree->searchComparator) {
+		return (searchValue == node->keys[below - 1]) ? node->values[below - 1] : NULL;
+	}
+	return (0 == tree->searchComparator(tree, searchValue, node->values[below - 1])) ? node->values[below - 1] : NULL;
+}
+
+/**
+ * Find the element with the greatest key less than or equal to key. This takes no locks.
+ *
+ * @param[in] tree  The tree
+ * @param[in] key  The key
+ *
+ * @return  The element or NULL if every key in the tree is greater than key
+ */
+void *
+btree_floor(J9BTree *tree, uintptr_t key)
+{
+	J9BTreeNode *node = tree->rootNode;
+
+	if (NULL == node) {
+		return NULL;
+	}
+	for (;;) {
+		uintptr_t below = keysAtOrBelow(node, key);
+
+		/* the keys of interior nodes are the smallest keys of their children, so only the root can miss */
+		if (0 == below) {
+			return NULL;
+		}
+		if (0 == node->level) {
+			return node->values[below - 1];
+		}
+		node = (J9BTreeNode *)node->values[below - 1];
+	}
+}
+
+/**
+ * Find the element with the smallest key greater than or equal to key. This takes no locks.
+ *
+ * @param[in] tree  The tree
+ * @param[in] key  The key
+ *
+ * @return  The element or NULL if every key in the tree is less than key
+ */
+void *
+btree_ceiling(J9BTree *tree, uintptr_t key)
+{
+	J9BTreeNode *node = tree->rootNode;
+	J9BTreeNode *nextSubtree = NULL;
+	uintptr_t position = 0;
+
+	if (NULL == node) {
+		return NULL;
+	}
+	while (0 != node->level) {
+		uintptr_t below = keysAtOrBelow(node, key);
+
+		if (0 == below) {
+			return leftmostElement(node);
+		}
+		if (below < node->count) {
+			/* the ceiling is the first element of the next child if it is not in this one */
+			nextSubtree = (J9BTreeNode *)node->values[below];
+		}
+		node = (J9BTreeNode *)node->values[below - 1];
+	}
+	position = keysBelow(node, key);
+	if (position < node->count) {
+		return node->values[position];
+	}
+	return (NULL == nextSubtree) ? NULL : leftmostElement(nextSubtree);
+}
+
+/**
+ * Start a walk over the elements of a tree in ascending key order, from the first element whose key
+ * is greater than or equal to fromKey. The walk takes no locks and sees the tree as it was when it
+ * started, whatever updates are made during it; btree_reclaim must not be called until it is over.
+ *
+ * @param[in] tree  The tree
+ * @param[in] fromKey  The key to start from; 0 walks the whole tree
+ * @param[out] state  The walk state
+ *
+ * @return  The first element or NULL if there is none
+ */
+void *
+btree_start_do(J9BTree *tree, uintptr_t fromKey, J9BTreeWalkState *state)
+{
+	J9BTreeNode *root = tree->rootNode;
+	uintptr_t leafLevel = 0;
+
+	state->tree = tree;
+	state->depth = 0;
+	if (NULL == root) {
+		return NULL;
+	}
+	state->depth = findPath(root, fromKey, state->path, state->index);
+	leafLevel = state->depth - 1;
+	state->index[leafLevel] = keysBelow(state->path[leafLevel], fromKey);
+	if (state->index[leafLevel] < state->path[leafLevel]->count) {
+		return state->path[leafLevel]->values[state->index[leafLevel]];
+	}
+	/* every key in the leaf is less than fromKey */
+	state->index[leafLevel] -= 1;
+	return btree_next_do(state);
+}
+
+/**
+ * Continue a walk started by @ref btree_start_do.
+ *
+ * @param[in] state  The walk state
+ *
+ * @return  The next element or NULL if there is none
+ */
+void *
+btree_next_do(J9BTreeWalkState *state)
+{
+	uintptr_t level = 0;
+
+	if (0 == state->depth) {
+		return NULL;
+	}
+	level = state->depth - 1;
+	state->index[level] += 1;
+	while (state->index[level] >= state->path[level]->count) {
+		if (0 == level) {
+			state->depth = 0;
+			return NULL;
+		}
+		level -= 1;
+		state->index[level] += 1;
+	}
+	return walkToElement(state, level);
+}
+
+/**
+ * @param[in] tree  The tree
+ *
+ * @return  The number of elements in the tree
+ */
+uintptr_t
+btree_get_count(J9BTree *tree)
+{
+	return tree->elementCount;
+}
+
+/**
+ * Free the nodes that updates have replaced. The caller must ensure that no other thread is
+ * searching or walking the tree.
+ *
+ * @param[in] tree  The tree
+ *
+ * @return  The number of nodes freed
+ */
+uintptr_t
+btree_reclaim(J9BTree *tree)
+{
+	uintptr_t freed = tree->retiredCount;
+	J9BTreeNode *node = tree->retiredNodes;
+
+	while (NULL != node) {
+		J9BTreeNode *next = node->retiredNext;
+
+		pool_removeElement(tree->nodePool, node);
+		node = next;
+	}
+	tree->retiredNodes = NULL;
+	tree->retiredCount = 0;
+	return freed;
+}
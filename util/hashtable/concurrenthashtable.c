@@ -0,0 +1,691 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * file    : concurrenthashtable.c
+ *
+ *  Concurrent hash table implementation
+ *
+ *  Entries live in a single lock-free linked list ordered by the bit-reversed hash of each entry
+ *  (a split-ordered list). Each bucket is a pointer to a sentinel node within that list, so doubling
+ *  the number of buckets never moves an entry: a new bucket is initialized the first time it is used,
+ *  by inserting its sentinel after the sentinel of its parent bucket. Lookups take no locks; adds and
+ *  removes use compare-and-swap on a single link.
+ *
+ *  Removal marks a node's link and then unlinks it. Unlinked nodes may still be in use by concurrent
+ *  readers, so they are retired rather than freed, and are only freed by concurrentHashTableReclaim
+ *  or concurrentHashTableFree, which the caller must invoke when no other thread is using the table.
+ */
+
+#include <string.h>
+#include "omrcfg.h"
+#include "hashtable_internal.h"
+#include "ut_hashtable.h"
+#include "omrutilbase.h"
+
+typedef struct J9ConcurrentHashTableNode {
+	volatile uintptr_t next; /* the next node, with DELETED_BIT set once this node is removed */
+	uintptr_t key; /* bit-reversed hash, low bit set for entries and clear for sentinels */
+	struct J9ConcurrentHashTableNode *retiredNext;
+} J9ConcurrentHashTableNode;
+
+#define DELETED_BIT ((uintptr_t)1)
+#define IS_DELETED(link) (0 != ((link) & DELETED_BIT))
+#define NODE_FROM_LINK(link) ((J9ConcurrentHashTableNode *)((link) & ~DELETED_BIT))
+
+#define NODE_HEADER_SIZE ROUND_TO_SIZEOF_U64(sizeof(J9ConcurrentHashTableNode))
+#define ROUND_TO_SIZEOF_U64(number) (((number) + (sizeof(uint64_t) - 1)) & (~(sizeof(uint64_t) - 1)))
+#define NODE_TO_ENTRY(node) ((void *)((uint8_t *)(node) + NODE_HEADER_SIZE))
+#define ENTRY_TO_NODE(entry) ((J9ConcurrentHashTableNode *)((uint8_t *)(entry) - NODE_HEADER_SIZE))
+#define IS_SENTINEL(node) (0 == ((node)->key & 1))
+
+#define CONCURRENT_HASH_TABLE_SIZE_MIN 16
+/* Grow when the average bucket holds more than this many entries */
+#define CONCURRENT_HASH_TABLE_LOAD_FACTOR 2
+
+#if defined(OMR_ENV_DATA64)
+#define CONCURRENT_HASH_TABLE_BUCKETS_MAX ((uintptr_t)1 << 40)
+#else
+#define CONCURRENT_HASH_TABLE_BUCKETS_MAX ((uintptr_t)1 << 28)
+#endif
+
+static uintptr_t reverseBits(uintptr_t value);
+static uintptr_t mixHash(uintptr_t hash);
+static uintptr_t maxBucketCount(J9ConcurrentHashTable *table);
+static uintptr_t bucketSegment(J9ConcurrentHashTable *table, uintptr_t bucket, uintptr_t *index);
+static J9ConcurrentHashTableNode **bucketSlot(J9ConcurrentHashTable *table, uintptr_t bucket, BOOLEAN allocate);
+static J9ConcurrentHashTableNode *getBucket(J9ConcurrentHashTable *table, uintptr_t bucket);
+static BOOLEAN listFind(J9ConcurrentHashTable *table, J9ConcurrentHashTableNode *head, uintptr_t key, void *entry, volatile uintptr_t **prevOut, J9ConcurrentHashTableNode **currentOut);
+static J9ConcurrentHashTableNode *listInsert(J9ConcurrentHashTable *table, J9ConcurrentHashTableNode *head, J9ConcurrentHashTableNode *node, void *entry);
+static BOOLEAN listRemove(J9ConcurrentHashTable *table, J9ConcurrentHashTableNode *head, uintptr_t key, void *entry, J9ConcurrentHashTableNode *target);
+static void retireNode(J9ConcurrentHashTable *table, J9ConcurrentHashTableNode *node);
+static J9ConcurrentHashTableNode *nextEntryNode(J9ConcurrentHashTableNode *node);
+
+static uintptr_t
+reverseBits(uintptr_t value)
+{
+#if defined(OMR_ENV_DATA64)
+	value = ((value >> 1) & J9CONST64(0x5555555555555555)) | ((value & J9CONST64(0x5555555555555555)) << 1);
+	value = ((value >> 2) & J9CONST64(0x3333333333333333)) | ((value & J9CONST64(0x3333333333333333)) << 2);
+	value = ((value >> 4) & J9CONST64(0x0F0F0F0F0F0F0F0F)) | ((value & J9CONST64(0x0F0F0F0F0F0F0F0F)) << 4);
+	value = ((value >> 8) & J9CONST64(0x00FF00FF00FF00FF)) | ((value & J9CONST64(0x00FF00FF00FF00FF)) << 8);
+	value = ((value >> 16) & J9CONST64(0x0000FFFF0000FFFF)) | ((value & J9CONST64(0x0000FFFF0000FFFF)) << 16);
+	value = (value >> 32) | (value << 32);
+#else
+	value = ((value >> 1) & 0x55555555) | ((value & 0x55555555) << 1);
+	value = ((value >> 2) & 0x33333333) | ((value & 0x33333333) << 2);
+	value = ((value >> 4) & 0x0F0F0F0F) | ((value & 0x0F0F0F0F) << 4);
+	value = ((value >> 8) & 0x00FF00FF) | ((value & 0x00FF00FF) << 8);
+	value = (value >> 16) | (value << 16);
+#endif
+	return value;
+}
+
+/* Hash functions written for J9HashTable are reduced modulo a prime; this table uses the low bits directly */
+static uintptr_t
+mixHash(uintptr_t hash)
+{
+#if defined(OMR_ENV_DATA64)
+	hash ^= hash >> 33;
+	hash *= (uintptr_t)J9CONST64(0xff51afd7ed558ccd);
+	hash ^= hash >> 33;
+	hash *= (uintptr_t)J9CONST64(0xc4ceb9fe1a85ec53);
+	hash ^= hash >> 33;
+#else
+	hash ^= hash >> 16;
+	hash *= 0x85ebca6b;
+	hash ^= hash >> 13;
+	hash *= 0xc2b2ae35;
+	hash ^= hash >> 16;
+#endif
+	return hash;
+}
+
+/* The table can only grow until its last segment is in use: segment n holds buckets up to initial << n */
+static uintptr_t
+maxBucketCount(J9ConcurrentHashTable *table)
+{
+	uintptr_t lastSegment = J9CONCURRENT_HASH_TABLE_SEGMENT_COUNT - 1;
+
+	if (table->initialBucketCount <= (CONCURRENT_HASH_TABLE_BUCKETS_MAX >> lastSegment)) {
+		return table->initialBucketCount << lastSegment;
+	}
+	return CONCURRENT_HASH_TABLE_BUCKETS_MAX;
+}
+
+static uintptr_t
+bucketSegment(J9ConcurrentHashTable *table, uintptr_t bucket, uintptr_t *index)
+{
+	uintptr_t segment = 0;
+	uintptr_t segmentStart = table->initialBucketCount;
+
+	if (bucket < segmentStart) {
+		*index = bucket;
+		return 0;
+	}
+	/* segment n >= 1 holds buckets [initial << (n - 1), initial << n) */
+	segment = 1;
+	while (bucket >= (segmentStart << 1)) {
+		segmentStart <<= 1;
+		segment += 1;
+	}
+	Assert_hashTable_true(segment < J9CONCURRENT_HASH_TABLE_SEGMENT_COUNT);
+	*index = bucket - segmentStart;
+	return segment;
+}
+
+static J9ConcurrentHashTableNode **
+bucketSlot(J9ConcurrentHashTable *table, uintptr_t bucket, BOOLEAN allocate)
+{
+	uintptr_t index = 0;
+	uintptr_t segment = bucketSegment(table, bucket, &index);
+	J9ConcurrentHashTableNode **buckets = (J9ConcurrentHashTableNode **)table->segments[segment];
+
+	if ((NULL == buckets) && allocate) {
+		OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+		uintptr_t segmentSize = (0 == segment) ? table->initialBucketCount : (table->initialBucketCount << (segment - 1));
+		J9ConcurrentHashTableNode **newBuckets = omrmem_allocate_memory(segmentSize * sizeof(J9ConcurrentHashTableNode *), table->memoryCategory);
+
+		if (NULL != newBuckets) {
+			memset(newBuckets, 0, segmentSize * sizeof(J9ConcurrentHashTableNode *));
+			issueWriteBarrier();
+			buckets = (J9ConcurrentHashTableNode **)compareAndSwapUDATA((uintptr_t *)&table->segments[segment], 0, (uintptr_t)newBuckets);
+			if (NULL == buckets) {
+				buckets = newBuckets;
+			} else {
+				/* another thread installed the segment first */
+				omrmem_free_memory(newBuckets);
+			}
+		}
+	}
+	return (NULL == buckets) ? NULL : &buckets[index];
+}
+
+/**
+ * Return the sentinel for a bucket, initializing it (and, recursively, its parent) on first use.
+ * Returns NULL only if memory for the bucket could not be allocated.
+ */
+static J9ConcurrentHashTableNode *
+getBucket(J9ConcurrentHashTable *table, uintptr_t bucket)
+{
+	J9ConcurrentHashTableNode **slot = bucketSlot(table, bucket, TRUE);
+	J9ConcurrentHashTableNode *sentinel = NULL;
+
+	if (NULL == slot) {
+		return NULL;
+	}
+	sentinel = *slot;
+	if (NULL == sentinel) {
+		OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+		/* the parent bucket is this one with its highest set bit cleared */
+		uintptr_t parentBucket = bucket;
+		uintptr_t bit = table->bucketCount;
+		J9ConcurrentHashTableNode *parent = NULL;
+		J9ConcurrentHashTableNode *newSentinel = NULL;
+
+		while (0 == (parentBucket & bit)) {
+			bit >>= 1;
+		}
+		parentBucket &= ~bit;
+		parent = getBucket(table, parentBucket);
+		if (NULL == parent) {
+			return NULL;
+		}
+
+		newSentinel = omrmem_allocate_memory(sizeof(J9ConcurrentHashTableNode), table->memoryCategory);
+		if (NULL == newSentinel) {
+			return NULL;
+		}
+		newSentinel->next = 0;
+		newSentinel->key = reverseBits(bucket);
+		newSentinel->retiredNext = NULL;
+		sentinel = listInsert(table, parent, newSentinel, NULL);
+		if (sentinel != newSentinel) {
+			/* another thread inserted this bucket's sentinel first */
+			omrmem_free_memory(newSentinel);
+		}
+		*slot = sentinel;
+	}
+	return sentinel;
+}
+
+/**
+ * Search the list from head for the node with key that matches entry (or the sentinel with key if entry is NULL),
+ * unlinking and retiring deleted nodes on the way. On return *prevOut is the link that points to *currentOut,
+ * the first node not ordered before the one searched for.
+ */
+static BOOLEAN
+listFind(J9ConcurrentHashTable *table, J9ConcurrentHashTableNode *head, uintptr_t key, void *entry, volatile uintptr_t **prevOut, J9ConcurrentHashTableNode **currentOut)
+{
+retry:
+	{
+		volatile uintptr_t *prev = &head->next;
+		J9ConcurrentHashTableNode *current = NODE_FROM_LINK(*prev);
+
+		while (NULL != current) {
+			uintptr_t next = current->next;
+
+			if (IS_DELETED(next)) {
+				/* help unlink the removed node; start over if prev changed underneath us */
+				if ((uintptr_t)current != compareAndSwapUDATA((uintptr_t *)prev, (uintptr_t)current, (uintptr_t)NODE_FROM_LINK(next))) {
+					goto retry;
+				}
+				retireNode(table, current);
+				current = NODE_FROM_LINK(next);
+				continue;
+			}
+			if (current->key > key) {
+				break;
+			}
+			if (current->key == key) {
+				if (NULL == entry) {
+					*prevOut = prev;
+					*currentOut = current;
+					return TRUE;
+				}
+				if (0 != table->hashEqualFn(NODE_TO_ENTRY(current), entry, table->equalFnUserData)) {
+					*prevOut = prev;
+					*currentOut = current;
+					return TRUE;
+				}
+			}
+			prev = &current->next;
+			current = NODE_FROM_LINK(next);
+		}
+		*prevOut = prev;
+		*currentOut = current;
+		return FALSE;
+	}
+}
+
+/**
+ * Insert node after head unless a matching node is already present.
+ * Returns node if it was inserted, otherwise the node already in the list.
+ */
+static J9ConcurrentHashTableNode *
+listInsert(J9ConcurrentHashTable *table, J9ConcurrentHashTableNode *head, J9ConcurrentHashTableNode *node, void *entry)
+{
+	for (;;) {
+		volatile uintptr_t *prev = NULL;
+		J9ConcurrentHashTableNode *current = NULL;
+
+		if (listFind(table, head, node->key, entry, &prev, &current)) {
+			return current;
+		}
+		node->next = (uintptr_t)current;
+		issueWriteBarrier();
+		if ((uintptr_t)current == compareAndSwapUDATA((uintptr_t *)prev, (uintptr_t)current, (uintptr_t)node)) {
+			return node;
+		}
+	}
+}
+
+/**
+ * Remove the node matching entry, or target itself if target is not NULL.
+ * Returns TRUE if this call removed the node.
+ */
+static BOOLEAN
+listRemove(J9ConcurrentHashTable *table, J9ConcurrentHashTableNode *head, uintptr_t key, void *entry, J9ConcurrentHashTableNode *target)
+{
+	for (;;) {
+		volatile uintptr_t *prev = NULL;
+		J9ConcurrentHashTableNode *current = target;
+		uintptr_t next = 0;
+
+		if (NULL == target) {
+			if (!listFind(table, head, key, entry, &prev, &current)) {
+				return FALSE;
+			}
+		}
+		next = current->next;
+		if (IS_DELETED(next)) {
+			/* someone else removed it */
+			return FALSE;
+		}
+		if (next == compareAndSwapUDATA((uintptr_t *)&current->next, next, next | DELETED_BIT)) {
+			/* logically removed; unlink it now if prev is still intact, otherwise leave it for the next search */
+			if ((NULL != prev) && ((uintptr_t)current == compareAndSwapUDATA((uintptr_t *)prev, (uintptr_t)current, next))) {
+				retireNode(table, current);
+			} else {
+				listFind(table, head, key, NODE_TO_ENTRY(current), &prev, &current);
+			}
+			return TRUE;
+		}
+	}
+}
+
+static void
+retireNode(J9ConcurrentHashTable *table, J9ConcurrentHashTableNode *node)
+{
+	uintptr_t oldHead = 0;
+
+	do {
+		oldHead = table->retiredNodes;
+		node->retiredNext = (J9ConcurrentHashTableNode *)oldHead;
+	} while (oldHead != compareAndSwapUDATA((uintptr_t *)&table->retiredNodes, oldHead, (uintptr_t)node));
+}
+
+/* Next node after node that holds an entry and has not been removed, or NULL */
+static J9ConcurrentHashTableNode *
+nextEntryNode(J9ConcurrentHashTableNode *node)
+{
+	J9ConcurrentHashTableNode *current = NODE_FROM_LINK(node->next);
+
+	while ((NULL != current) && (IS_SENTINEL(current) || IS_DELETED(current->next))) {
+		current = NODE_FROM_LINK(current->next);
+	}
+	return current;
+}
+
+/**
+ * \brief       Create a new concurrent hash table.
+ * \ingroup     hash_table
+ *
+ *
+ * @param portLibrary        The port library
+ * @param tableName          A string giving the name of the table
+ * @param tableSize          Initial number of buckets (if zero, use a suitable default); rounded up to a power of two
+ * @param entrySize          Size of the user-data for each entry; entries are 8-byte aligned
+ * @param memoryCategory     Memory category for memory allocated by the table
+ * @param hashFn             Mandatory hashing function ptr
+ * @param hashEqualFn        Mandatory equality function ptr
+ * @param printFn            Optional entry-print function ptr
+ * @param functionUserData   Optional userData ptr to be passed to hashFn and hashEqualFn
+ * @return                   An initialized table, or NULL on failure
+ *
+ *	The hash and equality functions have the same signatures as those of J9HashTable
+ *	and must be safe to call from several threads at once.
+ */
+J9ConcurrentHashTable *
+concurrentHashTableNew(
+	OMRPortLibrary *portLibrary,
+	const char *tableName,
+	uint32_t tableSize,
+	uint32_t entrySize,
+	uint32_t memoryCategory,
+	J9HashTableHashFn hashFn,
+	J9HashTableEqualFn hashEqualFn,
+	J9HashTablePrintFn printFn,
+	void *functionUserData)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	J9ConcurrentHashTable *table = omrmem_allocate_memory(sizeof(J9ConcurrentHashTable), memoryCategory);
+	J9ConcurrentHashTableNode *head = NULL;
+	uintptr_t initialBucketCount = CONCURRENT_HASH_TABLE_SIZE_MIN;
+
+	if (NULL == table) {
+		return NULL;
+	}
+	memset(table, 0, sizeof(J9ConcurrentHashTable));
+	while (initialBucketCount < tableSize) {
+		initialBucketCount <<= 1;
+	}
+	table->tableName = tableName;
+	table->entrySize = entrySize;
+	table->nodeSize = (uint32_t)(NODE_HEADER_SIZE + ROUND_TO_SIZEOF_U64(entrySize));
+	table->memoryCategory = memoryCategory;
+	table->initialBucketCount = initialBucketCount;
+	table->bucketCount = initialBucketCount;
+	table->hashFn = hashFn;
+	table->hashEqualFn = hashEqualFn;
+	table->printFn = printFn;
+	table->portLibrary = portLibrary;
+	table->equalFnUserData = functionUserData;
+	table->hashFnUserData = functionUserData;
+
+	/* bucket 0's sentinel heads the list */
+	head = omrmem_allocate_memory(sizeof(J9ConcurrentHashTableNode), memoryCategory);
+	if ((NULL == head) || (NULL == bucketSlot(table, 0, TRUE))) {
+		omrmem_free_memory(head);
+		omrmem_free_memory(table->segments[0]);
+		omrmem_free_memory(table);
+		return NULL;
+	}
+	head->next = 0;
+	head->key = 0;
+	head->retiredNext = NULL;
+	*bucketSlot(table, 0, FALSE) = head;
+
+	return table;
+}
+
+/**
+ * \brief       Free a concurrent hash table and all of its entries.
+ * \ingroup     hash_table
+ *
+ *
+ * @param table
+ *
+ *	No other thread may be using the table.
+ */
+void
+concurrentHashTableFree(J9ConcurrentHashTable *table)
+{
+	if (NULL != table) {
+		OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+		J9ConcurrentHashTableNode *node = *bucketSlot(table, 0, FALSE);
+		uintptr_t i = 0;
+
+		concurrentHashTableReclaim(table);
+		while (NULL != node) {
+			J9ConcurrentHashTableNode *next = NODE_FROM_LINK(node->next);
+			omrmem_free_memory(node);
+			node = next;
+		}
+		for (i = 0; i < J9CONCURRENT_HASH_TABLE_SEGMENT_COUNT; i++) {
+			omrmem_free_memory(table->segments[i]);
+		}
+		omrmem_free_memory(table);
+	}
+}
+
+/**
+ * \brief       Find an entry in the concurrent hash table.
+ * \ingroup     hash_table
+ *
+ *
+ * @param table
+ * @param entry
+ * @return                  NULL if entry is not present in the table; otherwise a pointer to the user-data
+ *
+ *	Takes no locks and may run concurrently with adds and removes. The returned pointer remains
+ *	valid after the entry is removed until the table is reclaimed or freed.
+ */
+void *
+concurrentHashTableFind(J9ConcurrentHashTable *table, void *entry)
+{
+	uintptr_t hash = mixHash(table->hashFn(entry, table->hashFnUserData));
+	uintptr_t key = reverseBits(hash) | 1;
+	J9ConcurrentHashTableNode *current = getBucket(table, hash & (table->bucketCount - 1));
+
+	/* A read-only walk: removed nodes are skipped rather than unlinked */
+	while (NULL != current) {
+		if (current->key > key) {
+			break;
+		}
+		if ((current->key == key)
+			&& !IS_DELETED(current->next)
+			&& (0 != table->hashEqualFn(NODE_TO_ENTRY(current), entry, table->equalFnUserData))
+		) {
+			return NODE_TO_ENTRY(current);
+		}
+		current = NODE_FROM_LINK(current->next);
+	}
+	return NULL;
+}
+
+/**
+ * \brief       Add an entry to the concurrent hash table.
+ * \ingroup     hash_table
+ *
+ *
+ * @param table
+ * @param entry
+ * @return                  NULL on failure (to allocate a new node); otherwise the entry pointer
+ *
+ *	If a matching entry is already present, returns a pointer to it. Otherwise copies entry into
+ *	the table and returns a pointer to the copy. When several threads add matching entries at
+ *	once, exactly one copy is added and every caller gets a pointer to it.
+ */
+void *
+concurrentHashTableAdd(J9ConcurrentHashTable *table, void *entry)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+	uintptr_t hash = mixHash(table->hashFn(entry, table->hashFnUserData));
+	uintptr_t bucketCount = table->bucketCount;
+	J9ConcurrentHashTableNode *head = getBucket(table, hash & (bucketCount - 1));
+	J9ConcurrentHashTableNode *node = NULL;
+	J9ConcurrentHashTableNode *result = NULL;
+	void *existing = NULL;
+
+	if (NULL == head) {
+		return NULL;
+	}
+	/* avoid allocating in the common case that the entry is already present */
+	existing = concurrentHashTableFind(table, entry);
+	if (NULL != existing) {
+		return existing;
+	}
+
+	node = omrmem_allocate_memory(table->nodeSize, table->memoryCategory);
+	if (NULL == node) {
+		return NULL;
+	}
+	node->key = reverseBits(hash) | 1;
+	node->retiredNext = NULL;
+	memcpy(NODE_TO_ENTRY(node), entry, table->entrySize);
+
+	result = listInsert(table, head, node, entry);
+	if (result != node) {
+		omrmem_free_memory(node);
+	} else {
+		uintptr_t count = addAtomic(&table->numberOfNodes, 1);
+
+		/* Double the bucket count; the new buckets are initialized lazily as they are used */
+		if ((count > (bucketCount * CONCURRENT_HASH_TABLE_LOAD_FACTOR)) && (bucketCount < maxBucketCount(table))) {
+			compareAndSwapUDATA((uintptr_t *)&table->bucketCount, bucketCount, bucketCount << 1);
+		}
+	}
+	return NODE_TO_ENTRY(result);
+}
+
+/**
+ * \brief       Remove an entry matching given key from the concurrent hash table
+ * \ingroup     hash_table
+ *
+ *
+ * @param table         concurrent hash table
+ * @param entry         entry to match
+ * @return                  0 on success, 1 on failure
+ *
+ *	The removed entry's memory is retired, not freed; see concurrentHashTableReclaim.
+ */
+uint32_t
+concurrentHashTableRemove(J9ConcurrentHashTable *table, void *entry)
+{
+	uintptr_t hash = mixHash(table->hashFn(entry, table->hashFnUserData));
+	J9ConcurrentHashTableNode *head = getBucket(table, hash & (table->bucketCount - 1));
+
+	if ((NULL != head) && listRemove(table, head, reverseBits(hash) | 1, entry, NULL)) {
+		subtractAtomic(&table->numberOfNodes, 1);
+		return 0;
+	}
+	return 1;
+}
+
+/**
+ * \brief       Return the number of entries in the concurrent hash table
+ * \ingroup     hash_table
+ *
+ *
+ * @param table
+ * @return                  the number of entries; a snapshot if other threads are modifying the table
+ */
+uintptr_t
+concurrentHashTableGetCount(J9ConcurrentHashTable *table)
+{
+	return table->numberOfNodes;
+}
+
+/**
+ * \brief       Free the memory of removed entries.
+ * \ingroup     hash_table
+ *
+ *
+ * @param table
+ * @return                  the number of nodes freed
+ *
+ *	Must only be called when no other thread is using the table, and invalidates pointers
+ *	previously returned for removed entries.
+ */
+uintptr_t
+concurrentHashTableReclaim(J9ConcurrentHashTable *table)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+	J9ConcurrentHashTableNode *node = (J9ConcurrentHashTableNode *)table->retiredNodes;
+	uintptr_t count = 0;
+
+	table->retiredNodes = 0;
+	while (NULL != node) {
+		J9ConcurrentHashTableNode *next = node->retiredNext;
+		omrmem_free_memory(node);
+		node = next;
+		count += 1;
+	}
+	return count;
+}
+
+/**
+ * \brief       Begin an iteration over all entries of a concurrent hash-table.
+ * \ingroup     hash_table
+ *
+ *
+ * @param table
+ * @param handle used by concurrentHashTableNextDo to keep track of state
+ * @return            NULL if no more entries; otherwise the address of the entry
+ *
+ *	Follows the contract of hashTableStartDo. The iteration is weakly consistent: it returns every
+ *	entry present for its whole duration exactly once, and may or may not return entries added or
+ *	removed while it runs.
+ */
+void *
+concurrentHashTableStartDo(J9ConcurrentHashTable *table, J9ConcurrentHashTableState *handle)
+{
+	memset(handle, 0, sizeof(J9ConcurrentHashTableState));
+	handle->table = table;
+	handle->currentNode = nextEntryNode(*bucketSlot(table, 0, FALSE));
+	handle->didDeleteCurrentNode = FALSE;
+
+	return (NULL == handle->currentNode) ? NULL : NODE_TO_ENTRY(handle->currentNode);
+}
+
+/**
+ * \brief       Continue an iteration over all entries of a concurrent hash-table.
+ * \ingroup     hash_table
+ *
+ *
+ * @param handle previously filled in by concurrentHashTableStartDo
+ * @return                  NULL if no more entries; otherwise a pointer to an entry
+ */
+void *
+concurrentHashTableNextDo(J9ConcurrentHashTableState *handle)
+{
+	J9ConcurrentHashTableNode *current = (J9ConcurrentHashTableNode *)handle->currentNode;
+
+	if (NULL == current) {
+		return NULL;
+	}
+	/* A removed node keeps its link, so the walk can continue from it */
+	current = nextEntryNode(current);
+	handle->currentNode = current;
+	handle->didDeleteCurrentNode = FALSE;
+
+	return (NULL == current) ? NULL : NODE_TO_ENTRY(current);
+}
+
+/**
+ * \brief       Remove the current entry in the concurrent hash-table iteration
+ * \ingroup     hash_table
+ *
+ *
+ * @param handle previously filled in by concurrentHashTableStartDo
+ * @return                  0 on success, 1 on failure
+ */
+uintptr_t
+concurrentHashTableDoRemove(J9ConcurrentHashTableState *handle)
+{
+	J9ConcurrentHashTable *table = handle->table;
+	J9ConcurrentHashTableNode *current = (J9ConcurrentHashTableNode *)handle->currentNode;
+	uintptr_t rc = 1;
+
+	if ((NULL != current) && !handle->didDeleteCurrentNode) {
+		uintptr_t hash = mixHash(table->hashFn(NODE_TO_ENTRY(current), table->hashFnUserData));
+		J9ConcurrentHashTableNode *head = getBucket(table, hash & (table->bucketCount - 1));
+
+		if ((NULL != head) && listRemove(table, head, current->key, NODE_TO_ENTRY(current), current)) {
+			subtractAtomic(&table->numberOfNodes, 1);
+			handle->didDeleteCurrentNode = TRUE;
+			rc = 0;
+		}
+	}
+	return rc;
+}
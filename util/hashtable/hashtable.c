@@ -235,6 +235,13 @@ collisionResilientHashTableNew(
  *  	hashTableRehash()
  *  	hashTableDoRemove()
  *
+ *  When J9HASH_TABLE_OPEN_ADDRESSING is set, entries are stored in an open-addressed
+ *  array instead of chained nodes, and tableSize is the number of entries the table
+ *  should hold before it first grows. Entries of up to four pointers in size are stored
+ *  inline, so pointers to them are invalidated when the table grows or is rehashed;
+ *  larger entries are pool-allocated and keep their addresses. All functions are
+ *  supported, and removal (including hashTableDoRemove) never moves other entries.
+ *
  */
 J9HashTable *
 hashTableNew(
@@ -311,6 +318,20 @@ hashTableNewImpl(
 	}
 	hashTable->nodeAlignment = entryAlignment;
 
+	if (J9HASH_TABLE_OPEN_ADDRESSING == (flags & J9HASH_TABLE_OPEN_ADDRESSING)) {
+		if (J9HASH_TABLE_COLLISION_RESILIENT == (flags & J9HASH_TABLE_COLLISION_RESILIENT)) {
+			/* collision resilient tables keep their chains; open addressing does not apply */
+			hashTable->flags &= ~(uint32_t)J9HASH_TABLE_OPEN_ADDRESSING;
+		} else {
+			hashTable->equalFnUserData = functionUserData;
+			hashTable->hashEqualFn = hashEqualFn;
+			if (0 != openAddressingHashTableInit(hashTable, tableSize)) {
+				goto error;
+			}
+			return hashTable;
+		}
+	}
+
 	if (J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION == ((flags & J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION))
 		&& (hashTable->listNodeSize == (2 * sizeof(uintptr_t)))
 		&& (hashTable->tableSize <= SPACE_OPT_LIMIT)
@@ -412,6 +433,9 @@ hashTableFree(J9HashTable *hashTable)
 		if (NULL != hashTable->nodes) {
 			omrmem_free_memory(hashTable->nodes);
 		}
+		if (NULL != hashTable->controlBytes) {
+			omrmem_free_memory(hashTable->controlBytes);
+		}
 		if (NULL != hashTable->avlTreeTemplate) {
 			omrmem_free_memory(hashTable->avlTreeTemplate);
 		}
@@ -441,13 +465,19 @@ hashTableFree(J9HashTable *hashTable)
 void *
 hashTableFind(J9HashTable *table, void *entry)
 {
-	uintptr_t hash = table->hashFn(entry, table->hashFnUserData) % table->tableSize;
-	void **head = &table->nodes[hash];
+	uintptr_t hash = 0;
+	void **head = NULL;
 	void *findNode = NULL;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
 	hashTable_printf("hashTableFind <%s>: table=%p entry=%p\n", table->tableName, table, entry);
 
+	if (hashTableIsOpenAddressing(table)) {
+		return openAddressingHashTableFind(table, entry);
+	}
+	hash = table->hashFn(entry, table->hashFnUserData) % table->tableSize;
+	head = &table->nodes[hash];
+
 	if (NULL == table->listNodePool) {
 		void **node = hashTableFindNodeSpaceOpt(table, entry, head);
 		findNode = (NULL != *node) ? node : NULL;
@@ -516,14 +546,20 @@ hashTableFindNodeInTree(J9HashTable *table, void *entry, void **head)
 void *
 hashTableAdd(J9HashTable *table, void *entry)
 {
-	uintptr_t hashCode = table->hashFn(entry, table->hashFnUserData);
-	void **head = &table->nodes[hashCode % table->tableSize];
+	uintptr_t hashCode = 0;
+	void **head = NULL;
 	void *addNode = NULL;
 	BOOLEAN growFailure = FALSE;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
 	hashTable_printf("hashTableAdd <%s>: table=%p entry=%p\n", table->tableName, table, entry);
 
+	if (hashTableIsOpenAddressing(table)) {
+		return openAddressingHashTableAdd(table, entry);
+	}
+	hashCode = table->hashFn(entry, table->hashFnUserData);
+	head = &table->nodes[hashCode % table->tableSize];
+
 	if ((table->numberOfNodes + 1) == table->tableSize) {
 		if (!hashTableCanGrow(table)) {
 			goto done;
@@ -702,13 +738,19 @@ listToTree(J9HashTable *table, void **head, uintptr_t listLength)
 uint32_t
 hashTableRemove(J9HashTable *table, void *entry)
 {
-	uintptr_t hash = table->hashFn(entry, table->hashFnUserData) % table->tableSize;
-	void **head = &table->nodes[hash];
+	uintptr_t hash = 0;
+	void **head = NULL;
 	uint32_t rc = 1;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
 	hashTable_printf("hashTableRemove <%s>: table=%p, entry=%p\n", table->tableName, table, entry);
 
+	if (hashTableIsOpenAddressing(table)) {
+		return openAddressingHashTableRemove(table, entry);
+	}
+	hash = table->hashFn(entry, table->hashFnUserData) % table->tableSize;
+	head = &table->nodes[hash];
+
 	if (NULL == table->listNodePool) {
 		rc = hashTableRemoveNodeSpaceOpt(table, entry, head);
 	} else if (NULL == *head) {
@@ -821,7 +863,7 @@ hashTableForEachDo(J9HashTable *table, J9HashTableDoFn doFn, void *opaque)
 
 	hashTable_printf("hashTableForEachDo <%s>: table=%p\n", table->tableName, table);
 
-	if (NULL == table->listNodePool) {
+	if (hashTableIsSpaceOptimized(table)) {
 		/* space optimized hashTable, operation not supported */
 		Assert_hashTable_unreachable();
 	}
@@ -854,6 +896,11 @@ hashTableRehash(J9HashTable *table)
 	void  *tail = NULL;
 	uintptr_t tableSize = table->tableSize;
 
+	if (hashTableIsOpenAddressing(table)) {
+		openAddressingHashTableRehash(table);
+		return;
+	}
+
 	if (NULL == table->listNodePool) {
 		/* space optimized hashTable, operation not supported */
 		Assert_hashTable_unreachable();
@@ -1012,7 +1059,9 @@ hashTableStartDo(J9HashTable *table,  J9HashTableState *handle)
 	handle->didDeleteCurrentNode = FALSE;
 	handle->iterateState = J9HASH_TABLE_ITERATE_STATE_LIST_NODES;
 
-	if (NULL == table->listNodePool) {
+	if (hashTableIsOpenAddressing(table)) {
+		result = openAddressingHashTableStartDo(table, handle);
+	} else if (NULL == table->listNodePool) {
 		/* find the first non-empty bucket */
 		while (handle->bucketIndex < table->tableSize) {
 			void **node = &table->nodes[handle->bucketIndex];
@@ -1071,7 +1120,9 @@ hashTableNextDo(J9HashTableState *handle)
 	void *result = NULL;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
-	if (NULL == table->listNodePool) {
+	if (hashTableIsOpenAddressing(table)) {
+		result = openAddressingHashTableNextDo(handle);
+	} else if (NULL == table->listNodePool) {
 		/* space optimized hashTable - advance to the next bucket */
 		handle->bucketIndex += 1;
 		while (handle->bucketIndex < table->tableSize) {
@@ -1158,8 +1209,10 @@ hashTableDoRemove(J9HashTableState *handle)
 	uintptr_t rc = 1;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
-	/* operation not supported on a space optimized hashTable */
-	if (NULL == table->listNodePool) {
+	if (hashTableIsOpenAddressing(table)) {
+		rc = openAddressingHashTableDoRemove(handle);
+	} else if (NULL == table->listNodePool) {
+		/* operation not supported on a space optimized hashTable */
 		Assert_hashTable_unreachable();
 	} else {
 		void *currentNode = NULL;
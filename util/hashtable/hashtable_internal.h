@@ -39,6 +39,75 @@
 extern "C" {
 #endif
 
+/* ---------------- openaddressinghashtable.c ---------------- */
+
+/**
+* @brief Allocate the slot and control byte arrays of an open-addressing table
+* @param *table
+* @param tableSize
+* @return uintptr_t 0 on success, 1 on failure
+*/
+uintptr_t
+openAddressingHashTableInit(J9HashTable *table, uint32_t tableSize);
+
+/**
+* @brief
+* @param *table
+* @param *entry
+* @return void *
+*/
+void *
+openAddressingHashTableAdd(J9HashTable *table, void *entry);
+
+/**
+* @brief
+* @param *table
+* @param *entry
+* @return void *
+*/
+void *
+openAddressingHashTableFind(J9HashTable *table, void *entry);
+
+/**
+* @brief
+* @param *table
+* @param *entry
+* @return uint32_t
+*/
+uint32_t
+openAddressingHashTableRemove(J9HashTable *table, void *entry);
+
+/**
+* @brief
+* @param *table
+*/
+void
+openAddressingHashTableRehash(J9HashTable *table);
+
+/**
+* @brief
+* @param *table
+* @param *handle
+* @return void *
+*/
+void *
+openAddressingHashTableStartDo(J9HashTable *table, J9HashTableState *handle);
+
+/**
+* @brief
+* @param *handle
+* @return void *
+*/
+void *
+openAddressingHashTableNextDo(J9HashTableState *handle);
+
+/**
+* @brief
+* @param *handle
+* @return uintptr_t
+*/
+uintptr_t
+openAddressingHashTableDoRemove(J9HashTableState *handle);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,524 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * file    : openaddressinghashtable.c
+ *
+ *  Open-addressing storage for J9HashTable (J9HASH_TABLE_OPEN_ADDRESSING)
+ *
+ *  Entries are stored in a power-of-two sized slot array with one control byte per slot. A control
+ *  byte is EMPTY, DELETED, or holds the low 7 bits of the entry's hash. A lookup hashes once, then
+ *  compares a whole group of control bytes against those 7 bits at a time (using SSE2 or NEON where
+ *  available), so the equality function is usually called only for the entry being looked for. Probing
+ *  moves from group to group and stops at the first group containing an EMPTY byte.
+ *
+ *  Entries up to OA_INLINE_ENTRY_SIZE_MAX bytes are stored inline in the slot array, so a successful
+ *  lookup touches one control byte group and one slot. Inline entries move when the table grows or is rehashed.
+ *  Larger entries are allocated from the list node pool and the slot holds a pointer to them, so
+ *  their addresses are stable for as long as they are in the table.
+ *
+ *  Removal leaves a DELETED byte behind so that probe sequences through the slot are not cut short,
+ *  and entries never move on removal, which keeps hashTableDoRemove safe during an iteration.
+ *  DELETED slots are reused by later adds and purged when the table is next resized.
+ */
+
+#include <string.h>
+#include "omrcfg.h"
+#include "hashtable_internal.h"
+#include "pool_api.h"
+#include "omrutil.h"
+#include "omrutilbase.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define OA_USE_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define OA_USE_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif /* defined(_MSC_VER) */
+
+#define OA_GROUP_WIDTH 16
+#define OA_CTRL_EMPTY ((uint8_t)0x80)
+#define OA_CTRL_DELETED ((uint8_t)0xFE)
+#define OA_CTRL_IS_FULL(ctrl) (0 == ((ctrl) & 0x80))
+#define OA_H1(hash) ((hash) >> 7)
+#define OA_H2(hash) ((uint8_t)((hash) & 0x7F))
+
+#define OA_INLINE_ENTRY_SIZE_MAX (4 * sizeof(uintptr_t))
+#define OA_CAPACITY_MIN OA_GROUP_WIDTH
+#define OA_CAPACITY_MAX ((uint32_t)1 << 30)
+/* Maximum load factor of 7/8 guarantees that every probe sequence reaches an EMPTY byte */
+#define OA_MAX_LOAD(capacity) ((capacity) - ((capacity) / 8))
+
+#define OA_IS_INLINE(table) (NULL == (table)->listNodePool)
+#define OA_SLOT(table, index) ((void *)((uint8_t *)(table)->nodes + ((uintptr_t)(index) * (table)->slotSize)))
+#define OA_SLOT_TO_ENTRY(table, slot) (OA_IS_INLINE(table) ? (slot) : *(void **)(slot))
+
+#define ROUND_TO_SIZEOF_UDATA(number) (((number) + (sizeof(uintptr_t) - 1)) & (~(sizeof(uintptr_t) - 1)))
+
+/* Bit i is set when byte i of the group matches */
+typedef uint32_t OAGroupMask;
+
+static uintptr_t mixHash(uintptr_t hash);
+static OAGroupMask groupMatch(const uint8_t *ctrl, uint8_t h2);
+static OAGroupMask groupMatchEmpty(const uint8_t *ctrl);
+static OAGroupMask groupMatchEmptyOrDeleted(const uint8_t *ctrl);
+static uint32_t lowestBit(OAGroupMask mask);
+static void setControl(J9HashTable *table, uintptr_t index, uint8_t value);
+static uintptr_t findSlot(J9HashTable *table, void *entry, uintptr_t hash);
+static uintptr_t findInsertSlot(J9HashTable *table, uintptr_t hash);
+static uintptr_t resize(J9HashTable *table, uint32_t newCapacity);
+static void rehashInPlace(J9HashTable *table);
+static void removeSlot(J9HashTable *table, uintptr_t index);
+
+/* Hash functions written for chained tables are reduced modulo a prime; here both the high and low bits are used */
+static uintptr_t
+mixHash(uintptr_t hash)
+{
+#if defined(OMR_ENV_DATA64)
+	hash ^= hash >> 33;
+	hash *= (uintptr_t)J9CONST64(0xff51afd7ed558ccd);
+	hash ^= hash >> 33;
+	hash *= (uintptr_t)J9CONST64(0xc4ceb9fe1a85ec53);
+	hash ^= hash >> 33;
+#else
+	hash ^= hash >> 16;
+	hash *= 0x85ebca6b;
+	hash ^= hash >> 13;
+	hash *= 0xc2b2ae35;
+	hash ^= hash >> 16;
+#endif
+	return hash;
+}
+
+#if defined(OA_USE_NEON)
+static OAGroupMask
+neonMovemask(uint8x16_t matches)
+{
+	static const uint8_t bitWeights[OA_GROUP_WIDTH] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+	uint8x16_t bits = vandq_u8(matches, vld1q_u8(bitWeights));
+
+	return (OAGroupMask)vaddv_u8(vget_low_u8(bits)) | ((OAGroupMask)vaddv_u8(vget_high_u8(bits)) << 8);
+}
+#endif /* defined(OA_USE_NEON) */
+
+static OAGroupMask
+groupMatch(const uint8_t *ctrl, uint8_t h2)
+{
+#if defined(OA_USE_SSE2)
+	__m128i group = _mm_loadu_si128((const __m128i *)ctrl);
+	return (OAGroupMask)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)h2)));
+#elif defined(OA_USE_NEON)
+	return neonMovemask(vceqq_u8(vld1q_u8(ctrl), vdupq_n_u8(h2)));
+#else
+	OAGroupMask mask = 0;
+	uint32_t i = 0;
+
+	for (i = 0; i < OA_GROUP_WIDTH; i++) {
+		if (ctrl[i] == h2) {
+			mask |= (OAGroupMask)1 << i;
+		}
+	}
+	return mask;
+#endif
+}
+
+static OAGroupMask
+groupMatchEmpty(const uint8_t *ctrl)
+{
+	return groupMatch(ctrl, OA_CTRL_EMPTY);
+}
+
+static OAGroupMask
+groupMatchEmptyOrDeleted(const uint8_t *ctrl)
+{
+#if defined(OA_USE_SSE2)
+	/* EMPTY and DELETED are the only control values with the high bit set */
+	return (OAGroupMask)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)ctrl));
+#elif defined(OA_USE_NEON)
+	return neonMovemask(vcltzq_s8(vreinterpretq_s8_u8(vld1q_u8(ctrl))));
+#else
+	OAGroupMask mask = 0;
+	uint32_t i = 0;
+
+	for (i = 0; i < OA_GROUP_WIDTH; i++) {
+		if (!OA_CTRL_IS_FULL(ctrl[i])) {
+			mask |= (OAGroupMask)1 << i;
+		}
+	}
+	return mask;
+#endif
+}
+
+static uint32_t
+lowestBit(OAGroupMask mask)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return (uint32_t)__builtin_ctz(mask);
+#elif defined(_MSC_VER)
+	unsigned long index = 0;
+	_BitScanForward(&index, mask);
+	return (uint32_t)index;
+#else
+	uint32_t index = 0;
+
+	while (0 == (mask & 1)) {
+		mask >>= 1;
+		index += 1;
+	}
+	return index;
+#endif
+}
+
+/* The first OA_GROUP_WIDTH control bytes are mirrored after the last one so that a group can be loaded at any index */
+static void
+setControl(J9HashTable *table, uintptr_t index, uint8_t value)
+{
+	table->controlBytes[index] = value;
+	if (index < OA_GROUP_WIDTH) {
+		table->controlBytes[table->tableSize + index] = value;
+	}
+}
+
+/* Return the index of the slot holding a match for entry, or tableSize if there is none */
+static uintptr_t
+findSlot(J9HashTable *table, void *entry, uintptr_t hash)
+{
+	uintptr_t mask = table->tableSize - 1;
+	uintptr_t position = OA_H1(hash) & mask;
+	uintptr_t stride = 0;
+	uint8_t h2 = OA_H2(hash);
+
+	for (;;) {
+		const uint8_t *group = &table->controlBytes[position];
+		OAGroupMask matches = groupMatch(group, h2);
+
+		while (0 != matches) {
+			uintptr_t index = (position + lowestBit(matches)) & mask;
+			void *candidate = OA_SLOT_TO_ENTRY(table, OA_SLOT(table, index));
+
+			if (0 != table->hashEqualFn(candidate, entry, table->equalFnUserData)) {
+				return index;
+			}
+			matches &= matches - 1;
+		}
+		if (0 != groupMatchEmpty(group)) {
+			return table->tableSize;
+		}
+		/* triangular probing visits every group when the number of groups is a power of two */
+		stride += OA_GROUP_WIDTH;
+		position = (position + stride) & mask;
+	}
+}
+
+/* Return the index of the first EMPTY or DELETED slot on the probe sequence for hash */
+static uintptr_t
+findInsertSlot(J9HashTable *table, uintptr_t hash)
+{
+	uintptr_t mask = table->tableSize - 1;
+	uintptr_t position = OA_H1(hash) & mask;
+	uintptr_t stride = 0;
+
+	for (;;) {
+		OAGroupMask available = groupMatchEmptyOrDeleted(&table->controlBytes[position]);
+
+		if (0 != available) {
+			return (position + lowestBit(available)) & mask;
+		}
+		stride += OA_GROUP_WIDTH;
+		position = (position + stride) & mask;
+	}
+}
+
+/* Move all entries into new arrays of newCapacity slots, dropping DELETED slots. Returns 0 on success, 1 on failure. */
+static uintptr_t
+resize(J9HashTable *table, uint32_t newCapacity)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+	void **oldNodes = table->nodes;
+	uint8_t *oldControlBytes = table->controlBytes;
+	uint32_t oldCapacity = table->tableSize;
+	uint8_t *newControlBytes = NULL;
+	void **newNodes = NULL;
+	uint32_t i = 0;
+
+	newNodes = omrmem_allocate_memory((uintptr_t)newCapacity * table->slotSize, table->memoryCategory);
+	newControlBytes = omrmem_allocate_memory(newCapacity + OA_GROUP_WIDTH, table->memoryCategory);
+	if ((NULL == newNodes) || (NULL == newControlBytes)) {
+		omrmem_free_memory(newNodes);
+		omrmem_free_memory(newControlBytes);
+		return 1;
+	}
+	memset(newControlBytes, OA_CTRL_EMPTY, newCapacity + OA_GROUP_WIDTH);
+
+	table->nodes = newNodes;
+	table->controlBytes = newControlBytes;
+	table->tableSize = newCapacity;
+	for (i = 0; i < oldCapacity; i++) {
+		if (OA_CTRL_IS_FULL(oldControlBytes[i])) {
+			void *oldSlot = (uint8_t *)oldNodes + ((uintptr_t)i * table->slotSize);
+			uintptr_t hash = mixHash(table->hashFn(OA_SLOT_TO_ENTRY(table, oldSlot), table->hashFnUserData));
+			uintptr_t index = findInsertSlot(table, hash);
+
+			memcpy(OA_SLOT(table, index), oldSlot, table->slotSize);
+			setControl(table, index, OA_H2(hash));
+		}
+	}
+	table->growthLeft = OA_MAX_LOAD(newCapacity) - table->numberOfNodes;
+
+	if (NULL != oldNodes) {
+		omrmem_free_memory(oldNodes);
+	}
+	if (NULL != oldControlBytes) {
+		omrmem_free_memory(oldControlBytes);
+	}
+	return 0;
+}
+
+/*
+ * Re-place every entry without allocating, which also purges DELETED slots. Every full slot is first
+ * marked DELETED to mean "not yet placed" and every DELETED slot becomes EMPTY. Each pending entry then
+ * either stays where it is (if that is within its first probe group that has room), moves to an EMPTY
+ * slot, or swaps with a pending entry which is then processed in turn.
+ */
+static void
+rehashInPlace(J9HashTable *table)
+{
+	uintptr_t mask = table->tableSize - 1;
+	uint8_t swapSpace[OA_INLINE_ENTRY_SIZE_MAX];
+	uintptr_t i = 0;
+
+	for (i = 0; i < table->tableSize; i++) {
+		setControl(table, i, OA_CTRL_IS_FULL(table->controlBytes[i]) ? OA_CTRL_DELETED : OA_CTRL_EMPTY);
+	}
+	for (i = 0; i < table->tableSize; i++) {
+		void *slot = OA_SLOT(table, i);
+		uintptr_t hash = 0;
+		uintptr_t probeStart = 0;
+		uintptr_t target = 0;
+
+		if (OA_CTRL_DELETED != table->controlBytes[i]) {
+			continue;
+		}
+		hash = mixHash(table->hashFn(OA_SLOT_TO_ENTRY(table, slot), table->hashFnUserData));
+		probeStart = OA_H1(hash) & mask;
+		target = findInsertSlot(table, hash);
+		if ((((target - probeStart) & mask) / OA_GROUP_WIDTH) == (((i - probeStart) & mask) / OA_GROUP_WIDTH)) {
+			/* already in the first group with room on its probe sequence */
+			setControl(table, i, OA_H2(hash));
+		} else if (OA_CTRL_EMPTY == table->controlBytes[target]) {
+			memcpy(OA_SLOT(table, target), slot, table->slotSize);
+			setControl(table, target, OA_H2(hash));
+			setControl(table, i, OA_CTRL_EMPTY);
+		} else {
+			/* target holds an entry still to be placed: swap and process slot i again */
+			memcpy(swapSpace, OA_SLOT(table, target), table->slotSize);
+			memcpy(OA_SLOT(table, target), slot, table->slotSize);
+			memcpy(slot, swapSpace, table->slotSize);
+			setControl(table, target, OA_H2(hash));
+			i -= 1;
+		}
+	}
+	table->growthLeft = OA_MAX_LOAD(table->tableSize) - table->numberOfNodes;
+}
+
+static void
+removeSlot(J9HashTable *table, uintptr_t index)
+{
+	if (!OA_IS_INLINE(table)) {
+		pool_removeElement(table->listNodePool, *(void **)OA_SLOT(table, index));
+	}
+	setControl(table, index, OA_CTRL_DELETED);
+	table->numberOfNodes -= 1;
+}
+
+uintptr_t
+openAddressingHashTableInit(J9HashTable *table, uint32_t tableSize)
+{
+	uint32_t capacity = OA_CAPACITY_MIN;
+	uintptr_t slotSize = ROUND_TO_SIZEOF_UDATA(table->entrySize);
+
+	if (0 != table->nodeAlignment) {
+		slotSize = ((slotSize + table->nodeAlignment - 1) / table->nodeAlignment) * table->nodeAlignment;
+	}
+	/* Large, over-aligned and 32-bit addressable entries live in pool nodes */
+	if ((slotSize > OA_INLINE_ENTRY_SIZE_MAX)
+		|| (table->nodeAlignment > (2 * sizeof(uintptr_t)))
+#if defined(OMR_ENV_DATA64)
+		|| (J9HASH_TABLE_ALLOCATE_ELEMENTS_USING_MALLOC32 == (table->flags & J9HASH_TABLE_ALLOCATE_ELEMENTS_USING_MALLOC32))
+#endif /* OMR_ENV_DATA64 */
+	) {
+		OMRPortLibrary *portLibrary = table->portLibrary;
+
+#if defined(OMR_ENV_DATA64)
+		if (J9HASH_TABLE_ALLOCATE_ELEMENTS_USING_MALLOC32 == (table->flags & J9HASH_TABLE_ALLOCATE_ELEMENTS_USING_MALLOC32)) {
+			table->listNodePool = pool_new(table->entrySize, tableSize, table->nodeAlignment, POOL_NO_ZERO, table->tableName, table->memoryCategory, POOL_FOR_PORT_PUDDLE32(portLibrary));
+		} else
+#endif /* OMR_ENV_DATA64 */
+		{
+			table->listNodePool = pool_new(table->entrySize, tableSize, table->nodeAlignment, POOL_NO_ZERO, table->tableName, table->memoryCategory, POOL_FOR_PORT(portLibrary));
+		}
+		if (NULL == table->listNodePool) {
+			return 1;
+		}
+		slotSize = sizeof(void *);
+	}
+	table->slotSize = (uint32_t)slotSize;
+
+	/* size the table so tableSize entries fit without growing */
+	while ((capacity < OA_CAPACITY_MAX) && (OA_MAX_LOAD(capacity) < tableSize)) {
+		capacity <<= 1;
+	}
+	table->tableSize = 0;
+	return resize(table, capacity);
+}
+
+void *
+openAddressingHashTableFind(J9HashTable *table, void *entry)
+{
+	uintptr_t hash = mixHash(table->hashFn(entry, table->hashFnUserData));
+	uintptr_t index = findSlot(table, entry, hash);
+
+	if (index == table->tableSize) {
+		return NULL;
+	}
+	return OA_SLOT_TO_ENTRY(table, OA_SLOT(table, index));
+}
+
+void *
+openAddressingHashTableAdd(J9HashTable *table, void *entry)
+{
+	uintptr_t hash = mixHash(table->hashFn(entry, table->hashFnUserData));
+	uintptr_t index = findSlot(table, entry, hash);
+	void *slot = NULL;
+	void *newEntry = NULL;
+
+	if (index != table->tableSize) {
+		return OA_SLOT_TO_ENTRY(table, OA_SLOT(table, index));
+	}
+
+	index = findInsertSlot(table, hash);
+	if ((0 == table->growthLeft) && (OA_CTRL_EMPTY == table->controlBytes[index])) {
+		/* out of EMPTY slots: grow, or just purge DELETED slots if at most half the slots are in use */
+		uint32_t newCapacity = table->tableSize;
+
+		if (table->numberOfNodes >= (OA_MAX_LOAD(table->tableSize) / 2)) {
+			newCapacity <<= 1;
+		}
+		if ((newCapacity > OA_CAPACITY_MAX) || !hashTableCanGrow(table) || !hashTableCanRehash(table)) {
+			return NULL;
+		}
+		if (newCapacity == table->tableSize) {
+			rehashInPlace(table);
+		} else if (0 != resize(table, newCapacity)) {
+			return NULL;
+		}
+		index = findInsertSlot(table, hash);
+	}
+
+	slot = OA_SLOT(table, index);
+	if (OA_IS_INLINE(table)) {
+		newEntry = slot;
+	} else {
+		newEntry = pool_newElement(table->listNodePool);
+		if (NULL == newEntry) {
+			return NULL;
+		}
+		*(void **)slot = newEntry;
+	}
+	memcpy(newEntry, entry, table->entrySize);
+	if (!hashTableCanGrow(table)) {
+		issueWriteBarrier();
+	}
+	if (OA_CTRL_EMPTY == table->controlBytes[index]) {
+		table->growthLeft -= 1;
+	}
+	setControl(table, index, OA_H2(hash));
+	table->numberOfNodes += 1;
+
+	return newEntry;
+}
+
+uint32_t
+openAddressingHashTableRemove(J9HashTable *table, void *entry)
+{
+	uintptr_t hash = mixHash(table->hashFn(entry, table->hashFnUserData));
+	uintptr_t index = findSlot(table, entry, hash);
+
+	if (index == table->tableSize) {
+		return 1;
+	}
+	removeSlot(table, index);
+	return 0;
+}
+
+void
+openAddressingHashTableRehash(J9HashTable *table)
+{
+	rehashInPlace(table);
+}
+
+void *
+openAddressingHashTableStartDo(J9HashTable *table, J9HashTableState *handle)
+{
+	handle->bucketIndex = (uint32_t)-1;
+	handle->iterateState = J9HASH_TABLE_ITERATE_STATE_LIST_NODES;
+
+	return openAddressingHashTableNextDo(handle);
+}
+
+void *
+openAddressingHashTableNextDo(J9HashTableState *handle)
+{
+	J9HashTable *table = handle->table;
+	uint32_t index = handle->bucketIndex + 1;
+
+	handle->didDeleteCurrentNode = FALSE;
+	if (J9HASH_TABLE_ITERATE_STATE_LIST_NODES == handle->iterateState) {
+		for (; index < table->tableSize; index++) {
+			if (OA_CTRL_IS_FULL(table->controlBytes[index])) {
+				handle->bucketIndex = index;
+				return OA_SLOT_TO_ENTRY(table, OA_SLOT(table, index));
+			}
+		}
+		handle->bucketIndex = table->tableSize;
+		handle->iterateState = J9HASH_TABLE_ITERATE_STATE_FINISHED;
+	}
+	return NULL;
+}
+
+uintptr_t
+openAddressingHashTableDoRemove(J9HashTableState *handle)
+{
+	J9HashTable *table = handle->table;
+
+	if ((J9HASH_TABLE_ITERATE_STATE_LIST_NODES != handle->iterateState) || handle->didDeleteCurrentNode) {
+		return 1;
+	}
+	removeSlot(table, handle->bucketIndex);
+	handle->didDeleteCurrentNode = TRUE;
+	return 0;
+}
@@ -25,6 +25,7 @@
 #include "pool_api.h"
 #include "omrthread.h"
 #include "omrhookable.h"
+#include "hookable_internal.h"
 #include "omrmemcategories.h"
 #include "omrutil.h"
 #include "AtomicSupport.hpp"
@@ -44,6 +45,14 @@ static intptr_t J9HookReserve(struct J9HookInterface **hookInterface, uintptr_t
 static void J9HookUnreserve(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum);
 static uintptr_t J9HookAllocateAgentID(struct J9HookInterface **hookInterface);
 static void J9HookDeallocateAgentID(struct J9HookInterface **hookInterface, uintptr_t agentID);
+static intptr_t J9HookEnableCompiledDispatch(struct J9HookInterface **hookInterface);
+static intptr_t J9HookRegisterBatched(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum, J9HookBatchFunction function, uintptr_t eventDataSize, uintptr_t batchSize, void *userData);
+static void J9HookUnregisterBatched(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum, J9HookBatchFunction function, void *userData);
+static void J9HookFlushBatches(struct J9HookInterface **hookInterface);
+static intptr_t rebuildSnapshot(J9CommonHookInterface *commonInterface, uintptr_t eventNum);
+static uintptr_t startSnapshotDispatch(J9CommonHookInterface *commonInterface);
+static void endSnapshotDispatch(J9CommonHookInterface *commonInterface, uintptr_t epoch);
+static void freeRetiredSnapshots(J9CommonHookInterface *commonInterface);
 
 static const J9HookInterface hookFunctionTable = {
 	J9HookDispatch,
@@ -57,6 +66,10 @@ static const J9HookInterface hookFunctionTable = {
 	J9HookIsEnabled,
 	J9HookAllocateAgentID,
 	J9HookDeallocateAgentID,
+	J9HookEnableCompiledDispatch,
+	J9HookRegisterBatched,
+	J9HookUnregisterBatched,
+	J9HookFlushBatches,
 };
 
 /* flags are stored at the beginning of the interface just after the common interface fields in ascending order */
@@ -158,6 +171,47 @@ static void
 J9HookShutdownInterface(struct J9HookInterface **hookInterface)
 {
 	J9CommonHookInterface *commonInterface = (J9CommonHookInterface *)hookInterface;
+	OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+
+	if (0 != commonInterface->batchKey) {
+		J9HookThreadBatches *batches = commonInterface->threadBatches;
+		J9HookBatchListener *listener = commonInterface->batchListeners;
+
+		/* this drops the TLS values without running the finalizer, so free the buffers of live threads here */
+		omrthread_tls_free(commonInterface->batchKey);
+		while (NULL != batches) {
+			J9HookThreadBatches *nextBatches = batches->next;
+			J9HookBatchBuffer *buffer = batches->buffers;
+
+			while (NULL != buffer) {
+				J9HookBatchBuffer *nextBuffer = buffer->next;
+				omrmem_free_memory(buffer);
+				buffer = nextBuffer;
+			}
+			omrmem_free_memory(batches);
+			batches = nextBatches;
+		}
+		while (NULL != listener) {
+			J9HookBatchListener *nextListener = listener->next;
+			omrmem_free_memory(listener);
+			listener = nextListener;
+		}
+	}
+
+	if (NULL != commonInterface->snapshots) {
+		J9HookSnapshot *snapshot = commonInterface->retiredSnapshots;
+		uintptr_t eventNum = 0;
+
+		while (NULL != snapshot) {
+			J9HookSnapshot *next = snapshot->nextRetired;
+			omrmem_free_memory(snapshot);
+			snapshot = next;
+		}
+		for (eventNum = 0; eventNum < commonInterface->eventSize; eventNum++) {
+			omrmem_free_memory(commonInterface->snapshots[eventNum]);
+		}
+		omrmem_free_memory((void *)commonInterface->snapshots);
+	}
 
 	if (commonInterface->lock) {
 		omrthread_monitor_destroy(commonInterface->lock);
@@ -169,6 +223,57 @@ J9HookShutdownInterface(struct J9HookInterface **hookInterface)
 }
 
 
+/*
+ * Call one listener, keeping the per-event statistics and timing it if the event is sampled.
+ */
+static VMINLINE void
+invokeListener(J9CommonHookInterface *commonInterface, uintptr_t eventNum, void *eventData, J9HookFunction function, void *userData, const char *callsite, OMREventInfo4Dump *eventDump, uintptr_t samplingInterval)
+{
+	struct J9HookInterface **hookInterface = (struct J9HookInterface **)commonInterface;
+	uint64_t startTime = 0;
+	uintptr_t count = 0;
+	bool sampling = false;
+	OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+
+	if (NULL != eventDump) {
+		count = VM_AtomicSupport::add((volatile uintptr_t *)&eventDump->count, 1);
+		sampling = (1 >= samplingInterval) || ((100 >= samplingInterval) && (0 == (count % samplingInterval)));
+	}
+	if (sampling) {
+		startTime = omrtime_usec_clock();
+	}
+
+	function(hookInterface, eventNum, eventData, userData);
+
+	if (sampling) {
+		uint64_t timeDelta = omrtime_hires_delta(startTime, omrtime_usec_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+		eventDump->lastHook.startTime = startTime;
+		eventDump->lastHook.callsite = callsite;
+		eventDump->lastHook.func_ptr = (void *)function;
+		eventDump->lastHook.duration = timeDelta;
+		VM_AtomicSupport::add((volatile uintptr_t *)&eventDump->totalTime, (uintptr_t)timeDelta);
+
+		if ((eventDump->longestHook.duration < timeDelta) ||
+			(0 == eventDump->longestHook.startTime)) {
+				eventDump->longestHook.startTime = startTime;
+				eventDump->longestHook.callsite = callsite;
+				eventDump->longestHook.func_ptr = (void *)function;
+				eventDump->longestHook.duration = timeDelta;
+		}
+
+		if (commonInterface->threshold4Trace <= timeDelta) {
+			char buffer[32];
+			if (NULL == callsite) {
+				/* if the callsite info can not be retrieved, use callback function pointer instead  */
+				omrstr_printf(buffer, sizeof(buffer), "0x%p", function);
+				callsite = buffer;
+			}
+			Trc_Hook_Dispatch_Exceed_Threshold_Event(callsite, timeDelta);
+		}
+	}
+}
+
 /*
  * Inform all registered listeners that the specified event has occurred. Details about the
  * event should be available through eventData.
@@ -177,6 +282,9 @@ J9HookShutdownInterface(struct J9HookInterface **hookInterface)
  * before the listeners are informed. Any attempts to add listeners to a TAG_ONCE event
  * once it has been reported will fail.
  *
+ * With compiled dispatch enabled the listeners are read from the event's snapshot, which
+ * is never modified once published, so no record IDs need to be checked.
+ *
  * This function should not be called directly. It should be called through the hook interface
  *
  */
@@ -185,10 +293,9 @@ J9HookDispatch(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum,
 {
 	uintptr_t eventNum = taggedEventNum & J9HOOK_EVENT_NUM_MASK;
 	J9CommonHookInterface *commonInterface = (J9CommonHookInterface *)hookInterface;
-	J9HookRecord *record = HOOK_RECORD(commonInterface, eventNum);
+	J9HookRecord *record = NULL;
 	OMREventInfo4Dump *eventDump = J9HOOK_DUMPINFO(commonInterface, eventNum);
 	uintptr_t samplingInterval = (taggedEventNum & J9HOOK_TAG_SAMPLING_MASK) >> 16;
-	bool sampling = false;
 
 	if (taggedEventNum & J9HOOK_TAG_ONCE) {
 		uint8_t oldFlags;
@@ -205,6 +312,29 @@ J9HookDispatch(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum,
 		}
 	}
 
+	if (commonInterface->compiledDispatch) {
+		J9HookSnapshot *snapshot = NULL;
+		uintptr_t epoch = 0;
+
+		/* pairs with the write barrier before compiledDispatch was set, so the snapshots array is seen */
+		VM_AtomicSupport::readBarrier();
+		epoch = startSnapshotDispatch(commonInterface);
+		snapshot = commonInterface->snapshots[eventNum];
+		if (NULL != snapshot) {
+			uintptr_t i = 0;
+
+			/* pairs with the write barrier before the snapshot was published */
+			VM_AtomicSupport::readBarrier();
+			for (i = 0; i < snapshot->count; i++) {
+				J9HookSnapshotEntry *entry = &snapshot->entries[i];
+				invokeListener(commonInterface, eventNum, eventData, entry->function, entry->userData, entry->callsite, eventDump, samplingInterval);
+			}
+		}
+		endSnapshotDispatch(commonInterface, epoch);
+		return;
+	}
+
+	record = HOOK_RECORD(commonInterface, eventNum);
 	while (record) {
 		J9HookFunction function;
 		void *userData;
@@ -221,51 +351,7 @@ J9HookDispatch(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum,
 			/* now read the id again to make sure that nothing has changed */
 			VM_AtomicSupport::readBarrier();
 			if (record->id == id) {
-				uint64_t startTime = 0;
-				uintptr_t count = 0;
-				if (NULL != eventDump) {
-					count = VM_AtomicSupport::add((volatile uintptr_t *)&eventDump->count, 1);
-					sampling = (1 >= samplingInterval) || ((100 >= samplingInterval) && (0 == (count % samplingInterval)));
-				} else {
-					sampling =  false;
-				}
-				OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
-				if (sampling) {
-					startTime = omrtime_usec_clock(); 
-				}
-
-				function(hookInterface, eventNum, eventData, userData);
-
-				if (sampling) {
-					uint64_t timeDelta = omrtime_hires_delta(startTime, omrtime_usec_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
-
-					eventDump->lastHook.startTime = startTime;
-					eventDump->lastHook.callsite = record->callsite;
-					eventDump->lastHook.func_ptr = (void *)record->function;
-					eventDump->lastHook.duration = timeDelta;
-					VM_AtomicSupport::add((volatile uintptr_t *)&eventDump->totalTime, (uintptr_t)timeDelta);
-
-					if ((eventDump->longestHook.duration < timeDelta) ||
-						(0 == eventDump->longestHook.startTime)) {
-							eventDump->longestHook.startTime = startTime;
-							eventDump->longestHook.callsite = record->callsite;
-							eventDump->longestHook.func_ptr = (void *)record->function;
-							eventDump->longestHook.duration = timeDelta;
-					}
-
-					if (commonInterface->threshold4Trace <= timeDelta) {
-						const char *callsite = "UNKNOWN";
-						char buffer[32];
-						if (NULL != record->callsite) {
-							callsite = record->callsite;
-						} else {
-							/* if the callsite info can not be retrieved, use callback function pointer instead  */
-							omrstr_printf(buffer, sizeof(buffer), "0x%p", record->function);
-							callsite = buffer;
-						}
-						Trc_Hook_Dispatch_Exceed_Threshold_Event(callsite, timeDelta);
-					}
-				}
+				invokeListener(commonInterface, eventNum, eventData, function, userData, record->callsite, eventDump, samplingInterval);
 			} else {
 				/* this record has been updated while we were reading it. Skip it. */
 			}
@@ -451,6 +537,10 @@ J9HookRegisterWithCallSitePrivate(struct J9HookInterface **hookInterface, uintpt
 				HOOK_FLAGS(commonInterface, eventNum) |= J9HOOK_FLAG_HOOKED | J9HOOK_FLAG_RESERVED;
 			}
 		}
+
+		if (0 == rc) {
+			rebuildSnapshot(commonInterface, eventNum);
+		}
 	}
 
 	omrthread_monitor_exit(commonInterface->lock);
@@ -575,6 +665,10 @@ J9HookUnregister(struct J9HookInterface **hookInterface, uintptr_t taggedEventNu
 		HOOK_FLAGS(commonInterface, eventNum) &= ~J9HOOK_FLAG_HOOKED;
 	}
 
+	if (hooksRemoved != 0) {
+		rebuildSnapshot(commonInterface, eventNum);
+	}
+
 	omrthread_monitor_exit(commonInterface->lock);
 
 	if (hooksRemoved != 0) {
@@ -646,4 +740,445 @@ J9HookDeallocateAgentID(struct J9HookInterface **hookInterface, uintptr_t agentI
 	return;
 }
 
+/*
+ * Count the calling thread as dispatching from the snapshots in the current epoch. The epoch
+ * is read again after the thread is counted, so that it is never counted in an epoch that a
+ * rebuild has already moved past.
+ *
+ * Returns the epoch to pass to endSnapshotDispatch
+ */
+static uintptr_t
+startSnapshotDispatch(J9CommonHookInterface *commonInterface)
+{
+	uintptr_t epoch = commonInterface->snapshotEpoch;
+
+	for (;;) {
+		uintptr_t currentEpoch = 0;
+
+		VM_AtomicSupport::add(&commonInterface->snapshotDispatches[epoch & 1], 1);
+		VM_AtomicSupport::readWriteBarrier();
+		currentEpoch = commonInterface->snapshotEpoch;
+		if (currentEpoch == epoch) {
+			break;
+		}
+		VM_AtomicSupport::subtract(&commonInterface->snapshotDispatches[epoch & 1], 1);
+		epoch = currentEpoch;
+	}
+
+	return epoch;
+}
+
+/*
+ * Stop counting the calling thread as dispatching from the snapshots.
+ */
+static void
+endSnapshotDispatch(J9CommonHookInterface *commonInterface, uintptr_t epoch)
+{
+	VM_AtomicSupport::subtract(&commonInterface->snapshotDispatches[epoch & 1], 1);
+}
+
+/*
+ * Free the retired snapshots that no dispatch can still be reading.
+ *
+ * The interface moves to the next epoch once every dispatch that started in the epoch before
+ * the current one has finished, so only dispatches from the current and previous epochs can be
+ * in progress. A snapshot retired two or more epochs ago had been replaced before any of them
+ * read the snapshots, so it is freed. A listener that blocks keeps the snapshots retired after
+ * its dispatch started until it returns.
+ *
+ * The caller must hold the interface lock.
+ */
+static void
+freeRetiredSnapshots(J9CommonHookInterface *commonInterface)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+	J9HookSnapshot **link = &commonInterface->retiredSnapshots;
+	J9HookSnapshot *snapshot = NULL;
+	uintptr_t epoch = commonInterface->snapshotEpoch;
+	uintptr_t i = 0;
+
+	if (NULL == commonInterface->retiredSnapshots) {
+		return;
+	}
+
+	/* a snapshot retired in the current epoch can be freed after two advances */
+	for (i = 0; i < 2; i++) {
+		VM_AtomicSupport::readWriteBarrier();
+		if (0 != commonInterface->snapshotDispatches[(epoch - 1) & 1]) {
+			break;
+		}
+		epoch = VM_AtomicSupport::add(&commonInterface->snapshotEpoch, 1);
+	}
+
+	while ((NULL != *link) && ((epoch - (*link)->retiredEpoch) < 2)) {
+		link = &(*link)->nextRetired;
+	}
+	snapshot = *link;
+	*link = NULL;
+	while (NULL != snapshot) {
+		J9HookSnapshot *next = snapshot->nextRetired;
+		omrmem_free_memory(snapshot);
+		snapshot = next;
+	}
+}
+
+/*
+ * Publish a new snapshot of the listeners of eventNum, built from its records. The previous
+ * snapshot may still be in use by dispatching threads, so it is retired rather than freed,
+ * and freed by a later rebuild once every dispatch that could have read it has finished.
+ *
+ * If the snapshot cannot be allocated, compiled dispatch is turned off and dispatch falls
+ * back to walking the records, which are always up to date.
+ *
+ * The caller must hold the interface lock.
+ *
+ * Returns 0 on success, J9HOOK_ERR_NOMEM on failure
+ */
+static intptr_t
+rebuildSnapshot(J9CommonHookInterface *commonInterface, uintptr_t eventNum)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+	J9HookSnapshot *snapshot = NULL;
+	J9HookSnapshot *oldSnapshot = NULL;
+	J9HookRecord *record = NULL;
+	uintptr_t count = 0;
+
+	if (NULL == commonInterface->snapshots) {
+		return 0;
+	}
+
+	for (record = HOOK_RECORD(commonInterface, eventNum); NULL != record; record = record->next) {
+		if (HOOK_IS_VALID_ID(record->id)) {
+			count += 1;
+		}
+	}
+
+	if (0 != count) {
+		snapshot = (J9HookSnapshot *)omrmem_allocate_memory(offsetof(J9HookSnapshot, entries) + (count * sizeof(J9HookSnapshotEntry)), OMRMEM_CATEGORY_VM);
+		if (NULL == snapshot) {
+			commonInterface->compiledDispatch = 0;
+			return J9HOOK_ERR_NOMEM;
+		}
+		snapshot->nextRetired = NULL;
+		snapshot->retiredEpoch = 0;
+		snapshot->count = 0;
+		for (record = HOOK_RECORD(commonInterface, eventNum); NULL != record; record = record->next) {
+			if (HOOK_IS_VALID_ID(record->id)) {
+				J9HookSnapshotEntry *entry = &snapshot->entries[snapshot->count];
+
+				entry->function = record->function;
+				entry->userData = record->userData;
+				entry->callsite = record->callsite;
+				snapshot->count += 1;
+			}
+		}
+	}
+
+	oldSnapshot = commonInterface->snapshots[eventNum];
+	VM_AtomicSupport::writeBarrier();
+	commonInterface->snapshots[eventNum] = snapshot;
+	if (NULL != oldSnapshot) {
+		oldSnapshot->retiredEpoch = commonInterface->snapshotEpoch;
+		oldSnapshot->nextRetired = commonInterface->retiredSnapshots;
+		commonInterface->retiredSnapshots = oldSnapshot;
+	}
+	freeRetiredSnapshots(commonInterface);
+
+	return 0;
+}
+
+/**
+ * Switch the interface to compiled dispatch. Each event gets an immutable array of its
+ * listeners, rebuilt whenever a listener is registered or unregistered, so reporting an
+ * event reads one pointer and calls the listeners without checking each record for
+ * concurrent modification. Each report counts itself in and out of the current snapshot
+ * epoch with two atomic updates, so that replaced arrays can be freed once no report can
+ * still be reading them. The per-event statistics are kept as before.
+ *
+ * A listener unregistered while an event is being reported on another thread may still
+ * receive that event.
+ *
+ * This function should not be called directly. It should be called through the hook interface
+ *
+ * Returns 0 on success, J9HOOK_ERR_NOMEM if the snapshots could not be allocated
+ */
+static intptr_t
+J9HookEnableCompiledDispatch(struct J9HookInterface **hookInterface)
+{
+	J9CommonHookInterface *commonInterface = (J9CommonHookInterface *)hookInterface;
+	OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+	intptr_t rc = 0;
+	uintptr_t eventNum = 0;
+
+	omrthread_monitor_enter(commonInterface->lock);
+
+	if (NULL == commonInterface->snapshots) {
+		uintptr_t size = commonInterface->eventSize * sizeof(J9HookSnapshot *);
+
+		commonInterface->snapshots = (J9HookSnapshot * volatile *)omrmem_allocate_memory(size, OMRMEM_CATEGORY_VM);
+		if (NULL == commonInterface->snapshots) {
+			rc = J9HOOK_ERR_NOMEM;
+		} else {
+			memset((void *)commonInterface->snapshots, 0, size);
+		}
+	}
+
+	for (eventNum = 0; (0 == rc) && (eventNum < commonInterface->eventSize); eventNum++) {
+		rc = rebuildSnapshot(commonInterface, eventNum);
+	}
+
+	if (0 == rc) {
+		VM_AtomicSupport::writeBarrier();
+		commonInterface->compiledDispatch = 1;
+	}
+
+	omrthread_monitor_exit(commonInterface->lock);
+
+	return rc;
+}
+
+/*
+ * Report the events accumulated in buffer to its listener, unless the listener has been unregistered.
+ */
+static void
+deliverBatch(J9CommonHookInterface *commonInterface, J9HookBatchBuffer *buffer)
+{
+	J9HookBatchListener *listener = buffer->listener;
+	uintptr_t count = buffer->count;
+
+	/* reset first, so an event the listener reports itself starts a new batch instead of redelivering this one */
+	buffer->count = 0;
+	if (listener->active && (0 != count)) {
+		listener->function((struct J9HookInterface **)commonInterface, listener->eventNum, J9HOOK_BATCH_DATA(buffer), count, listener->userData);
+	}
+}
+
+/*
+ * Deliver the pending events of a thread and free its batch buffers. Runs when the thread detaches.
+ */
+static void J9THREAD_PROC
+J9HookThreadBatchesFinalizer(void *value)
+{
+	J9HookThreadBatches *batches = (J9HookThreadBatches *)value;
+	J9CommonHookInterface *commonInterface = batches->commonInterface;
+	J9HookBatchBuffer *buffer = batches->buffers;
+	OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+
+	omrthread_monitor_enter(commonInterface->lock);
+	if (NULL != batches->prev) {
+		batches->prev->next = batches->next;
+	} else {
+		commonInterface->threadBatches = batches->next;
+	}
+	if (NULL != batches->next) {
+		batches->next->prev = batches->prev;
+	}
+	omrthread_monitor_exit(commonInterface->lock);
+
+	while (NULL != buffer) {
+		J9HookBatchBuffer *next = buffer->next;
+
+		deliverBatch(commonInterface, buffer);
+		omrmem_free_memory(buffer);
+		buffer = next;
+	}
+	omrmem_free_memory(batches);
+}
+
+/*
+ * Find or create the calling thread's buffer for a batched listener.
+ *
+ * Returns NULL if the thread is not attached or memory is exhausted.
+ */
+static J9HookBatchBuffer *
+getBatchBuffer(J9CommonHookInterface *commonInterface, J9HookBatchListener *listener)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+	omrthread_t self = omrthread_self();
+	J9HookThreadBatches *batches = NULL;
+	J9HookBatchBuffer *buffer = NULL;
+
+	if (NULL == self) {
+		return NULL;
+	}
+
+	batches = (J9HookThreadBatches *)omrthread_tls_get(self, commonInterface->batchKey);
+	if (NULL == batches) {
+		batches = (J9HookThreadBatches *)omrmem_allocate_memory(sizeof(J9HookThreadBatches), OMRMEM_CATEGORY_VM);
+		if (NULL == batches) {
+			return NULL;
+		}
+		batches->commonInterface = commonInterface;
+		batches->buffers = NULL;
+		batches->prev = NULL;
+		omrthread_monitor_enter(commonInterface->lock);
+		batches->next = commonInterface->threadBatches;
+		if (NULL != batches->next) {
+			batches->next->prev = batches;
+		}
+		commonInterface->threadBatches = batches;
+		omrthread_monitor_exit(commonInterface->lock);
+		omrthread_tls_set(self, commonInterface->batchKey, batches);
+	}
+
+	for (buffer = batches->buffers; NULL != buffer; buffer = buffer->next) {
+		if (listener == buffer->listener) {
+			return buffer;
+		}
+	}
+
+	buffer = (J9HookBatchBuffer *)omrmem_allocate_memory(sizeof(J9HookBatchBuffer) + (listener->eventDataSize * listener->batchSize), OMRMEM_CATEGORY_VM);
+	if (NULL != buffer) {
+		buffer->listener = listener;
+		buffer->count = 0;
+		buffer->next = batches->buffers;
+		batches->buffers = buffer;
+	}
+	return buffer;
+}
+
+/*
+ * The J9HookFunction registered for every batched listener. Copies the event data into the
+ * calling thread's buffer, and delivers the buffer once it holds batchSize events.
+ */
+static void
+J9HookBatchTrampoline(struct J9HookInterface **hookInterface, uintptr_t eventNum, void *eventData, void *userData)
+{
+	J9CommonHookInterface *commonInterface = (J9CommonHookInterface *)hookInterface;
+	J9HookBatchListener *listener = (J9HookBatchListener *)userData;
+	J9HookBatchBuffer *buffer = getBatchBuffer(commonInterface, listener);
+
+	if (NULL == buffer) {
+		/* nowhere to accumulate it: deliver this event on its own */
+		listener->function(hookInterface, eventNum, eventData, 1, listener->userData);
+	} else {
+		memcpy(J9HOOK_BATCH_DATA(buffer) + (buffer->count * listener->eventDataSize), eventData, listener->eventDataSize);
+		buffer->count += 1;
+		if (buffer->count == listener->batchSize) {
+			deliverBatch(commonInterface, buffer);
+		}
+	}
+}
+
+/**
+ * Register a listener which receives an event in batches. Each reporting thread copies
+ * eventDataSize bytes of event data into its own buffer, and the listener is called with
+ * batchSize events at a time, on the thread which reported them. Events still buffered
+ * are delivered by J9HookFlushBatches, or when the thread detaches.
+ *
+ * Since the listener only sees copies, batched listeners must not be used for events
+ * whose listeners return results through the event data.
+ *
+ * If the same function and userData are already registered for the event, no action is taken.
+ *
+ * This function should not be called directly. It should be called through the hook interface
+ *
+ * Returns 0 on success,
+ * J9HOOK_ERR_DISABLED if the event has been disabled
+ * J9HOOK_ERR_NOMEM if insufficient resources exist to register the listener
+ */
+static intptr_t
+J9HookRegisterBatched(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum, J9HookBatchFunction function, uintptr_t eventDataSize, uintptr_t batchSize, void *userData)
+{
+	J9CommonHookInterface *commonInterface = (J9CommonHookInterface *)hookInterface;
+	OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+	uintptr_t eventNum = taggedEventNum & J9HOOK_EVENT_NUM_MASK;
+	J9HookBatchListener *listener = NULL;
+	intptr_t rc = 0;
+
+	omrthread_monitor_enter(commonInterface->lock);
+
+	if (0 == commonInterface->batchKey) {
+		if (0 != omrthread_tls_alloc_with_finalizer(&commonInterface->batchKey, J9HookThreadBatchesFinalizer)) {
+			commonInterface->batchKey = 0;
+			omrthread_monitor_exit(commonInterface->lock);
+			return J9HOOK_ERR_NOMEM;
+		}
+	}
+
+	for (listener = commonInterface->batchListeners; NULL != listener; listener = listener->next) {
+		if (listener->active && (listener->eventNum == eventNum) && (listener->function == function) && (listener->userData == userData)) {
+			/* this listener is already registered */
+			omrthread_monitor_exit(commonInterface->lock);
+			return 0;
+		}
+	}
+
+	listener = (J9HookBatchListener *)omrmem_allocate_memory(sizeof(J9HookBatchListener), OMRMEM_CATEGORY_VM);
+	if (NULL == listener) {
+		omrthread_monitor_exit(commonInterface->lock);
+		return J9HOOK_ERR_NOMEM;
+	}
+	listener->function = function;
+	listener->userData = userData;
+	listener->eventNum = eventNum;
+	listener->eventDataSize = eventDataSize;
+	listener->batchSize = (0 == batchSize) ? 1 : batchSize;
+	listener->active = 1;
+	listener->next = commonInterface->batchListeners;
+	commonInterface->batchListeners = listener;
+
+	omrthread_monitor_exit(commonInterface->lock);
+
+	rc = J9HookRegisterWithCallSitePrivate(hookInterface, taggedEventNum & ~J9HOOK_TAG_AGENT_ID, J9HookBatchTrampoline, NULL, listener, J9HOOK_AGENTID_DEFAULT);
+	if (0 != rc) {
+		/* the listener stays on the list until shutdown, since no thread can have buffered events for it */
+		listener->active = 0;
+	}
+
+	return rc;
+}
+
+/*
+ * Remove a listener registered with J9HookRegisterBatched. Events which other threads have
+ * buffered but not yet delivered are discarded.
+ *
+ * This function should not be called directly. It should be called through the hook interface
+ */
+static void
+J9HookUnregisterBatched(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum, J9HookBatchFunction function, void *userData)
+{
+	J9CommonHookInterface *commonInterface = (J9CommonHookInterface *)hookInterface;
+	uintptr_t eventNum = taggedEventNum & J9HOOK_EVENT_NUM_MASK;
+	J9HookBatchListener *listener = NULL;
+
+	omrthread_monitor_enter(commonInterface->lock);
+	for (listener = commonInterface->batchListeners; NULL != listener; listener = listener->next) {
+		if (listener->active && (listener->eventNum == eventNum) && (listener->function == function) && (listener->userData == userData)) {
+			listener->active = 0;
+			break;
+		}
+	}
+	omrthread_monitor_exit(commonInterface->lock);
+
+	if (NULL != listener) {
+		/* buffers may still refer to the listener, so it is only freed at shutdown */
+		J9HookUnregister(hookInterface, eventNum, J9HookBatchTrampoline, listener);
+	}
+}
+
+/*
+ * Deliver all of the events buffered by the calling thread for batched listeners.
+ *
+ * This function should not be called directly. It should be called through the hook interface
+ */
+static void
+J9HookFlushBatches(struct J9HookInterface **hookInterface)
+{
+	J9CommonHookInterface *commonInterface = (J9CommonHookInterface *)hookInterface;
+	omrthread_t self = omrthread_self();
+
+	if ((0 != commonInterface->batchKey) && (NULL != self)) {
+		J9HookThreadBatches *batches = (J9HookThreadBatches *)omrthread_tls_get(self, commonInterface->batchKey);
+
+		if (NULL != batches) {
+			J9HookBatchBuffer *buffer = NULL;
+
+			for (buffer = batches->buffers; NULL != buffer; buffer = buffer->next) {
+				deliverBatch(commonInterface, buffer);
+			}
+		}
+	}
+}
+
 }
@@ -33,11 +33,54 @@
 */
 
 #include "hookable_api.h"
+#include "omrhookable.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/* An immutable array of the listeners of one event, published for lock-free dispatch. */
+typedef struct J9HookSnapshotEntry {
+	J9HookFunction function;
+	void *userData;
+	const char *callsite;
+} J9HookSnapshotEntry;
+
+typedef struct J9HookSnapshot {
+	struct J9HookSnapshot *nextRetired;
+	uintptr_t retiredEpoch;	/* snapshotEpoch of the interface when the snapshot was replaced */
+	uintptr_t count;
+	J9HookSnapshotEntry entries[1];
+} J9HookSnapshot;
+
+/* A listener registered with J9HookRegisterBatched. Its J9HookRecord points at it through userData. */
+typedef struct J9HookBatchListener {
+	struct J9HookBatchListener *next;
+	J9HookBatchFunction function;
+	void *userData;
+	uintptr_t eventNum;
+	uintptr_t eventDataSize;
+	uintptr_t batchSize;
+	volatile uintptr_t active;
+} J9HookBatchListener;
+
+/* Events accumulated by one thread for one batched listener; batchSize copies of the event data follow. */
+typedef struct J9HookBatchBuffer {
+	struct J9HookBatchBuffer *next;
+	J9HookBatchListener *listener;
+	uintptr_t count;
+} J9HookBatchBuffer;
+
+#define J9HOOK_BATCH_DATA(buffer) ((uint8_t *)((J9HookBatchBuffer *)(buffer) + 1))
+
+/* The batch buffers of one thread, stored in the thread's TLS. */
+typedef struct J9HookThreadBatches {
+	struct J9HookThreadBatches *next;
+	struct J9HookThreadBatches *prev;
+	struct J9CommonHookInterface *commonInterface;
+	J9HookBatchBuffer *buffers;
+} J9HookThreadBatches;
+
 
 #ifdef __cplusplus
 }
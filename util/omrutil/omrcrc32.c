@@ -20,8 +20,46 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
  *******************************************************************************/
 
+#include "omrcfg.h"
 #include "omrcomp.h"
 #include "omrutil.h"
+#include "omrutilbase.h"
+
+/*
+ * omrcrc32 computes the CRC-32 used by zlib and gzip, and omrcrc32c the CRC-32C (Castagnoli)
+ * used by iSCSI and ext4. The first call picks the fastest implementation this machine supports:
+ *
+ *   OMRCRC32_HARDWARE   x86: PCLMULQDQ folding of 64 bytes per iteration for CRC-32, and
+ *                            the SSE4.2 crc32 instruction for CRC-32C.
+ *                       AArch64: the ARMv8 CRC32 instructions, for both.
+ *   OMRCRC32_SLICE_BY_8 eight table lookups per 8 bytes, everywhere else.
+ *   OMRCRC32_BYTEWISE   the original table lookup per byte, kept as the reference.
+ *
+ * All of them work on the inverted CRC, so they can be mixed within one buffer: the hardware
+ * paths leave any unaligned tail to slicing-by-8.
+ */
+
+#if defined(OMR_ARCH_X86) && defined(__GNUC__)
+#define OMRCRC32_X86
+#include <cpuid.h>
+#include <immintrin.h>
+#define OMRCRC32_TARGET_PCLMUL __attribute__((target("pclmul,sse4.1")))
+#define OMRCRC32_TARGET_SSE42 __attribute__((target("sse4.2")))
+#elif defined(OMR_ARCH_AARCH64) && (defined(__ARM_FEATURE_CRC32) || (defined(LINUX) && defined(__GNUC__) && !defined(__clang__)))
+#define OMRCRC32_ARM64
+#include <arm_acle.h>
+#if defined(__ARM_FEATURE_CRC32)
+#define OMRCRC32_TARGET_CRC
+#else /* defined(__ARM_FEATURE_CRC32) */
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#define OMRCRC32_TARGET_CRC __attribute__((target("+crc")))
+#endif /* defined(__ARM_FEATURE_CRC32) */
+#endif /* defined(OMR_ARCH_X86) && defined(__GNUC__) */
+
+#define CRC32C_POLYNOMIAL 0x82f63b78
+
+typedef U_32 (*crcFunction)(U_32 crc, const U_8 *bytes, UDATA len);
 
 U_32 const crcValues[] = {
 	0x00000000L, 0x77073096L, 0xee0e612cL, 0x990951baL, 0x076dc419L,
@@ -78,14 +116,378 @@ U_32 const crcValues[] = {
 	0x2d02ef8dL
 };
 
+/* crc32Slices[0] is crcValues; crc32Slices[k][i] is the CRC of byte i followed by k zero bytes */
+static U_32 crc32Slices[8][256];
+static U_32 crc32cSlices[8][256];
+
+static crcFunction volatile crc32Function = NULL;
+static crcFunction volatile crc32cFunction = NULL;
+static U_32 crc32Implementation = OMRCRC32_SLICE_BY_8;
+static U_32 crc32cImplementation = OMRCRC32_SLICE_BY_8;
+
+static void
+initSlices(U_32 slices[8][256], const U_32 *base)
+{
+	UDATA i = 0;
+	UDATA k = 0;
+
+	for (i = 0; i < 256; i++) {
+		slices[0][i] = base[i];
+	}
+	for (k = 1; k < 8; k++) {
+		for (i = 0; i < 256; i++) {
+			U_32 previous = slices[k - 1][i];
+			slices[k][i] = (previous >> 8) ^ slices[0][previous & 0xff];
+		}
+	}
+}
+
+static U_32
+loadLittleEndian32(const U_8 *bytes)
+{
+	return (U_32)bytes[0] | ((U_32)bytes[1] << 8) | ((U_32)bytes[2] << 16) | ((U_32)bytes[3] << 24);
+}
+
+static U_32
+crcBytewise(U_32 crc, const U_8 *bytes, UDATA len, U_32 slices[8][256])
+{
+	while (0 != len--) {
+		crc = (crc >> 8) ^ slices[0][(crc ^ *bytes++) & 0xff];
+	}
+	return crc;
+}
+
+static U_32
+crcSliceBy8(U_32 crc, const U_8 *bytes, UDATA len, U_32 slices[8][256])
+{
+	/* Align, so the pairs of 32 bit loads below can be combined into one 64 bit load. */
+	while ((0 != len) && (0 != ((UDATA)bytes & 7))) {
+		crc = (crc >> 8) ^ slices[0][(crc ^ *bytes++) & 0xff];
+		len -= 1;
+	}
+	while (len >= 8) {
+		U_32 low = crc ^ loadLittleEndian32(bytes);
+		U_32 high = loadLittleEndian32(bytes + 4);
+
+		crc = slices[7][low & 0xff]
+			^ slices[6][(low >> 8) & 0xff]
+			^ slices[5][(low >> 16) & 0xff]
+			^ slices[4][low >> 24]
+			^ slices[3][high & 0xff]
+			^ slices[2][(high >> 8) & 0xff]
+			^ slices[1][(high >> 16) & 0xff]
+			^ slices[0][high >> 24];
+		bytes += 8;
+		len -= 8;
+	}
+	return crcBytewise(crc, bytes, len, slices);
+}
+
+static U_32
+crc32Bytewise(U_32 crc, const U_8 *bytes, UDATA len)
+{
+	return crcBytewise(crc, bytes, len, crc32Slices);
+}
+
+static U_32
+crc32SliceBy8(U_32 crc, const U_8 *bytes, UDATA len)
+{
+	return crcSliceBy8(crc, bytes, len, crc32Slices);
+}
+
+static U_32
+crc32cBytewise(U_32 crc, const U_8 *bytes, UDATA len)
+{
+	return crcBytewise(crc, bytes, len, crc32cSlices);
+}
+
+static U_32
+crc32cSliceBy8(U_32 crc, const U_8 *bytes, UDATA len)
+{
+	return crcSliceBy8(crc, bytes, len, crc32cSlices);
+}
+
+#if defined(OMRCRC32_X86)
+
+/*
+ * Fold 16 byte lanes with carry-less multiplication, as described in Intel's "Fast CRC Computation
+ * for Generic Polynomials Using PCLMULQDQ Instruction". The constants are x^(n) mod P(x) for the
+ * fold distances, bit reflected, followed by the Barrett reduction constants.
+ */
+static U_32 OMRCRC32_TARGET_PCLMUL
+crc32Pclmul(U_32 crc, const U_8 *bytes, UDATA len)
+{
+	static const U_64 k1k2[] = { 0x0154442bd4, 0x01c6e41596 };
+	static const U_64 k3k4[] = { 0x01751997d0, 0x00ccaa009e };
+	static const U_64 k5k0[] = { 0x0163cd6124, 0x0000000000 };
+	static const U_64 poly[] = { 0x01db710641, 0x01f7011641 };
+	__m128i x0, x1, x2, x3, x4, x5, x6, x7, x8;
+	UDATA folded = len & ~(UDATA)15;
+
+	if (len < 64) {
+		return crc32SliceBy8(crc, bytes, len);
+	}
+	len -= folded;
+
+	x1 = _mm_loadu_si128((const __m128i *)(bytes + 0x00));
+	x2 = _mm_loadu_si128((const __m128i *)(bytes + 0x10));
+	x3 = _mm_loadu_si128((const __m128i *)(bytes + 0x20));
+	x4 = _mm_loadu_si128((const __m128i *)(bytes + 0x30));
+	x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+	x0 = _mm_loadu_si128((const __m128i *)k1k2);
+	bytes += 64;
+	folded -= 64;
+
+	/* four lanes, 64 bytes per iteration */
+	while (folded >= 64) {
+		x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+		x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+		x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+		x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+		x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+		x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+		x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+		x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128((const __m128i *)(bytes + 0x00)));
+		x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128((const __m128i *)(bytes + 0x10)));
+		x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128((const __m128i *)(bytes + 0x20)));
+		x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128((const __m128i *)(bytes + 0x30)));
+		bytes += 64;
+		folded -= 64;
+	}
+
+	/* fold the four lanes into one */
+	x0 = _mm_loadu_si128((const __m128i *)k3k4);
+	x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+	x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+	x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+	x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+	x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+	x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+	/* remaining 16 byte blocks */
+	while (folded >= 16) {
+		x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+		x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, _mm_loadu_si128((const __m128i *)bytes)), x5);
+		bytes += 16;
+		folded -= 16;
+	}
+
+	/* 128 bits to 64 */
+	x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+	x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+	x1 = _mm_srli_si128(x1, 8);
+	x1 = _mm_xor_si128(x1, x2);
+	x0 = _mm_loadl_epi64((const __m128i *)k5k0);
+	x2 = _mm_srli_si128(x1, 4);
+	x1 = _mm_and_si128(x1, x3);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+
+	/* Barrett reduction to 32 bits */
+	x0 = _mm_loadu_si128((const __m128i *)poly);
+	x2 = _mm_and_si128(x1, x3);
+	x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+	x2 = _mm_and_si128(x2, x3);
+	x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+	crc = (U_32)_mm_extract_epi32(x1, 1);
+
+	return crc32SliceBy8(crc, bytes, len);
+}
+
+static U_32 OMRCRC32_TARGET_SSE42
+crc32cSse42(U_32 crc, const U_8 *bytes, UDATA len)
+{
+	while ((0 != len) && (0 != ((UDATA)bytes & 7))) {
+		crc = _mm_crc32_u8(crc, *bytes++);
+		len -= 1;
+	}
+#if defined(OMR_ENV_DATA64)
+	{
+		U_64 crc64 = crc;
+
+		while (len >= 8) {
+			crc64 = _mm_crc32_u64(crc64, *(const U_64 *)bytes);
+			bytes += 8;
+			len -= 8;
+		}
+		crc = (U_32)crc64;
+	}
+#endif /* defined(OMR_ENV_DATA64) */
+	while (len >= 4) {
+		crc = _mm_crc32_u32(crc, *(const U_32 *)bytes);
+		bytes += 4;
+		len -= 4;
+	}
+	while (0 != len--) {
+		crc = _mm_crc32_u8(crc, *bytes++);
+	}
+	return crc;
+}
+
+#elif defined(OMRCRC32_ARM64) /* defined(OMRCRC32_X86) */
+
+static U_32 OMRCRC32_TARGET_CRC
+crc32Arm64(U_32 crc, const U_8 *bytes, UDATA len)
+{
+	while ((0 != len) && (0 != ((UDATA)bytes & 7))) {
+		crc = __crc32b(crc, *bytes++);
+		len -= 1;
+	}
+	while (len >= 8) {
+		crc = __crc32d(crc, *(const U_64 *)bytes);
+		bytes += 8;
+		len -= 8;
+	}
+	while (0 != len--) {
+		crc = __crc32b(crc, *bytes++);
+	}
+	return crc;
+}
+
+static U_32 OMRCRC32_TARGET_CRC
+crc32cArm64(U_32 crc, const U_8 *bytes, UDATA len)
+{
+	while ((0 != len) && (0 != ((UDATA)bytes & 7))) {
+		crc = __crc32cb(crc, *bytes++);
+		len -= 1;
+	}
+	while (len >= 8) {
+		crc = __crc32cd(crc, *(const U_64 *)bytes);
+		bytes += 8;
+		len -= 8;
+	}
+	while (0 != len--) {
+		crc = __crc32cb(crc, *bytes++);
+	}
+	return crc;
+}
+
+#endif /* defined(OMRCRC32_X86) */
+
+static crcFunction
+selectCrcFunction(BOOLEAN castagnoli, U_32 implementation)
+{
+	if (OMRCRC32_BYTEWISE == implementation) {
+		return castagnoli ? crc32cBytewise : crc32Bytewise;
+	}
+	if (OMRCRC32_HARDWARE == implementation) {
+#if defined(OMRCRC32_X86)
+		if (castagnoli && (OMRCRC32_HARDWARE == crc32cImplementation)) {
+			return crc32cSse42;
+		}
+		if (!castagnoli && (OMRCRC32_HARDWARE == crc32Implementation)) {
+			return crc32Pclmul;
+		}
+#elif defined(OMRCRC32_ARM64) /* defined(OMRCRC32_X86) */
+		if (OMRCRC32_HARDWARE == crc32Implementation) {
+			return castagnoli ? crc32cArm64 : crc32Arm64;
+		}
+#endif /* defined(OMRCRC32_X86) */
+	}
+	return castagnoli ? crc32cSliceBy8 : crc32SliceBy8;
+}
+
+/*
+ * Build the tables and choose the implementations. Racing callers compute identical
+ * tables and choices, so the only ordering needed is that the tables are visible
+ * before the function pointers that use them.
+ */
+static void
+initCrc32(void)
+{
+	U_32 crc32cBase[256];
+	UDATA i = 0;
+
+	for (i = 0; i < 256; i++) {
+		U_32 crc = (U_32)i;
+		UDATA bit = 0;
+
+		for (bit = 0; bit < 8; bit++) {
+			crc = (crc >> 1) ^ ((0 != (crc & 1)) ? CRC32C_POLYNOMIAL : 0);
+		}
+		crc32cBase[i] = crc;
+	}
+	initSlices(crc32Slices, crcValues);
+	initSlices(crc32cSlices, crc32cBase);
+
+#if defined(OMRCRC32_X86)
+	{
+		unsigned int eax = 0;
+		unsigned int ebx = 0;
+		unsigned int ecx = 0;
+		unsigned int edx = 0;
+
+		if (0 != __get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+			if ((0 != (ecx & bit_PCLMUL)) && (0 != (ecx & bit_SSE4_1))) {
+				crc32Implementation = OMRCRC32_HARDWARE;
+			}
+			if (0 != (ecx & bit_SSE4_2)) {
+				crc32cImplementation = OMRCRC32_HARDWARE;
+			}
+		}
+	}
+#elif defined(OMRCRC32_ARM64) /* defined(OMRCRC32_X86) */
+#if defined(__ARM_FEATURE_CRC32)
+	crc32Implementation = OMRCRC32_HARDWARE;
+	crc32cImplementation = OMRCRC32_HARDWARE;
+#else /* defined(__ARM_FEATURE_CRC32) */
+	if (0 != (getauxval(AT_HWCAP) & HWCAP_CRC32)) {
+		crc32Implementation = OMRCRC32_HARDWARE;
+		crc32cImplementation = OMRCRC32_HARDWARE;
+	}
+#endif /* defined(__ARM_FEATURE_CRC32) */
+#endif /* defined(OMRCRC32_X86) */
+
+	issueWriteBarrier();
+	crc32cFunction = selectCrcFunction(TRUE, crc32cImplementation);
+	crc32Function = selectCrcFunction(FALSE, crc32Implementation);
+}
+
 U_32 omrcrc32(U_32 crc, U_8 *bytes, U_32 len)
 {
+	crcFunction function = crc32Function;
+
 	if (!bytes) return 0;
-	crc = crc ^ 0xffffffffL;
-	while ( len-- ) {
-		crc = ( crc >> 8 ) ^ crcValues[(crc ^ *bytes++)& 0xff];
+	if (NULL == function) {
+		initCrc32();
+		function = crc32Function;
 	}
-	return crc ^ 0xffffffffL;
+	return function(crc ^ 0xffffffffL, bytes, len) ^ 0xffffffffL;
+}
+
+U_32 omrcrc32c(U_32 crc, U_8 *bytes, U_32 len)
+{
+	crcFunction function = crc32cFunction;
+
+	if (!bytes) return 0;
+	if (NULL == function) {
+		initCrc32();
+		function = crc32cFunction;
+	}
+	return function(crc ^ 0xffffffffL, bytes, len) ^ 0xffffffffL;
+}
+
+U_32 omrcrc32Implementation(BOOLEAN castagnoli)
+{
+	if (NULL == crc32Function) {
+		initCrc32();
+	}
+	return castagnoli ? crc32cImplementation : crc32Implementation;
+}
+
+U_32 omrcrc32UsingImplementation(U_32 crc, U_8 *bytes, U_32 len, BOOLEAN castagnoli, U_32 implementation)
+{
+	if (!bytes) return 0;
+	if (NULL == crc32Function) {
+		initCrc32();
+	}
+	return selectCrcFunction(castagnoli, implementation)(crc ^ 0xffffffffL, bytes, len) ^ 0xffffffffL;
 }
 
 /*
@@ -0,0 +1,464 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Whole-buffer conversions between modified UTF-8 and UTF-16, with the same rules as
+ * decodeUTF8CharN and encodeUTF8CharN. Runs of ASCII characters (U+0001 to U+007F, the
+ * only characters which are encoded as one byte) are handled a block at a time, using
+ * SSE2 or NEON where available. A block which holds other characters is converted one
+ * character at a time before going back to whole blocks.
+ */
+
+#include <string.h>
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrutil.h"
+
+#if defined(OMR_ARCH_X86) && (defined(OMR_ENV_DATA64) || defined(__SSE2__))
+#define OMRUTF8_SSE2
+#include <emmintrin.h>
+#elif defined(OMR_ARCH_AARCH64)
+#define OMRUTF8_NEON
+#include <arm_neon.h>
+#endif
+
+/* Bytes handled by one iteration of the block loops */
+#define UTF8_BLOCK_SIZE 16
+/* Bytes checked by one iteration of the validation loop */
+#define UTF8_SCAN_SIZE 64
+
+#if !defined(OMRUTF8_SSE2) && !defined(OMRUTF8_NEON)
+#if defined(OMR_ENV_DATA64)
+#define UTF8_ONES ((uintptr_t)J9CONST64(0x0101010101010101))
+#define UTF8_HIGH_BITS ((uintptr_t)J9CONST64(0x8080808080808080))
+#else /* defined(OMR_ENV_DATA64) */
+#define UTF8_ONES ((uintptr_t)0x01010101)
+#define UTF8_HIGH_BITS ((uintptr_t)0x80808080)
+#endif /* defined(OMR_ENV_DATA64) */
+
+/**
+ * Answer whether any byte of a word is 0 or has its top bit set. May also answer TRUE for
+ * some words following a 0 byte, which only sends the caller to the per-character path.
+ */
+static VMINLINE BOOLEAN
+wordHasNonASCII(uintptr_t word)
+{
+	return 0 != (((word - UTF8_ONES) | word) & UTF8_HIGH_BITS);
+}
+
+/**
+ * Answer whether UTF8_BLOCK_SIZE bytes are all in the range 0x01 to 0x7F.
+ */
+static VMINLINE BOOLEAN
+blockIsASCII(const uint8_t *input)
+{
+	uintptr_t i = 0;
+
+	for (i = 0; i < UTF8_BLOCK_SIZE; i += sizeof(uintptr_t)) {
+		uintptr_t word = 0;
+		memcpy(&word, input + i, sizeof(word));
+		if (wordHasNonASCII(word)) {
+			return FALSE;
+		}
+	}
+	return TRUE;
+}
+#endif /* !defined(OMRUTF8_SSE2) && !defined(OMRUTF8_NEON) */
+
+/**
+ * Answer the length of the prefix of input made of whole UTF8_SCAN_SIZE or UTF8_BLOCK_SIZE
+ * blocks of characters in the range 0x01 to 0x7F. The bytes after it are for the caller to check.
+ */
+static uintptr_t
+skipASCIIBlocks(const uint8_t *input, uintptr_t length)
+{
+	const uint8_t *cursor = input;
+	const uint8_t *scanLimit = input + (length - (length % UTF8_SCAN_SIZE));
+	const uint8_t *blockLimit = input + (length - (length % UTF8_BLOCK_SIZE));
+#if defined(OMRUTF8_SSE2)
+	const __m128i zero = _mm_setzero_si128();
+
+	while (cursor < scanLimit) {
+		/* a byte is ASCII iff it is greater than 0 as a signed value */
+		__m128i a = _mm_cmpgt_epi8(_mm_loadu_si128((const __m128i *)cursor), zero);
+		__m128i b = _mm_cmpgt_epi8(_mm_loadu_si128((const __m128i *)(cursor + 16)), zero);
+		__m128i c = _mm_cmpgt_epi8(_mm_loadu_si128((const __m128i *)(cursor + 32)), zero);
+		__m128i d = _mm_cmpgt_epi8(_mm_loadu_si128((const __m128i *)(cursor + 48)), zero);
+		if (0xFFFF != _mm_movemask_epi8(_mm_and_si128(_mm_and_si128(a, b), _mm_and_si128(c, d)))) {
+			break;
+		}
+		cursor += UTF8_SCAN_SIZE;
+	}
+	while (cursor < blockLimit) {
+		if (0xFFFF != _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_loadu_si128((const __m128i *)cursor), zero))) {
+			break;
+		}
+		cursor += UTF8_BLOCK_SIZE;
+	}
+#elif defined(OMRUTF8_NEON) /* defined(OMRUTF8_SSE2) */
+	while (cursor < scanLimit) {
+		/* the byte range 0x01 to 0x7F is 0x00 to 0x7E after subtracting 1, so the maximum of those must be below 0x7F */
+		const uint8x16_t one = vdupq_n_u8(1);
+		uint8x16_t a = vsubq_u8(vld1q_u8(cursor), one);
+		uint8x16_t b = vsubq_u8(vld1q_u8(cursor + 16), one);
+		uint8x16_t c = vsubq_u8(vld1q_u8(cursor + 32), one);
+		uint8x16_t d = vsubq_u8(vld1q_u8(cursor + 48), one);
+		if (vmaxvq_u8(vmaxq_u8(vmaxq_u8(a, b), vmaxq_u8(c, d))) >= 0x7F) {
+			break;
+		}
+		cursor += UTF8_SCAN_SIZE;
+	}
+	while (cursor < blockLimit) {
+		if (vmaxvq_u8(vsubq_u8(vld1q_u8(cursor), vdupq_n_u8(1))) >= 0x7F) {
+			break;
+		}
+		cursor += UTF8_BLOCK_SIZE;
+	}
+#else /* defined(OMRUTF8_NEON) */
+	while (cursor < blockLimit) {
+		if (!blockIsASCII(cursor)) {
+			break;
+		}
+		cursor += UTF8_BLOCK_SIZE;
+	}
+	/* scanLimit is only used by the vector loops */
+	(void)scanLimit;
+#endif /* defined(OMRUTF8_SSE2) */
+	return (uintptr_t)(cursor - input);
+}
+
+/**
+ * Widen the prefix of input made of whole UTF8_BLOCK_SIZE blocks of characters in the range
+ * 0x01 to 0x7F into output.
+ *
+ * @return the number of characters converted
+ */
+static uintptr_t
+widenASCIIBlocks(const uint8_t *input, uint16_t *output, uintptr_t length)
+{
+	uintptr_t done = 0;
+	uintptr_t limit = length - (length % UTF8_BLOCK_SIZE);
+#if defined(OMRUTF8_SSE2)
+	const __m128i zero = _mm_setzero_si128();
+
+	while (done < limit) {
+		__m128i bytes = _mm_loadu_si128((const __m128i *)(input + done));
+		if (0xFFFF != _mm_movemask_epi8(_mm_cmpgt_epi8(bytes, zero))) {
+			break;
+		}
+		_mm_storeu_si128((__m128i *)(output + done), _mm_unpacklo_epi8(bytes, zero));
+		_mm_storeu_si128((__m128i *)(output + done + 8), _mm_unpackhi_epi8(bytes, zero));
+		done += UTF8_BLOCK_SIZE;
+	}
+#elif defined(OMRUTF8_NEON) /* defined(OMRUTF8_SSE2) */
+	while (done < limit) {
+		uint8x16_t bytes = vld1q_u8(input + done);
+		if (vmaxvq_u8(vsubq_u8(bytes, vdupq_n_u8(1))) >= 0x7F) {
+			break;
+		}
+		vst1q_u16(output + done, vmovl_u8(vget_low_u8(bytes)));
+		vst1q_u16(output + done + 8, vmovl_high_u8(bytes));
+		done += UTF8_BLOCK_SIZE;
+	}
+#else /* defined(OMRUTF8_NEON) */
+	while (done < limit) {
+		uintptr_t i = 0;
+		if (!blockIsASCII(input + done)) {
+			break;
+		}
+		for (i = 0; i < UTF8_BLOCK_SIZE; i++) {
+			output[done + i] = input[done + i];
+		}
+		done += UTF8_BLOCK_SIZE;
+	}
+#endif /* defined(OMRUTF8_SSE2) */
+	return done;
+}
+
+/**
+ * Narrow the prefix of input made of whole UTF8_BLOCK_SIZE blocks of characters in the range
+ * U+0001 to U+007F into output.
+ *
+ * @return the number of characters converted
+ */
+static uintptr_t
+narrowASCIIBlocks(const uint16_t *input, uint8_t *output, uintptr_t length)
+{
+	uintptr_t done = 0;
+	uintptr_t limit = length - (length % UTF8_BLOCK_SIZE);
+#if defined(OMRUTF8_SSE2)
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i high = _mm_set1_epi16(0x80);
+
+	while (done < limit) {
+		__m128i low = _mm_loadu_si128((const __m128i *)(input + done));
+		__m128i upper = _mm_loadu_si128((const __m128i *)(input + done + 8));
+		/* 0 < c < 0x80 as signed 16 bit values also excludes 0x8000 and above */
+		__m128i ok = _mm_and_si128(
+			_mm_and_si128(_mm_cmpgt_epi16(low, zero), _mm_cmplt_epi16(low, high)),
+			_mm_and_si128(_mm_cmpgt_epi16(upper, zero), _mm_cmplt_epi16(upper, high)));
+		if (0xFFFF != _mm_movemask_epi8(ok)) {
+			break;
+		}
+		_mm_storeu_si128((__m128i *)(output + done), _mm_packus_epi16(low, upper));
+		done += UTF8_BLOCK_SIZE;
+	}
+#elif defined(OMRUTF8_NEON) /* defined(OMRUTF8_SSE2) */
+	while (done < limit) {
+		const uint16x8_t one = vdupq_n_u16(1);
+		uint16x8_t low = vld1q_u16(input + done);
+		uint16x8_t upper = vld1q_u16(input + done + 8);
+		if (vmaxvq_u16(vmaxq_u16(vsubq_u16(low, one), vsubq_u16(upper, one))) >= 0x7F) {
+			break;
+		}
+		vst1q_u8(output + done, vcombine_u8(vmovn_u16(low), vmovn_u16(upper)));
+		done += UTF8_BLOCK_SIZE;
+	}
+#else /* defined(OMRUTF8_NEON) */
+	while (done < limit) {
+		uintptr_t i = 0;
+		uint16_t bits = 0;
+		uint16_t zeros = 1;
+		for (i = 0; i < UTF8_BLOCK_SIZE; i++) {
+			bits |= input[done + i];
+			zeros &= (0 != input[done + i]) ? 1 : 0;
+		}
+		if ((bits >= 0x80) || (0 == zeros)) {
+			break;
+		}
+		for (i = 0; i < UTF8_BLOCK_SIZE; i++) {
+			output[done + i] = (uint8_t)input[done + i];
+		}
+		done += UTF8_BLOCK_SIZE;
+	}
+#endif /* defined(OMRUTF8_SSE2) */
+	return done;
+}
+
+/**
+ * Decode one modified UTF-8 character. Well-formed characters are decoded inline; anything
+ * else is left to decodeUTF8CharN so that it is rejected and traced in the same way.
+ *
+ * @return the number of bytes consumed, 0 if the character is not valid
+ */
+static VMINLINE uint32_t
+decodeOne(const uint8_t *input, uint16_t *result, uintptr_t bytesRemaining)
+{
+	uint8_t c = input[0];
+
+	if ((uint8_t)(c - 1) < 0x7F) {
+		*result = c;
+		return 1;
+	} else if (((c & 0xE0) == 0xC0) && (bytesRemaining >= 2) && ((input[1] & 0xC0) == 0x80)) {
+		*result = (uint16_t)(((c & 0x1F) << 6) | (input[1] & 0x3F));
+		return 2;
+	} else if (((c & 0xF0) == 0xE0) && (bytesRemaining >= 3) && ((input[1] & 0xC0) == 0x80) && ((input[2] & 0xC0) == 0x80)) {
+		*result = (uint16_t)(((c & 0x0F) << 12) | ((input[1] & 0x3F) << 6) | (input[2] & 0x3F));
+		return 3;
+	}
+	return decodeUTF8CharN(input, result, bytesRemaining);
+}
+
+/**
+ * Answer the length of the run of characters in the range 0x01 to 0x7F at the start of a
+ * UTF-8 or modified UTF-8 string. Such bytes are the same in both encodings and stand for
+ * themselves in UTF-16.
+ *
+ * @param[in] input The string
+ * @param[in] length The number of bytes in the string
+ *
+ * @return the number of leading ASCII bytes
+ */
+uintptr_t
+scanUTF8ASCII(const uint8_t *input, uintptr_t length)
+{
+	uintptr_t done = skipASCIIBlocks(input, length);
+
+	while ((done < length) && ((uint8_t)(input[done] - 1) < 0x7F)) {
+		done += 1;
+	}
+	return done;
+}
+
+/**
+ * Validate a modified UTF-8 string, as decoded by decodeUTF8CharN.
+ *
+ * @param[in] input The string
+ * @param[in] length The number of bytes in the string
+ *
+ * @return the number of UTF-16 characters the string decodes to, or -1 if it is not valid
+ */
+intptr_t
+validateUTF8String(const uint8_t *input, uintptr_t length)
+{
+	const uint8_t *cursor = input;
+	const uint8_t *end = input + length;
+	intptr_t count = 0;
+
+	while (cursor < end) {
+		const uint8_t *blockEnd = NULL;
+		uintptr_t ascii = skipASCIIBlocks(cursor, (uintptr_t)(end - cursor));
+		cursor += ascii;
+		count += ascii;
+		/* the next block holds a non-ASCII character, or is the short tail of the string */
+		blockEnd = ((uintptr_t)(end - cursor) > UTF8_BLOCK_SIZE) ? (cursor + UTF8_BLOCK_SIZE) : end;
+		while (cursor < blockEnd) {
+			uint16_t unused = 0;
+			uint32_t consumed = decodeOne(cursor, &unused, (uintptr_t)(end - cursor));
+			if (0 == consumed) {
+				return -1;
+			}
+			cursor += consumed;
+			count += 1;
+		}
+	}
+	return count;
+}
+
+/**
+ * Decode a modified UTF-8 string to UTF-16, as decodeUTF8CharN does one character at a time.
+ * Stops early if the output buffer fills, so may be resumed.
+ *
+ * @param[in,out] input The string. Updated to the first character not decoded.
+ * @param[in,out] inputLength The number of bytes in the string. Updated to the number not decoded.
+ * @param[out] output Buffer for the UTF-16 characters
+ * @param[in] outputLength The number of UTF-16 characters that fit in output
+ *
+ * @return the number of UTF-16 characters stored, or -1 if the string is not valid, in which case
+ * input is updated to the invalid character
+ */
+intptr_t
+decodeUTF8String(const uint8_t **input, uintptr_t *inputLength, uint16_t *output, uintptr_t outputLength)
+{
+	const uint8_t *cursor = *input;
+	const uint8_t *end = cursor + *inputLength;
+	uintptr_t count = 0;
+	BOOLEAN valid = TRUE;
+
+	while ((cursor < end) && (count < outputLength)) {
+		const uint8_t *blockEnd = NULL;
+		uintptr_t remaining = (uintptr_t)(end - cursor);
+		uintptr_t space = outputLength - count;
+		uintptr_t ascii = widenASCIIBlocks(cursor, output + count, (remaining < space) ? remaining : space);
+		cursor += ascii;
+		count += ascii;
+		/* the next block holds a non-ASCII character, or is the short tail of the string */
+		blockEnd = ((uintptr_t)(end - cursor) > UTF8_BLOCK_SIZE) ? (cursor + UTF8_BLOCK_SIZE) : end;
+		while ((cursor < blockEnd) && (count < outputLength)) {
+			uint32_t consumed = decodeOne(cursor, output + count, (uintptr_t)(end - cursor));
+			if (0 == consumed) {
+				valid = FALSE;
+				goto done;
+			}
+			cursor += consumed;
+			count += 1;
+		}
+	}
+done:
+	*inputLength = (uintptr_t)(end - cursor);
+	*input = cursor;
+	return valid ? (intptr_t)count : -1;
+}
+
+/**
+ * Answer the number of bytes needed to encode UTF-16 characters as modified UTF-8.
+ *
+ * @param[in] input The characters
+ * @param[in] length The number of characters
+ *
+ * @return the number of bytes encodeUTF8String would produce, not including a terminating NUL
+ */
+uintptr_t
+encodedUTF8Length(const uint16_t *input, uintptr_t length)
+{
+	uintptr_t total = length;
+	uintptr_t i = 0;
+
+	for (i = 0; i < length; i++) {
+		uint16_t c = input[i];
+		/* U+0000 takes two bytes, like U+0080 to U+07FF */
+		total += (uintptr_t)((uint16_t)(c - 1) >= 0x7F) + (uintptr_t)(c >= 0x800);
+	}
+	return total;
+}
+
+/**
+ * Encode UTF-16 characters as modified UTF-8, as encodeUTF8CharN does one character at a time.
+ * Surrogates are encoded individually. Stops early if the next character does not fit in the
+ * output buffer, so may be resumed.
+ *
+ * @param[in,out] input The characters. Updated to the first character not encoded.
+ * @param[in,out] inputLength The number of characters. Updated to the number not encoded.
+ * @param[out] output Buffer for the encoded bytes
+ * @param[in] outputLength The size of output in bytes
+ *
+ * @return the number of bytes stored
+ */
+uintptr_t
+encodeUTF8String(const uint16_t **input, uintptr_t *inputLength, uint8_t *output, uintptr_t outputLength)
+{
+	const uint16_t *cursor = *input;
+	const uint16_t *end = cursor + *inputLength;
+	uint8_t *outputCursor = output;
+	uint8_t *outputEnd = output + outputLength;
+
+	while ((cursor < end) && (outputCursor < outputEnd)) {
+		const uint16_t *blockEnd = NULL;
+		uintptr_t remaining = (uintptr_t)(end - cursor);
+		uintptr_t space = (uintptr_t)(outputEnd - outputCursor);
+		uintptr_t ascii = narrowASCIIBlocks(cursor, outputCursor, (remaining < space) ? remaining : space);
+		cursor += ascii;
+		outputCursor += ascii;
+		/* the next block holds a non-ASCII character, or is the short tail of the input */
+		blockEnd = ((uintptr_t)(end - cursor) > UTF8_BLOCK_SIZE) ? (cursor + UTF8_BLOCK_SIZE) : end;
+		while (cursor < blockEnd) {
+			uint16_t c = *cursor;
+			space = (uintptr_t)(outputEnd - outputCursor);
+			if ((uint16_t)(c - 1) < 0x7F) {
+				if (space < 1) {
+					goto done;
+				}
+				*outputCursor++ = (uint8_t)c;
+			} else if (c < 0x800) {
+				/* includes U+0000, which is encoded as two bytes */
+				if (space < 2) {
+					goto done;
+				}
+				*outputCursor++ = (uint8_t)(((c >> 6) & 0x1F) | 0xC0);
+				*outputCursor++ = (uint8_t)((c & 0x3F) | 0x80);
+			} else {
+				if (space < 3) {
+					goto done;
+				}
+				*outputCursor++ = (uint8_t)(((c >> 12) & 0x0F) | 0xE0);
+				*outputCursor++ = (uint8_t)(((c >> 6) & 0x3F) | 0x80);
+				*outputCursor++ = (uint8_t)((c & 0x3F) | 0x80);
+			}
+			cursor += 1;
+		}
+	}
+done:
+	*inputLength = (uintptr_t)(end - cursor);
+	*input = cursor;
+	return (uintptr_t)(outputCursor - output);
+}
@@ -34,11 +34,6 @@
 #include "ut_pool.h"
 
 #define ROUND_TO(granularity, number) ( (((number) % (granularity)) ? ((number) + (granularity) - ((number) % (granularity))) : (number)))
-#define NEXT_FREE_SLOT(slot) SRP_PTR_GET((uintptr_t *)slot, uintptr_t*)
-#define LINK_TO_FREE_LIST(prev, toAdd) SRP_PTR_SET((uintptr_t *)prev, toAdd)
-#define LINK_TO_NULL(prev) SRP_PTR_SET_TO_NULL(prev)
-
-#define PUDDLE_BITS(puddle) ((uint32_t *) ((J9PoolPuddle *) (puddle) + 1))
 #define POOL_PUDDLE_BITS_LEN(pool) (((pool)->elementsPerPuddle+31) / 32)
 #define PUDDLE_SLOT_FREE(puddle, sindex) (*(PUDDLE_BITS(puddle) + (((uint32_t)(sindex)) >> 5)) & (1 << (31 - (((uint32_t)(sindex)) & 31))))
 #define MARK_SLOT_FREE(puddle, sindex) do { *(PUDDLE_BITS(puddle) + (((uint32_t)(sindex)) >> 5)) |=  (1 << (31 - (((uint32_t)(sindex)) & 31))); } while (0)
@@ -58,7 +53,7 @@
  *
  * @return A pointer to the SRP to the puddle containing the specified element.
  */
-static J9SRP *
+J9SRP *
 pool_getElementPuddleSRP(J9Pool *pool, void *element)
 {
 	J9SRP *puddleSRP;
@@ -83,7 +78,7 @@ pool_getElementPuddleSRP(J9Pool *pool, void *element)
  *
  * @return The element's index in the puddle, or -1 if the element is not in the puddle.
  */
-static int32_t
+int32_t
 pool_getElementPuddleSlot(J9Pool *pool, J9PoolPuddle *puddle, void *element)
 {
 	int32_t returnValue = -1;
@@ -309,6 +304,11 @@ pool_new(uintptr_t structSizeArg,
 
 	poolFlags &= ~POOL_USES_HOLES;
 
+	if (poolFlags & POOL_USES_MAGAZINES) {
+		/* Elements cached in magazines still refer to their puddles, so puddles must never be freed. */
+		poolFlags |= POOL_NEVER_FREE_PUDDLES;
+	}
+
 	switch (roundedStructSize) {
 	case 4:
 	case 8:
@@ -392,6 +392,7 @@ pool_new(uintptr_t structSizeArg,
 		pool->memFree = memFree;
 		pool->userData = userData;
 		pool->memoryCategory = memoryCategory;
+		pool->depot = NULL;
 
 		doInit = 1;
 		puddleList = memAlloc(userData, sizeof(J9PoolPuddleList), poolCreatorCallsite, memoryCategory, POOL_ALLOC_TYPE_PUDDLE_LIST, &doInit);
@@ -415,6 +416,21 @@ pool_new(uintptr_t structSizeArg,
 			memFree(userData, pool, POOL_ALLOC_TYPE_POOL);
 			pool = NULL;
 		}
+
+		if ((NULL != pool) && (poolFlags & POOL_USES_MAGAZINES)) {
+			J9PoolMagazineDepot *depot;
+
+			doInit = 1;
+			depot = memAlloc(userData, sizeof(J9PoolMagazineDepot), poolCreatorCallsite, memoryCategory, POOL_ALLOC_TYPE_POOL, &doInit);
+			if (NULL != depot) {
+				depot->lock = 0;
+				depot->fullCount = 0;
+				pool->depot = depot;
+			} else {
+				pool_kill(pool);
+				pool = NULL;
+			}
+		}
 	}
 
 	Trc_pool_new_Exit(pool);
@@ -446,6 +462,9 @@ pool_kill(J9Pool *pool)
 			pool->memFree(pool->userData, puddle, POOL_ALLOC_TYPE_PUDDLE);
 		}
 
+		if (NULL != pool->depot) {
+			pool->memFree(pool->userData, pool->depot, POOL_ALLOC_TYPE_POOL);
+		}
 		pool->memFree(pool->userData, puddleList, POOL_ALLOC_TYPE_PUDDLE_LIST);
 		pool->memFree(pool->userData, pool, POOL_ALLOC_TYPE_POOL);
 	}
@@ -490,6 +509,11 @@ pool_newElement(J9Pool *pool)
 		return NULL;
 	}
 
+	if (pool->flags & POOL_USES_MAGAZINES) {
+		/* Magazine owners update the slot bits and counts without the lock; see pool_magazine.cpp. */
+		pool_lockDepot(pool);
+	}
+
 	/* Check if there is a puddle with free slots - if so use it. */
 	puddleList = J9POOL_PUDDLELIST(pool);
 
@@ -500,6 +524,9 @@ pool_newElement(J9Pool *pool)
 		/* No available puddles. Allocate a new one. */
 		puddle = poolPuddle_new(pool);
 		if (NULL == puddle) {
+			if (pool->flags & POOL_USES_MAGAZINES) {
+				pool_unlockDepot(pool);
+			}
 			Trc_pool_newElement_Exit(NULL);
 			return NULL;
 		}
@@ -518,9 +545,13 @@ pool_newElement(J9Pool *pool)
 
 	SRP_SET(puddle->firstFreeSlot, nextFreeElement);
 	slot = pool_getElementPuddleSlot(pool, puddle, newElement);
-	MARK_SLOT_USED(puddle, slot);
-	puddle->usedElements++;
-	puddleList->numElements++;
+	if (pool->flags & POOL_USES_MAGAZINES) {
+		pool_atomicMarkSlotUsed(pool, puddle, slot);
+	} else {
+		MARK_SLOT_USED(puddle, slot);
+		puddle->usedElements++;
+		puddleList->numElements++;
+	}
 	if (!(pool->flags & POOL_NO_ZERO)) {
 		memset(newElement, 0, pool->elementSize);
 	}
@@ -547,6 +578,10 @@ pool_newElement(J9Pool *pool)
 		WSRP_SET(puddle->prevAvailablePuddle, NULL);
 	}
 
+	if (pool->flags & POOL_USES_MAGAZINES) {
+		pool_unlockDepot(pool);
+	}
+
 	Trc_pool_newElement_Exit(newElement);
 
 	return newElement;
@@ -591,15 +626,25 @@ pool_removeElement(J9Pool *pool, void *anElement)
 		return;		/* this is an error...  we were passed a bogus data pointer. */
 	}
 
-	if (PUDDLE_SLOT_FREE(puddle, slot)) {
-		Trc_pool_removeElement_NotFound(anElement, puddle);
-		Trc_pool_removeElement_Exit();
-		return;		/* this is an error... the slot was already free. */
-	}
+	if (pool->flags & POOL_USES_MAGAZINES) {
+		pool_lockDepot(pool);
+		if (!pool_atomicMarkSlotFree(pool, puddle, slot)) {
+			pool_unlockDepot(pool);
+			Trc_pool_removeElement_NotFound(anElement, puddle);
+			Trc_pool_removeElement_Exit();
+			return;		/* this is an error... the slot was already free. */
+		}
+	} else {
+		if (PUDDLE_SLOT_FREE(puddle, slot)) {
+			Trc_pool_removeElement_NotFound(anElement, puddle);
+			Trc_pool_removeElement_Exit();
+			return;		/* this is an error... the slot was already free. */
+		}
 
-	MARK_SLOT_FREE(puddle, slot);
-	puddle->usedElements--;
-	puddleList->numElements--;
+		MARK_SLOT_FREE(puddle, slot);
+		puddle->usedElements--;
+		puddleList->numElements--;
+	}
 	freeLocation = (void *) J9POOLPUDDLE_FIRSTFREESLOT(puddle);
 	SRP_SET(puddle->firstFreeSlot, anElement);
 	LINK_TO_FREE_LIST(anElement, freeLocation);
@@ -619,6 +664,10 @@ pool_removeElement(J9Pool *pool, void *anElement)
 		}
 	}
 
+	if (pool->flags & POOL_USES_MAGAZINES) {
+		pool_unlockDepot(pool);
+	}
+
 	Trc_pool_removeElement_Exit();
 }
 
@@ -841,6 +890,8 @@ pool_nextDo(pool_state *state)
  * Clear the contents of a pool, but do not de-allocate the puddles or the pool.
  *
  * @note Make no assumptions about the contents of the pool after invoking this method (it currently does not zero the memory)
+ * @note For a POOL_USES_MAGAZINES pool, any elements still cached in magazines are lost; reset each magazine with
+ * pool_magazineInit() before using it again.
  *
  * @param[in] pool The pool to clear
  *
@@ -868,6 +919,9 @@ pool_clear(J9Pool *pool)
 		}
 
 		puddleList->numElements = 0;
+		if (NULL != pool->depot) {
+			pool->depot->fullCount = 0;
+		}
 	}
 
 	Trc_pool_clear_Exit();
@@ -60,6 +60,10 @@ pool_ensureCapacity(J9Pool *aPool, uintptr_t newCapacity)
 	/* mark each pool as POOL_NEVER_FREE_PUDDLES */
 	aPool->flags |= POOL_NEVER_FREE_PUDDLES;
 
+	if (aPool->flags & POOL_USES_MAGAZINES) {
+		pool_lockDepot(aPool);
+	}
+
 	if (newCapacity > numElements) {
 		J9PoolPuddleList *puddleList;
 		J9PoolPuddle *newPuddle, *lastPuddle;
@@ -101,6 +105,10 @@ pool_ensureCapacity(J9Pool *aPool, uintptr_t newCapacity)
 		}
 	}
 
+	if (aPool->flags & POOL_USES_MAGAZINES) {
+		pool_unlockDepot(aPool);
+	}
+
 	Trc_pool_ensureCapacity_Exit(result);
 	return result;
 }
@@ -124,12 +132,19 @@ pool_capacity(J9Pool *aPool)
 
 	if (aPool) {
 		J9PoolPuddleList *puddleList = J9POOL_PUDDLELIST(aPool);
-		J9PoolPuddle *walk = J9POOLPUDDLELIST_NEXTPUDDLE(puddleList);
+		J9PoolPuddle *walk = NULL;
 
+		if (aPool->flags & POOL_USES_MAGAZINES) {
+			pool_lockDepot(aPool);
+		}
+		walk = J9POOLPUDDLELIST_NEXTPUDDLE(puddleList);
 		while (walk) {
 			numElements += aPool->elementsPerPuddle;
 			walk = J9POOLPUDDLE_NEXTPUDDLE(walk);
 		}
+		if (aPool->flags & POOL_USES_MAGAZINES) {
+			pool_unlockDepot(aPool);
+		}
 	}
 
 	Trc_pool_capacity_Exit(numElements);
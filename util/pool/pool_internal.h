@@ -39,6 +39,70 @@
 extern "C" {
 #endif
 
+#define NEXT_FREE_SLOT(slot) SRP_PTR_GET((uintptr_t *)slot, uintptr_t*)
+#define LINK_TO_FREE_LIST(prev, toAdd) SRP_PTR_SET((uintptr_t *)prev, toAdd)
+#define LINK_TO_NULL(prev) SRP_PTR_SET_TO_NULL(prev)
+
+#define PUDDLE_BITS(puddle) ((uint32_t *) ((J9PoolPuddle *) (puddle) + 1))
+#define PUDDLE_SLOT_BIT(sindex) ((uint32_t)1 << (31 - (((uint32_t)(sindex)) & 31)))
+#define PUDDLE_SLOT_WORD(puddle, sindex) (PUDDLE_BITS(puddle) + (((uint32_t)(sindex)) >> 5))
+
+/* ---------------- pool.c ---------------- */
+
+/**
+* @brief Get a pointer to the SRP to the puddle containing an element
+* @param *pool
+* @param *element
+* @return J9SRP *
+*/
+J9SRP *
+pool_getElementPuddleSRP(J9Pool *pool, void *element);
+
+/**
+* @brief Get the slot index of an element in a puddle, or -1 if it is not in the puddle
+* @param *pool
+* @param *puddle
+* @param *element
+* @return int32_t
+*/
+int32_t
+pool_getElementPuddleSlot(J9Pool *pool, J9PoolPuddle *puddle, void *element);
+
+/* ---------------- pool_magazine.cpp ---------------- */
+
+/**
+* @brief Acquire the depot lock of a pool that uses magazines
+* @param *pool
+*/
+void
+pool_lockDepot(J9Pool *pool);
+
+/**
+* @brief Release the depot lock of a pool that uses magazines
+* @param *pool
+*/
+void
+pool_unlockDepot(J9Pool *pool);
+
+/**
+* @brief Atomically mark a slot used and count it, for pools that use magazines
+* @param *pool
+* @param *puddle
+* @param slot
+*/
+void
+pool_atomicMarkSlotUsed(J9Pool *pool, J9PoolPuddle *puddle, int32_t slot);
+
+/**
+* @brief Atomically mark a slot free and uncount it, for pools that use magazines
+* @param *pool
+* @param *puddle
+* @param slot
+* @return uintptr_t FALSE if the slot was already free
+*/
+uintptr_t
+pool_atomicMarkSlotFree(J9Pool *pool, J9PoolPuddle *puddle, int32_t slot);
+
 
 #ifdef __cplusplus
 }
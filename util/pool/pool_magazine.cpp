@@ -0,0 +1,317 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Pool
+ * @brief Per-thread magazines of free pool elements
+ *
+ * A pool created with POOL_USES_MAGAZINES may be used through J9PoolMagazines, each owned by a single
+ * thread. A magazine caches free elements taken off the puddle free lists, so allocating and freeing
+ * through it only touches the element's slot bit and the element counts, which are updated atomically.
+ * When a magazine runs empty or full it exchanges a whole magazine of elements with the pool's depot,
+ * or falls back to the puddle free lists, under the depot lock. The puddle lists, the free lists and
+ * the plain pool_newElement/pool_removeElement paths are all serialized by that same lock.
+ *
+ * Cached elements are free as far as the slot bits are concerned, so pool_do(), pool_numElements()
+ * and pool_includesElement() see exactly the elements handed out to callers.
+ */
+
+#include <string.h>
+
+#include "AtomicSupport.hpp"
+
+extern "C" {
+
+#include "pool_internal.h"
+#include "ut_pool.h"
+
+/**
+ * Take up to count elements off the puddle free lists, growing the pool if needed.
+ * The caller must hold the depot lock. The slot bits and counts are left alone.
+ *
+ * @return the number of elements stored in elements
+ */
+static uintptr_t
+reserveFreeElements(J9Pool *pool, void **elements, uintptr_t count)
+{
+	J9PoolPuddleList *puddleList = J9POOL_PUDDLELIST(pool);
+	uintptr_t reserved = 0;
+
+	while (reserved < count) {
+		J9PoolPuddle *puddle = J9POOLPUDDLELIST_NEXTAVAILABLEPUDDLE(puddleList);
+		void *element = NULL;
+		void *nextFreeElement = NULL;
+
+		if (NULL == puddle) {
+			J9PoolPuddle *head = NULL;
+
+			puddle = poolPuddle_new(pool);
+			if (NULL == puddle) {
+				break;
+			}
+			head = J9POOLPUDDLELIST_NEXTPUDDLE(puddleList);
+			NNWSRP_SET(puddleList->nextPuddle, puddle);
+			NNWSRP_SET(puddle->nextPuddle, head);
+			NNWSRP_SET(head->prevPuddle, puddle);
+			NNWSRP_SET(puddleList->nextAvailablePuddle, puddle);
+		}
+
+		element = J9POOLPUDDLE_FIRSTFREESLOT(puddle);
+		nextFreeElement = NEXT_FREE_SLOT(element);
+		SRP_SET(puddle->firstFreeSlot, nextFreeElement);
+		NNSRP_SET(*pool_getElementPuddleSRP(pool, element), puddle);
+		elements[reserved] = element;
+		reserved += 1;
+
+		if (NULL == nextFreeElement) {
+			/* The free list is exhausted; take the puddle off the available list. */
+			J9PoolPuddle *next = J9POOLPUDDLE_NEXTAVAILABLEPUDDLE(puddle);
+
+			WSRP_SET(puddleList->nextAvailablePuddle, next);
+			if (NULL != next) {
+				WSRP_SET(next->prevAvailablePuddle, NULL);
+			}
+			WSRP_SET(puddle->nextAvailablePuddle, NULL);
+			WSRP_SET(puddle->prevAvailablePuddle, NULL);
+		}
+	}
+
+	return reserved;
+}
+
+/**
+ * Put count free elements back on their puddle free lists.
+ * The caller must hold the depot lock.
+ */
+static void
+releaseFreeElements(J9Pool *pool, void **elements, uintptr_t count)
+{
+	J9PoolPuddleList *puddleList = J9POOL_PUDDLELIST(pool);
+	uintptr_t i = 0;
+
+	for (i = 0; i < count; i++) {
+		void *element = elements[i];
+		J9PoolPuddle *puddle = NNSRP_GET(*pool_getElementPuddleSRP(pool, element), J9PoolPuddle *);
+		void *freeLocation = (void *)J9POOLPUDDLE_FIRSTFREESLOT(puddle);
+
+		SRP_SET(puddle->firstFreeSlot, element);
+		LINK_TO_FREE_LIST(element, freeLocation);
+
+		if (NULL == freeLocation) {
+			/* The free list was empty, so the puddle is not on the available list. */
+			J9PoolPuddle *next = J9POOLPUDDLELIST_NEXTAVAILABLEPUDDLE(puddleList);
+
+			WSRP_SET(puddleList->nextAvailablePuddle, puddle);
+			WSRP_SET(puddle->prevAvailablePuddle, NULL);
+			WSRP_SET(puddle->nextAvailablePuddle, next);
+			if (NULL != next) {
+				WSRP_SET(next->prevAvailablePuddle, puddle);
+			}
+		}
+	}
+}
+
+void
+pool_lockDepot(J9Pool *pool)
+{
+	volatile uintptr_t *lock = &pool->depot->lock;
+
+	while (0 != VM_AtomicSupport::lockCompareExchange(lock, 0, 1, true)) {
+		VM_AtomicSupport::yieldCPU();
+	}
+	VM_AtomicSupport::readBarrier();
+}
+
+void
+pool_unlockDepot(J9Pool *pool)
+{
+	VM_AtomicSupport::writeBarrier();
+	pool->depot->lock = 0;
+}
+
+void
+pool_atomicMarkSlotUsed(J9Pool *pool, J9PoolPuddle *puddle, int32_t slot)
+{
+	VM_AtomicSupport::bitAndU32(PUDDLE_SLOT_WORD(puddle, slot), ~PUDDLE_SLOT_BIT(slot));
+	VM_AtomicSupport::add((volatile uintptr_t *)&puddle->usedElements, 1);
+	VM_AtomicSupport::add((volatile uintptr_t *)&J9POOL_PUDDLELIST(pool)->numElements, 1);
+}
+
+uintptr_t
+pool_atomicMarkSlotFree(J9Pool *pool, J9PoolPuddle *puddle, int32_t slot)
+{
+	uint32_t bit = PUDDLE_SLOT_BIT(slot);
+
+	if (0 != (bit & VM_AtomicSupport::bitOrU32(PUDDLE_SLOT_WORD(puddle, slot), bit))) {
+		return FALSE;
+	}
+	VM_AtomicSupport::subtract((volatile uintptr_t *)&puddle->usedElements, 1);
+	VM_AtomicSupport::subtract((volatile uintptr_t *)&J9POOL_PUDDLELIST(pool)->numElements, 1);
+	return TRUE;
+}
+
+/**
+ * Initialize an empty magazine. A magazine must only be used by one thread at a time.
+ *
+ * @param[in] aPool     The pool the magazine allocates from.
+ * @param[in] magazine  The magazine to initialize.
+ */
+void
+pool_magazineInit(J9Pool *aPool, J9PoolMagazine *magazine)
+{
+	magazine->pool = aPool;
+	magazine->count = 0;
+}
+
+/**
+ * Allocate an element from the magazine's pool, as pool_newElement() does. When the magazine
+ * is empty it is refilled from the depot, or failing that from the puddles.
+ *
+ * If the pool was not created with POOL_USES_MAGAZINES this is equivalent to pool_newElement().
+ *
+ * @param[in] magazine  The calling thread's magazine.
+ *
+ * @return NULL on error
+ * @return pointer to a new element otherwise
+ */
+void *
+pool_magazineNewElement(J9PoolMagazine *magazine)
+{
+	J9Pool *pool = magazine->pool;
+	J9SRP *puddleSRP = NULL;
+	J9PoolPuddle *puddle = NULL;
+	void *element = NULL;
+
+	if (NULL == pool->depot) {
+		return pool_newElement(pool);
+	}
+
+	if (0 == magazine->count) {
+		J9PoolMagazineDepot *depot = pool->depot;
+
+		pool_lockDepot(pool);
+		if (0 != depot->fullCount) {
+			depot->fullCount -= 1;
+			memcpy(magazine->elements, depot->full[depot->fullCount], sizeof(magazine->elements));
+			magazine->count = J9POOL_MAGAZINE_SIZE;
+		} else {
+			/* Take half a magazine, so the next few frees don't immediately overflow it. */
+			magazine->count = reserveFreeElements(pool, magazine->elements, J9POOL_MAGAZINE_SIZE / 2);
+		}
+		pool_unlockDepot(pool);
+
+		Trc_pool_magazineRefill(magazine, pool, magazine->count);
+		if (0 == magazine->count) {
+			return NULL;
+		}
+	}
+
+	magazine->count -= 1;
+	element = magazine->elements[magazine->count];
+	puddleSRP = pool_getElementPuddleSRP(pool, element);
+	puddle = NNSRP_GET(*puddleSRP, J9PoolPuddle *);
+	pool_atomicMarkSlotUsed(pool, puddle, pool_getElementPuddleSlot(pool, puddle, element));
+	if (!(pool->flags & POOL_NO_ZERO)) {
+		memset(element, 0, pool->elementSize);
+		/* Without holes the puddle SRP lives at the end of the element. */
+		NNSRP_SET(*puddleSRP, puddle);
+	}
+
+	return element;
+}
+
+/**
+ * Free an element allocated from the magazine's pool, by any thread and through any magazine
+ * or pool_newElement(). When the magazine is full it is handed to the depot, or if the depot is
+ * full, half of it is returned to the puddles.
+ *
+ * If the pool was not created with POOL_USES_MAGAZINES this is equivalent to pool_removeElement().
+ *
+ * @param[in] magazine   The calling thread's magazine.
+ * @param[in] anElement  The element to free.
+ */
+void
+pool_magazineRemoveElement(J9PoolMagazine *magazine, void *anElement)
+{
+	J9Pool *pool = magazine->pool;
+	J9PoolPuddle *puddle = NULL;
+	int32_t slot = 0;
+
+	if (NULL == pool->depot) {
+		pool_removeElement(pool, anElement);
+		return;
+	}
+
+	if (NULL == anElement) {
+		return;
+	}
+
+	puddle = NNSRP_GET(*pool_getElementPuddleSRP(pool, anElement), J9PoolPuddle *);
+	slot = pool_getElementPuddleSlot(pool, puddle, anElement);
+	if ((slot < 0) || !pool_atomicMarkSlotFree(pool, puddle, slot)) {
+		/* this is an error... a bogus pointer, or the slot was already free. */
+		Trc_pool_removeElement_NotFound(anElement, puddle);
+		return;
+	}
+
+	if (J9POOL_MAGAZINE_SIZE == magazine->count) {
+		J9PoolMagazineDepot *depot = pool->depot;
+
+		pool_lockDepot(pool);
+		if (depot->fullCount < J9POOL_DEPOT_MAGAZINES) {
+			memcpy(depot->full[depot->fullCount], magazine->elements, sizeof(magazine->elements));
+			depot->fullCount += 1;
+			magazine->count = 0;
+		} else {
+			releaseFreeElements(pool, &magazine->elements[J9POOL_MAGAZINE_SIZE / 2], J9POOL_MAGAZINE_SIZE / 2);
+			magazine->count = J9POOL_MAGAZINE_SIZE / 2;
+		}
+		Trc_pool_magazineExchange(magazine, pool, depot->fullCount);
+		pool_unlockDepot(pool);
+	}
+
+	magazine->elements[magazine->count] = anElement;
+	magazine->count += 1;
+}
+
+/**
+ * Return every element cached in a magazine to the puddle free lists, for instance
+ * before the owning thread exits. The magazine remains usable.
+ *
+ * @param[in] magazine  The magazine to flush.
+ */
+void
+pool_magazineFlush(J9PoolMagazine *magazine)
+{
+	J9Pool *pool = magazine->pool;
+
+	if ((NULL != pool->depot) && (0 != magazine->count)) {
+		pool_lockDepot(pool);
+		releaseFreeElements(pool, magazine->elements, magazine->count);
+		pool_unlockDepot(pool);
+		Trc_pool_magazineFlush(magazine->count, magazine, pool);
+		magazine->count = 0;
+	}
+}
+
+} /* extern "C" */